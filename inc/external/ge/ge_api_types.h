@@ -48,6 +48,10 @@ const char *const OPTION_EXEC_ENABLE_DUMP_DEBUG = "ge.exec.enableDumpDebug";
 const char *const OPTION_EXEC_DUMP_DEBUG_MODE = "ge.exec.dumpDebugMode";
 const char *const OPTION_EXEC_ENABLE_INCRE_BUILD = "ge.exec.enableIncreBuild";
 const char *const OPTION_EXEC_INCRE_BUILD_CACHE_PATH = "ge.exec.increBuildCachePath";
+// Directory of the constant folding cache shared by builds, the cache is disabled if it is not set
+const char *const OPTION_EXEC_CONSTANT_FOLDING_CACHE_PATH = "ge.exec.constantFoldingCachePath";
+// Max size of the constant folding cache in MB, default 1024
+const char *const OPTION_EXEC_CONSTANT_FOLDING_CACHE_SIZE = "ge.exec.constantFoldingCacheSize";
 const char *const OPTION_EXEC_ENABLE_SCOPE_FUSION_PASSES = "ge.exec.enableScopeFusionPasses";
 // profiling flag
 const char *const OPTION_EXEC_PROFILING_MODE = "ge.exec.profilingMode";
@@ -222,6 +226,10 @@ const char *const ENABLE_PRINT_OP_PASS = "ge.enablePrintOpPass";
 // Its value should be "true" or "false", default value is "false"
 const char *const ENABLE_SINGLE_STREAM = "ge.enableSingleStream";
 
+// Configure whether to put ops on the critical path to the main stream, and spread other branches on parallel
+// streams by the cost of ops. Its value should be "true" or "false", default value is "false"
+const char *const ENABLE_CRITICAL_PATH_STREAM = "ge.enableCriticalPathStream";
+
 // Configure input fp16 nodes
 const std::string INPUT_FP16_NODES = "ge.INPUT_NODES_SET_FP16";
 
@@ -229,6 +237,14 @@ const std::string INPUT_FP16_NODES = "ge.INPUT_NODES_SET_FP16";
 // 0: close debug; 1: open TBE compiler; 2: open ccec compiler
 const std::string OP_DEBUG_LEVEL = "ge.opDebugLevel";
 
+// Configure directory of the compile cache of GeGenerator, unchanged models are not rebuilt
+// if they are found in the cache. The cache is disabled if it is not set
+const std::string COMPILE_CACHE_DIR = "ge.compileCacheDir";
+
+// Configure whether to write the checksums of the chunks of a saved om file to "<om file>.checksum", they are
+// verified when the om file is loaded. Its value should be "true" or "false", default value is "false"
+const char *const OM_CHUNK_CHECKSUM = "ge.omChunkChecksum";
+
 // Graph run mode
 enum GraphRunMode { PREDICTION = 0, TRAIN };
 
@@ -17,10 +17,13 @@
 #ifndef INC_FRAMEWORK_COMMON_DEBUG_GE_LOG_H_
 #define INC_FRAMEWORK_COMMON_DEBUG_GE_LOG_H_
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <unistd.h>
 #include <sys/syscall.h>
 
+#include "external/graph/ge_error_codes.h"
 #include "framework/common/ge_inner_error_codes.h"
 #include "toolchain/slog.h"
 
@@ -37,29 +40,130 @@ enum TraceStatus { TRACE_INIT = 0, TRACE_RUNNING, TRACE_WAITING, TRACE_STOP };
 #define GELOGO(...) GE_LOG_OPLOG(GE_MODULE_NAME, __VA_ARGS__)
 #define GELOGT(VALUE, ...) GE_LOG_TRACE(GE_MODULE_NAME, VALUE, __VA_ARGS__)
 
-inline bool IsLogEnable(int module_name, int log_level) {
-  int32_t enable = CheckLogLevel(module_name, log_level);
-  // 1:enable, 0:disable
-  if (enable == 1) {
-    return true;
+// Log sites below the level are compiled out, e.g. build with -DGE_LOG_MIN_LEVEL=1 to remove all debug logs
+#ifndef GE_LOG_MIN_LEVEL
+#define GE_LOG_MIN_LEVEL DLOG_DEBUG
+#endif
+
+namespace ge {
+using LogSinkFunc = void (*)(int module_id, int level, const char *fmt, ...);
+using LogFlushFunc = void (*)();
+
+///
+/// @brief Log state shared by all modules
+///
+struct LogState {
+  // increased when the log level is changed
+  std::atomic<uint32_t> level_generation{0};
+  // sink of the debug and info logs, they are written by dlog directly while it is null
+  std::atomic<LogSinkFunc> sink{nullptr};
+  // waits until the logs in the sink are written, called before a warning or error log is written by dlog
+  std::atomic<LogFlushFunc> flush{nullptr};
+};
+
+///
+/// @brief The state is a static of an inline function, so no library is linked for it. It is of default visibility
+///        even in the libraries built with hidden visibility, then the loader binds all of them to one instance.
+///
+inline __attribute__((visibility("default"))) LogState &GetLogState() {
+  static LogState state;
+  return state;
+}
+
+inline void FlushLogSink() {
+  LogFlushFunc flush = GetLogState().flush.load(std::memory_order_acquire);
+  if (flush != nullptr) {
+    flush();
   }
-  return false;
 }
 
+///
+/// @brief Results of CheckLogLevel cached by each thread, since it is an external call while most log sites are
+///        disabled. A thread checks again after kCacheLife queries, or after RefreshLogLevel is called.
+///
+class LogLevelCache {
+ public:
+  static bool IsEnable(int module_id, int log_level) {
+    if ((module_id < 0) || (module_id >= kModuleNum) || (log_level < DLOG_DEBUG) || (log_level >= kLevelNum)) {
+      return CheckLogLevel(module_id, log_level) == 1;
+    }
+    Cache &cache = GetCache();
+    uint32_t generation = GetLogState().level_generation.load(std::memory_order_relaxed);
+    if ((cache.life == 0) || (cache.generation != generation)) {
+      (void)memset(cache.states, kUnknown, sizeof(cache.states));
+      cache.generation = generation;
+      cache.life = kCacheLife;
+    }
+    --cache.life;
+    int8_t &state = cache.states[module_id][log_level];
+    if (state == kUnknown) {
+      // 1:enable, 0:disable
+      state = (CheckLogLevel(module_id, log_level) == 1) ? kEnabled : kDisabled;
+    }
+    return state == kEnabled;
+  }
+
+  // Call it after the log level is changed, so that all threads check the level again
+  static void Refresh() { (void)GetLogState().level_generation.fetch_add(1, std::memory_order_relaxed); }
+
+ private:
+  static const int kModuleNum = INVLID_MOUDLE_ID;
+  static const int kLevelNum = DLOG_ERROR + 1;
+  static const uint32_t kCacheLife = 4096;
+  static const int8_t kUnknown = 0;
+  static const int8_t kDisabled = 1;
+  static const int8_t kEnabled = 2;
+
+  struct Cache {
+    uint32_t generation;
+    uint32_t life;
+    int8_t states[kModuleNum][kLevelNum];
+  };
+
+  static Cache &GetCache() {
+    thread_local static Cache cache;
+    return cache;
+  }
+};
+
+inline void RefreshLogLevel() { LogLevelCache::Refresh(); }
+}  // namespace ge
+
+inline bool IsLogEnable(int module_name, int log_level) { return ge::LogLevelCache::IsEnable(module_name, log_level); }
+
 inline pid_t GetTid() {
   thread_local static pid_t tid = syscall(__NR_gettid);
   return tid;
 }
 
-#define GE_LOG_ERROR(MOD_NAME, ERROR_CODE, fmt, ...)                                       \
-  dlog_error(MOD_NAME, "%lu %s: ErrorNo: %d(%s) " fmt, GetTid(), __FUNCTION__, ERROR_CODE, \
-             ((GE_GET_ERRORNO_STR(ERROR_CODE)).c_str()), ##__VA_ARGS__)
-#define GE_LOG_WARN(MOD_NAME, fmt, ...) \
-  if (IsLogEnable(MOD_NAME, DLOG_WARN)) dlog_warn(MOD_NAME, "%lu %s:" fmt, GetTid(), __FUNCTION__, ##__VA_ARGS__)
-#define GE_LOG_INFO(MOD_NAME, fmt, ...) \
-  if (IsLogEnable(MOD_NAME, DLOG_INFO)) dlog_info(MOD_NAME, "%lu %s:" fmt, GetTid(), __FUNCTION__, ##__VA_ARGS__)
-#define GE_LOG_DEBUG(MOD_NAME, fmt, ...) \
-  if (IsLogEnable(MOD_NAME, DLOG_DEBUG)) dlog_debug(MOD_NAME, "%lu %s:" fmt, GetTid(), __FUNCTION__, ##__VA_ARGS__)
+// errors and warnings are written by dlog directly, after the earlier logs in the sink are written
+#define GE_LOG_ERROR(MOD_NAME, ERROR_CODE, fmt, ...)                                         \
+  do {                                                                                       \
+    ge::FlushLogSink();                                                                      \
+    dlog_error(MOD_NAME, "%lu %s: ErrorNo: %d(%s) " fmt, GetTid(), __FUNCTION__, ERROR_CODE, \
+               ((GE_GET_ERRORNO_STR(ERROR_CODE)).c_str()), ##__VA_ARGS__);                   \
+  } while (0)
+#define GE_LOG_TO_SINK(DLOG_FUNC, MOD_NAME, LEVEL, fmt, ...)                                              \
+  do {                                                                                                    \
+    ge::LogSinkFunc ge_log_sink = ge::GetLogState().sink.load(std::memory_order_acquire);                \
+    if (ge_log_sink != nullptr) {                                                                         \
+      ge_log_sink(MOD_NAME, LEVEL, "[%s:%d]%lu %s:" fmt, __FILE__, __LINE__, GetTid(), __FUNCTION__, \
+                  ##__VA_ARGS__);                                                                         \
+    } else {                                                                                              \
+      DLOG_FUNC(MOD_NAME, "%lu %s:" fmt, GetTid(), __FUNCTION__, ##__VA_ARGS__);                          \
+    }                                                                                                     \
+  } while (0)
+#define GE_LOG_WARN(MOD_NAME, fmt, ...)                                          \
+  if (IsLogEnable(MOD_NAME, DLOG_WARN)) do {                                     \
+      ge::FlushLogSink();                                                        \
+      dlog_warn(MOD_NAME, "%lu %s:" fmt, GetTid(), __FUNCTION__, ##__VA_ARGS__); \
+    } while (0)
+#define GE_LOG_INFO(MOD_NAME, fmt, ...)                                      \
+  if ((DLOG_INFO >= GE_LOG_MIN_LEVEL) && IsLogEnable(MOD_NAME, DLOG_INFO)) \
+  GE_LOG_TO_SINK(dlog_info, MOD_NAME, DLOG_INFO, fmt, ##__VA_ARGS__)
+#define GE_LOG_DEBUG(MOD_NAME, fmt, ...)                                       \
+  if ((DLOG_DEBUG >= GE_LOG_MIN_LEVEL) && IsLogEnable(MOD_NAME, DLOG_DEBUG)) \
+  GE_LOG_TO_SINK(dlog_debug, MOD_NAME, DLOG_DEBUG, fmt, ##__VA_ARGS__)
 #define GE_LOG_EVENT(MOD_NAME, fmt, ...) dlog_event(MOD_NAME, "%lu %s:" fmt, GetTid(), __FUNCTION__, ##__VA_ARGS__)
 #define GE_LOG_OPLOG(MOD_NAME, fmt, ...) \
   Dlog(MOD_NAME, DLOG_OPLOG, "%lu %s:" fmt, GetTid(), __FUNCTION__, ##__VA_ARGS__)
@@ -34,6 +34,7 @@ class ModelListenerAdapter;
 
 class SingleOp;
 class DynamicSingleOp;
+class SingleOpPlan;
 
 struct RunModelData {
   uint32_t index;  // Data index
@@ -48,6 +49,14 @@ struct RunModelData {
   std::vector<uint64_t> dynamic_dims;  // Dynamic dims scene, set dynamic dims, not supported by default:empty
 };
 
+struct DynamicSingleOpCacheStats {
+  uint64_t hit_count = 0;    // Executions which reuse the tiling result of a previous shape
+  uint64_t miss_count = 0;   // Executions which invoke tiling
+  uint64_t evict_count = 0;  // Shapes evicted as the least recently used one
+  size_t entry_num = 0;      // Shapes in cache
+  size_t capacity = 0;       // Max shapes in cache, 0 if cache is disabled
+};
+
 class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeExecutor {
  public:
   GeExecutor();
@@ -248,6 +257,40 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeExecutor {
   static ge::Status ExecuteAsync(SingleOp *executor, const std::vector<DataBuffer> &inputs,
                                  std::vector<DataBuffer> &outputs);
 
+  ///
+  /// @ingroup ge
+  /// @brief Create a plan which captures a sequence of static single op launches and replays them without
+  ///        per op validation. The plan must be destroyed before the resource of the ops is released
+  /// @param [out] SingleOpPlan **plan
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  static ge::Status CreateSingleOpPlan(SingleOpPlan **plan);
+
+  ///
+  /// @ingroup ge
+  /// @brief Append a launch of single op with buffers to the plan, the buffers are validated here
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  static ge::Status CaptureSingleOp(SingleOpPlan *plan, SingleOp *executor, const std::vector<DataBuffer> &inputs,
+                                    const std::vector<DataBuffer> &outputs);
+
+  ///
+  /// @ingroup ge
+  /// @brief Change buffers of the index-th launch captured in the plan
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  static ge::Status RebindSingleOp(SingleOpPlan *plan, size_t index, const std::vector<DataBuffer> &inputs,
+                                   const std::vector<DataBuffer> &outputs);
+
+  ///
+  /// @ingroup ge
+  /// @brief Launch the single ops captured in the plan in order
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  static ge::Status ReplaySingleOpPlan(SingleOpPlan *plan);
+
+  static ge::Status DestroySingleOpPlan(SingleOpPlan *plan);
+
   static ge::Status LoadDynamicSingleOp(const std::string &model_name, const ge::ModelData &modelData, void *stream,
                                         DynamicSingleOp **single_op);
 
@@ -255,6 +298,22 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeExecutor {
                                  const std::vector<DataBuffer> &inputs, std::vector<GeTensorDesc> &output_desc,
                                  std::vector<DataBuffer> &outputs);
 
+  ///
+  /// @ingroup ge
+  /// @brief Get counters of the shape cache of dynamic single op, which keeps the tiling results of recent shapes
+  /// @param [in] DynamicSingleOp *executor
+  /// @param [out] DynamicSingleOpCacheStats &stats
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  static ge::Status GetDynamicSingleOpCacheStats(DynamicSingleOp *executor, DynamicSingleOpCacheStats &stats);
+
+  ///
+  /// @ingroup ge
+  /// @brief Set max number of shapes in the cache of dynamic single op, 0 disables the cache
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  static ge::Status SetDynamicSingleOpCacheCapacity(DynamicSingleOp *executor, size_t capacity);
+
   static ge::Status ReleaseSingleOpResource(void *stream);
 
   ge::Status GetBatchInfoSize(uint32_t model_id, size_t &shape_count);
@@ -132,6 +132,36 @@ namespace domi {
  */
 ge::OmgContext &GetContext();
 
+/**
+ * @ingroup domi_omg
+ * @brief bind an OMG context to the calling thread, GetContext() returns it in this thread instead of the
+ *        process wide one, so that concurrent builds do not share their settings. nullptr unbinds
+ * @param [in] context context to bind
+ */
+void BindContext(ge::OmgContext *context);
+
+/**
+ * @ingroup domi_omg
+ * @brief get the OMG context bound to the calling thread
+ * @return bound context, nullptr if the thread uses the process wide one
+ */
+ge::OmgContext *GetBoundContext();
+
+/**
+ * @ingroup domi_omg
+ * @brief bind an OMG context to the calling thread within a scope, the previous binding is restored on exit
+ */
+class OmgContextGuard {
+ public:
+  explicit OmgContextGuard(ge::OmgContext *context) : last_context_(GetBoundContext()) { BindContext(context); }
+  ~OmgContextGuard() { BindContext(last_context_); }
+  OmgContextGuard(const OmgContextGuard &) = delete;
+  OmgContextGuard &operator=(const OmgContextGuard &) = delete;
+
+ private:
+  ge::OmgContext *last_context_;
+};
+
 struct TEBinInfo {
   // It is obsolete. It will be automatically obtained from the binfilename field of the JSON file later.
   // To be compatible with use cases written by previous users, fields are not deleted.(2018.11.21)
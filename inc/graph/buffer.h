@@ -18,6 +18,7 @@
 #define INC_GRAPH_BUFFER_H_
 
 #include <graph/types.h>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -37,6 +38,41 @@ namespace ge {
 
 using std::shared_ptr;
 
+///
+/// @brief Reference counted host memory block, used as the zero copy storage of Buffer and GeTensor.
+///        The memory is released by the deleter when the last reference goes away.
+///
+class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY AlignedPtr {
+ public:
+  using Deleter = std::function<void(std::uint8_t *)>;
+  static const std::size_t kDefaultAlignment = 64;
+
+  // Allocate uninitialized memory aligned to alignment(power of 2), return nullptr if failed
+  static std::shared_ptr<AlignedPtr> Allocate(std::size_t size, std::size_t alignment = kDefaultAlignment);
+  // Take over the memory, the deleter is called on release
+  static std::shared_ptr<AlignedPtr> Adopt(std::uint8_t *data, std::size_t size, const Deleter &deleter);
+  // Take over the memory of the vector without copying
+  static std::shared_ptr<AlignedPtr> Adopt(std::vector<std::uint8_t> &&data);
+
+  AlignedPtr(std::uint8_t *data, std::size_t size, const Deleter &deleter)
+      : data_(data), size_(size), deleter_(deleter) {}
+  ~AlignedPtr();
+  AlignedPtr(const AlignedPtr &) = delete;
+  AlignedPtr &operator=(const AlignedPtr &) = delete;
+
+  std::uint8_t *Get() const { return data_; }
+  std::size_t Size() const { return size_; }
+
+ private:
+  std::uint8_t *data_ = nullptr;
+  std::size_t size_ = 0;
+  Deleter deleter_;
+};
+
+///
+/// @brief The zero copy storage changed the size and layout of Buffer, and operator[] is no longer inlined as
+///        a read of the proto string. Binaries built against the old header, e.g. engine plugins, must be rebuilt.
+///
 class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Buffer {
  public:
   Buffer();
@@ -50,6 +86,9 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Buffer {
 
   static Buffer CopyFrom(const std::uint8_t *data, std::size_t bufferSize);
 
+  // Zero copy, the buffer refers to [offset, offset + size) of aligned_ptr and shares its ownership
+  static Buffer FromAlignedPtr(const std::shared_ptr<AlignedPtr> &aligned_ptr, std::size_t offset, std::size_t size);
+
   const std::uint8_t *GetData() const;
   std::uint8_t *GetData();
   std::size_t GetSize() const;
@@ -60,9 +99,9 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Buffer {
   inline std::uint8_t *data() { return GetData(); }  // lint !e659
   inline std::size_t size() const { return GetSize(); }
   inline void clear() { return ClearBuffer(); }
-  uint8_t operator[](size_t index) const {                // lint !e1022 !e1042
-    if (buffer_ != nullptr && index < buffer_->size()) {  // lint !e574
-      return (uint8_t)(*buffer_)[index];
+  uint8_t operator[](size_t index) const {  // lint !e1022 !e1042
+    if (index < GetSize()) {                // lint !e574
+      return GetData()[index];
     }
     return 0xff;
   }
@@ -70,6 +109,12 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Buffer {
  private:
   GeIrProtoHelper<proto::AttrDef> data_;
   std::string *buffer_ = nullptr;
+  // Zero copy storage, takes precedence over buffer_ when set
+  std::shared_ptr<AlignedPtr> aligned_ptr_;
+  std::uint8_t *external_data_ = nullptr;
+  std::size_t external_size_ = 0;
+
+  bool IsExternal() const { return aligned_ptr_ != nullptr; }
 
   // Create from protobuf obj
   Buffer(const ProtoMsgOwner &protoOnwer, proto::AttrDef *buffer);
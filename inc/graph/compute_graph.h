@@ -147,6 +147,13 @@ class ComputeGraph : public std::enable_shared_from_this<ComputeGraph>, public A
   graphStatus InferShape();
   graphStatus InferOriginFormat();
   graphStatus InferShapeInNeed();
+  ///
+  /// @brief Infer shape of the nodes with NEED_INFER. With thread_num > 1, the nodes before the first one whose infer
+  ///        func is not registered are inferred concurrently, which requires their infer funcs to be thread safe
+  /// @param [in] thread_num max number of nodes inferred at the same time, 1 infers serially as InferShapeInNeed()
+  /// @return graphStatus
+  ///
+  graphStatus InferShapeInNeed(uint32_t thread_num);
   graphStatus InsertEventNodes();
   bool operator==(const ComputeGraph &r_compute_graph) const;
 
@@ -150,6 +150,10 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensorDesc : public AttrH
   GeShape &ShapeReference() const;
 };
 
+///
+/// @brief The zero copy storage changed the size and layout of GeTensor, binaries built against the old header
+///        must be rebuilt.
+///
 class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensor {
  public:
   GeTensor();
@@ -168,8 +172,17 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensor {
   Buffer MutableData();
   graphStatus SetData(std::vector<uint8_t> &&data);
   graphStatus SetData(const std::vector<uint8_t> &data);
+  // Copy the data, use ShareData to refer to the storage of data
   graphStatus SetData(const Buffer &data);
   graphStatus SetData(const uint8_t *data, size_t size);
+  // Zero copy, the tensor refers to [offset, offset + size) of aligned_ptr, the data is copied into the proto
+  // only when the tensor is serialized. Tensors which are views of other proto messages(e.g. attributes) fall
+  // back to copying.
+  graphStatus SetData(const std::shared_ptr<AlignedPtr> &aligned_ptr, size_t offset, size_t size);
+  // Zero copy if data is in external storage, the tensor and data then share the storage and writes through
+  // one of them are seen by the other. Otherwise the data is copied.
+  graphStatus ShareData(const Buffer &data);
+  bool IsExternalData() const;
 
   GeTensor Clone() const;
 
@@ -187,7 +200,12 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeTensor {
   GeIrProtoHelper<proto::TensorDef> tensor_def_;
   // Reference from tensorDef_, do not direct use
   mutable GeTensorDesc __desc_;
+  // Zero copy storage shared by the copies of this tensor, null if the tensor is a view of other proto message
+  std::shared_ptr<Buffer> external_data_;
   GeTensorDesc &DescReference() const;
+  void ResetExternalData();
+  // Copy the tensor into proto_msg, the zero copy data is materialized here
+  void SerializeTo(proto::TensorDef &proto_msg) const;
 };
 }  // namespace ge
 #endif  // INC_GRAPH_GE_TENSOR_H_
@@ -17,17 +17,56 @@
 #ifndef INC_GRAPH_SHAPE_REFINER_H_
 #define INC_GRAPH_SHAPE_REFINER_H_
 
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "external/graph/inference_context.h"
 
 #include "external/graph/ge_error_codes.h"
 #include "graph/node.h"
 
 namespace ge {
+// ShapeInferenceSession keeps the inference contexts of one shape inference run, usually of one graph.
+// The contexts are guarded by a lock, so nodes of a session can be inferred by multi threads.
+class ShapeInferenceSession {
+ public:
+  using NodeInferFunc = std::function<graphStatus(const NodePtr &node)>;
+
+  ShapeInferenceSession() = default;
+  ~ShapeInferenceSession() = default;
+  ShapeInferenceSession(const ShapeInferenceSession &) = delete;
+  ShapeInferenceSession &operator=(const ShapeInferenceSession &) = delete;
+
+  InferenceContextPtr GetContext(const NodePtr &node) const;
+  void SetContext(const NodePtr &node, const InferenceContextPtr &context);
+  void Clear();
+
+  ///
+  /// @brief Run infer_func on nodes with thread_num threads. A node is started after all of its in nodes in the list
+  ///        are done, and nodes of a subgraph are started after the parent node. The nodes are run one by one in
+  ///        the given order if thread_num is not greater than 1. No more node is started once infer_func fails.
+  /// @param [in] nodes nodes in topological order
+  /// @param [in] thread_num
+  /// @param [in] infer_func
+  /// @return the first failed status of infer_func, or GRAPH_SUCCESS
+  ///
+  static graphStatus InferNodes(const std::vector<NodePtr> &nodes, uint32_t thread_num,
+                                const NodeInferFunc &infer_func);
+
+ private:
+  mutable std::mutex mutex_;
+  std::atomic<size_t> context_num_{0};
+  std::unordered_map<NodePtr, InferenceContextPtr> contexts_;
+};
+
 // ShapeRefiner performs shape inference for compute graphs
 class ShapeRefiner {
  public:
   static graphStatus InferShapeAndType(const ConstNodePtr &node, Operator &op, bool before_subgraph);
+  static graphStatus InferShapeAndType(const NodePtr &node, bool before_subgraph, ShapeInferenceSession &session);
   static graphStatus InferShapeAndType(const NodePtr &node, bool before_subgraph);
   static graphStatus InferShapeAndType(const NodePtr &node);
   static graphStatus InferShapeAndType(const ConstNodePtr &node, Operator &op);
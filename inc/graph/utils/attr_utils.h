@@ -117,6 +117,11 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY AttrUtils {
 
   static std::string GetAllAttrsStr(ConstAttrHolderAdapter &&obj);
 
+  // Hash of all the attrs which does not depend on their order, objects with equal attrs have the same hash
+  static uint64_t GetAllAttrsHash(ConstAttrHolderAdapter &&obj);
+
+  static bool IsAllAttrsEqual(ConstAttrHolderAdapter &&obj1, ConstAttrHolderAdapter &&obj2);
+
   class AttrHolderAdapter {
    public:
     AttrHolderAdapter(AttrHolder *obj) : obj_(obj) {}
@@ -17,6 +17,7 @@
 #ifndef INC_GRAPH_UTILS_GRAPH_UTILS_H_
 #define INC_GRAPH_UTILS_GRAPH_UTILS_H_
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -37,7 +38,7 @@
     GraphUtils::DumpGEGraph(compute_graph, name);                                                      \
     GraphUtils::DumpGEGraphToOnnx(*compute_graph, name);                                               \
     for (const auto &sub_graph_func : compute_graph->GetAllSubgraphs()) {                              \
-      static int8_t i = 0;                                                                             \
+      static std::atomic<int8_t> i(0);                                                                 \
       auto sub_graph_func_name = std::string(name) + std::string("_sub_graph_") + std::to_string(i++); \
       GraphUtils::DumpGEGraph(sub_graph_func, sub_graph_func_name);                                    \
       GraphUtils::DumpGEGraphToOnnx(*sub_graph_func, sub_graph_func_name);                             \
@@ -213,6 +214,11 @@ class GraphUtils {
 
   static bool LoadGEGraphFromOnnx(const char *file, ge::ComputeGraph &compute_graph);
 
+  ///
+  /// @brief Wait until the graphs dumped by DumpGEGraph and DumpGEGraphToOnnx are written
+  ///
+  static void FlushGraphDump();
+
   static bool ReadProtoFromTextFile(const char *file, google::protobuf::Message *message);
 
   static void WriteProtoToTextFile(const google::protobuf::Message &proto, const char *real_path);
@@ -19,6 +19,56 @@
 #include "framework/common/debug/ge_log.h"
 
 namespace ge {
+const std::size_t AlignedPtr::kDefaultAlignment;
+
+std::shared_ptr<AlignedPtr> AlignedPtr::Allocate(std::size_t size, std::size_t alignment) {
+  if ((alignment == 0) || ((alignment & (alignment - 1)) != 0)) {
+    GELOGE(GRAPH_PARAM_INVALID, "Alignment %zu is not power of 2", alignment);
+    return nullptr;
+  }
+  if (size > SIZE_MAX - alignment) {
+    GELOGE(GRAPH_PARAM_INVALID, "Size %zu is too large", size);
+    return nullptr;
+  }
+  auto base = new (std::nothrow) std::uint8_t[size + alignment];
+  if (base == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Failed to alloc aligned memory, size %zu", size);
+    return nullptr;
+  }
+  auto addr = reinterpret_cast<std::uintptr_t>(base);
+  auto aligned = reinterpret_cast<std::uint8_t *>((addr + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+  std::shared_ptr<AlignedPtr> aligned_ptr(new (std::nothrow)
+                                            AlignedPtr(aligned, size, [base](std::uint8_t *) { delete[] base; }));
+  if (aligned_ptr == nullptr) {
+    delete[] base;
+    GELOGE(MEMALLOC_FAILED, "Failed to create aligned ptr");
+  }
+  return aligned_ptr;
+}
+
+std::shared_ptr<AlignedPtr> AlignedPtr::Adopt(std::uint8_t *data, std::size_t size, const Deleter &deleter) {
+  std::shared_ptr<AlignedPtr> aligned_ptr(new (std::nothrow) AlignedPtr(data, size, deleter));
+  if ((aligned_ptr == nullptr) && (deleter != nullptr)) {
+    deleter(data);
+  }
+  return aligned_ptr;
+}
+
+std::shared_ptr<AlignedPtr> AlignedPtr::Adopt(std::vector<std::uint8_t> &&data) {
+  auto holder = new (std::nothrow) std::vector<std::uint8_t>(std::move(data));
+  if (holder == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Failed to create vector holder");
+    return nullptr;
+  }
+  return Adopt(holder->data(), holder->size(), [holder](std::uint8_t *) { delete holder; });
+}
+
+AlignedPtr::~AlignedPtr() {
+  if (deleter_ != nullptr) {
+    deleter_(data_);
+  }
+}
+
 Buffer::Buffer() {
   data_.InitDefault();
   if (data_.GetProtoMsg()) {
@@ -30,6 +80,9 @@ Buffer::Buffer(const Buffer &other) {
   // Share data
   data_ = other.data_;
   buffer_ = other.buffer_;
+  aligned_ptr_ = other.aligned_ptr_;
+  external_data_ = other.external_data_;
+  external_size_ = other.external_size_;
 }
 
 Buffer::Buffer(std::size_t buffer_size, std::uint8_t default_val) : Buffer() {  // default
@@ -60,6 +113,19 @@ Buffer Buffer::CopyFrom(const std::uint8_t *data, std::size_t buffer_size) {
   return buffer;
 }
 
+Buffer Buffer::FromAlignedPtr(const std::shared_ptr<AlignedPtr> &aligned_ptr, std::size_t offset,
+                              std::size_t size) {
+  Buffer buffer;
+  if ((aligned_ptr == nullptr) || (offset > aligned_ptr->Size()) || (size > aligned_ptr->Size() - offset)) {
+    GELOGE(GRAPH_PARAM_INVALID, "Invalid aligned ptr, offset %zu, size %zu", offset, size);
+    return buffer;
+  }
+  buffer.aligned_ptr_ = aligned_ptr;
+  buffer.external_data_ = aligned_ptr->Get() + offset;
+  buffer.external_size_ = size;
+  return buffer;
+}
+
 Buffer::Buffer(const std::shared_ptr<google::protobuf::Message> &proto_owner, proto::AttrDef *buffer)
     : data_(proto_owner, buffer) {
   if (data_.GetProtoMsg() != nullptr) {
@@ -77,11 +143,17 @@ Buffer &Buffer::operator=(const Buffer &other) {
     // Share data
     data_ = other.data_;
     buffer_ = other.buffer_;
+    aligned_ptr_ = other.aligned_ptr_;
+    external_data_ = other.external_data_;
+    external_size_ = other.external_size_;
   }
   return *this;
 }
 
 const std::uint8_t *Buffer::GetData() const {
+  if (IsExternal()) {
+    return external_data_;
+  }
   if (buffer_ != nullptr) {
     return (const std::uint8_t *)buffer_->data();
   }
@@ -89,6 +161,9 @@ const std::uint8_t *Buffer::GetData() const {
 }
 
 std::uint8_t *Buffer::GetData() {
+  if (IsExternal()) {
+    return external_data_;
+  }
   if (buffer_ != nullptr && !buffer_->empty()) {
     // Avoid copy on write
     (void)(*buffer_)[0];
@@ -98,6 +173,9 @@ std::uint8_t *Buffer::GetData() {
 }
 
 std::size_t Buffer::GetSize() const {
+  if (IsExternal()) {
+    return external_size_;
+  }
   if (buffer_ != nullptr) {
     return buffer_->size();
   }
@@ -105,6 +183,13 @@ std::size_t Buffer::GetSize() const {
 }
 
 void Buffer::ClearBuffer() {
+  if (IsExternal()) {
+    // only drop the reference, the memory is released with the last owner
+    aligned_ptr_.reset();
+    external_data_ = nullptr;
+    external_size_ = 0;
+    return;
+  }
   if (buffer_ != nullptr) {
     buffer_->clear();
   }
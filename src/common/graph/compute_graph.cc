@@ -24,6 +24,7 @@
 #include "debug/ge_util.h"
 #include "framework/common/debug/ge_log.h"
 #include "ge/ge_api_types.h"
+#include "graph/operator_factory_impl.h"
 #include "graph/shape_refiner.h"
 #include "proto/ge_ir.pb.h"
 #include "utils/ge_ir_utils.h"
@@ -48,6 +49,49 @@ bool IsUseBFS() {
   }
   return false;
 }
+
+bool IsNeedInfer(const NodePtr &node_ptr) {
+  bool is_need_infer = false;
+  (void)ge::AttrUtils::GetBool(node_ptr->GetOpDesc(), NEED_INFER, is_need_infer);
+  return is_need_infer;
+}
+
+// Whether the infer func of the node is known without creating an operator of it
+bool HasKnownInferFunc(const NodePtr &node_ptr) {
+  auto op_desc = node_ptr->GetOpDesc();
+  return (op_desc->GetInferFunc() != nullptr) ||
+         (OperatorFactoryImpl::GetInferShapeFunc(op_desc->GetType()) != nullptr);
+}
+
+///
+/// Infer the node if it needs to
+/// @return GRAPH_PARAM_INVALID if the op has no infer func, upon which no more node is inferred
+///
+graphStatus InferNodeInNeed(const NodePtr &node_ptr) {
+  if (!IsNeedInfer(node_ptr)) {
+    return GRAPH_SUCCESS;
+  }
+  GE_CHK_BOOL_EXEC(node_ptr->Verify() == GRAPH_SUCCESS, return GRAPH_FAILED, "Verifying %s failed.",
+                   node_ptr->GetName().c_str());
+
+  graphStatus status = node_ptr->InferShapeAndType();
+  GE_CHK_BOOL_EXEC_INFO(node_ptr->GetType() == DATA || GRAPH_PARAM_INVALID != status, return GRAPH_PARAM_INVALID,
+                        "Op %s does not have the IMPLEMT_INFERFUNC definition,"
+                        " and subsequent operators no longer perform shape inference.",
+                        node_ptr->GetName().c_str());
+  GE_CHK_BOOL_EXEC(status == GRAPH_SUCCESS, return GRAPH_FAILED, "Inferring %s failed.", node_ptr->GetName().c_str());
+
+  for (const auto &out_anchor : node_ptr->GetAllOutDataAnchors()) {
+    GE_CHECK_NOTNULL(out_anchor->GetOwnerNode()->GetOpDesc());
+    auto output_tensor = out_anchor->GetOwnerNode()->GetOpDesc()->GetOutputDesc(out_anchor->GetIdx());
+    ge::TensorUtils::SetRealDimCnt(output_tensor, output_tensor.GetShape().GetDims().size());
+    (void)out_anchor->GetOwnerNode()->GetOpDesc()->UpdateOutputDesc(out_anchor->GetIdx(), output_tensor);
+    for (const auto &peer_anchor : out_anchor->GetPeerInDataAnchors()) {
+      (void)peer_anchor->GetOwnerNode()->GetOpDesc()->UpdateInputDesc(peer_anchor->GetIdx(), output_tensor);
+    }
+  }
+  return GRAPH_SUCCESS;
+}
 }  // namespace
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY ComputeGraph::ComputeGraph(const std::string &name)
@@ -1202,33 +1246,39 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::InferOr
 }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::InferShapeInNeed() {
+  return InferShapeInNeed(1);
+}
+
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ComputeGraph::InferShapeInNeed(uint32_t thread_num) {
   GE_CHK_BOOL_ONLY_LOG(TopologicalSorting() == GRAPH_SUCCESS, "Verifying failed.");
+  std::vector<NodePtr> nodes;
   for (const auto &node_ptr : GetAllNodes()) {
     GE_CHECK_NOTNULL(node_ptr);
-    auto op_desc = node_ptr->GetOpDesc();
-    bool is_need_infer = false;
-    (void)ge::AttrUtils::GetBool(op_desc, NEED_INFER, is_need_infer);
-    if (is_need_infer) {
-      GE_CHK_BOOL_EXEC(node_ptr->Verify() == GRAPH_SUCCESS, return GRAPH_FAILED, "Verifying %s failed.",
-                       node_ptr->GetName().c_str());
-
-      graphStatus status = node_ptr->InferShapeAndType();
-      GE_CHK_BOOL_EXEC_INFO(node_ptr->GetType() == DATA || GRAPH_PARAM_INVALID != status, break,
-                            "Op %s does not have the IMPLEMT_INFERFUNC definition,"
-                            " and subsequent operators no longer perform shape inference.",
-                            node_ptr->GetName().c_str());
-      GE_CHK_BOOL_EXEC(status == GRAPH_SUCCESS, return GRAPH_FAILED, "Inferring %s failed.",
-                       node_ptr->GetName().c_str());
-
-      for (const auto &out_anchor : node_ptr->GetAllOutDataAnchors()) {
-        GE_CHECK_NOTNULL(out_anchor->GetOwnerNode()->GetOpDesc());
-        auto output_tensor = out_anchor->GetOwnerNode()->GetOpDesc()->GetOutputDesc(out_anchor->GetIdx());
-        ge::TensorUtils::SetRealDimCnt(output_tensor, output_tensor.GetShape().GetDims().size());
-        (void)out_anchor->GetOwnerNode()->GetOpDesc()->UpdateOutputDesc(out_anchor->GetIdx(), output_tensor);
-        for (const auto &peer_anchor : out_anchor->GetPeerInDataAnchors()) {
-          (void)peer_anchor->GetOwnerNode()->GetOpDesc()->UpdateInputDesc(peer_anchor->GetIdx(), output_tensor);
-        }
-      }
+    nodes.emplace_back(node_ptr);
+  }
+
+  size_t parallel_num = 0;
+  if (thread_num > 1) {
+    // Only the nodes before the first one whose infer func is not known are inferred concurrently, the rest are
+    // inferred serially, so that inference stops at the same op as the serial run. As a topological prefix, the
+    // nodes never depend on the rest.
+    while ((parallel_num < nodes.size()) && (!IsNeedInfer(nodes[parallel_num]) ||
+                                              HasKnownInferFunc(nodes[parallel_num]))) {
+      ++parallel_num;
+    }
+    std::vector<NodePtr> parallel_nodes(nodes.begin(), nodes.begin() + parallel_num);
+    graphStatus ret = ShapeInferenceSession::InferNodes(parallel_nodes, thread_num, InferNodeInNeed);
+    if (ret != GRAPH_SUCCESS) {
+      return ret;
+    }
+  }
+  for (size_t i = parallel_num; i < nodes.size(); ++i) {
+    graphStatus ret = InferNodeInNeed(nodes[i]);
+    if (ret == GRAPH_PARAM_INVALID) {
+      break;
+    }
+    if (ret != GRAPH_SUCCESS) {
+      return ret;
     }
   }
   return GRAPH_SUCCESS;
@@ -15,6 +15,9 @@
  */
 
 #include "graph/ge_attr_value.h"
+
+#include <cstring>
+
 #include "graph/ge_tensor.h"
 #include "external/graph/graph.h"
 #include "utils/attr_utils.h"
@@ -439,7 +442,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const GeTensor &va
     GELOGE(FAILED, "Proto msg is nullptr");
     return false;
   }
-  *proto_attr_val.mutable_t() = *proto_msg;
+  val.SerializeTo(*proto_attr_val.mutable_t());
   return true;
 }
 
@@ -469,7 +472,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const vector<Const
       proto_attr_val.clear_list();
       return false;
     }
-    *list->add_t() = *proto_msg;
+    item->SerializeTo(*list->add_t());
   }
   return true;
 }
@@ -489,7 +492,7 @@ bool GeAttrValueImp::SetValue(proto::AttrDef &proto_attr_val, const vector<GeTen
       proto_attr_val.clear_list();
       return false;
     }
-    *list->add_t() = *proto_msg;
+    item.SerializeTo(*list->add_t());
   }
   return true;
 }
@@ -1286,4 +1289,127 @@ std::string AttrUtils::GetAllAttrsStr(AttrUtils::ConstAttrHolderAdapter &&obj) {
   }
   return ss.str();
 }
+
+namespace {
+inline uint64_t HashCombine(uint64_t seed, uint64_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+inline uint64_t FloatBits(float value) {
+  uint32_t bits = 0;
+  (void)memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// The scalars and the scalar lists are hashed by value, the other values only by their kinds and sizes, the
+// equality check tells them apart
+uint64_t GetAttrValueHash(const proto::AttrDef &attr) {
+  uint64_t hash = static_cast<uint64_t>(attr.value_case());
+  switch (attr.value_case()) {
+    case proto::AttrDef::kS:
+      return HashCombine(hash, std::hash<std::string>()(attr.s()));
+    case proto::AttrDef::kI:
+      return HashCombine(hash, static_cast<uint64_t>(attr.i()));
+    case proto::AttrDef::kF:
+      return HashCombine(hash, FloatBits(attr.f()));
+    case proto::AttrDef::kB:
+      return HashCombine(hash, static_cast<uint64_t>(attr.b()));
+    case proto::AttrDef::kBt:
+      return HashCombine(hash, std::hash<std::string>()(attr.bt()));
+    case proto::AttrDef::kDt:
+      return HashCombine(hash, static_cast<uint64_t>(attr.dt()));
+    case proto::AttrDef::kList: {
+      const auto &list = attr.list();
+      hash = HashCombine(hash, static_cast<uint64_t>(list.val_type()));
+      for (const auto &value : list.s()) {
+        hash = HashCombine(hash, std::hash<std::string>()(value));
+      }
+      for (auto value : list.i()) {
+        hash = HashCombine(hash, static_cast<uint64_t>(value));
+      }
+      for (auto value : list.f()) {
+        hash = HashCombine(hash, FloatBits(value));
+      }
+      for (auto value : list.b()) {
+        hash = HashCombine(hash, static_cast<uint64_t>(value));
+      }
+      for (auto value : list.dt()) {
+        hash = HashCombine(hash, static_cast<uint64_t>(value));
+      }
+      hash = HashCombine(hash, static_cast<uint64_t>(list.bt_size()));
+      hash = HashCombine(hash, static_cast<uint64_t>(list.td_size()));
+      hash = HashCombine(hash, static_cast<uint64_t>(list.t_size()));
+      hash = HashCombine(hash, static_cast<uint64_t>(list.g_size()));
+      return HashCombine(hash, static_cast<uint64_t>(list.na_size()));
+    }
+    default:
+      return hash;
+  }
+}
+
+bool IsAttrValueEqual(const proto::AttrDef &lhs, const proto::AttrDef &rhs) {
+  if (lhs.value_case() != rhs.value_case()) {
+    return false;
+  }
+  switch (lhs.value_case()) {
+    case proto::AttrDef::kS:
+      return lhs.s() == rhs.s();
+    case proto::AttrDef::kI:
+      return lhs.i() == rhs.i();
+    case proto::AttrDef::kF:
+      return FloatBits(lhs.f()) == FloatBits(rhs.f());
+    case proto::AttrDef::kB:
+      return lhs.b() == rhs.b();
+    case proto::AttrDef::kBt:
+      return lhs.bt() == rhs.bt();
+    case proto::AttrDef::kDt:
+      return lhs.dt() == rhs.dt();
+    default:
+      // nested values are compared by their serialization, the same as GetAllAttrsStr does
+      return lhs.SerializeAsString() == rhs.SerializeAsString();
+  }
+}
+}  // namespace
+
+uint64_t AttrUtils::GetAllAttrsHash(AttrUtils::ConstAttrHolderAdapter &&obj) {
+  auto holder = obj.get();
+  if (holder == nullptr) {
+    return 0;
+  }
+  auto attrs_map = holder->GetAttrMap();
+  if (attrs_map.GetProtoMsg() == nullptr) {
+    return 0;
+  }
+  // the attrs are summed up since the map has no stable order
+  uint64_t hash = 0;
+  for (auto &attr : *(attrs_map.GetProtoMsg())) {
+    hash += HashCombine(std::hash<std::string>()(attr.first), GetAttrValueHash(attr.second));
+  }
+  return hash;
+}
+
+bool AttrUtils::IsAllAttrsEqual(AttrUtils::ConstAttrHolderAdapter &&obj1, AttrUtils::ConstAttrHolderAdapter &&obj2) {
+  auto holder1 = obj1.get();
+  auto holder2 = obj2.get();
+  if ((holder1 == nullptr) || (holder2 == nullptr)) {
+    return holder1 == holder2;
+  }
+  auto attrs_map1 = holder1->GetAttrMap();
+  auto attrs_map2 = holder2->GetAttrMap();
+  if ((attrs_map1.GetProtoMsg() == nullptr) || (attrs_map2.GetProtoMsg() == nullptr)) {
+    return attrs_map1.GetProtoMsg() == attrs_map2.GetProtoMsg();
+  }
+  const auto &attrs1 = *(attrs_map1.GetProtoMsg());
+  const auto &attrs2 = *(attrs_map2.GetProtoMsg());
+  if (attrs1.size() != attrs2.size()) {
+    return false;
+  }
+  for (auto &attr : attrs1) {
+    auto iter = attrs2.find(attr.first);
+    if ((iter == attrs2.end()) || !IsAttrValueEqual(attr.second, iter->second)) {
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace ge
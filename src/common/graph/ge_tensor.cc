@@ -607,6 +607,8 @@ GeTensor::GeTensor::GeTensor() {
   tensor_def_.InitDefault();
   // Default init desc
   DescReference() = GeTensorDesc();
+  // The tensor owns its proto message, so the data can be kept out of the message
+  external_data_ = ComGraphMakeShared<Buffer>();
 }
 
 GeTensor::GeTensor(const GeTensorDesc &tensor_desc) : GeTensor() { DescReference() = tensor_desc; }
@@ -629,10 +631,8 @@ GeTensor::GeTensor(const GeTensorDesc &tensor_desc, const uint8_t *data, size_t
 
 GeTensor::GeTensor(GeTensorDesc &&tensor_desc, vector<uint8_t> &&data) : GeTensor() {
   DescReference() = std::move(tensor_desc);
-  auto proto_msg = tensor_def_.GetProtoMsg();
-  if (proto_msg != nullptr) {
-    proto_msg->set_data(data.data(), data.size());
-  }
+  // Callers rely on data being left intact, so it is copied here, use SetData(std::vector<uint8_t> &&) to move
+  (void)SetData(static_cast<const vector<uint8_t> &>(data));
 }
 
 GeTensor::GeTensor(const GeTensorDesc &tensor_desc, const Buffer &data) : GeTensor() {
@@ -669,7 +669,18 @@ GeTensorDesc &GeTensor::DescReference() const {
 
 void GeTensor::SetTensorDesc(const GeTensorDesc &tensor_desc) { DescReference() = tensor_desc; }
 
+bool GeTensor::IsExternalData() const { return (external_data_ != nullptr) && external_data_->IsExternal(); }
+
+void GeTensor::ResetExternalData() {
+  if (IsExternalData()) {
+    *external_data_ = Buffer();
+  }
+}
+
 const Buffer GeTensor::GetData() const {
+  if (IsExternalData()) {
+    return *external_data_;
+  }
   auto proto_msg = tensor_def_.GetProtoMsg();
   if (proto_msg != nullptr) {
     return Buffer(tensor_def_.GetProtoOwner(), proto_msg->mutable_data());
@@ -678,6 +689,9 @@ const Buffer GeTensor::GetData() const {
 }
 
 Buffer GeTensor::MutableData() {
+  if (IsExternalData()) {
+    return *external_data_;
+  }
   auto proto_msg = tensor_def_.GetProtoMsg();
   if (proto_msg != nullptr) {
     return Buffer(tensor_def_.GetProtoOwner(), proto_msg->mutable_data());
@@ -688,6 +702,11 @@ Buffer GeTensor::MutableData() {
 graphStatus GeTensor::SetData(vector<uint8_t> &&data) {
   auto proto_msg = tensor_def_.GetProtoMsg();
   GE_CHECK_NOTNULL(proto_msg);
+  if (external_data_ != nullptr) {
+    auto aligned_ptr = AlignedPtr::Adopt(std::move(data));
+    GE_CHECK_NOTNULL(aligned_ptr);
+    return SetData(aligned_ptr, 0, aligned_ptr->Size());
+  }
   proto_msg->set_data(data.data(), data.size());
   return GRAPH_SUCCESS;
 }
@@ -695,6 +714,7 @@ graphStatus GeTensor::SetData(vector<uint8_t> &&data) {
 graphStatus GeTensor::SetData(const vector<uint8_t> &data) {
   auto proto_msg = tensor_def_.GetProtoMsg();
   GE_CHECK_NOTNULL(proto_msg);
+  ResetExternalData();
   proto_msg->set_data(data.data(), data.size());
   return GRAPH_SUCCESS;
 }
@@ -703,6 +723,7 @@ graphStatus GeTensor::SetData(const uint8_t *data, size_t size) {
   GE_CHECK_NOTNULL(data);
   auto proto_msg = tensor_def_.GetProtoMsg();
   GE_CHECK_NOTNULL(proto_msg);
+  ResetExternalData();
   proto_msg->set_data(data, size);
   return GRAPH_SUCCESS;
 }
@@ -716,21 +737,70 @@ graphStatus GeTensor::SetData(const Buffer &data) {
   if (data.data() == nullptr) {
     GELOGI("data addr is null.");
   }
+  ResetExternalData();
   proto_msg->set_data(data.data(), data.size());
   return GRAPH_SUCCESS;
 }
 
+graphStatus GeTensor::ShareData(const Buffer &data) {
+  if (!data.IsExternal()) {
+    // the data lives in a proto message, it can not be shared
+    return SetData(data);
+  }
+  return SetData(data.aligned_ptr_, static_cast<size_t>(data.external_data_ - data.aligned_ptr_->Get()),
+                 data.external_size_);
+}
+
+graphStatus GeTensor::SetData(const std::shared_ptr<AlignedPtr> &aligned_ptr, size_t offset, size_t size) {
+  GE_CHECK_NOTNULL(aligned_ptr);
+  auto proto_msg = tensor_def_.GetProtoMsg();
+  GE_CHECK_NOTNULL(proto_msg);
+  if ((offset > aligned_ptr->Size()) || (size > aligned_ptr->Size() - offset)) {
+    GELOGE(GRAPH_PARAM_INVALID, "Invalid data range, offset %zu, size %zu, total size %zu", offset, size,
+           aligned_ptr->Size());
+    return GRAPH_PARAM_INVALID;
+  }
+  if (external_data_ == nullptr) {
+    // view of other proto message, e.g. an attribute, which must hold the data itself
+    proto_msg->set_data(aligned_ptr->Get() + offset, size);
+    return GRAPH_SUCCESS;
+  }
+  *external_data_ = Buffer::FromAlignedPtr(aligned_ptr, offset, size);
+  proto_msg->clear_data();
+  return GRAPH_SUCCESS;
+}
+
+void GeTensor::SerializeTo(proto::TensorDef &proto_msg) const {
+  auto src_msg = tensor_def_.GetProtoMsg();
+  if (src_msg == nullptr) {
+    return;
+  }
+  if (!IsExternalData()) {
+    proto_msg = *src_msg;
+    return;
+  }
+  *proto_msg.mutable_desc() = src_msg->desc();
+  proto_msg.set_data(external_data_->GetData(), external_data_->GetSize());
+}
+
 GeTensor GeTensor::Clone() const {
   GeTensor tensor;
-  tensor.tensor_def_.CopyValueFrom(tensor_def_);
+  auto proto_msg = tensor.tensor_def_.GetProtoMsg();
+  if (proto_msg != nullptr) {
+    SerializeTo(*proto_msg);
+  }
   return tensor;
 }
 
-GeTensor::GeTensor(const GeTensor &other) { tensor_def_ = other.tensor_def_; }
+GeTensor::GeTensor(const GeTensor &other) {
+  tensor_def_ = other.tensor_def_;
+  external_data_ = other.external_data_;
+}
 
 GeTensor &GeTensor::operator=(const GeTensor &other) {
   if (&other != this) {
     tensor_def_ = other.tensor_def_;
+    external_data_ = other.external_data_;
   }
   return *this;
 }
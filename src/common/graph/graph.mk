@@ -29,6 +29,7 @@ COMMON_LOCAL_SRC_FILES := \
     ./ge_tensor.cc \
     ./detail/attributes_holder.cc \
     ./utils/anchor_utils.cc \
+    ./utils/async_graph_dumper.cc \
     ./utils/graph_utils.cc \
     ./utils/ge_ir_utils.cc \
     ./utils/node_utils.cc \
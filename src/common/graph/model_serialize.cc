@@ -51,7 +51,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool ModelSerializeImp::Serialize
   GE_CHK_BOOL_EXEC(tensor_proto != nullptr, return false, "tensor_proto is null.");
 
   if (tensor->tensor_def_.GetProtoMsg() != nullptr) {
-    *tensor_proto = *tensor->tensor_def_.GetProtoMsg();
+    tensor->SerializeTo(*tensor_proto);
     return true;
   }
   return false;
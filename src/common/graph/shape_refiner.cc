@@ -16,8 +16,12 @@
 
 #include "graph/shape_refiner.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -30,6 +34,7 @@
 #include "external/graph/operator_factory.h"
 #include "framework/common/debug/ge_log.h"
 #include "graph/compute_graph.h"
+#include "graph/ge_local_context.h"
 #include "utils/node_utils.h"
 #include "utils/op_desc_utils.h"
 #include "utils/tensor_utils.h"
@@ -482,8 +487,7 @@ graphStatus ShapeRefiner::InferShapeAndType(const ConstNodePtr &node, Operator &
   return GRAPH_SUCCESS;
 }
 
-InferenceContextPtr CreateInferenceContext(const std::unordered_map<NodePtr, InferenceContextPtr> &context_map,
-                                           const NodePtr &node) {
+InferenceContextPtr CreateInferenceContext(const ShapeInferenceSession &session, const NodePtr &node) {
   if (node == nullptr) {
     GELOGE(GRAPH_FAILED, "node is null");
     return nullptr;
@@ -510,10 +514,8 @@ InferenceContextPtr CreateInferenceContext(const std::unordered_map<NodePtr, Inf
       continue;
     }
 
-    auto iter = context_map.find(input_node);
-    if (iter != context_map.end()) {
-      const auto &src_context = iter->second;
-      GE_IF_BOOL_EXEC(src_context == nullptr, GELOGE(GRAPH_FAILED, "src_context is null."); return nullptr);
+    auto src_context = session.GetContext(input_node);
+    if (src_context != nullptr) {
       GELOGD("node:%s get %ld marks from node:%s", node->GetName().c_str(), src_context->GetMarks().size(),
              input_node->GetName().c_str());
       for (auto mark : src_context->GetMarks()) {
@@ -543,16 +545,166 @@ InferenceContextPtr CreateInferenceContext(const std::unordered_map<NodePtr, Inf
 }
 
 namespace {
-std::unordered_map<NodePtr, InferenceContextPtr> context_map;
+ShapeInferenceSession &GetDefaultSession() {
+  static ShapeInferenceSession session;
+  return session;
 }
 
-GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void ShapeRefiner::ClearContextMap() { context_map.clear(); }
+// Nodes of InferNodes with the counters of their unfinished in nodes
+struct InferNodesState {
+  std::vector<std::vector<size_t>> out_indexes;
+  std::vector<size_t> pending_counts;
+  std::deque<size_t> ready_indexes;
+  size_t done_num = 0;
+  size_t running_num = 0;
+  graphStatus status = GRAPH_SUCCESS;
+  std::mutex mutex;
+  std::condition_variable cond;
+};
+
+void InitInferNodesState(const std::vector<NodePtr> &nodes, InferNodesState &state) {
+  std::unordered_map<const Node *, size_t> indexes;
+  indexes.reserve(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    indexes[nodes[i].get()] = i;
+  }
+  state.out_indexes.resize(nodes.size());
+  state.pending_counts.assign(nodes.size(), 0);
+  auto add_dependency = [&state, &indexes](const Node *in_node, size_t index) {
+    auto iter = indexes.find(in_node);
+    if (iter != indexes.end()) {
+      state.out_indexes[iter->second].emplace_back(index);
+      ++state.pending_counts[index];
+    }
+  };
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    for (const auto &in_node : nodes[i]->GetInAllNodes()) {
+      add_dependency(in_node.get(), i);
+    }
+    // the parent node updates the data nodes of its subgraphs before they are inferred
+    auto owner_graph = nodes[i]->GetOwnerComputeGraph();
+    if ((owner_graph != nullptr) && (owner_graph->GetParentNode() != nullptr)) {
+      add_dependency(owner_graph->GetParentNode().get(), i);
+    }
+    if (state.pending_counts[i] == 0) {
+      state.ready_indexes.emplace_back(i);
+    }
+  }
+}
+
+void RunInferNodes(const std::vector<NodePtr> &nodes, const ShapeInferenceSession::NodeInferFunc &infer_func,
+                   InferNodesState &state) {
+  std::unique_lock<std::mutex> lock(state.mutex);
+  while (true) {
+    state.cond.wait(lock, [&state]() {
+      return !state.ready_indexes.empty() || (state.status != GRAPH_SUCCESS) || (state.running_num == 0);
+    });
+    if ((state.status != GRAPH_SUCCESS) || state.ready_indexes.empty()) {
+      // failed, or all nodes are done, or the rest nodes are never ready since they are in a cycle
+      break;
+    }
+    size_t index = state.ready_indexes.front();
+    state.ready_indexes.pop_front();
+    ++state.running_num;
+    lock.unlock();
+    graphStatus ret = infer_func(nodes[index]);
+    lock.lock();
+    --state.running_num;
+    if (ret != GRAPH_SUCCESS) {
+      if (state.status == GRAPH_SUCCESS) {
+        state.status = ret;
+      }
+    } else {
+      ++state.done_num;
+      for (auto out_index : state.out_indexes[index]) {
+        if (--state.pending_counts[out_index] == 0) {
+          state.ready_indexes.emplace_back(out_index);
+        }
+      }
+    }
+    state.cond.notify_all();
+  }
+}
+}  // namespace
+
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY InferenceContextPtr
+ShapeInferenceSession::GetContext(const NodePtr &node) const {
+  // most graphs have no context at all, skip the lock for them
+  if (context_num_.load(std::memory_order_acquire) == 0) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = contexts_.find(node);
+  return (iter == contexts_.end()) ? nullptr : iter->second;
+}
+
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void ShapeInferenceSession::SetContext(const NodePtr &node, const InferenceContextPtr &context) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  (void)contexts_.emplace(node, context);
+  context_num_.store(contexts_.size(), std::memory_order_release);
+}
+
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void ShapeInferenceSession::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  contexts_.clear();
+  context_num_.store(0, std::memory_order_release);
+}
+
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ShapeInferenceSession::InferNodes(
+    const std::vector<NodePtr> &nodes, uint32_t thread_num, const NodeInferFunc &infer_func) {
+  GE_IF_BOOL_EXEC(infer_func == nullptr, GELOGE(GRAPH_FAILED, "infer func is null."); return GRAPH_FAILED);
+  if ((thread_num <= 1) || (nodes.size() <= 1)) {
+    for (const auto &node : nodes) {
+      graphStatus ret = infer_func(node);
+      if (ret != GRAPH_SUCCESS) {
+        return ret;
+      }
+    }
+    return GRAPH_SUCCESS;
+  }
+
+  InferNodesState state;
+  InitInferNodesState(nodes, state);
+  size_t worker_num = std::min(static_cast<size_t>(thread_num), nodes.size());
+  GELOGD("Infer %zu nodes with %zu threads, %zu nodes are ready at first.", nodes.size(), worker_num,
+         state.ready_indexes.size());
+  const GEThreadLocalContext &context = GetThreadLocalContext();
+  std::vector<std::thread> workers;
+  workers.reserve(worker_num - 1);
+  for (size_t i = 1; i < worker_num; ++i) {
+    workers.emplace_back([&nodes, &infer_func, &state, &context]() {
+      // infer funcs may read the options of the graph
+      GetThreadLocalContext() = context;
+      RunInferNodes(nodes, infer_func, state);
+    });
+  }
+  RunInferNodes(nodes, infer_func, state);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (state.status != GRAPH_SUCCESS) {
+    return state.status;
+  }
+  if (state.done_num != nodes.size()) {
+    GELOGE(GRAPH_FAILED, "Only %zu of %zu nodes are inferred, there is a cycle in the nodes.", state.done_num,
+           nodes.size());
+    return GRAPH_FAILED;
+  }
+  return GRAPH_SUCCESS;
+}
+
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void ShapeRefiner::ClearContextMap() { GetDefaultSession().Clear(); }
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ShapeRefiner::InferShapeAndType(const NodePtr &node) {
   return InferShapeAndType(node, true);
 }
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ShapeRefiner::InferShapeAndType(const NodePtr &node,
                                                                                            bool before_subgraph) {
+  return InferShapeAndType(node, before_subgraph, GetDefaultSession());
+}
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus
+ShapeRefiner::InferShapeAndType(const NodePtr &node, bool before_subgraph, ShapeInferenceSession &session) {
   GE_IF_BOOL_EXEC(node == nullptr, GELOGE(GRAPH_FAILED, "node is null."); return GRAPH_FAILED);
   if (node->Verify() != GRAPH_SUCCESS) {
     GELOGE(GRAPH_FAILED, "Verifying %s failed.", node->GetName().c_str());
@@ -563,7 +715,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ShapeRefiner::InferSh
 
   bool is_unknown_graph = node->GetOwnerComputeGraph()->GetGraphUnknownFlag();
   if (!is_unknown_graph) {
-    auto inference_context = CreateInferenceContext(context_map, node);
+    auto inference_context = CreateInferenceContext(session, node);
     if (inference_context == nullptr) {
       GELOGE(GRAPH_FAILED, "inference context is null");
       return GRAPH_FAILED;
@@ -586,7 +738,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus ShapeRefiner::InferSh
       if (!ctx_after_infer->GetOutputHandleShapesAndTypes().empty() || !ctx_after_infer->GetMarks().empty()) {
         GELOGD("[%s] set inference context after. mark:%zu", node->GetName().c_str(),
                ctx_after_infer->GetMarks().size());
-        (void)context_map.emplace(node, ctx_after_infer);
+        session.SetContext(node, ctx_after_infer);
       }
     }
   }
@@ -0,0 +1,129 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/async_graph_dumper.h"
+
+#include <chrono>
+
+#include "framework/common/debug/ge_log.h"
+
+namespace ge {
+namespace {
+const size_t kMaxPendingDumpNum = 16;
+const size_t kDumpWorkerNum = 2;
+}  // namespace
+
+AsyncGraphDumper &AsyncGraphDumper::Instance() {
+  static AsyncGraphDumper instance;
+  return instance;
+}
+
+AsyncGraphDumper::~AsyncGraphDumper() {
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    stopped_ = true;
+  }
+  task_cond_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+bool AsyncGraphDumper::Submit(DumpTask &&task) {
+  std::lock_guard<std::mutex> lk(mu_);
+  snapshot_cost_us_ += task.snapshot_cost_us;
+  if (tasks_.size() >= kMaxPendingDumpNum) {
+    for (auto &pending_task : tasks_) {
+      if (pending_task.graph_key == task.graph_key) {
+        GELOGW("Dump queue is full, %s replaces pending dump %s.", task.file_name.c_str(),
+               pending_task.file_name.c_str());
+        pending_task = std::move(task);
+        ++merged_num_;
+        return true;
+      }
+    }
+    GELOGW("Dump queue is full, %s is dropped.", task.file_name.c_str());
+    ++dropped_num_;
+    return false;
+  }
+
+  tasks_.emplace_back(std::move(task));
+  if (workers_.empty()) {
+    for (size_t i = 0; i < kDumpWorkerNum; ++i) {
+      workers_.emplace_back(&AsyncGraphDumper::Run, this);
+    }
+  }
+  task_cond_.notify_one();
+  return true;
+}
+
+void AsyncGraphDumper::Flush() {
+  std::unique_lock<std::mutex> lk(mu_);
+  done_cond_.wait(lk, [this]() { return tasks_.empty() && (running_num_ == 0); });
+  GELOGI("Graph dump flushed, written: %lu, merged: %lu, dropped: %lu, snapshot cost: %ld us, write cost: %ld us.",
+         written_num_, merged_num_, dropped_num_, snapshot_cost_us_, write_cost_us_);
+}
+
+uint64_t AsyncGraphDumper::GetWrittenNum() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return written_num_;
+}
+
+uint64_t AsyncGraphDumper::GetMergedNum() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return merged_num_;
+}
+
+uint64_t AsyncGraphDumper::GetDroppedNum() const {
+  std::lock_guard<std::mutex> lk(mu_);
+  return dropped_num_;
+}
+
+void AsyncGraphDumper::Run() {
+  while (true) {
+    DumpTask task;
+    {
+      std::unique_lock<std::mutex> lk(mu_);
+      task_cond_.wait(lk, [this]() { return stopped_ || !tasks_.empty(); });
+      // pending dumps are still written after stopped
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+      ++running_num_;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (task.write != nullptr) {
+      task.write();
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    GELOGD("Dump %s, snapshot cost: %ld us, write cost: %ld us.", task.file_name.c_str(), task.snapshot_cost_us,
+           static_cast<int64_t>(cost));
+
+    std::lock_guard<std::mutex> lk(mu_);
+    write_cost_us_ += cost;
+    ++written_num_;
+    --running_num_;
+    if (tasks_.empty() && (running_num_ == 0)) {
+      done_cond_.notify_all();
+    }
+  }
+}
+}  // namespace ge
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COMMON_GRAPH_UTILS_ASYNC_GRAPH_DUMPER_H_
+#define COMMON_GRAPH_UTILS_ASYNC_GRAPH_DUMPER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ge {
+///
+/// @ingroup ge_graph
+/// @brief Writes dumped graphs on background threads, so that dump points only pay for the snapshot of the graph.
+///        Pending dumps are bounded: a new dump replaces the pending dump of the same graph, or is dropped if there
+///        is none when the queue is full.
+///
+class AsyncGraphDumper {
+ public:
+  struct DumpTask {
+    std::string graph_key;  // dumps with the same key are merged under pressure
+    std::string file_name;
+    int64_t snapshot_cost_us = 0;
+    std::function<void()> write;
+  };
+
+  static AsyncGraphDumper &Instance();
+
+  AsyncGraphDumper(const AsyncGraphDumper &) = delete;
+  AsyncGraphDumper &operator=(const AsyncGraphDumper &) = delete;
+
+  ///
+  /// @brief Queue a dump, the workers are started by the first one
+  /// @return false if the dump is dropped
+  ///
+  bool Submit(DumpTask &&task);
+
+  ///
+  /// @brief Wait until all the submitted dumps are written or dropped
+  ///
+  void Flush();
+
+  uint64_t GetWrittenNum() const;
+  uint64_t GetMergedNum() const;
+  uint64_t GetDroppedNum() const;
+
+ private:
+  AsyncGraphDumper() = default;
+  ~AsyncGraphDumper();
+
+  void Run();
+
+  mutable std::mutex mu_;
+  std::condition_variable task_cond_;
+  std::condition_variable done_cond_;
+  std::deque<DumpTask> tasks_;
+  std::vector<std::thread> workers_;
+  size_t running_num_ = 0;
+  bool stopped_ = false;
+  uint64_t written_num_ = 0;
+  uint64_t merged_num_ = 0;
+  uint64_t dropped_num_ = 0;
+  int64_t snapshot_cost_us_ = 0;
+  int64_t write_cost_us_ = 0;
+};
+}  // namespace ge
+#endif  // COMMON_GRAPH_UTILS_ASYNC_GRAPH_DUMPER_H_
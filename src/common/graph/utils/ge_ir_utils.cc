@@ -15,7 +15,9 @@
  */
 
 #include "graph/utils/ge_ir_utils.h"
+#include <algorithm>
 #include <utility>
+#include <vector>
 #include "framework/common/debug/ge_log.h"
 
 namespace {
@@ -396,9 +398,17 @@ void OnnxUtils::AddAttrProtoForOpInAndOutDesc(onnx::NodeProto *node_proto, const
 void OnnxUtils::AddAttrProtoForAttrsFromAttrMap(
   const ::google::protobuf::Map<std::string, ::ge::proto::AttrDef> &attr_map, onnx::NodeProto *node_proto,
   const std::string &prefix, const std::string &suffix) {
+  // the attrs are written in the order of names, the order of a proto map changes when it is copied or erased
+  std::vector<const AttrDefPair *> items;
+  items.reserve(attr_map.size());
   for (const auto &item : attr_map) {
-    auto attr_name = item.first;
-    auto attr_def = item.second;
+    items.push_back(&item);
+  }
+  std::sort(items.begin(), items.end(),
+            [](const AttrDefPair *lhs, const AttrDefPair *rhs) { return lhs->first < rhs->first; });
+  for (const auto *item : items) {
+    const auto &attr_name = item->first;
+    const auto &attr_def = item->second;
     auto attr_type = attr_def.value_case();
     if (attr_type == ge::proto::AttrDef::kT) {
       const auto &tensor_def = attr_def.t();
@@ -690,6 +700,8 @@ bool OnnxUtils::EncodeGraph(const ConstComputeGraphPtr &graph, onnx::GraphProto
   return true;
 }
 
+int64_t OnnxUtils::GetDumpLevel() { return kDumpLevel; }
+
 bool OnnxUtils::ConvertGeModelToModelProto(const ge::Model &model, onnx::ModelProto &model_proto) {
   model_proto.set_model_version(model.GetVersion());
   model_proto.set_ir_version(onnx::IR_VERSION);
@@ -107,6 +107,9 @@ class OnnxUtils {
 
   static bool ConvertModelProtoToGeModel(const onnx::ModelProto &model_proto, ge::Model &model);
 
+  // the level of DUMP_GE_GRAPH that is read when the library is loaded and used by the conversion
+  static int64_t GetDumpLevel();
+
  private:
   // Part 1: from IR convert to ONNX Protobuf
   static void AddAttrProto(onnx::NodeProto *node_proto, onnx::AttributeProto_AttributeType type,
@@ -25,8 +25,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <queue>
 
@@ -34,12 +37,15 @@
 #include "debug/ge_util.h"
 #include "framework/common/debug/ge_log.h"
 #include "proto/ge_ir.pb.h"
+#include "utils/async_graph_dumper.h"
 #include "utils/attr_utils.h"
 #include "utils/ge_ir_utils.h"
 #include "utils/node_utils.h"
 #include "debug/ge_op_types.h"
 #include "external/ge/ge_api_types.h"
 #include "graph/debug/ge_attr_define.h"
+#include "graph/detail/model_serialize_imp.h"
+#include "graph/model_serialize.h"
 #include "graph/utils/op_desc_utils.h"
 #include "graph/utils/tensor_utils.h"
 
@@ -64,6 +70,151 @@ const char *const kDumpStrPartition = "partition";
 const char *const kDumpStrOptimizeSubgraph = "OptimizeSubGraph";
 const char *const kDumpStrSubgraphFunc = "sub_graph";
 const char *const kDumpStrAicpu = "Aicpu";
+#ifdef FMK_SUPPORT_DUMP
+const char *const kDumpGraphAsync = "DUMP_GRAPH_ASYNC";
+const char *const kDumpGraphFormat = "DUMP_GRAPH_FORMAT";
+const char *const kDumpFormatBinary = "pb";
+const int kFileAuthority = 0600;
+
+// dumps are written by background threads unless DUMP_GRAPH_ASYNC is 0
+bool IsAsyncDump() {
+  const char *async_dump = std::getenv(kDumpGraphAsync);
+  return (async_dump == nullptr) || (strcmp(async_dump, "0") != 0);
+}
+
+// dumps are written in text format unless DUMP_GRAPH_FORMAT is pb, which is converted to text offline if needed
+bool IsBinaryDump() {
+  const char *dump_format = std::getenv(kDumpGraphFormat);
+  return (dump_format != nullptr) && (strcmp(dump_format, kDumpFormatBinary) == 0);
+}
+
+// the option is read by the thread of the dump point, since options are thread local. It is read again until it is
+// set, so a dump before the options are set does not fix the size to 0 which means no limit
+int64_t GetMaxDumpFileSize() {
+  static std::atomic<int64_t> max_dump_file_size(0);
+  if (max_dump_file_size.load() == 0) {
+    string opt = "0";
+    // Can not check return value
+    (void)GetContext().GetOption(OPTION_GE_MAX_DUMP_FILE_SIZE, opt);
+    max_dump_file_size.store(static_cast<int64_t>(std::strtoll(opt.c_str(), nullptr, kBaseOfIntegerValue)));
+  }
+  return max_dump_file_size.load();
+}
+
+// the graphs may be dumped by several builds at the same time, 0 means no limit of the file number
+int GetMaxDumpFileNum() {
+  static std::atomic<int> max_dumpfile_num(0);
+  if (max_dumpfile_num.load() == 0) {
+    string opt = "0";
+    (void)GetContext().GetOption(OPTION_GE_MAX_DUMP_FILE_NUM, opt);
+    max_dumpfile_num.store(static_cast<int>(std::strtol(opt.c_str(), nullptr, kBaseOfIntegerValue)));
+  }
+  return max_dumpfile_num.load();
+}
+
+void WriteProtoToFile(const google::protobuf::Message &proto, const char *real_path, bool is_binary,
+                      int64_t max_file_size) {
+  int fd = open(real_path, O_WRONLY | O_CREAT | O_TRUNC, kFileAuthority);
+  if (fd < 0) {
+    GELOGE(GRAPH_FAILED, "fail to open the file: %s, %s", real_path, strerror(errno));
+    return;
+  }
+  bool ret = false;
+  if (is_binary) {
+    ret = proto.SerializeToFileDescriptor(fd);
+  } else {
+    google::protobuf::io::FileOutputStream *output = new (std::nothrow) FileOutputStream(fd);
+    if (output == nullptr) {
+      GELOGE(GRAPH_FAILED, "Output is nullptr");
+      GE_CHK_BOOL_EXEC(close(fd) == 0, return, "Close fileoutputstream failed");
+      return;
+    }
+    ret = google::protobuf::TextFormat::Print(proto, output);
+    delete output;
+    output = nullptr;
+  }
+  GE_CHK_BOOL_EXEC(close(fd) == 0, return, "Close fileoutputstream failed");
+  if (!ret) {
+    GELOGE(GRAPH_FAILED, "Fail to write the file: %s", real_path);
+    return;
+  }
+
+  struct stat file_stat;
+  if ((max_file_size != 0) && (stat(real_path, &file_stat) == 0) && (file_stat.st_size > max_file_size)) {
+    GELOGW("dump graph file size > maxDumpFileSize, maxDumpFileSize=%ld.", max_file_size);
+    GE_IF_BOOL_EXEC(std::remove(real_path) != 0, GELOGW("remove %s failed", real_path));
+  }
+}
+
+std::shared_ptr<ge::proto::ModelDef> SnapshotModel(const ge::Model &model, bool is_dump) {
+  auto ge_proto = ComGraphMakeShared<ge::proto::ModelDef>();
+  GE_CHECK_NOTNULL_EXEC(ge_proto, return nullptr);
+  ModelSerializeImp serialize_imp;
+  if (!serialize_imp.SerializeModel(model, ge_proto.get(), is_dump)) {
+    GELOGE(GRAPH_FAILED, "serialize model %s failed.", model.GetName().c_str());
+    return nullptr;
+  }
+  return ge_proto;
+}
+
+// drop the attrs that the onnx conversion does not write below DUMP_ALL, which are the data of tensors (e.g. the
+// weights of Const), strings (e.g. the framework defs) and bytes, so that the pending snapshot holds no weights.
+// The lists of strings are kept, the serializer stores the input and output names of ops in them
+void StripAttrsNotInOnnx(google::protobuf::Map<std::string, ge::proto::AttrDef> *attrs) {
+  for (auto it = attrs->begin(); it != attrs->end();) {
+    auto value_case = it->second.value_case();
+    if ((value_case == ge::proto::AttrDef::kS) || (value_case == ge::proto::AttrDef::kBt)) {
+      it = attrs->erase(it);
+      continue;
+    }
+    if (value_case == ge::proto::AttrDef::kT) {
+      it->second.mutable_t()->clear_data();
+    }
+    ++it;
+  }
+}
+
+std::shared_ptr<ge::proto::ModelDef> SnapshotModelForOnnx(const ge::Model &model) {
+  auto ge_proto = SnapshotModel(model, false);
+  if ((ge_proto == nullptr) || (OnnxUtils::GetDumpLevel() == OnnxUtils::DUMP_ALL)) {
+    return ge_proto;
+  }
+  for (auto &graph_def : *ge_proto->mutable_graph()) {
+    // the attrs of tensor descs are kept, their getters such as the origin format read the strings
+    for (auto &op_def : *graph_def.mutable_op()) {
+      StripAttrsNotInOnnx(op_def.mutable_attr());
+    }
+  }
+  return ge_proto;
+}
+
+std::shared_ptr<onnx::ModelProto> ConvertToOnnx(ge::proto::ModelDef &ge_proto) {
+  ge::Model model = ModelSerialize().UnserializeModel(ge_proto);
+  auto model_proto = ComGraphMakeShared<onnx::ModelProto>();
+  GE_CHECK_NOTNULL_EXEC(model_proto, return nullptr);
+  if (!OnnxUtils::ConvertGeModelToModelProto(model, *model_proto)) {
+    GELOGE(GRAPH_FAILED, "convert model %s to onnx failed.", model.GetName().c_str());
+    return nullptr;
+  }
+  return model_proto;
+}
+
+// write is called by the dump thread if the dump is async, otherwise it is called directly
+void SubmitDump(bool is_async, const std::string &graph_key, const std::string &file_path,
+                std::chrono::steady_clock::time_point snapshot_start, std::function<void()> &&write) {
+  if (!is_async) {
+    write();
+    return;
+  }
+  AsyncGraphDumper::DumpTask task;
+  task.graph_key = graph_key;
+  task.file_name = file_path;
+  task.snapshot_cost_us =
+    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - snapshot_start).count();
+  task.write = std::move(write);
+  (void)AsyncGraphDumper::Instance().Submit(std::move(task));
+}
+#endif
 };  // namespace
 
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY graphStatus GraphUtils::AddEdge(const OutDataAnchorPtr &src,
@@ -563,17 +714,12 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void GraphUtils::DumpGEGraph(cons
   }
 
   // file name
-  static int file_idx = 0;
+  static std::atomic<int> file_idx_counter(0);
   const int dump_graph_index_width = 5;
-  file_idx++;
+  int file_idx = ++file_idx_counter;
   GELOGD("Start to dump om txt: %d", file_idx);
 
-  static int max_dumpfile_num = 0;
-  if (max_dumpfile_num == 0) {
-    string opt = "0";
-    (void)GetContext().GetOption(OPTION_GE_MAX_DUMP_FILE_NUM, opt);
-    max_dumpfile_num = std::strtol(opt.c_str(), nullptr, kBaseOfIntegerValue);
-  }
+  int max_dumpfile_num = GetMaxDumpFileNum();
   if (max_dumpfile_num != 0 && file_idx > max_dumpfile_num) {
     GELOGW("dump graph file cnt > maxDumpFileNum, maxDumpFileCnt=%d.", max_dumpfile_num);
     return;
@@ -581,30 +727,29 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void GraphUtils::DumpGEGraph(cons
 
   std::stringstream stream_file_name;
   stream_file_name << "ge_proto_" << std::setw(dump_graph_index_width) << std::setfill('0') << file_idx;
-  stream_file_name << "_" << suffix << ".txt";
+  stream_file_name << "_" << suffix << (IsBinaryDump() ? ".pb" : ".txt");
   std::string proto_file = stream_file_name.str();
 
-  // Create buffer
+  // Snapshot the graph into proto, it is serialized to file later
+  auto snapshot_start = std::chrono::steady_clock::now();
+  GE_CHECK_NOTNULL_EXEC(graph, return);
   ge::Model model("", "");
   model.SetGraph(GraphUtils::CreateGraphFromComputeGraph(std::const_pointer_cast<ComputeGraph>(graph)));
-  Buffer buffer;
-  model.Save(buffer, true);
+  auto ge_proto = SnapshotModel(model, true);
+  GE_CHECK_NOTNULL_EXEC(ge_proto, return);
 
   // Write file
-  ge::proto::ModelDef ge_proto;
-  if (buffer.GetData() != nullptr) {
-    std::string str(reinterpret_cast<const char *>(buffer.GetData()), buffer.GetSize());
-    if (!ge_proto.ParseFromString(str)) {
-      GELOGE(GRAPH_FAILED, "parse from string failed.");
-      return;
-    }
-    char real_path[PATH_MAX] = {0x00};
-    GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(strlen(proto_file.c_str()) >= PATH_MAX, return, "file path is too longer!");
-    GE_IF_BOOL_EXEC(realpath(proto_file.c_str(), real_path) == nullptr,
-                    GELOGI("file %s does not exist, it will be created.", proto_file.c_str()));
-
-    GraphUtils::WriteProtoToTextFile(ge_proto, real_path);
-  }
+  char real_path[PATH_MAX] = {0x00};
+  GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(strlen(proto_file.c_str()) >= PATH_MAX, return, "file path is too longer!");
+  GE_IF_BOOL_EXEC(realpath(proto_file.c_str(), real_path) == nullptr,
+                  GELOGI("file %s does not exist, it will be created.", proto_file.c_str()));
+  std::string file_path = real_path;
+  bool is_binary = IsBinaryDump();
+  int64_t max_file_size = GetMaxDumpFileSize();
+  SubmitDump(IsAsyncDump(), graph->GetName() + "_ge_proto", file_path, snapshot_start,
+             [ge_proto, file_path, is_binary, max_file_size]() {
+               WriteProtoToFile(*ge_proto, file_path.c_str(), is_binary, max_file_size);
+             });
 #else
   GELOGW("need to define FMK_SUPPORT_DUMP for dump graph.");
 #endif
@@ -635,58 +780,18 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool GraphUtils::LoadGEGraph(cons
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void GraphUtils::WriteProtoToTextFile(
   const google::protobuf::Message &proto, const char *real_path) {
 #ifdef FMK_SUPPORT_DUMP
-  const int FILE_AUTHORITY = 0600;
-  int fd = open(real_path, O_WRONLY | O_CREAT | O_TRUNC, FILE_AUTHORITY);
-  if (fd < 0) {
-    GELOGE(GRAPH_FAILED, "fail to open the file: %s, %s", real_path, strerror(errno));
-    return;
-  }
-  google::protobuf::io::FileOutputStream *output = new (std::nothrow) FileOutputStream(fd);
-  if (output == nullptr) {
-    GELOGE(GRAPH_FAILED, "Output is nullptr");
-    if (close(fd) != 0) {
-      GELOGE(GRAPH_FAILED, "Close fileoutputstream failed");
-    }
-    return;
-  }
-  bool ret = google::protobuf::TextFormat::Print(proto, output);
-  if (!ret) {
-    GELOGE(GRAPH_FAILED, "Fail to write the file: %s", real_path);
-    delete output;
-    output = nullptr;
-    GE_CHK_BOOL_EXEC(close(fd) == 0, return, "Close fileoutputstream failed");
-    return;
-  }
-  delete output;
-  output = nullptr;
-  GE_CHK_BOOL_EXEC(close(fd) == 0, return, "Close fileoutputstream failed");
-
-  FILE *file = fopen(real_path, "rb");
-  if (file == nullptr) {
-    return;
-  }
-  if (fseek(file, 0L, SEEK_END) == 0) {
-    int64_t fileSize = ftell(file);
-    static int64_t maxDumpFileSize = 0;
-    if (maxDumpFileSize == 0) {
-      string opt = "0";
-      // Can not check return value
-      (void)GetContext().GetOption(OPTION_GE_MAX_DUMP_FILE_SIZE, opt);
-      maxDumpFileSize = atol(opt.c_str());
-    }
-    if (maxDumpFileSize != 0 && fileSize != -1 && fileSize > maxDumpFileSize) {
-      GELOGW("dump graph file size > maxDumpFileSize, maxDumpFileSize=%ld.", maxDumpFileSize);
-      GE_IF_BOOL_EXEC(std::remove(real_path) != 0, GELOGW("remove %s failed", real_path));
-      GE_CHK_BOOL_EXEC(fclose(file) == 0, return, "Fclose %s failed", real_path);
-      return;
-    }
-  }
-  GE_CHK_BOOL_EXEC(fclose(file) == 0, return, "Fclose fileoutputstream failed");
+  WriteProtoToFile(proto, real_path, false, GetMaxDumpFileSize());
 #else
   GELOGW("need to define FMK_SUPPORT_DUMP for dump graph.");
 #endif
 }
 
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void GraphUtils::FlushGraphDump() {
+#ifdef FMK_SUPPORT_DUMP
+  AsyncGraphDumper::Instance().Flush();
+#endif
+}
+
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool GraphUtils::ReadProtoFromTextFile(
   const char *file, google::protobuf::Message *proto) {
   if (file == nullptr || proto == nullptr) {
@@ -723,27 +828,33 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void GraphUtils::DumpGEGraphToOnn
     return;
   }
 
-  // 1.Get ge::onnx::ModelProto from ge::Model
+  /// 1.Get ge::onnx::ModelProto from ge::Model. If the dump is async, the graph is snapshot into ge proto, which is
+  /// much faster, and it is converted to onnx by the dump thread.
+  auto snapshot_start = std::chrono::steady_clock::now();
   ge::Model model("GE", "");
   std::shared_ptr<ge::ComputeGraph> compute_graph_ptr = ComGraphMakeShared<ge::ComputeGraph>(compute_graph);
   model.SetGraph(GraphUtils::CreateGraphFromComputeGraph(std::const_pointer_cast<ComputeGraph>(compute_graph_ptr)));
-  onnx::ModelProto model_proto;
-  if (!OnnxUtils::ConvertGeModelToModelProto(model, model_proto)) {
-    GELOGE(GRAPH_FAILED, "DumpGEGraphToOnnx failed.");
-    return;
+  bool is_async = IsAsyncDump();
+  std::shared_ptr<ge::proto::ModelDef> ge_proto;
+  std::shared_ptr<onnx::ModelProto> model_proto;
+  if (is_async) {
+    ge_proto = SnapshotModelForOnnx(model);
+    GE_CHECK_NOTNULL_EXEC(ge_proto, return);
+  } else {
+    model_proto = ComGraphMakeShared<onnx::ModelProto>();
+    GE_CHECK_NOTNULL_EXEC(model_proto, return);
+    if (!OnnxUtils::ConvertGeModelToModelProto(model, *model_proto)) {
+      GELOGE(GRAPH_FAILED, "DumpGEGraphToOnnx failed.");
+      return;
+    }
   }
 
   // 2.Set file name
-  static int file_index = 0;
-  file_index++;
+  static std::atomic<int> file_index_counter(0);
+  int file_index = ++file_index_counter;
   GELOGD("Start to dump ge onnx file: %d", file_index);
 
-  static int max_dumpfile_num = 0;
-  if (max_dumpfile_num == 0) {
-    string opt = "0";
-    (void)GetContext().GetOption(OPTION_GE_MAX_DUMP_FILE_NUM, opt);
-    max_dumpfile_num = std::strtol(opt.c_str(), nullptr, kBaseOfIntegerValue);
-  }
+  int max_dumpfile_num = GetMaxDumpFileNum();
   if (max_dumpfile_num != 0 && file_index > max_dumpfile_num) {
     GELOGW("dump graph file cnt > maxDumpFileNum, maxDumpFileNum=%d.", max_dumpfile_num);
     return;
@@ -754,7 +865,7 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void GraphUtils::DumpGEGraphToOnn
   std::stringstream stream_file_name;
   stream_file_name << "ge_onnx_" << std::setw(5) << std::setfill('0') << file_index;
   stream_file_name << "_graph_" << compute_graph.GetGraphID();
-  stream_file_name << "_" << suffix << ".pbtxt";
+  stream_file_name << "_" << suffix << (IsBinaryDump() ? ".pb" : ".pbtxt");
   std::string proto_file = stream_file_name.str();
   if ((proto_file.length()) >= NAME_MAX) {
     GELOGE(GRAPH_FAILED, "File name is too longer!");
@@ -779,7 +890,16 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void GraphUtils::DumpGEGraphToOnn
   }
 
   // 3. Serialize to file in current path
-  GraphUtils::WriteProtoToTextFile(model_proto, real_path.get());
+  std::string file_path = real_path.get();
+  bool is_binary = IsBinaryDump();
+  int64_t max_file_size = GetMaxDumpFileSize();
+  SubmitDump(is_async, compute_graph.GetName() + "_onnx", file_path, snapshot_start,
+             [ge_proto, model_proto, file_path, is_binary, max_file_size]() {
+               auto onnx_proto = (model_proto != nullptr) ? model_proto : ConvertToOnnx(*ge_proto);
+               if (onnx_proto != nullptr) {
+                 WriteProtoToFile(*onnx_proto, file_path.c_str(), is_binary, max_file_size);
+               }
+             });
 #else
   GELOGW("need to define FMK_SUPPORT_DUMP for dump graph.");
 #endif
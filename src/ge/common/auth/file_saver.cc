@@ -18,18 +18,66 @@
 
 #include <fcntl.h>
 #include <securec.h>
+#include <sys/stat.h>
 #include <unistd.h>
+#include <algorithm>
+#include <cerrno>
 #include <cstdlib>
 #include <fstream>
+#include <future>
+#include <iterator>
 #include <vector>
 
+#include "common/cache_file_util.h"
+#include "common/content_hash_index.h"
 #include "common/math/math_util.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/debug/log.h"
 #include "framework/common/util.h"
+#include "common/thread_pool.h"
+#include "external/ge/ge_api_types.h"
+#include "graph/ge_context.h"
 
 namespace {
 const int kFileOpSuccess = 0;
+const size_t kWriteChunkSize = 16 * 1024 * 1024;         // bytes of a positioned write
+const size_t kMinParallelWriteSize = 64 * 1024 * 1024;  // partitions smaller than it are written in one thread
+const uint32_t kMaxWriteThreadNum = 4;
+// the checksum file beside the om file, see OmChunkChecksum
+const char *const kChecksumSuffix = ".checksum";
+const char *const kChecksumOptionOn = "true";
+const uint32_t kChecksumFileMagic = 0x434F4547;  // "GEOC"
+const uint32_t kChecksumFileVersion = 2;
+
+struct WriteBlock {
+  const void *data;
+  size_t size;
+  int64_t offset;
+};
+
+// size and modify time of the om file when its checksums are saved, a checksum file left by another save of the om
+// file does not match it
+struct OmFileStamp {
+  uint64_t size;
+  int64_t mtime_sec;
+  int64_t mtime_nsec;
+};
+
+bool IsChunkChecksumOn() {
+  std::string option;
+  return (ge::GetContext().GetOption(ge::OM_CHUNK_CHECKSUM, option) == ge::GRAPH_SUCCESS) &&
+         (option == kChecksumOptionOn);
+}
+
+bool GetOmFileStamp(const std::string &file_path, OmFileStamp &stamp) {
+  struct stat file_stat;
+  if (stat(file_path.c_str(), &file_stat) != 0) {
+    return false;
+  }
+  stamp = {static_cast<uint64_t>(file_stat.st_size), static_cast<int64_t>(file_stat.st_mtim.tv_sec),
+           static_cast<int64_t>(file_stat.st_mtim.tv_nsec)};
+  return true;
+}
 }  //  namespace
 
 namespace ge {
@@ -67,6 +115,26 @@ Status FileSaver::WriteData(const void *data, uint32_t size, int32_t fd) {
   return SUCCESS;
 }
 
+Status FileSaver::WriteDataAt(const void *data, size_t size, int32_t fd, int64_t offset) {
+  GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(size == 0 || data == nullptr, return PARAM_INVALID);
+
+  auto buff = static_cast<const uint8_t *>(data);
+  while (size > 0) {
+    ssize_t write_count = pwrite(fd, buff, size, static_cast<off_t>(offset));
+    if (write_count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (write_count <= 0) {
+      GELOGE(FAILED, "Write data at offset %ld failed, left size %zu, %s", offset, size, strerror(errno));
+      return FAILED;
+    }
+    buff += write_count;
+    size -= static_cast<size_t>(write_count);
+    offset += write_count;
+  }
+  return SUCCESS;
+}
+
 Status FileSaver::SaveWithFileHeader(const std::string &file_path, const ModelFileHeader &file_header, const void *data,
                                      int len) {
   if (data == nullptr || len <= 0) {
@@ -103,28 +171,138 @@ Status FileSaver::SaveWithFileHeader(const std::string &file_path, const ModelFi
     !partition_datas.empty() && model_partition_table.num != 0 && model_partition_table.num == partition_datas.size(),
     FAILED, "Invalid param:partition data size is (%u), model_partition_table.num is (%zu).", model_partition_table.num,
     partition_datas.size());
+  // The header, the partition table and the partitions are placed one after another, the partitions are split
+  // into chunks written by positioned writes, so that the large ones are written in parallel
+  uint32_t table_size = static_cast<uint32_t>(SIZE_OF_MODEL_PARTITION_TABLE(model_partition_table));
+  int64_t offset = static_cast<int64_t>(sizeof(ModelFileHeader));
+  std::vector<WriteBlock> blocks = {{&file_header, sizeof(ModelFileHeader), 0},
+                                    {&model_partition_table, table_size, offset}};
+  offset += table_size;
+  size_t partition_size = 0;
+  for (const auto &partition_data : partition_datas) {
+    GE_CHK_BOOL_RET_STATUS(partition_data.data != nullptr && partition_data.size != 0, FAILED,
+                           "Invalid partition %d, size %u.", static_cast<int>(partition_data.type),
+                           partition_data.size);
+    for (size_t pos = 0; pos < partition_data.size; pos += kWriteChunkSize) {
+      size_t size = std::min(kWriteChunkSize, static_cast<size_t>(partition_data.size) - pos);
+      blocks.push_back({partition_data.data + pos, size, offset + static_cast<int64_t>(pos)});
+    }
+    offset += partition_data.size;
+    partition_size += partition_data.size;
+  }
+
+  // The checksums are computed by the writers of the blocks, so the large partitions are hashed in parallel too
+  bool with_checksum = IsChunkChecksumOn();
+  std::vector<OmChunkChecksum> checksums(with_checksum ? blocks.size() : 0);
+  auto write_block = [&blocks, &checksums](int32_t fd, size_t index) -> Status {
+    const WriteBlock &block = blocks[index];
+    GE_CHK_STATUS_RET_NOLOG(WriteDataAt(block.data, block.size, fd, block.offset));
+    if (!checksums.empty()) {
+      checksums[index] = {static_cast<uint64_t>(block.offset), block.size, ContentHash(block.data, block.size)};
+    }
+    return SUCCESS;
+  };
+
   // Open file
   int32_t fd = 0;
   GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(OpenFile(fd, file_path) != SUCCESS, return FAILED);
   Status ret = SUCCESS;
-  do {
-    // Write file header
-    GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(
-      WriteData(static_cast<const void *>(&file_header), sizeof(ModelFileHeader), fd) != SUCCESS, ret = FAILED; break);
-    // Write model partition table
-    uint32_t table_size = static_cast<uint32_t>(SIZE_OF_MODEL_PARTITION_TABLE(model_partition_table));
-    GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(
-      WriteData(static_cast<const void *>(&model_partition_table), table_size, fd) != SUCCESS, ret = FAILED; break);
-    // Write partition data
-    for (const auto &partitionData : partition_datas) {
-      GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(
-        WriteData(static_cast<const void *>(partitionData.data), partitionData.size, fd) != SUCCESS, ret = FAILED;
-        break);
+  if (partition_size < kMinParallelWriteSize) {
+    for (size_t i = 0; i < blocks.size(); ++i) {
+      GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(write_block(fd, i) != SUCCESS, ret = FAILED; break);
     }
-  } while (0);
+  } else {
+    uint32_t thread_num = std::min(kMaxWriteThreadNum, static_cast<uint32_t>(blocks.size()));
+    GELOGI("Write %zu bytes of partitions by %zu blocks in %u threads.", partition_size, blocks.size(), thread_num);
+    ThreadPool executor(thread_num);
+    std::vector<std::future<Status>> vector_future;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+      const WriteBlock &block = blocks[i];
+      std::future<Status> f = executor.commit([fd, i, &write_block]() -> Status { return write_block(fd, i); });
+      if (!f.valid()) {
+        GELOGE(FAILED, "Commit the write of offset %ld failed.", block.offset);
+        ret = FAILED;
+        break;
+      }
+      vector_future.push_back(std::move(f));
+    }
+    for (auto &f : vector_future) {
+      if (f.get() != SUCCESS) {
+        ret = FAILED;
+      }
+    }
+  }
   // Close file
   GE_CHK_BOOL_RET_STATUS(mmClose(fd) == EN_OK, FAILED, "Close file failed.");
-  return ret;
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  return SaveChecksumFile(file_path, checksums);
+}
+
+Status FileSaver::SaveChecksumFile(const std::string &file_path, const std::vector<OmChunkChecksum> &checksums) {
+  if (checksums.empty()) {
+    return SUCCESS;
+  }
+  std::string checksum_path = file_path + kChecksumSuffix;
+  OmFileStamp stamp;
+  GE_CHK_BOOL_RET_STATUS(GetOmFileStamp(file_path, stamp), FAILED, "Stat om file %s failed.", file_path.c_str());
+  std::vector<std::pair<const void *, uint64_t>> blocks = {
+      {&stamp, sizeof(OmFileStamp)}, {checksums.data(), checksums.size() * sizeof(OmChunkChecksum)}};
+  Status ret = WriteCacheFile(checksum_path, kChecksumFileMagic, kChecksumFileVersion, blocks);
+  GE_CHK_BOOL_RET_STATUS(ret == SUCCESS, FAILED, "Save checksum file %s failed.", checksum_path.c_str());
+  GELOGI("Save checksums of %zu blocks to %s.", checksums.size(), checksum_path.c_str());
+  return SUCCESS;
+}
+
+Status FileSaver::CheckChecksumFile(const std::string &file_path, const void *data, size_t size) {
+  std::string checksum_path = file_path + kChecksumSuffix;
+  std::ifstream ifs(checksum_path, std::ifstream::binary);
+  if (!ifs.is_open()) {
+    return SUCCESS;
+  }
+  std::vector<char> content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  ifs.close();
+
+  CacheFileHeader header = {0, 0, 0};
+  if (content.size() >= sizeof(CacheFileHeader)) {
+    GE_CHK_BOOL_RET_STATUS(memcpy_s(&header, sizeof(header), content.data(), sizeof(header)) == EOK, FAILED,
+                           "Copy header of %s failed.", checksum_path.c_str());
+  }
+  size_t payload_size = content.size() - std::min(content.size(), sizeof(CacheFileHeader));
+  if ((header.magic != kChecksumFileMagic) || (header.version != kChecksumFileVersion) ||
+      (header.length != payload_size) || (payload_size < sizeof(OmFileStamp)) ||
+      ((payload_size - sizeof(OmFileStamp)) % sizeof(OmChunkChecksum) != 0)) {
+    GELOGW("Checksum file %s is not of version %u, skip it.", checksum_path.c_str(), kChecksumFileVersion);
+    return SUCCESS;
+  }
+  const char *payload = content.data() + sizeof(CacheFileHeader);
+  OmFileStamp saved_stamp;
+  OmFileStamp stamp;
+  GE_CHK_BOOL_RET_STATUS(memcpy_s(&saved_stamp, sizeof(saved_stamp), payload, sizeof(OmFileStamp)) == EOK, FAILED,
+                         "Copy stamp of %s failed.", checksum_path.c_str());
+  if (!GetOmFileStamp(file_path, stamp) || (stamp.size != saved_stamp.size) || (stamp.size != size) ||
+      (stamp.mtime_sec != saved_stamp.mtime_sec) || (stamp.mtime_nsec != saved_stamp.mtime_nsec)) {
+    GELOGW("Checksum file %s does not belong to om file %s, skip it.", checksum_path.c_str(), file_path.c_str());
+    return SUCCESS;
+  }
+
+  size_t num = (payload_size - sizeof(OmFileStamp)) / sizeof(OmChunkChecksum);
+  std::vector<OmChunkChecksum> checksums(num);
+  GE_CHK_BOOL_RET_STATUS(memcpy_s(checksums.data(), num * sizeof(OmChunkChecksum), payload + sizeof(OmFileStamp),
+                                  num * sizeof(OmChunkChecksum)) == EOK,
+                         FAILED, "Copy checksums of %s failed.", checksum_path.c_str());
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+  for (const auto &checksum : checksums) {
+    if ((checksum.offset > size) || (checksum.size > size - checksum.offset) ||
+        (ContentHash(bytes + checksum.offset, checksum.size) != checksum.hash)) {
+      GELOGE(GE_EXEC_READ_MODEL_FILE_FAILED, "Chunk of %lu bytes at offset %lu of om file %s does not match %s.",
+             checksum.size, checksum.offset, file_path.c_str(), checksum_path.c_str());
+      return GE_EXEC_READ_MODEL_FILE_FAILED;
+    }
+  }
+  GELOGI("Verify %zu chunks of om file %s.", num, file_path.c_str());
+  return SUCCESS;
 }
 
 Status FileSaver::SaveToBuffWithFileHeader(const ModelFileHeader &file_header,
@@ -262,6 +440,15 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status FileSaver::SaveToFile(co
     GELOGE(FAILED, "Close file failed.");
     ret = FAILED;
   }
-  return ret;
+  if ((ret != SUCCESS) || !IsChunkChecksumOn()) {
+    return ret;
+  }
+  std::vector<OmChunkChecksum> checksums;
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+  for (size_t pos = 0; pos < static_cast<size_t>(len); pos += kWriteChunkSize) {
+    size_t size = std::min(kWriteChunkSize, static_cast<size_t>(len) - pos);
+    checksums.push_back({static_cast<uint64_t>(pos), size, ContentHash(bytes + pos, size)});
+  }
+  return SaveChecksumFile(file_path, checksums);
 }
 }  //  namespace ge
@@ -60,6 +60,19 @@ struct ProcOut {
 namespace ge {
 using std::string;
 
+///
+/// @ingroup domi_common
+/// @brief Record of the checksum file "<om file>.checksum" written beside the om file when the option
+///        ge.omChunkChecksum is "true". The file is a CacheFileHeader followed by the size and modify time of the
+///        om file and the records of the file header, the partition table and each chunk of the partitions. The om
+///        file is not changed, the records are verified when it is loaded, see FileSaver::CheckChecksumFile.
+///
+struct OmChunkChecksum {
+  uint64_t offset;
+  uint64_t size;
+  uint64_t hash;  // ContentHash of the block
+};
+
 class FileSaver {
  public:
   ///
@@ -79,6 +92,16 @@ class FileSaver {
 
   static Status SaveToFile(const string &file_path, const void *data, int len);
 
+  ///
+  /// @ingroup domi_common
+  /// @brief verify the data of om file by the checksum file beside it, if there is one
+  /// @param [in] file_path  om file path
+  /// @param [in] data  data read from om file
+  /// @param [in] size  byte size of data
+  /// @return SUCCESS if there is no checksum file, it is left by another save or all the chunks match
+  ///
+  static Status CheckChecksumFile(const std::string &file_path, const void *data, size_t size);
+
  protected:
   ///
   /// @ingroup domi_common
@@ -89,6 +112,13 @@ class FileSaver {
 
   static Status WriteData(const void *data, uint32_t size, int32_t fd);
 
+  ///
+  /// @ingroup domi_common
+  /// @brief write data at offset of the file, partial writes are continued
+  /// @return Status  result
+  ///
+  static Status WriteDataAt(const void *data, size_t size, int32_t fd, int64_t offset);
+
   static Status OpenFile(int32_t &fd, const std::string &file_path);
 
   ///
@@ -106,6 +136,15 @@ class FileSaver {
   static Status SaveWithFileHeader(const std::string &file_path, const ModelFileHeader &file_header,
                                    ModelPartitionTable &model_partition_table,
                                    const std::vector<ModelPartition> &partition_datas);
+
+  ///
+  /// @ingroup domi_common
+  /// @brief save the checksums of om file after it is closed, nothing is written if there is none
+  /// @param [in] file_path  om file path
+  /// @param [in] checksums  checksums of the blocks of om file
+  /// @return Status  result
+  ///
+  static Status SaveChecksumFile(const std::string &file_path, const std::vector<OmChunkChecksum> &checksums);
 };
 }  // namespace ge
 #endif  // GE_COMMON_AUTH_FILE_SAVER_H_
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/cache_file_util.h"
+
+#include <unistd.h>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#include "common/content_hash_index.h"
+#include "framework/common/debug/ge_log.h"
+
+namespace ge {
+namespace {
+const uint64_t kDigestSecondSeed = 0x9E3779B97F4A7C15ULL;
+}  // namespace
+
+std::string DigestToString(const void *data, size_t size) {
+  char digest[33] = {0};  // two 64-bit hash in hex
+  (void)snprintf(digest, sizeof(digest), "%016" PRIx64 "%016" PRIx64, ContentHash(data, size),
+                 ContentHash(data, size, kDigestSecondSeed));
+  return std::string(digest);
+}
+
+void AppendTensorDesc(const GeTensorDesc &desc, std::stringstream &ss) {
+  ss << static_cast<int32_t>(desc.GetDataType()) << ',' << static_cast<int32_t>(desc.GetFormat()) << ','
+     << static_cast<int32_t>(desc.GetOriginFormat()) << '[';
+  for (auto dim : desc.GetShape().GetDims()) {
+    ss << dim << ',';
+  }
+  ss << "][";
+  for (auto dim : desc.GetOriginShape().GetDims()) {
+    ss << dim << ',';
+  }
+  ss << "];";
+}
+
+Status WriteCacheFile(const std::string &path, uint32_t magic, uint32_t version, const void *data, uint64_t size) {
+  return WriteCacheFile(path, magic, version, {{data, size}});
+}
+
+Status WriteCacheFile(const std::string &path, uint32_t magic, uint32_t version,
+                      const std::vector<std::pair<const void *, uint64_t>> &blocks) {
+  uint64_t size = 0;
+  for (const auto &block : blocks) {
+    size += block.second;
+  }
+  // a file may be written by several processes or threads at the same time
+  std::string temp_path = path + "." + std::to_string(getpid()) + "_" +
+                          std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+  std::ofstream ofs(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!ofs.is_open()) {
+    GELOGW("Failed to open cache file %s.", temp_path.c_str());
+    return FAILED;
+  }
+  CacheFileHeader header = {magic, version, size};
+  (void)ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  for (const auto &block : blocks) {
+    (void)ofs.write(reinterpret_cast<const char *>(block.first), block.second);
+  }
+  ofs.close();
+  if (!ofs.good() || (rename(temp_path.c_str(), path.c_str()) != 0)) {
+    GELOGW("Failed to write cache file %s.", path.c_str());
+    (void)remove(temp_path.c_str());
+    return FAILED;
+  }
+  return SUCCESS;
+}
+}  // namespace ge
@@ -0,0 +1,88 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_COMMON_CACHE_FILE_UTIL_H_
+#define GE_COMMON_CACHE_FILE_UTIL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "framework/common/ge_inner_error_codes.h"
+#include "graph/ge_tensor.h"
+
+namespace ge {
+///
+/// @ingroup ge_common
+/// @brief Header of the on-disk cache files, the payload of length bytes follows it
+///
+struct CacheFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t length;
+};
+
+///
+/// @ingroup ge_common
+/// @brief 128-bit digest of a memory block in hex, made of two 64-bit content hashes with different seeds
+/// @param [in] data start of the memory block, may be null when size is 0
+/// @param [in] size byte size of the memory block
+/// @return digest string of 32 characters
+///
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY std::string DigestToString(const void *data, size_t size);
+
+///
+/// @ingroup ge_common
+/// @brief Append data type, formats, shape and origin shape of desc to the key material of a cache entry
+/// @param [in] desc
+/// @param [in|out] ss
+///
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY void AppendTensorDesc(const GeTensorDesc &desc,
+                                                                     std::stringstream &ss);
+
+///
+/// @ingroup ge_common
+/// @brief Write a cache file of header and data. The file is written to a temp file unique to the process and
+///        thread first and renamed to path then, so a broken file is never seen by other builds.
+/// @param [in] path
+/// @param [in] magic
+/// @param [in] version
+/// @param [in] data
+/// @param [in] size
+/// @return Status
+///
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Status WriteCacheFile(const std::string &path, uint32_t magic,
+                                                                     uint32_t version, const void *data,
+                                                                     uint64_t size);
+
+///
+/// @ingroup ge_common
+/// @brief Write a cache file of header and the data blocks one after another, see the overload above
+/// @param [in] path
+/// @param [in] magic
+/// @param [in] version
+/// @param [in] blocks start and byte size of each data block
+/// @return Status
+///
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Status WriteCacheFile(
+    const std::string &path, uint32_t magic, uint32_t version,
+    const std::vector<std::pair<const void *, uint64_t>> &blocks);
+}  // namespace ge
+
+#endif  // GE_COMMON_CACHE_FILE_UTIL_H_
@@ -0,0 +1,135 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/content_hash_index.h"
+
+#include <cstring>
+
+namespace ge {
+namespace {
+const uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+const uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+const uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+const size_t kStripeSize = 32;
+
+inline uint64_t RotateLeft(uint64_t value, uint32_t bits) { return (value << bits) | (value >> (64 - bits)); }
+
+// the hosts we run on are little endian, memcpy keeps the unaligned loads well defined
+inline uint64_t Read64(const uint8_t *ptr) {
+  uint64_t value;
+  (void)memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+inline uint32_t Read32(const uint8_t *ptr) {
+  uint32_t value;
+  (void)memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+inline uint64_t Round(uint64_t acc, uint64_t input) {
+  acc += input * kPrime2;
+  acc = RotateLeft(acc, 31);
+  return acc * kPrime1;
+}
+
+inline uint64_t MergeRound(uint64_t acc, uint64_t value) {
+  acc ^= Round(0, value);
+  return acc * kPrime1 + kPrime4;
+}
+}  // namespace
+
+uint64_t ContentHash(const void *data, size_t size, uint64_t seed) {
+  const uint8_t *ptr = static_cast<const uint8_t *>(data);
+  const uint8_t *const end = ptr + size;
+  uint64_t hash;
+
+  if (size >= kStripeSize) {
+    // four independent lanes, the compiler is free to keep them in vector registers
+    uint64_t v1 = seed + kPrime1 + kPrime2;
+    uint64_t v2 = seed + kPrime2;
+    uint64_t v3 = seed;
+    uint64_t v4 = seed - kPrime1;
+    const uint8_t *const limit = end - kStripeSize;
+    do {
+      v1 = Round(v1, Read64(ptr));
+      v2 = Round(v2, Read64(ptr + 8));
+      v3 = Round(v3, Read64(ptr + 16));
+      v4 = Round(v4, Read64(ptr + 24));
+      ptr += kStripeSize;
+    } while (ptr <= limit);
+
+    hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+    hash = MergeRound(hash, v1);
+    hash = MergeRound(hash, v2);
+    hash = MergeRound(hash, v3);
+    hash = MergeRound(hash, v4);
+  } else {
+    hash = seed + kPrime5;
+  }
+
+  hash += static_cast<uint64_t>(size);
+  while (ptr + sizeof(uint64_t) <= end) {
+    hash ^= Round(0, Read64(ptr));
+    hash = RotateLeft(hash, 27) * kPrime1 + kPrime4;
+    ptr += sizeof(uint64_t);
+  }
+  if (ptr + sizeof(uint32_t) <= end) {
+    hash ^= static_cast<uint64_t>(Read32(ptr)) * kPrime1;
+    hash = RotateLeft(hash, 23) * kPrime2 + kPrime3;
+    ptr += sizeof(uint32_t);
+  }
+  while (ptr < end) {
+    hash ^= static_cast<uint64_t>(*ptr) * kPrime5;
+    hash = RotateLeft(hash, 11) * kPrime1;
+    ++ptr;
+  }
+
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+bool ContentHashIndex::FindOrInsert(const void *data, size_t size, const std::vector<int64_t> &tags, size_t &id) {
+  uint64_t hash = ContentHash(data, size);
+  hash = ContentHash(tags.data(), tags.size() * sizeof(int64_t), hash);
+  auto &bucket = entries_[hash];
+  for (const auto &entry : bucket) {
+    if ((entry.size != size) || (entry.tags != tags)) {
+      continue;
+    }
+    ++full_compare_count_;
+    if ((size == 0) || (memcmp(entry.data, data, size) == 0)) {
+      id = entry.id;
+      return true;
+    }
+  }
+  bucket.emplace_back(Entry{static_cast<const uint8_t *>(data), size, tags, id});
+  ++entry_num_;
+  return false;
+}
+
+void ContentHashIndex::Clear() {
+  entries_.clear();
+  entry_num_ = 0;
+  full_compare_count_ = 0;
+}
+}  // namespace ge
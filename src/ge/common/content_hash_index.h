@@ -0,0 +1,76 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_COMMON_CONTENT_HASH_INDEX_H_
+#define GE_COMMON_CONTENT_HASH_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "graph/types.h"
+
+namespace ge {
+///
+/// @ingroup ge_common
+/// @brief 64-bit content hash of a memory block (xxHash64 algorithm)
+/// @param [in] data start of the memory block, may be null when size is 0
+/// @param [in] size byte size of the memory block
+/// @param [in] seed hash seed
+/// @return hash value
+///
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY uint64_t ContentHash(const void *data, size_t size,
+                                                                    uint64_t seed = 0);
+
+///
+/// @ingroup ge_common
+/// @brief Index of memory blocks by content. The blocks are compared by hash first, the full content is compared
+///        only when the hashes are equal. The index does not own the memory, the caller must keep the registered
+///        blocks alive and unchanged while the index is used.
+///
+class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY ContentHashIndex {
+ public:
+  ///
+  /// @brief Find the block with the same content and tags, or register the block if there is none
+  /// @param [in] data start of the memory block
+  /// @param [in] size byte size of the memory block
+  /// @param [in] tags extra values which must be equal too, e.g. data type, format and shape
+  /// @param [in|out] id in: the id to register the block with; out: the id of the block found
+  /// @return true if a block with the same content was registered before
+  ///
+  bool FindOrInsert(const void *data, size_t size, const std::vector<int64_t> &tags, size_t &id);
+
+  size_t Size() const { return entry_num_; }
+  size_t FullCompareCount() const { return full_compare_count_; }
+
+  void Clear();
+
+ private:
+  struct Entry {
+    const uint8_t *data;
+    size_t size;
+    std::vector<int64_t> tags;
+    size_t id;
+  };
+
+  std::unordered_map<uint64_t, std::vector<Entry>> entries_;
+  size_t entry_num_ = 0;
+  size_t full_compare_count_ = 0;
+};
+}  // namespace ge
+
+#endif  // GE_COMMON_CONTENT_HASH_INDEX_H_
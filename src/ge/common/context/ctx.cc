@@ -18,8 +18,19 @@
 
 using ge::OmgContext;
 namespace domi {
+namespace {
+thread_local OmgContext *bound_context = nullptr;
+}  // namespace
+
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY OmgContext &GetContext() {
+  if (bound_context != nullptr) {
+    return *bound_context;
+  }
   static OmgContext context;
   return context;
 }
+
+FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY void BindContext(OmgContext *context) { bound_context = context; }
+
+FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY OmgContext *GetBoundContext() { return bound_context; }
 }  // namespace domi
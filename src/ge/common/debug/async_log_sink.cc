@@ -0,0 +1,231 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/debug/async_log_sink.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace ge {
+namespace {
+const char *const kEnvAsyncLog = "GE_ASYNC_LOG";
+// must be power of 2
+const uint64_t kLogSlotNum = 2048;
+const size_t kMaxLogLength = 1024;
+const uint32_t kFlushIntervalMs = 5;
+}  // namespace
+
+struct AsyncLogSink::LogSlot {
+  // the slot is free to write if seq == pos, and ready to read if seq == pos + 1
+  std::atomic<uint64_t> seq;
+  int module_id;
+  int level;
+  char msg[kMaxLogLength];
+};
+
+AsyncLogSink &AsyncLogSink::Instance() {
+  static AsyncLogSink instance;
+  return instance;
+}
+
+AsyncLogSink::AsyncLogSink()
+    : enqueue_pos_(0),
+      dequeue_pos_(0),
+      dropped_num_(0),
+      reported_dropped_num_(0),
+      writer_num_(0),
+      flushed_pos_(0),
+      stopped_num_(0),
+      start_count_(0),
+      running_(false) {}
+
+AsyncLogSink::~AsyncLogSink() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (start_count_ == 0) {
+      return;
+    }
+    start_count_ = 1;
+  }
+  Stop();
+}
+
+Status AsyncLogSink::Start() {
+  const char *env = std::getenv(kEnvAsyncLog);
+  return Acquire((env != nullptr) && (strcmp(env, "1") == 0));
+}
+
+Status AsyncLogSink::ForceStart() { return Acquire(true); }
+
+Status AsyncLogSink::Acquire(bool start_worker) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++start_count_;
+  if (!start_worker || running_) {
+    return SUCCESS;
+  }
+  return StartWorker();
+}
+
+Status AsyncLogSink::StartWorker() {
+  if (slots_ == nullptr) {
+    slots_.reset(new (std::nothrow) LogSlot[kLogSlotNum]);
+    if (slots_ == nullptr) {
+      GELOGE(MEMALLOC_FAILED, "Failed to alloc %lu slots for async log.", kLogSlotNum);
+      return MEMALLOC_FAILED;
+    }
+  }
+  for (uint64_t i = 0; i < kLogSlotNum; ++i) {
+    slots_[i].seq.store(i, std::memory_order_relaxed);
+  }
+  enqueue_pos_.store(0, std::memory_order_relaxed);
+  dequeue_pos_ = 0;
+  {
+    std::lock_guard<std::mutex> lock(flush_mutex_);
+    flushed_pos_ = 0;
+  }
+  running_ = true;
+  worker_ = std::thread(&AsyncLogSink::Run, this);
+  worker_id_ = worker_.get_id();
+  GetLogState().flush.store(&AsyncLogSink::Flush, std::memory_order_release);
+  GetLogState().sink.store(&AsyncLogSink::Write, std::memory_order_release);
+  GELOGI("Async log sink started, %lu slots of %zu bytes.", kLogSlotNum, kMaxLogLength);
+  return SUCCESS;
+}
+
+void AsyncLogSink::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ((start_count_ == 0) || (--start_count_ > 0) || !running_) {
+      return;
+    }
+    GetLogState().sink.store(nullptr, std::memory_order_release);
+    GetLogState().flush.store(nullptr, std::memory_order_release);
+    running_ = false;
+  }
+  cond_.notify_one();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+  GELOGI("Async log sink stopped, %lu logs are dropped.", dropped_num_.load());
+}
+
+void AsyncLogSink::Write(int module_id, int level, const char *fmt, ...) {
+  AsyncLogSink &instance = Instance();
+  va_list args;
+  va_start(args, fmt);
+  // the worker checks writer_num_ after running_ is cleared, so either it waits for the push, or the log is written
+  // synchronously here
+  (void)instance.writer_num_.fetch_add(1);
+  bool running = instance.running_.load();
+  if (running) {
+    (void)instance.Push(module_id, level, fmt, args);
+  }
+  (void)instance.writer_num_.fetch_sub(1);
+  if (!running) {
+    char msg[kMaxLogLength];
+    (void)vsnprintf(msg, kMaxLogLength, fmt, args);
+    DlogInner(module_id, level, "%s", msg);
+  }
+  va_end(args);
+}
+
+void AsyncLogSink::Flush() { Instance().WaitFlushed(); }
+
+void AsyncLogSink::WaitFlushed() {
+  if (!running_.load() || (std::this_thread::get_id() == worker_id_)) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(flush_mutex_);
+  // all logs are written when the worker exits, the positions start from 0 again if the sink is restarted
+  uint64_t stopped_num = stopped_num_;
+  uint64_t pos = enqueue_pos_.load(std::memory_order_acquire);
+  cond_.notify_one();
+  flush_cond_.wait(lock, [this, pos, stopped_num]() { return (flushed_pos_ >= pos) || (stopped_num_ != stopped_num); });
+}
+
+void AsyncLogSink::SetFlushedPos(bool stopped) {
+  {
+    std::lock_guard<std::mutex> lock(flush_mutex_);
+    flushed_pos_ = dequeue_pos_;
+    if (stopped) {
+      ++stopped_num_;
+    }
+  }
+  flush_cond_.notify_all();
+}
+
+bool AsyncLogSink::Push(int module_id, int level, const char *fmt, va_list args) {
+  LogSlot *slot = nullptr;
+  uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    slot = &slots_[pos & (kLogSlotNum - 1)];
+    uint64_t seq = slot->seq.load(std::memory_order_acquire);
+    int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // full, the slot is not read yet
+      dropped_num_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  slot->module_id = module_id;
+  slot->level = level;
+  (void)vsnprintf(slot->msg, kMaxLogLength, fmt, args);
+  slot->seq.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+bool AsyncLogSink::Pop() {
+  LogSlot &slot = slots_[dequeue_pos_ & (kLogSlotNum - 1)];
+  if (slot.seq.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+    return false;
+  }
+  DlogInner(slot.module_id, slot.level, "%s", slot.msg);
+  slot.seq.store(dequeue_pos_ + kLogSlotNum, std::memory_order_release);
+  ++dequeue_pos_;
+  return true;
+}
+
+void AsyncLogSink::Run() {
+  while (true) {
+    while (Pop()) {
+    }
+    SetFlushedPos(false);
+    uint64_t dropped_num = dropped_num_.load(std::memory_order_relaxed);
+    if (dropped_num != reported_dropped_num_) {
+      GELOGW("%lu logs are dropped since the async log buffer is full.", dropped_num - reported_dropped_num_);
+      reported_dropped_num_ = dropped_num;
+    }
+    // producers never wake the worker up, so that they do not take the lock
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!running_) {
+      break;
+    }
+    (void)cond_.wait_for(lock, std::chrono::milliseconds(kFlushIntervalMs));
+  }
+  // the sink is removed before stopped, flush the logs of the writers which took it before that
+  while (Pop() || (writer_num_.load() != 0) || (dequeue_pos_ != enqueue_pos_.load(std::memory_order_acquire))) {
+  }
+  SetFlushedPos(true);
+}
+}  // namespace ge
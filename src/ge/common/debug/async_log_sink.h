@@ -0,0 +1,111 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_COMMON_DEBUG_ASYNC_LOG_SINK_H_
+#define GE_COMMON_DEBUG_ASYNC_LOG_SINK_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/ge_inner_error_codes.h"
+#include "graph/types.h"
+
+namespace ge {
+///
+/// @brief Sink of the debug and info logs of GE. The caller only formats the log into a slot of a lock-free ring
+///        buffer, and a background thread writes the logs to dlog in order. A log is dropped rather than waited for
+///        when the buffer is full, and the number of dropped logs is reported by a warning log.
+///        It is started by Start if the environment variable GE_ASYNC_LOG is 1, and flushed when it is stopped or a
+///        warning or error log is written. A log which takes the sink after it is stopped is written synchronously.
+///
+class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY AsyncLogSink {
+ public:
+  static AsyncLogSink &Instance();
+
+  AsyncLogSink(const AsyncLogSink &) = delete;
+  AsyncLogSink &operator=(const AsyncLogSink &) = delete;
+
+  ///
+  /// @brief Start the sink if it is enabled by GE_ASYNC_LOG. Every Start is counted and must be paired with a Stop
+  ///        whatever it returns, the logs are written synchronously if the sink fails to start
+  /// @return Status
+  ///
+  Status Start();
+
+  ///
+  /// @brief Start the sink whatever GE_ASYNC_LOG is
+  /// @return Status
+  ///
+  Status ForceStart();
+
+  ///
+  /// @brief Write all logs in the buffer and stop the sink after the last Start is stopped
+  ///
+  void Stop();
+
+  bool IsRunning() const { return running_.load(); }
+
+  uint64_t GetDroppedNum() const { return dropped_num_.load(); }
+
+  static void Write(int module_id, int level, const char *fmt, ...);
+
+  ///
+  /// @brief Wait until the logs written before are written to dlog, it returns at once in the worker thread
+  ///
+  static void Flush();
+
+ private:
+  struct LogSlot;
+
+  AsyncLogSink();
+  ~AsyncLogSink();
+
+  Status Acquire(bool start_worker);
+  Status StartWorker();
+  bool Push(int module_id, int level, const char *fmt, va_list args);
+  bool Pop();
+  void Run();
+  void WaitFlushed();
+  void SetFlushedPos(bool stopped);
+
+  std::unique_ptr<LogSlot[]> slots_;
+  std::atomic<uint64_t> enqueue_pos_;
+  uint64_t dequeue_pos_;
+  std::atomic<uint64_t> dropped_num_;
+  uint64_t reported_dropped_num_;
+  // number of the Write calls in progress, the worker does not exit until they are done
+  std::atomic<uint32_t> writer_num_;
+
+  std::mutex flush_mutex_;
+  std::condition_variable flush_cond_;
+  uint64_t flushed_pos_;
+  uint64_t stopped_num_;
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  uint32_t start_count_;
+  std::atomic<bool> running_;
+  std::thread worker_;
+  std::thread::id worker_id_;
+};
+}  // namespace ge
+#endif  // GE_COMMON_DEBUG_ASYNC_LOG_SINK_H_
@@ -17,9 +17,12 @@
 #include "common/formats/format_transfers/format_transfer_fractal_nz.h"
 
 #include <securec.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include "common/formats/utils/formats_definitions.h"
+#include "common/formats/utils/formats_element_utils.h"
 #include "common/formats/utils/formats_trans_utils.h"
 #include "framework/common/debug/ge_log.h"
 #include "graph/utils/type_utils.h"
@@ -28,6 +31,7 @@ namespace ge {
 namespace formats {
 namespace {
 const int kDimSize4D = 4;
+const int64_t kMinParallelTransSize = 4 * 1024 * 1024;  // bytes transferred by a thread at least
 bool IsDataTypeSupport(DataType data_type) { return GetSizeByDataType(data_type) > 0; }
 
 using ShapeVector = std::vector<int64_t>;
@@ -113,15 +117,99 @@ Status CheckShapeRelation(const TransArgs &args, ShapeVector &hw_shape) {
   return SUCCESS;
 }
 
-Status TransFormatFromNdToFracNz(const TransArgs &args, TransResult &result, const ShapeVector &hw_shape) {
-  int size = GetSizeByDataType(args.src_data_type);
+/**
+ * Fill the fractal panels [panel_begin, panel_end) of dst, panel p is (times_idx, w1_idx) of size H1*H0*W0.
+ * The panels are filled by h0 x w0 cubes, so that the rows of src read by a cube are shared by the adjacent panels.
+ * The elements are moved by the converter, which casts the data type if the transfer is fused with a cast
+ * @src: times*H*W
+ * @dst: times*W1*H1*H0*W0
+ */
+struct FracNzPanelsFiller {
+  const uint8_t *src;
+  int64_t h;
+  int64_t w;
+  int64_t w1;
+  int64_t h1h0;
+  int64_t h0;
+  int64_t w0;
+  int64_t panel_begin;
+  int64_t panel_end;
+  uint8_t *dst;
+
+  template <typename Converter>
+  Status operator()(const Converter &converter) const {
+    using SrcT = typename Converter::SrcType;
+    using DstT = typename Converter::DstType;
+    const SrcT *src_data = reinterpret_cast<const SrcT *>(src);
+    DstT *dst_data = reinterpret_cast<DstT *>(dst);
+    const DstT zero{};
+    for (int64_t h_begin = 0; h_begin < h1h0; h_begin += h0) {
+      for (int64_t panel = panel_begin; panel < panel_end; panel++) {
+        auto times_idx = panel / w1;
+        auto w_head = (panel % w1) * w0;
+        auto w_num = std::min(w0, w - w_head);
+        auto h_end = std::min(h_begin + h0, h);
+        DstT *dst_row = dst_data + (panel * h1h0 + h_begin) * w0;
+        for (int64_t h_idx = h_begin; h_idx < h_end; h_idx++) {
+          MoveElements(src_data + (times_idx * h + h_idx) * w + w_head, w_num, dst_row, converter);
+          for (int64_t w0_idx = w_num; w0_idx < w0; w0_idx++) {
+            dst_row[w0_idx] = zero;
+          }
+          dst_row += w0;
+        }
+        // pad the rows out of h in bulk
+        std::fill(dst_row, dst_data + (panel * h1h0 + h_begin + h0) * w0, zero);
+      }
+    }
+    return SUCCESS;
+  }
+};
+
+/**
+ * Fill the row blocks [row_begin, row_end) of dst, block r is the H0 rows of (times_idx, h1_idx),
+ * each row is gathered from the w0 chunks of the W1 panels
+ * @src: times*W1*H1*H0*W0
+ * @dst: times*H*W
+ */
+template <typename T>
+void FracNzToNdRows(const T *src, int64_t h, int64_t w, int64_t w1, int64_t h1, int64_t h0, int64_t w0,
+                    int64_t row_begin, int64_t row_end, T *dst) {
+  auto h1h0w0 = h1 * h0 * w0;
+  for (int64_t row = row_begin; row < row_end; row++) {
+    auto times_idx = row / h1;
+    auto h_begin = (row % h1) * h0;
+    auto h_end = std::min(h_begin + h0, h);
+    for (int64_t h_idx = h_begin; h_idx < h_end; h_idx++) {
+      T *dst_row = dst + (times_idx * h + h_idx) * w;
+      const T *src_row = src + times_idx * w1 * h1h0w0 + h_idx * w0;
+      for (int64_t w_head = 0; w_head < w; w_head += w0) {
+        auto w_num = std::min(w0, w - w_head);
+        std::memcpy(dst_row + w_head, src_row, static_cast<size_t>(w_num) * sizeof(T));
+        src_row += h1h0w0;
+      }
+    }
+  }
+}
+
+#define FRACTAL_NZ_CASES(CASE) \
+  CASE(1, uint8_t)             \
+  CASE(2, uint16_t)            \
+  CASE(4, uint32_t)            \
+  CASE(5, ElementBytes<5>)     \
+  CASE(8, uint64_t)            \
+  CASE(16, ElementBytes<16>)
+
+Status TransFormatFromNdToFracNz(const TransArgs &args, DataType dst_data_type, TransResult &result,
+                                 const ShapeVector &hw_shape) {
+  int size = GetSizeByDataType(dst_data_type);
   int64_t dst_size = GetItemNumByShape(args.dst_shape) * size;
   if (dst_size == 0) {
     result.length = static_cast<size_t>(dst_size);
     return SUCCESS;
   }
 
-  std::shared_ptr<uint8_t> dst(new (std::nothrow) uint8_t[dst_size](), std::default_delete<uint8_t[]>());
+  // all the pads are filled by the panels, so dst is not zeroed here
+  std::shared_ptr<uint8_t> dst(new (std::nothrow) uint8_t[dst_size], std::default_delete<uint8_t[]>());
   if (dst == nullptr) {
     GELOGE(OUT_OF_MEMORY, "Failed to trans format from %s to %s, can not alloc the memory for dst buf %ld",
            TypeUtils::FormatToSerialString(args.src_format).c_str(),
@@ -133,7 +221,6 @@ Status TransFormatFromNdToFracNz(const TransArgs &args, TransResult &result, con
   auto times = hw_shape.at(0);
   auto h = hw_shape.at(1);
   auto w = hw_shape.at(2);
-  auto hw = h * w;
 
   auto shape_size = args.dst_shape.size();
   auto w1 = args.dst_shape[shape_size - 4];
@@ -141,45 +228,20 @@ Status TransFormatFromNdToFracNz(const TransArgs &args, TransResult &result, con
   auto h0 = args.dst_shape[shape_size - 2];
   auto w0 = args.dst_shape[shape_size - 1];
   auto h1h0 = h1 * h0;
-  auto h1h0w0 = h1h0 * w0;
-  auto w1h1h0w0 = w1 * h1h0w0;
-  auto num_w1 = w / w0;
+  auto panel_size = h1h0 * w0 * size;
+  auto min_panel_num = std::max(kMinParallelTransSize / panel_size, static_cast<int64_t>(1));
 
-  for (int64_t times_idx = 0; times_idx < times; times_idx++) {
-    auto times_head = times_idx * w1h1h0w0;
-    auto src_times_head = times_idx * hw;
-    for (int64_t h1h0_idx = 0; h1h0_idx < h; h1h0_idx++) {
-      auto h1h0_head = times_head + h1h0_idx * w0;
-      auto src_h_head = src_times_head + h1h0_idx * w;
-      for (int64_t w1_idx = 0; w1_idx < num_w1; w1_idx++) {
-        auto dst_offset = (h1h0_head + w1_idx * h1h0w0) * size;
-        auto src_offset = (src_h_head + w1_idx * w0) * size;
-        auto protected_size = dst_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                ? dst_size - dst_offset
-                                : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-        auto ret = memcpy_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), args.data + src_offset,
-                            static_cast<size_t>(size * w0));
-        if (ret != EOK) {
-          GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory at offset %ld, error-code %d", dst_offset, ret);
-          return INTERNAL_ERROR;
-        }
-      }
-      auto w1_head = num_w1 * w0;
-      for (int64_t w0_idx = 0; w1_head + w0_idx < w; w0_idx++) {
-        auto src_w_idx = w1_head + w0_idx;
-        auto dst_offset = (h1h0_head + num_w1 * h1h0w0 + w0_idx) * size;
-        auto src_offset = (src_h_head + src_w_idx) * size;
-        auto protected_size = dst_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                ? dst_size - dst_offset
-                                : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-        auto ret = memcpy_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), args.data + src_offset,
-                            static_cast<size_t>(size));
-        if (ret != EOK) {
-          GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory at offset %ld, error-code %d", dst_offset, ret);
-          return INTERNAL_ERROR;
-        }
-      }
-    }
+  auto ret = ParallelFor(times * w1, min_panel_num, [&](int64_t panel_begin, int64_t panel_end) {
+    FracNzPanelsFiller filler = {args.data, h, w, w1, h1h0, h0, w0, panel_begin, panel_end, dst.get()};
+    return VisitElementConverter(args.src_data_type, dst_data_type, filler);
+  });
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Failed to trans format from %s to %s, data type from %s to %s",
+           TypeUtils::FormatToSerialString(args.src_format).c_str(),
+           TypeUtils::FormatToSerialString(args.dst_format).c_str(),
+           TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(),
+           TypeUtils::DataTypeToSerialString(dst_data_type).c_str());
+    return ret;
   }
   result.data = dst;
   result.length = static_cast<size_t>(dst_size);
@@ -205,62 +267,41 @@ Status TransFormatFromFracNzToNd(const TransArgs &args, TransResult &result, con
   auto times = dst_hw_shape.at(0);
   auto h = dst_hw_shape.at(1);
   auto w = dst_hw_shape.at(2);
-  auto hw = h * w;
 
   auto shape_size = args.src_shape.size();
   auto w1 = args.src_shape[shape_size - 4];
   auto h1 = args.src_shape[shape_size - 3];
   auto h0 = args.src_shape[shape_size - 2];
   auto w0 = args.src_shape[shape_size - 1];
-  auto h1h0 = h1 * h0;
-  auto h1h0w0 = h1h0 * w0;
-  auto w1h1h0w0 = w1 * h1h0w0;
-  auto num_w1 = w / w0;
-  errno_t ret;
+  auto row_size = h0 * w * size;
+  auto min_row_num = std::max(kMinParallelTransSize / row_size, static_cast<int64_t>(1));
 
-  for (int64_t times_idx = 0; times_idx < times; times_idx++) {
-    auto times_head = times_idx * w1h1h0w0;
-    auto dst_times_head = times_idx * hw;
-    for (int64_t h1h0_idx = 0; h1h0_idx < h; h1h0_idx++) {
-      auto h1h0_head = times_head + h1h0_idx * w0;
-      auto dst_h_head = dst_times_head + h1h0_idx * w;
-      for (int64_t w1_idx = 0; w1_idx < num_w1; w1_idx++) {
-        auto src_offset = (h1h0_head + w1_idx * h1h0w0) * size;
-        auto dst_offset = (dst_h_head + w1_idx * w0) * size;
-        auto protected_size = dst_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                ? dst_size - dst_offset
-                                : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-        ret = memcpy_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), args.data + src_offset,
-                       static_cast<size_t>(size * w0));
-        if (ret != EOK) {
-          GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory at offset %ld, error-code %d", dst_offset, ret);
-          return INTERNAL_ERROR;
-        }
-      }
-      auto w1_head = num_w1 * w0;
-      for (int64_t w0_idx = 0; w1_head + w0_idx < w; w0_idx++) {
-        auto dst_w_idx = w1_head + w0_idx;
-        auto src_offset = (h1h0_head + num_w1 * h1h0w0 + w0_idx) * size;
-        auto dst_offset = (dst_h_head + dst_w_idx) * size;
-        auto protected_size = dst_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                ? dst_size - dst_offset
-                                : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-        ret = memcpy_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), args.data + src_offset,
-                       static_cast<size_t>(size));
-        if (ret != EOK) {
-          GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory at offset %ld, error-code %d", dst_offset, ret);
-          return INTERNAL_ERROR;
-        }
-      }
+  auto ret = ParallelFor(times * h1, min_row_num, [&](int64_t row_begin, int64_t row_end) {
+    switch (size) {
+#define CASE(len, type)                                                                                     \
+  case len:                                                                                                 \
+    FracNzToNdRows(reinterpret_cast<const type *>(args.data), h, w, w1, h1, h0, w0, row_begin, row_end,    \
+                   reinterpret_cast<type *>(dst.get()));                                                    \
+    return SUCCESS;
+      FRACTAL_NZ_CASES(CASE)
+#undef CASE
+      default:
+        GELOGE(UNSUPPORTED, "Failed to trans format from %s to %s, data type size %d is not supported",
+               TypeUtils::FormatToSerialString(args.src_format).c_str(),
+               TypeUtils::FormatToSerialString(args.dst_format).c_str(), size);
+        return UNSUPPORTED;
     }
+  });
+  if (ret != SUCCESS) {
+    return ret;
   }
   result.data = dst;
   result.length = static_cast<size_t>(dst_size);
   return SUCCESS;
 }
-}  // namespace
+#undef FRACTAL_NZ_CASES
 
-Status FormatTransferFractalNz::TransFormat(const TransArgs &args, TransResult &result) {
+Status TransFormatToFracNzByDataType(const TransArgs &args, DataType dst_data_type, TransResult &result) {
   if (!IsDataTypeSupport(args.src_data_type) || !CheckShape(args.src_format, args.src_shape) ||
       !IsShapeValid(args.dst_shape)) {
     GELOGE(PARAM_INVALID, "Trans format from %s to %s, src shape %s, dst shape %s, data type %s is not supported",
@@ -269,10 +310,11 @@ Status FormatTransferFractalNz::TransFormat(const TransArgs &args, TransResult &
            ShapeToString(args.dst_shape).c_str(), TypeUtils::DataTypeToSerialString(args.src_data_type).c_str());
     return PARAM_INVALID;
   }
-  GELOGD("Begin to trans format from %s to %s, src shape %s, dst shape %s, data type %s",
+  GELOGD("Begin to trans format from %s to %s, src shape %s, dst shape %s, data type from %s to %s",
          TypeUtils::FormatToSerialString(args.src_format).c_str(),
          TypeUtils::FormatToSerialString(args.dst_format).c_str(), ShapeToString(args.src_shape).c_str(),
-         ShapeToString(args.dst_shape).c_str(), TypeUtils::DataTypeToSerialString(args.src_data_type).c_str());
+         ShapeToString(args.dst_shape).c_str(), TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(),
+         TypeUtils::DataTypeToSerialString(dst_data_type).c_str());
   ShapeVector expect_shape;
   ShapeVector hw_shape;
   auto ret = TransShapeToFracNz(args.src_shape, args.src_data_type, expect_shape, hw_shape);
@@ -286,7 +328,25 @@ Status FormatTransferFractalNz::TransFormat(const TransArgs &args, TransResult &
            ShapeToString(expect_shape).c_str());
     return PARAM_INVALID;
   }
-  return TransFormatFromNdToFracNz(args, result, hw_shape);
+  return TransFormatFromNdToFracNz(args, dst_data_type, result, hw_shape);
+}
+}  // namespace
+
+Status FormatTransferFractalNz::TransFormat(const TransArgs &args, TransResult &result) {
+  return TransFormatToFracNzByDataType(args, args.src_data_type, result);
+}
+
+Status TransFormatToFracNzWithCast(const TransArgs &args, DataType dst_data_type, TransResult &result) {
+  if (!IsElementConverterSupported(args.src_data_type, dst_data_type) ||
+      GetCubeSizeByDataType(args.src_data_type) != GetCubeSizeByDataType(dst_data_type)) {
+    GELOGD("Can not trans format from %s to %s with cast from %s to %s",
+           TypeUtils::FormatToSerialString(args.src_format).c_str(),
+           TypeUtils::FormatToSerialString(args.dst_format).c_str(),
+           TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(),
+           TypeUtils::DataTypeToSerialString(dst_data_type).c_str());
+    return UNSUPPORTED;
+  }
+  return TransFormatToFracNzByDataType(args, dst_data_type, result);
 }
 
 Status FormatTransferFractalNz::TransShape(Format src_format, const ShapeVector &src_shape, DataType data_type,
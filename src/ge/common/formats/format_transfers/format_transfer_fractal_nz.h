@@ -38,6 +38,13 @@ class FormatTransferFractalNzND : public FormatTransfer {
   Status TransShape(Format src_format, const std::vector<int64_t> &src_shape, DataType data_type, Format dst_format,
                     std::vector<int64_t> &dst_shape) override;
 };
+
+/**
+ * Trans format from ND, NCHW or NHWC to FRACTAL_NZ and cast the elements from args.src_data_type to dst_data_type
+ * in the same pass
+ * @return UNSUPPORTED if the cast can not be fused, e.g. the cube sizes of the data types are different
+ */
+Status TransFormatToFracNzWithCast(const TransArgs &args, DataType dst_data_type, TransResult &result);
 }  // namespace formats
 }  // namespace ge
 
@@ -17,10 +17,13 @@
 #include "common/formats/format_transfers/format_transfer_fractal_z.h"
 
 #include <securec.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include "common/debug/log.h"
 #include "common/formats/utils/formats_definitions.h"
+#include "common/formats/utils/formats_element_utils.h"
 #include "common/formats/utils/formats_trans_utils.h"
 #include "framework/common/debug/ge_log.h"
 #include "graph/utils/type_utils.h"
@@ -28,6 +31,8 @@
 namespace ge {
 namespace formats {
 namespace {
+const int64_t kMinParallelTransSize = 4 * 1024 * 1024;  // bytes transferred by a thread at least
+
 Status CheckDataTypeSupport(DataType data_type) { return GetSizeByDataType(data_type) > 0 ? SUCCESS : UNSUPPORTED; }
 
 /**
@@ -97,114 +102,80 @@ Status TransShapeNhwcToFz(const std::vector<int64_t> &src_shape, DataType data_t
   return TransShapeToFz(n, c, h, w, data_type, dst_shape);
 }
 
-Status TransFormatFromNchwToFz(const TransArgs &args, TransResult &result) {
-  int64_t n = args.src_shape.at(kNchwN);
-  int64_t c = args.src_shape.at(kNchwC);
-  int64_t h = args.src_shape.at(kNchwH);
-  int64_t w = args.src_shape.at(kNchwW);
-
-  int64_t c0 = GetCubeSizeByDataType(args.src_data_type);
-  int64_t c1 = Ceil(c, c0);
-
-  int64_t hw = h * w;
-  int64_t chw = c * hw;
-  int64_t nchw = n * chw;
-  int64_t hwc0 = hw * c0;
-
-  // horizontal fractal matrix count (N)
-  int64_t hf_cnt = Ceil(n, static_cast<int64_t>(kNiSize));
-  // vertical fractal matrix count (C1HWC0)
-  int64_t vf_cnt = c1 * hw;
-  // elements count in one fractal
-  int64_t fractal_ele_cnt = c0 * kNiSize;
-  int64_t total_ele_cnt = hf_cnt * vf_cnt * fractal_ele_cnt;
-  int size = GetSizeByDataType(args.src_data_type);
-  int64_t dst_size = total_ele_cnt * size;
-  GE_CHK_BOOL_EXEC_NOLOG(dst_size != 0, result.length = static_cast<size_t>(dst_size); return SUCCESS;);
-
-  std::shared_ptr<uint8_t> dst(new (std::nothrow) uint8_t[dst_size], std::default_delete<uint8_t[]>());
-  GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(
-    dst == nullptr,
-    GELOGE(OUT_OF_MEMORY, "Failed to trans format from %s to %s, can not alloc the memory for dst buf %ld",
-           TypeUtils::FormatToSerialString(args.src_format).c_str(),
-           TypeUtils::FormatToSerialString(args.dst_format).c_str(), dst_size);
-    return OUT_OF_MEMORY;);
+/**
+ * Strides of the src elements in N, C and H*W, by which NCHW, HWCN and NHWC are transferred in the same way
+ */
+struct FzSrcStrides {
+  int64_t n;
+  int64_t c;
+  int64_t hw;
+};
 
-  for (int64_t vfi = 0; vfi < vf_cnt; vfi++) {
-    // vertical fractal matrix base index
-    auto vf_base_i = vfi * hf_cnt;
-    for (int64_t hfi = 0; hfi < hf_cnt; hfi++) {
-      // global fractal matrix index
-      auto gfi = vf_base_i + hfi;
-      auto src_n_offset = hfi * chw * kNiSize;
-      auto src_f_offset = src_n_offset + vfi % hw + vfi / hw * hwc0;
-      for (int64_t row = 0; row < c0; row++) {
-        auto src_ci = vfi / hw * c0 + row;
-        auto src_row_offset = src_f_offset + row * hw;
-        for (int col = 0; col < kNiSize; col++) {
-          auto src_ni = hfi * kNiSize + col;
-          auto src_offset = src_row_offset + chw * col;
-          // pad 0
-          // 1. src_ni grater than n
-          // 2. src_ci grater than c
-          // 3. source address grater than original array size
-          auto need_pad_zero = src_ni >= n || src_offset >= nchw || src_ci >= c;
-          auto idx = gfi * fractal_ele_cnt + col * c0 + row;
-          auto offset = idx * size;
-          auto protected_size = dst_size - offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                  ? dst_size - offset
-                                  : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-          errno_t ret = EOK;
-          if (need_pad_zero) {
-            ret = memset_s(dst.get() + offset, static_cast<size_t>(protected_size), 0, static_cast<size_t>(size));
+/**
+ * Fill the panels [panel_begin, panel_end) of dst, panel p is (c1_idx, hw_idx) of size N1N0*C0.
+ * The panels are filled by Ni x C0 cubes, so that the src lines read by a cube are shared by the adjacent panels.
+ * The elements are moved by the converter, which casts the data type if the transfer is fused with a cast
+ * @dst: C1*H*W*N1N0*C0
+ */
+struct FzPanelsFiller {
+  const uint8_t *src;
+  FzSrcStrides strides;
+  int64_t n;
+  int64_t c;
+  int64_t hw;
+  int64_t c0;
+  int64_t n1n0;
+  int64_t panel_begin;
+  int64_t panel_end;
+  uint8_t *dst;
+
+  template <typename Converter>
+  Status operator()(const Converter &converter) const {
+    using SrcT = typename Converter::SrcType;
+    using DstT = typename Converter::DstType;
+    const SrcT *src_data = reinterpret_cast<const SrcT *>(src);
+    DstT *dst_data = reinterpret_cast<DstT *>(dst);
+    const DstT zero{};
+    for (int64_t ni_begin = 0; ni_begin < n1n0; ni_begin += kNiSize) {
+      for (int64_t panel = panel_begin; panel < panel_end; panel++) {
+        auto c_head = panel / hw * c0;
+        auto c_num = std::min(c0, c - c_head);
+        auto ni_end = std::min(ni_begin + kNiSize, n);
+        DstT *dst_row = dst_data + (panel * n1n0 + ni_begin) * c0;
+        const SrcT *src_head = src_data + c_head * strides.c + panel % hw * strides.hw;
+        for (int64_t ni = ni_begin; ni < ni_end; ni++) {
+          const SrcT *src_row = src_head + ni * strides.n;
+          if (strides.c == 1) {
+            MoveElements(src_row, c_num, dst_row, converter);
           } else {
-            if (protected_size < size) {
-              GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory, protected_size is %ld and size is %ld",
-                     protected_size, size);
-              return INTERNAL_ERROR;
-            }
-            char *dst_data = reinterpret_cast<char *>(dst.get() + offset);
-            const char *src_data = reinterpret_cast<const char *>(args.data + src_offset * size);
-            for (int64_t index = 0; index < size; index++) {
-              *dst_data++ = *src_data++;
-            }
+            GatherElements(src_row, c_num, strides.c, dst_row, converter);
           }
-          if (ret != EOK) {
-            GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory at offset %ld, error-code %d pad mode %d", offset,
-                   ret, need_pad_zero);
-            return INTERNAL_ERROR;
+          for (int64_t c0_idx = c_num; c0_idx < c0; c0_idx++) {
+            dst_row[c0_idx] = zero;
           }
+          dst_row += c0;
         }
+        // pad the rows out of n in bulk
+        std::fill(dst_row, dst_data + (panel * n1n0 + ni_begin + kNiSize) * c0, zero);
       }
     }
+    return SUCCESS;
   }
+};
 
-  result.data = dst;
-  result.length = static_cast<size_t>(dst_size);
-  return SUCCESS;
-}
-
-Status TransFormatHwcnToFz(const TransArgs &args, TransResult &result) {
-  int64_t h = args.src_shape[kHwcnH];
-  int64_t w = args.src_shape[kHwcnW];
-  int64_t c = args.src_shape[kHwcnC];
-  int64_t n = args.src_shape[kHwcnN];
+/**
+ * frac_z axises: (C1*H*W, No, Ni, C0), each (c1, h, w) is a panel of No*Ni rows of C0,
+ * the rows of n out of N and the columns of c out of C are padded by 0.
+ * The src elements of args.src_data_type are cast to dst_data_type on the way
+ */
+Status TransFormatToFz(const TransArgs &args, DataType dst_data_type, int64_t n, int64_t c, int64_t hw,
+                       const FzSrcStrides &strides, TransResult &result) {
   int64_t n1n0 = Ceil(n, static_cast<int64_t>(kNiSize)) * kNiSize;
   int64_t c0 = GetCubeSizeByDataType(args.src_data_type);
   int64_t c1 = Ceil(c, c0);
 
-  auto cn = c * n;
-  auto wcn = w * cn;
-  auto n1n0c0 = n1n0 * c0;
-  auto wn1n0c0 = w * n1n0c0;
-  auto hwn1n0c0 = h * wn1n0c0;
-
-  int64_t data_size = GetSizeByDataType(args.src_data_type);
-  int64_t dst_size = 1;
-  for (auto dim : args.dst_shape) {
-    dst_size *= dim;
-  }
-  dst_size *= data_size;
+  int size = GetSizeByDataType(dst_data_type);
+  int64_t dst_size = c1 * hw * n1n0 * c0 * size;
   GE_CHK_BOOL_EXEC_NOLOG(dst_size != 0, result.length = static_cast<size_t>(dst_size); return SUCCESS;);
 
   std::shared_ptr<uint8_t> dst(new (std::nothrow) uint8_t[dst_size], std::default_delete<uint8_t[]>());
@@ -215,43 +186,19 @@ Status TransFormatHwcnToFz(const TransArgs &args, TransResult &result) {
            TypeUtils::FormatToSerialString(args.dst_format).c_str(), dst_size);
     return OUT_OF_MEMORY;);
 
-  for (int64_t c1i = 0; c1i < c1; c1i++) {
-    for (int64_t hi = 0; hi < h; hi++) {
-      for (int64_t wi = 0; wi < w; wi++) {
-        for (int64_t n1n0i = 0; n1n0i < n1n0; n1n0i++) {
-          for (int64_t c0i = 0; c0i < c0; c0i++) {
-            int64_t dst_idx = c1i * hwn1n0c0 + hi * wn1n0c0 + wi * n1n0c0 + n1n0i * c0 + c0i;
-            int64_t dst_offset = dst_idx * data_size;
-            auto protected_size = dst_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                    ? dst_size - dst_offset
-                                    : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-            auto pad_zero = ((c1i * c0 + c0i) >= c) || (n1n0i >= n);
-            errno_t ret = EOK;
-            if (pad_zero) {
-              ret = memset_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), 0,
-                             static_cast<size_t>(data_size));
-            } else {
-              if (protected_size < data_size) {
-                GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory, protected_size is %ld and size is %ld",
-                       protected_size, data_size);
-                return INTERNAL_ERROR;
-              }
-              int64_t src_idx = hi * wcn + wi * cn + (c1i * c0 + c0i) * n + n1n0i;
-              char *dst_data = reinterpret_cast<char *>(dst.get() + dst_offset);
-              const char *src_data = reinterpret_cast<const char *>(args.data + src_idx * data_size);
-              for (int64_t index = 0; index < data_size; index++) {
-                *dst_data++ = *src_data++;
-              }
-            }
-            if (ret != EOK) {
-              GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory at offset %ld, error-code %d, pad mode %d",
-                     dst_offset, ret, pad_zero);
-              return INTERNAL_ERROR;
-            }
-          }
-        }
-      }
-    }
+  auto panel_size = n1n0 * c0 * size;
+  auto min_panel_num = std::max(kMinParallelTransSize / panel_size, static_cast<int64_t>(1));
+  auto ret = ParallelFor(c1 * hw, min_panel_num, [&](int64_t panel_begin, int64_t panel_end) {
+    FzPanelsFiller filler = {args.data, strides, n, c, hw, c0, n1n0, panel_begin, panel_end, dst.get()};
+    return VisitElementConverter(args.src_data_type, dst_data_type, filler);
+  });
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Failed to trans format from %s to %s, data type from %s to %s",
+           TypeUtils::FormatToSerialString(args.src_format).c_str(),
+           TypeUtils::FormatToSerialString(args.dst_format).c_str(),
+           TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(),
+           TypeUtils::DataTypeToSerialString(dst_data_type).c_str());
+    return ret;
   }
 
   result.data = dst;
@@ -259,89 +206,34 @@ Status TransFormatHwcnToFz(const TransArgs &args, TransResult &result) {
   return SUCCESS;
 }
 
-Status TransFormatNhwcToFz(const TransArgs &args, TransResult &result) {
-  int64_t n = args.src_shape[kNhwcN];
-  int64_t h = args.src_shape[kNhwcH];
-  int64_t w = args.src_shape[kNhwcW];
-  int64_t c = args.src_shape[kNhwcC];
-  auto wc = w * c;
-  auto hwc = h * w * c;
-
-  int64_t n1n0 = Ceil(n, static_cast<int64_t>(kNiSize)) * kNiSize;
-  int64_t c0 = GetCubeSizeByDataType(args.src_data_type);
-  int64_t c1 = Ceil(c, c0);
-  auto n1n0c0 = n1n0 * c0;
-  auto wn1n0c0 = w * n1n0c0;
-  auto hwn1n0c0 = h * wn1n0c0;
-
-  int64_t data_size = GetSizeByDataType(args.src_data_type);
-  int64_t dst_size = 1;
-  for (auto dim : args.dst_shape) {
-    dst_size *= dim;
-  }
-  dst_size *= data_size;
-  GE_CHK_BOOL_EXEC_NOLOG(dst_size != 0, result.length = static_cast<size_t>(dst_size); return SUCCESS;);
-
-  std::shared_ptr<uint8_t> dst(new (std::nothrow) uint8_t[dst_size], std::default_delete<uint8_t[]>());
-  GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(
-    dst == nullptr,
-    GELOGE(OUT_OF_MEMORY, "Failed to trans format from %s to %s, can not alloc the memory for dst buf %ld",
-           TypeUtils::FormatToSerialString(args.src_format).c_str(),
-           TypeUtils::FormatToSerialString(args.dst_format).c_str(), dst_size);
-    return OUT_OF_MEMORY;);
+Status TransFormatFromNchwToFz(const TransArgs &args, DataType dst_data_type, TransResult &result) {
+  int64_t n = args.src_shape.at(kNchwN);
+  int64_t c = args.src_shape.at(kNchwC);
+  int64_t hw = args.src_shape.at(kNchwH) * args.src_shape.at(kNchwW);
+  FzSrcStrides strides = {c * hw, hw, 1};
+  return TransFormatToFz(args, dst_data_type, n, c, hw, strides, result);
+}
 
-  for (int64_t c1i = 0; c1i < c1; c1i++) {
-    for (int64_t hi = 0; hi < h; hi++) {
-      for (int64_t wi = 0; wi < w; wi++) {
-        for (int64_t n1n0i = 0; n1n0i < n1n0; n1n0i++) {
-          for (int64_t c0i = 0; c0i < c0; c0i++) {
-            int64_t dst_idx = c1i * hwn1n0c0 + hi * wn1n0c0 + wi * n1n0c0 + n1n0i * c0 + c0i;
-            int64_t dst_offset = dst_idx * data_size;
-            auto protected_size = dst_size - dst_offset < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                                    ? dst_size - dst_offset
-                                    : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-            auto pad_zero = ((c1i * c0 + c0i) >= c) || (n1n0i >= n);
-            errno_t ret = EOK;
-            if (pad_zero) {
-              ret = memset_s(dst.get() + dst_offset, static_cast<size_t>(protected_size), 0,
-                             static_cast<size_t>(data_size));
-            } else {
-              if (protected_size < data_size) {
-                GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory, protected_size is %ld and size is %ld",
-                       protected_size, data_size);
-                return INTERNAL_ERROR;
-              }
-              int64_t src_idx = n1n0i * hwc + hi * wc + wi * c + (c1i * c0 + c0i);
-              char *dst_data = reinterpret_cast<char *>(dst.get() + dst_offset);
-              const char *src_data = reinterpret_cast<const char *>(args.data + src_idx * data_size);
-              for (int64_t index = 0; index < data_size; index++) {
-                *dst_data++ = *src_data++;
-              }
-            }
-            if (ret != EOK) {
-              GELOGE(INTERNAL_ERROR, "Failed to operate the dst memory at offset %ld, error-code %d, pad mode %d",
-                     dst_offset, ret, pad_zero);
-              return INTERNAL_ERROR;
-            }
-          }
-        }
-      }
-    }
-  }
+Status TransFormatHwcnToFz(const TransArgs &args, DataType dst_data_type, TransResult &result) {
+  int64_t hw = args.src_shape[kHwcnH] * args.src_shape[kHwcnW];
+  int64_t c = args.src_shape[kHwcnC];
+  int64_t n = args.src_shape[kHwcnN];
+  FzSrcStrides strides = {1, n, c * n};
+  return TransFormatToFz(args, dst_data_type, n, c, hw, strides, result);
+}
 
-  result.data = dst;
-  result.length = static_cast<size_t>(dst_size);
-  return SUCCESS;
+Status TransFormatNhwcToFz(const TransArgs &args, DataType dst_data_type, TransResult &result) {
+  int64_t n = args.src_shape[kNhwcN];
+  int64_t hw = args.src_shape[kNhwcH] * args.src_shape[kNhwcW];
+  int64_t c = args.src_shape[kNhwcC];
+  FzSrcStrides strides = {hw * c, 1, c};
+  return TransFormatToFz(args, dst_data_type, n, c, hw, strides, result);
 }
-}  // namespace
 
-Status FormatTransferFractalZ::TransFormat(const TransArgs &args, TransResult &result) {
-  GELOGD("Begin to trans format from %s to %s, src shape %s, data type %s, dst shape %s",
-         TypeUtils::FormatToSerialString(args.src_format).c_str(),
-         TypeUtils::FormatToSerialString(args.dst_format).c_str(), ShapeToString(args.src_shape).c_str(),
-         TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(), ShapeToString(args.dst_shape).c_str());
+Status TransFormatToFzByDataType(const TransArgs &args, DataType dst_data_type, TransResult &result) {
   std::vector<int64_t> expect_shape;
-  auto ret = TransShape(args.src_format, args.src_shape, args.src_data_type, args.dst_format, expect_shape);
+  FormatTransferFractalZ transfer;
+  auto ret = transfer.TransShape(args.src_format, args.src_shape, args.src_data_type, args.dst_format, expect_shape);
   if (ret != SUCCESS) {
     return ret;
   }
@@ -354,19 +246,45 @@ Status FormatTransferFractalZ::TransFormat(const TransArgs &args, TransResult &r
   }
 
   if (args.src_format == FORMAT_NHWC && args.dst_format == FORMAT_FRACTAL_Z) {
-    return TransFormatNhwcToFz(args, result);
+    return TransFormatNhwcToFz(args, dst_data_type, result);
   }
 
   if (args.src_format == FORMAT_HWCN && args.dst_format == FORMAT_FRACTAL_Z) {
-    return TransFormatHwcnToFz(args, result);
+    return TransFormatHwcnToFz(args, dst_data_type, result);
   }
 
   if (args.src_format == FORMAT_NCHW && args.dst_format == FORMAT_FRACTAL_Z) {
-    return TransFormatFromNchwToFz(args, result);
+    return TransFormatFromNchwToFz(args, dst_data_type, result);
   }
 
   return UNSUPPORTED;
 }
+}  // namespace
+
+Status FormatTransferFractalZ::TransFormat(const TransArgs &args, TransResult &result) {
+  GELOGD("Begin to trans format from %s to %s, src shape %s, data type %s, dst shape %s",
+         TypeUtils::FormatToSerialString(args.src_format).c_str(),
+         TypeUtils::FormatToSerialString(args.dst_format).c_str(), ShapeToString(args.src_shape).c_str(),
+         TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(), ShapeToString(args.dst_shape).c_str());
+  return TransFormatToFzByDataType(args, args.src_data_type, result);
+}
+
+Status TransFormatToFzWithCast(const TransArgs &args, DataType dst_data_type, TransResult &result) {
+  GELOGD("Begin to trans format from %s to %s with cast from %s to %s, src shape %s, dst shape %s",
+         TypeUtils::FormatToSerialString(args.src_format).c_str(),
+         TypeUtils::FormatToSerialString(args.dst_format).c_str(),
+         TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(),
+         TypeUtils::DataTypeToSerialString(dst_data_type).c_str(), ShapeToString(args.src_shape).c_str(),
+         ShapeToString(args.dst_shape).c_str());
+  if (!IsElementConverterSupported(args.src_data_type, dst_data_type) ||
+      GetCubeSizeByDataType(args.src_data_type) != GetCubeSizeByDataType(dst_data_type)) {
+    GELOGD("Can not trans format with cast from %s to %s",
+           TypeUtils::DataTypeToSerialString(args.src_data_type).c_str(),
+           TypeUtils::DataTypeToSerialString(dst_data_type).c_str());
+    return UNSUPPORTED;
+  }
+  return TransFormatToFzByDataType(args, dst_data_type, result);
+}
 
 Status FormatTransferFractalZ::TransShape(Format src_format, const std::vector<int64_t> &src_shape, DataType data_type,
                                           Format dst_format, std::vector<int64_t> &dst_shape) {
@@ -24,6 +24,8 @@
 #include <string>
 #include <vector>
 
+#include "common/formats/format_transfers/format_transfer_fractal_nz.h"
+#include "common/formats/format_transfers/format_transfer_fractal_z.h"
 #include "common/formats/utils/formats_trans_utils.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
@@ -31,6 +33,61 @@
 
 namespace ge {
 namespace formats {
+namespace {
+bool IsFusibleFormatStep(const TransStep &step) {
+  if (step.type != kTransStepFormat || step.src_data_type != step.dst_data_type) {
+    return false;
+  }
+  if (step.dst_format == FORMAT_FRACTAL_Z) {
+    return step.src_format == FORMAT_NCHW || step.src_format == FORMAT_HWCN || step.src_format == FORMAT_NHWC;
+  }
+  if (step.dst_format == FORMAT_FRACTAL_NZ) {
+    return step.src_format == FORMAT_ND || step.src_format == FORMAT_NCHW || step.src_format == FORMAT_NHWC;
+  }
+  return false;
+}
+
+/**
+ * Trans a format step to FRACTAL_Z/FRACTAL_NZ and a cast step before or after it in one pass
+ * @return UNSUPPORTED if the steps can not be fused
+ */
+Status TransFusedSteps(const uint8_t *data, const TransStep &first, const TransStep &second, TransResult &result) {
+  bool cast_first = first.type == kTransStepDataType;
+  const TransStep &format_step = cast_first ? second : first;
+  const TransStep &cast_step = cast_first ? first : second;
+  if (!IsFusibleFormatStep(format_step) || cast_step.type != kTransStepDataType) {
+    return UNSUPPORTED;
+  }
+  // the cast casts the input of the format step if it is first, or the output otherwise
+  auto cast_data_type = cast_first ? cast_step.dst_data_type : cast_step.src_data_type;
+  const auto &cast_shape = cast_first ? format_step.src_shape : format_step.dst_shape;
+  if (cast_data_type != format_step.src_data_type ||
+      GetItemNumByShape(cast_step.src_shape) != GetItemNumByShape(cast_shape)) {
+    return UNSUPPORTED;
+  }
+
+  TransArgs args{data,
+                 format_step.src_format,
+                 format_step.dst_format,
+                 format_step.src_shape,
+                 format_step.dst_shape,
+                 cast_step.src_data_type};
+  if (format_step.dst_format == FORMAT_FRACTAL_Z) {
+    return TransFormatToFzWithCast(args, cast_step.dst_data_type, result);
+  }
+  return TransFormatToFracNzWithCast(args, cast_step.dst_data_type, result);
+}
+
+Status TransStepByStep(const uint8_t *data, const TransStep &step, TransResult &result) {
+  if (step.type == kTransStepFormat) {
+    return TransFormat({data, step.src_format, step.dst_format, step.src_shape, step.dst_shape, step.src_data_type},
+                       result);
+  }
+  auto data_size = GetItemNumByShape(step.src_shape);
+  return TransDataType({data, static_cast<size_t>(data_size), step.src_data_type, step.dst_data_type}, result);
+}
+}  // namespace
+
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Status TransFormat(const TransArgs &args, TransResult &result) {
   auto transfer = BuildFormatTransfer(args);
   if (transfer == nullptr) {
@@ -91,5 +148,40 @@ GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool IsTransFormatSupport(const T
 GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY bool IsTransDataTypeSupport(const CastArgs &args) {
   return DataTypeTransferExists(args);
 }
+
+GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Status TransRoad(const uint8_t *data, const std::vector<TransStep> &road,
+                                                                TransResult &result) {
+  TransResult result_last_time{};
+  const uint8_t *src_data = data;
+  size_t i = 0;
+  while (i < road.size()) {
+    TransResult tmp_result{};
+    Status ret = UNSUPPORTED;
+    if (i + 1 < road.size()) {
+      ret = TransFusedSteps(src_data, road[i], road[i + 1], tmp_result);
+      if (ret == SUCCESS) {
+        GELOGD("Trans the steps %zu and %zu of the road in one pass", i, i + 1);
+        i += 2;
+      } else if (ret != UNSUPPORTED) {
+        GELOGE(ret, "Failed to trans the steps %zu and %zu of the road", i, i + 1);
+        return ret;
+      }
+    }
+    if (ret == UNSUPPORTED) {
+      ret = TransStepByStep(src_data, road[i], tmp_result);
+      if (ret != SUCCESS) {
+        GELOGE(ret, "Failed to trans the step %zu of the road", i);
+        return ret;
+      }
+      ++i;
+    }
+    // the output of the previous step is released after the next one is done
+    result_last_time = tmp_result;
+    src_data = result_last_time.data.get();
+  }
+
+  result = result_last_time;
+  return SUCCESS;
+}
 }  // namespace formats
 }  // namespace ge
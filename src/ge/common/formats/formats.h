@@ -28,6 +28,25 @@
 
 namespace ge {
 namespace formats {
+enum TransStepType {
+  kTransStepFormat,
+  kTransStepDataType,
+};
+
+/**
+ * A step of a trans road, the format step trans src_shape of src_format to dst_shape of dst_format,
+ * the data type step casts the elements of src_shape from src_data_type to dst_data_type
+ */
+struct TransStep {
+  TransStepType type;
+  Format src_format;
+  Format dst_format;
+  std::vector<int64_t> src_shape;
+  std::vector<int64_t> dst_shape;
+  DataType src_data_type;
+  DataType dst_data_type;
+};
+
 /**
  * Convert the data format, and put the converted format and length in the result
  * @param args
@@ -44,6 +63,17 @@ Status TransDataType(const CastArgs &args, TransResult &result);
 bool IsTransFormatSupport(const TransArgs &args);
 
 bool IsTransDataTypeSupport(const CastArgs &args);
+
+/**
+ * Trans the data by the steps of a road and put the output of the last step in the result.
+ * A cast next to a format step to FRACTAL_Z or FRACTAL_NZ is fused into the format step, so that the pair is done
+ * in one pass with one output buffer, the other steps are done one by one
+ * @param data
+ * @param road
+ * @param result
+ * @return
+ */
+Status TransRoad(const uint8_t *data, const std::vector<TransStep> &road, TransResult &result);
 }  // namespace formats
 }  // namespace ge
 #endif  // GE_COMMON_FORMATS_FORMATS_H_
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_COMMON_FORMATS_UTILS_FORMATS_ELEMENT_UTILS_H_
+#define GE_COMMON_FORMATS_UTILS_FORMATS_ELEMENT_UTILS_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "common/formats/utils/formats_trans_utils.h"
+#include "common/fp16_t.h"
+#include "external/graph/types.h"
+#include "framework/common/ge_inner_error_codes.h"
+
+namespace ge {
+namespace formats {
+/**
+ * Converters of elements, a format transfer takes one to cast the data type while moving the elements.
+ * SrcType and DstType are the storage types of the elements
+ */
+template <typename T>
+struct ElementCopy {
+  using SrcType = T;
+  using DstType = T;
+  T operator()(const T &src) const { return src; }
+};
+
+template <typename SrcT, typename DstT>
+struct ElementCast {
+  using SrcType = SrcT;
+  using DstType = DstT;
+  DstT operator()(const SrcT &src) const { return static_cast<DstT>(src); }
+};
+
+/**
+ * Cast to fp16 the same way as DataTypeTransfer, the fp16 elements are stored as uint16_t
+ */
+template <typename SrcT>
+struct ElementCastToFp16 {
+  using SrcType = SrcT;
+  using DstType = uint16_t;
+  uint16_t operator()(const SrcT &src) const {
+    fp16_t dst;
+    dst = src;
+    return dst.val;
+  }
+};
+
+/**
+ * Move num continuous elements, the elements of the same type are copied by memcpy
+ */
+template <typename T>
+void MoveElements(const T *src, int64_t num, T *dst, const ElementCopy<T> &) {
+  std::memcpy(dst, src, static_cast<size_t>(num) * sizeof(T));
+}
+
+template <typename Converter>
+void MoveElements(const typename Converter::SrcType *src, int64_t num, typename Converter::DstType *dst,
+                  const Converter &converter) {
+  for (int64_t i = 0; i < num; i++) {
+    dst[i] = converter(src[i]);
+  }
+}
+
+/**
+ * Gather num elements of src by stride into dst
+ */
+template <typename Converter>
+void GatherElements(const typename Converter::SrcType *src, int64_t num, int64_t stride,
+                    typename Converter::DstType *dst, const Converter &converter) {
+  for (int64_t i = 0; i < num; i++) {
+    dst[i] = converter(src[i * stride]);
+  }
+}
+
+/**
+ * Call func with the converter from src_data_type to dst_data_type, func is a functor with a template operator()
+ * taking the converter. The elements of the same data type are moved by their sizes, and the casts are those of
+ * DataTypeTransfer which keep the cube size
+ * @return UNSUPPORTED if there is no converter
+ */
+template <typename Func>
+Status VisitElementConverter(DataType src_data_type, DataType dst_data_type, const Func &func) {
+  if (src_data_type == dst_data_type) {
+    switch (GetSizeByDataType(src_data_type)) {
+      case 1:
+        return func(ElementCopy<uint8_t>());
+      case 2:
+        return func(ElementCopy<uint16_t>());
+      case 4:
+        return func(ElementCopy<uint32_t>());
+      case 5:
+        return func(ElementCopy<ElementBytes<5>>());
+      case 8:
+        return func(ElementCopy<uint64_t>());
+      case 16:
+        return func(ElementCopy<ElementBytes<16>>());
+      default:
+        return UNSUPPORTED;
+    }
+  }
+  if (src_data_type == DT_FLOAT && dst_data_type == DT_FLOAT16) {
+    return func(ElementCastToFp16<float>());
+  }
+  if (src_data_type == DT_INT32 && dst_data_type == DT_FLOAT16) {
+    return func(ElementCastToFp16<int32_t>());
+  }
+  if (src_data_type == DT_FLOAT16 && dst_data_type == DT_FLOAT) {
+    return func(ElementCast<fp16_t, float>());
+  }
+  if (src_data_type == DT_FLOAT16 && dst_data_type == DT_INT32) {
+    return func(ElementCast<fp16_t, int32_t>());
+  }
+  if (src_data_type == DT_FLOAT && dst_data_type == DT_INT32) {
+    return func(ElementCast<float, int32_t>());
+  }
+  if (src_data_type == DT_INT32 && dst_data_type == DT_FLOAT) {
+    return func(ElementCast<int32_t, float>());
+  }
+  return UNSUPPORTED;
+}
+
+struct ElementConverterChecker {
+  template <typename Converter>
+  Status operator()(const Converter &) const {
+    return SUCCESS;
+  }
+};
+
+inline bool IsElementConverterSupported(DataType src_data_type, DataType dst_data_type) {
+  return VisitElementConverter(src_data_type, dst_data_type, ElementConverterChecker()) == SUCCESS;
+}
+}  // namespace formats
+}  // namespace ge
+#endif  // GE_COMMON_FORMATS_UTILS_FORMATS_ELEMENT_UTILS_H_
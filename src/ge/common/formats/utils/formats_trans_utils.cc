@@ -16,15 +16,31 @@
 
 #include "common/formats/utils/formats_trans_utils.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <future>
+#include <thread>
 
 #include "common/formats/utils/formats_definitions.h"
+#include "common/thread_pool.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/utils/type_utils.h"
 
 namespace ge {
 namespace formats {
+namespace {
+const int64_t kMaxTransThreadNum = 8;
+
+thread_local bool parallel_for_serial = false;
+
+ThreadPool &GetTransThreadPool() {
+  // the current thread computes a block too, the pool is shared by all the callers and created on first use
+  static ThreadPool pool(static_cast<uint32_t>(kMaxTransThreadNum - 1));
+  return pool;
+}
+}  // namespace
+
 int64_t GetCubeSizeByDataType(DataType data_type) {
   // Current cube does not support 4 bytes and longer data
   auto size = GetSizeByDataType(data_type);
@@ -82,6 +98,53 @@ bool IsShapeValid(const std::vector<int64_t> &shape) {
   return true;
 }
 
+Status ParallelFor(int64_t total, int64_t min_block_num, const std::function<Status(int64_t, int64_t)> &func) {
+  if (total <= 0) {
+    return SUCCESS;
+  }
+  int64_t thread_num = std::min(static_cast<int64_t>(std::thread::hardware_concurrency()), kMaxTransThreadNum);
+  thread_num = std::min(thread_num, total / std::max(min_block_num, static_cast<int64_t>(1)));
+  if ((thread_num <= 1) || parallel_for_serial) {
+    return func(0, total);
+  }
+
+  int64_t block_num = (total + thread_num - 1) / thread_num;
+  std::vector<Status> rets(static_cast<size_t>(thread_num), SUCCESS);
+  std::vector<std::future<void>> futures;
+  ThreadPool &pool = GetTransThreadPool();
+  int64_t begin = block_num;
+  for (int64_t i = 1; i < thread_num && begin < total; ++i, begin += block_num) {
+    int64_t end = std::min(begin + block_num, total);
+    auto f = pool.commit([&func, &rets, i, begin, end]() {
+      // a task of the pool never waits for the pool, or the nested calls may deadlock
+      SerialParallelForGuard serial_guard;
+      rets[static_cast<size_t>(i)] = func(begin, end);
+    });
+    if (!f.valid()) {
+      GELOGW("Commit trans task failed, trans [%ld, %ld) in current thread", begin, end);
+      rets[static_cast<size_t>(i)] = func(begin, end);
+      continue;
+    }
+    futures.emplace_back(std::move(f));
+  }
+  rets[0] = func(0, std::min(block_num, total));
+  for (auto &f : futures) {
+    f.wait();
+  }
+  for (auto ret : rets) {
+    if (ret != SUCCESS) {
+      return ret;
+    }
+  }
+  return SUCCESS;
+}
+
+SerialParallelForGuard::SerialParallelForGuard() : prev_serial_(parallel_for_serial) { parallel_for_serial = true; }
+
+SerialParallelForGuard::~SerialParallelForGuard() { parallel_for_serial = prev_serial_; }
+
+bool IsParallelForSerial() { return parallel_for_serial; }
+
 bool IsShapeEqual(const GeShape &src, const GeShape &dst) {
   if (src.GetDims().size() != dst.GetDims().size()) {
     return false;
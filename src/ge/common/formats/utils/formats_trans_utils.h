@@ -18,9 +18,11 @@
 #define GE_COMMON_FORMATS_UTILS_FORMATS_TRANS_UTILS_H_
 
 #include <cstdint>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <vector>
+#include "external/ge/ge_api_error_codes.h"
 #include "external/graph/types.h"
 #include "graph/ge_tensor.h"
 
@@ -68,6 +70,45 @@ T Ceil(T n1, T n2) {
   }
   return (n2 != 0) ? (n1 - 1) / n2 + 1 : 0;
 }
+
+/**
+ * An element of N bytes, so that elements of any data type can be moved by typed loops
+ * @tparam N
+ */
+template <size_t N>
+struct ElementBytes {
+  uint8_t bytes[N];
+};
+
+/**
+ * Split [0, total) into blocks of at least min_block_num and run func on each block in parallel,
+ * the first block is run by the current thread and the others by a thread pool shared by all the callers
+ * @param total
+ * @param min_block_num
+ * @param func
+ * @return the first failure of func
+ */
+Status ParallelFor(int64_t total, int64_t min_block_num, const std::function<Status(int64_t, int64_t)> &func);
+
+/**
+ * ParallelFor runs serially in the current thread while the guard lives, for the callers which are run
+ * by a thread pool already, so that the threads are not nested
+ */
+class SerialParallelForGuard {
+ public:
+  SerialParallelForGuard();
+  ~SerialParallelForGuard();
+  SerialParallelForGuard(const SerialParallelForGuard &) = delete;
+  SerialParallelForGuard &operator=(const SerialParallelForGuard &) = delete;
+
+ private:
+  bool prev_serial_;
+};
+
+/**
+ * Whether ParallelFor should run serially in the current thread
+ */
+bool IsParallelForSerial();
 }  // namespace formats
 }  // namespace ge
 #endif  // GE_COMMON_FORMATS_UTILS_FORMATS_TRANS_UTILS_H_
@@ -1,7 +1,9 @@
 LOCAL_PATH := $(call my-dir)
 
 GE_COMMON_LOCAL_SRC_FILES := \
+    cache_file_util.cc \
     context/ctx.cc \
+    content_hash_index.cc \
     model_saver.cc \
     ge/datatype_util.cc \
     helper/om_file_helper.cc \
@@ -10,6 +12,7 @@ GE_COMMON_LOCAL_SRC_FILES := \
     auth/file_saver.cc \
     fp16_t.cc \
     math/fp16_math.cc \
+    debug/async_log_sink.cc \
     debug/memory_dumper.cc \
     formats/utils/formats_trans_utils.cc \
     formats/format_transfers/datatype_transfer.cc \
@@ -15,12 +15,19 @@
  */
 
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
+#include <algorithm>
 #include <climits>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <sstream>
 
+#include "common/cache_file_util.h"
+#include "common/content_hash_index.h"
 #include "common/ge/ge_util.h"
 #include "common/helper/model_cache_helper.h"
 #include "common/types.h"
@@ -90,13 +97,306 @@ const char *const kInputSize = "inputSize";
 const char *const kOutputOffset = "outputOffset";
 const char *const kOutputSize = "outputSize";
 // Suffix of cache files
-const char *const kBeforeVarManagerSuffix = "_before_build_var_manager.json";
-const char *const kAfterVarManagerSuffix = "_after_build_var_manager.json";
+const char *const kBeforeVarManagerSuffix = "_before_build_var_manager.bin";
+const char *const kAfterVarManagerSuffix = "_after_build_var_manager.bin";
 const char *const kManifestSuffix = ".manifest";
 const char *const kOmSuffix = ".om";
+// Suffix of the json exported from cache files for debugging
+const char *const kJsonExportSuffix = ".json";
+
+const uint32_t kCacheFileMagic = 0x43424547;  // "GEBC"
+// Increase the version when the layout or the content of cache files is changed, files of other versions are missed
+const uint32_t kCacheFileVersion = 1;
+const size_t kSectionNameLen = 64;
+const size_t kSectionAlign = 8;
+const char kSectionNameSeparator = '/';
+const int kJsonIndent = 2;
 }  // namespace
 
 namespace ge {
+namespace {
+///
+/// Layout of cache files: header, section table, and msgpack encoded sections. Each top level item of the json is a
+/// section, and items of a nested object are split into sections named "item/member", so that a reader maps the
+/// file and decodes only the sections it needs. Sections are validated by their hash when decoded.
+///
+struct ManifestFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t section_num;
+  uint32_t reserved;
+};
+
+struct CacheSectionDesc {
+  char name[kSectionNameLen];
+  uint64_t offset;
+  uint64_t length;
+  uint64_t hash;
+};
+
+Status AddCacheSection(const string &name, const Json &json, vector<CacheSectionDesc> &section_descs,
+                       vector<vector<uint8_t>> &section_datas) {
+  if (name.size() >= kSectionNameLen) {
+    GELOGW("Section name %s of cache file is too long.", name.c_str());
+    return PARAM_INVALID;
+  }
+  CacheSectionDesc section_desc;
+  (void)memset(&section_desc, 0, sizeof(section_desc));
+  (void)memcpy(section_desc.name, name.data(), name.size());
+  section_datas.emplace_back(Json::to_msgpack(json));
+  section_desc.length = section_datas.back().size();
+  section_desc.hash = ContentHash(section_datas.back().data(), section_datas.back().size());
+  section_descs.emplace_back(section_desc);
+  return SUCCESS;
+}
+
+Status EncodeCacheFile(const Json &json, vector<uint8_t> &buffer) {
+  if (!json.is_object()) {
+    GELOGW("Json saved to cache file should be object.");
+    return PARAM_INVALID;
+  }
+  vector<CacheSectionDesc> section_descs;
+  vector<vector<uint8_t>> section_datas;
+  try {
+    for (auto iter = json.begin(); iter != json.end(); ++iter) {
+      const Json &value = iter.value();
+      if (!value.is_object() || value.empty()) {
+        GE_CHK_STATUS_RET_NOLOG(AddCacheSection(iter.key(), value, section_descs, section_datas));
+        continue;
+      }
+      for (auto member = value.begin(); member != value.end(); ++member) {
+        GE_CHK_STATUS_RET_NOLOG(AddCacheSection(iter.key() + kSectionNameSeparator + member.key(), member.value(),
+                                                section_descs, section_datas));
+      }
+    }
+  } catch (const std::exception &e) {
+    GELOGW("Fail to encode cache file. Error message: %s", e.what());
+    return INTERNAL_ERROR;
+  }
+
+  ManifestFileHeader header = {kCacheFileMagic, kCacheFileVersion, static_cast<uint32_t>(section_descs.size()), 0};
+  uint64_t offset = sizeof(header) + section_descs.size() * sizeof(CacheSectionDesc);
+  for (size_t i = 0; i < section_descs.size(); ++i) {
+    offset = (offset + kSectionAlign - 1) / kSectionAlign * kSectionAlign;
+    section_descs[i].offset = offset;
+    offset += section_descs[i].length;
+  }
+  buffer.assign(offset, 0);
+  (void)memcpy(buffer.data(), &header, sizeof(header));
+  if (!section_descs.empty()) {
+    (void)memcpy(buffer.data() + sizeof(header), section_descs.data(), section_descs.size() * sizeof(CacheSectionDesc));
+  }
+  for (size_t i = 0; i < section_descs.size(); ++i) {
+    if (!section_datas[i].empty()) {
+      (void)memcpy(buffer.data() + section_descs[i].offset, section_datas[i].data(), section_datas[i].size());
+    }
+  }
+  return SUCCESS;
+}
+
+}  // namespace
+
+///
+/// Read only mapping of a cache file, the header and the section table are checked when opened, and the sections
+/// are validated and decoded on demand.
+///
+class CacheFileReader {
+ public:
+  CacheFileReader() = default;
+  ~CacheFileReader() {
+    if (data_ != nullptr) {
+      (void)munmap(data_, size_);
+    }
+  }
+  CacheFileReader(const CacheFileReader &) = delete;
+  CacheFileReader &operator=(const CacheFileReader &) = delete;
+
+  Status Open(const string &path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      GELOGW("Fail to open the file: %s.", path.c_str());
+      return INTERNAL_ERROR;
+    }
+    struct stat file_stat;
+    if ((fstat(fd, &file_stat) != 0) || (static_cast<size_t>(file_stat.st_size) < sizeof(ManifestFileHeader))) {
+      GELOGW("Cache file %s is invalid.", path.c_str());
+      (void)close(fd);
+      return FAILED;
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+    void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    (void)close(fd);
+    if (data == MAP_FAILED) {
+      GELOGW("Fail to map the file: %s.", path.c_str());
+      return INTERNAL_ERROR;
+    }
+    data_ = data;
+
+    auto header = reinterpret_cast<const ManifestFileHeader *>(data_);
+    if ((header->magic != kCacheFileMagic) || (header->version != kCacheFileVersion)) {
+      GELOGW("Cache file %s is not supported, magic %u, version %u.", path.c_str(), header->magic, header->version);
+      return FAILED;
+    }
+    uint64_t table_end =
+      sizeof(ManifestFileHeader) + static_cast<uint64_t>(header->section_num) * sizeof(CacheSectionDesc);
+    if (table_end > size_) {
+      GELOGW("Section table of cache file %s is broken.", path.c_str());
+      return FAILED;
+    }
+    auto section_descs = reinterpret_cast<const CacheSectionDesc *>(reinterpret_cast<const uint8_t *>(data_) +
+                                                                     sizeof(ManifestFileHeader));
+    for (uint32_t i = 0; i < header->section_num; ++i) {
+      const CacheSectionDesc &section_desc = section_descs[i];
+      if ((section_desc.name[kSectionNameLen - 1] != '\0') || (section_desc.offset < table_end) ||
+          (section_desc.offset > size_) || (section_desc.length > size_ - section_desc.offset)) {
+        GELOGW("Section %u of cache file %s is broken.", i, path.c_str());
+        return FAILED;
+      }
+      sections_.emplace_back(&section_desc);
+    }
+    path_ = path;
+    return SUCCESS;
+  }
+
+  ///
+  /// Decode the sections of the top level items in keys to json, all sections are decoded if keys is empty
+  ///
+  Status ReadSections(const std::set<string> &keys, Json &json) const {
+    try {
+      for (const auto section_desc : sections_) {
+        string name(section_desc->name);
+        auto pos = name.find(kSectionNameSeparator);
+        string key = name.substr(0, pos);
+        if (!keys.empty() && (keys.count(key) == 0)) {
+          continue;
+        }
+        auto section_data = reinterpret_cast<const uint8_t *>(data_) + section_desc->offset;
+        if (ContentHash(section_data, section_desc->length) != section_desc->hash) {
+          GELOGW("Section %s of cache file %s is broken.", name.c_str(), path_.c_str());
+          return FAILED;
+        }
+        Json value = Json::from_msgpack(section_data, section_data + section_desc->length);
+        if (pos == string::npos) {
+          json[key] = std::move(value);
+        } else {
+          json[key][name.substr(pos + 1)] = std::move(value);
+        }
+      }
+    } catch (const std::exception &e) {
+      GELOGW("Fail to decode cache file %s. Error message: %s", path_.c_str(), e.what());
+      return INTERNAL_ERROR;
+    }
+    if (json.is_null()) {
+      json = Json::object();
+    }
+    return SUCCESS;
+  }
+
+ private:
+  void *data_ = nullptr;
+  size_t size_ = 0;
+  string path_;
+  vector<const CacheSectionDesc *> sections_;
+};
+
+namespace {
+Status SerializeNodeForHash(const NodePtr &node, ModelSerializeImp &model_serialize_imp, proto::OpDef &op_def) {
+  bool is_framework_op = (node->GetType() == FRAMEWORKOP);
+  int32_t framework_type = 0;
+  if (is_framework_op) {
+    AttrUtils::GetInt(node->GetOpDesc(), ge::ATTR_NAME_FRAMEWORK_FWK_TYPE, framework_type);
+    AttrUtils::SetInt(node->GetOpDesc(), ge::ATTR_NAME_FRAMEWORK_FWK_TYPE, 0);
+  }
+  bool ret = model_serialize_imp.SerializeNode(node, &op_def, is_framework_op);
+  op_def.set_id(0);  // Id of op is not stable because of parallel parsing
+  // Clear weights attr in constant.
+  auto attr = op_def.mutable_attr();
+  if (op_def.type() == CONSTANT || op_def.type() == CONSTANTOP) {
+    attr->erase(ATTR_NAME_WEIGHTS);
+  }
+  if (is_framework_op) {
+    AttrUtils::SetInt(node->GetOpDesc(), ge::ATTR_NAME_FRAMEWORK_FWK_TYPE, framework_type);
+  }
+  if (!ret) {
+    GELOGW("Fail to serialize node[%s].", node->GetName().c_str());
+    return INTERNAL_ERROR;
+  }
+  return SUCCESS;
+}
+
+Status AppendCanonicalGraph(const ComputeGraphPtr &compute_graph, std::stringstream &ss) {
+  ModelSerializeImp model_serialize_imp;
+  // Attributes of graph, the nodes are serialized one by one below, so they are not copied with the graph
+  auto graph_attrs = MakeShared<ComputeGraph>("");
+  GE_CHECK_NOTNULL(graph_attrs);
+  graph_attrs->CopyAttrsFrom(*compute_graph);
+  proto::GraphDef graph_proto;
+  if (!model_serialize_imp.SerializeGraph(graph_attrs, &graph_proto)) {
+    GELOGW("Serialize graph failed.");
+    return INTERNAL_ERROR;
+  }
+  string prototxt;
+  if (!google::protobuf::TextFormat::PrintToString(graph_proto, &prototxt)) {
+    GELOGW("Print GraphDef to string failed.");
+    return INTERNAL_ERROR;
+  }
+  ss << prototxt << '[';
+  for (const auto &input : compute_graph->GetInputNodes()) {
+    ss << input->GetName() << ',';
+  }
+  ss << "][";
+  for (const auto &output : compute_graph->GetOutputNodes()) {
+    ss << output->GetName() << ',';
+  }
+  ss << "];";
+
+  // The om keeps the names of ops, so the edges are kept with names too. Ids of ops are not stable and are
+  // excluded by SerializeNodeForHash.
+  vector<NodePtr> nodes;
+  if ((GraphUtils::TopologicalSortingByName(compute_graph, nodes) != GRAPH_SUCCESS) ||
+      (nodes.size() != compute_graph->GetDirectNodesSize())) {
+    GELOGW("Topological sorting graph[%s] failed.", compute_graph->GetName().c_str());
+    return INTERNAL_ERROR;
+  }
+  for (const auto &node : nodes) {
+    proto::OpDef op_def;
+    GE_CHK_STATUS_RET_NOLOG(SerializeNodeForHash(node, model_serialize_imp, op_def));
+    op_def.clear_input();
+    if (!google::protobuf::TextFormat::PrintToString(op_def, &prototxt)) {
+      GELOGW("Print OpDef to string failed.");
+      return INTERNAL_ERROR;
+    }
+    ss << prototxt << '[';
+    for (const auto &in_anchor : node->GetAllInDataAnchors()) {
+      auto peer_anchor = in_anchor->GetPeerOutAnchor();
+      if (peer_anchor == nullptr) {
+        ss << "-,";
+        continue;
+      }
+      ss << peer_anchor->GetOwnerNode()->GetName() << ':' << peer_anchor->GetIdx() << ',';
+    }
+    std::vector<string> control_inputs;
+    for (const auto &in_control_node : node->GetInControlNodes()) {
+      control_inputs.emplace_back(in_control_node->GetName());
+    }
+    std::sort(control_inputs.begin(), control_inputs.end());
+    for (const auto &name : control_inputs) {
+      ss << '^' << name << ',';
+    }
+    ss << ']';
+    // Weights are hashed by content instead of being printed
+    ConstGeTensorPtr weight;
+    if ((node->GetType() == CONSTANT || node->GetType() == CONSTANTOP) &&
+        AttrUtils::GetTensor(node->GetOpDesc(), ATTR_NAME_WEIGHTS, weight) && (weight != nullptr)) {
+      const auto &data = weight->GetData();
+      ss << "w" << data.size() << ':' << DigestToString(data.data(), data.size());
+    }
+    ss << ';';
+  }
+  return SUCCESS;
+}
+}  // namespace
+
 map<uint32_t, uint32_t> ModelCacheHelper::graph_id_run_times_;
 ModelCacheHelper::ModelCacheHelper(uint64_t session_id, uint32_t graph_id, ComputeGraphPtr &compute_graph)
     : session_id_(session_id),
@@ -139,8 +439,11 @@ ModelCacheHelper::ModelCacheHelper(uint64_t session_id, uint32_t graph_id, Compu
 ModelCacheHelper::~ModelCacheHelper() { var_names_.clear(); }
 
 bool ModelCacheHelper::IsModelCacheHit() const {
+  // the manifest is mapped once, and its sections are decoded when they are checked
+  string cache_manifest = to_string(graph_id_) + "_" + to_string(graph_id_run_times_[graph_id_]) + kManifestSuffix;
+  CacheFileReader manifest;
   CacheInfo cache_info;
-  if (GetCacheInfo(cache_info) != SUCCESS) {
+  if ((OpenCacheFile(cache_manifest, manifest) != SUCCESS) || (GetCacheInfo(manifest, cache_info) != SUCCESS)) {
     GELOGI("Get cache info of graph id[%u] failed.", graph_id_);
     return false;
   }
@@ -165,7 +468,9 @@ bool ModelCacheHelper::IsModelCacheHit() const {
     GELOGI("Graph id[%u] cache miss: the hash code of the graph does not match the cache info.", graph_id_);
     return false;
   }
-  if (!IsNodeHashSameAsCache(cache_info.nodes_hash)) {
+  // hash of nodes is the biggest part of the manifest, which is decoded only when other info matches
+  if ((GetNodesHashFromCache(manifest, cache_info.nodes_hash) != SUCCESS) ||
+      !IsNodeHashSameAsCache(cache_info.nodes_hash)) {
     GELOGI("Graph id[%u] cache miss: the hash code of node does not match the cache info.", graph_id_);
     return false;
   }
@@ -173,7 +478,7 @@ bool ModelCacheHelper::IsModelCacheHit() const {
   string var_manager_cache =
     to_string(graph_id_) + "_" + to_string(graph_id_run_times_[graph_id_]) + kBeforeVarManagerSuffix;
   Json var_manager_json;
-  if (LoadJsonFromFile(var_manager_cache, var_manager_json) != SUCCESS) {
+  if (LoadCacheFromFile(var_manager_cache, {}, var_manager_json) != SUCCESS) {
     GELOGW("Fail to load json from cache file: %s", var_manager_cache.c_str());
     return false;
   }
@@ -250,7 +555,7 @@ Status ModelCacheHelper::RecoverVarManagerFromCache() const {
   string var_manager_cache =
     to_string(graph_id_) + "_" + to_string(graph_id_run_times_[graph_id_]) + kAfterVarManagerSuffix;
   Json var_manager_json;
-  if (LoadJsonFromFile(var_manager_cache, var_manager_json) != SUCCESS) {
+  if (LoadCacheFromFile(var_manager_cache, {kMemResourceMap, kVarResource}, var_manager_json) != SUCCESS) {
     GELOGW("Fail to load json from cache file: %s", var_manager_cache.c_str());
     return FAILED;
   }
@@ -374,28 +679,11 @@ Status ModelCacheHelper::GetNodesHash(map<std::string, size_t> &hash_map) const
       continue;
     }
     proto::OpDef op_def;
-    bool is_framework_op = (node->GetType() == FRAMEWORKOP);
-    int32_t framework_type = 0;
-    if (is_framework_op) {
-      AttrUtils::GetInt(node->GetOpDesc(), ge::ATTR_NAME_FRAMEWORK_FWK_TYPE, framework_type);
-      AttrUtils::SetInt(node->GetOpDesc(), ge::ATTR_NAME_FRAMEWORK_FWK_TYPE, 0);
-    }
-    bool ret = model_serialize_imp.SerializeNode(node, &op_def, is_framework_op);
-    op_def.set_id(0);  // Id of op is not stable because of parallel parsing
-    // Clear weights attr in constant.
-    auto attr = op_def.mutable_attr();
-    if (op_def.type() == CONSTANT || op_def.type() == CONSTANTOP) {
-      attr->erase(ATTR_NAME_WEIGHTS);
-    }
-    if (is_framework_op) {
-      AttrUtils::SetInt(node->GetOpDesc(), ge::ATTR_NAME_FRAMEWORK_FWK_TYPE, framework_type);
-    }
-    if (!ret) {
-      GELOGW("Fail to serialize node[%s].", node->GetName().c_str());
+    if (SerializeNodeForHash(node, model_serialize_imp, op_def) != SUCCESS) {
       return INTERNAL_ERROR;
     }
     string prototxt;
-    ret = google::protobuf::TextFormat::PrintToString(op_def, &prototxt);
+    bool ret = google::protobuf::TextFormat::PrintToString(op_def, &prototxt);
     if (!ret) {
       GELOGW("Print OpDef to string failed.");
       hash_map.clear();
@@ -407,6 +695,28 @@ Status ModelCacheHelper::GetNodesHash(map<std::string, size_t> &hash_map) const
   return SUCCESS;
 }
 
+Status ModelCacheHelper::GetCanonicalGraph(const ComputeGraphPtr &compute_graph, std::string &canonical_graph) {
+  GE_CHECK_NOTNULL(compute_graph);
+  std::stringstream ss;
+  GE_CHK_STATUS_RET_NOLOG(AppendCanonicalGraph(compute_graph, ss));
+  for (const auto &subgraph : compute_graph->GetAllSubgraphs()) {
+    GE_CHECK_NOTNULL(subgraph);
+    ss << subgraph->GetName() << ';';
+    GE_CHK_STATUS_RET_NOLOG(AppendCanonicalGraph(subgraph, ss));
+  }
+  canonical_graph = ss.str();
+  return SUCCESS;
+}
+
+Status ModelCacheHelper::GetCanonicalGraphDigest(const ComputeGraphPtr &compute_graph, std::string &digest) {
+  std::string canonical_graph;
+  GE_CHK_STATUS_RET_NOLOG(GetCanonicalGraph(compute_graph, canonical_graph));
+  digest = DigestToString(canonical_graph.data(), canonical_graph.size());
+  GELOGD("Canonical digest of graph[%s] is %s, length %zu.", compute_graph->GetName().c_str(), digest.c_str(),
+         canonical_graph.size());
+  return SUCCESS;
+}
+
 Status ModelCacheHelper::GetComputeGraphHash(size_t &hash) const {
   proto::GraphDef graph_proto;
   ModelSerializeImp model_serialize_imp;
@@ -435,7 +745,7 @@ Status ModelCacheHelper::GetComputeGraphHash(size_t &hash) const {
   return SUCCESS;
 }
 
-Status ModelCacheHelper::SaveJsonToFile(const string &file_name, const Json &json) const {
+Status ModelCacheHelper::SaveCacheToFile(const string &file_name, const Json &json) const {
   if (!is_cache_path_valid_for_output) {
     GELOGW("Invalid cache path.");
     return PARAM_INVALID;
@@ -446,6 +756,12 @@ Status ModelCacheHelper::SaveJsonToFile(const string &file_name, const Json &jso
     GELOGW("File path is invalid. please check cache path: %s", cache_path_.c_str());
     return FAILED;
   }
+  vector<uint8_t> buffer;
+  Status ret = EncodeCacheFile(json, buffer);
+  if (ret != SUCCESS) {
+    GELOGW("Fail to encode cache file: %s.", file_name.c_str());
+    return ret;
+  }
   const string path = cache_path_ + file_name;
   const int FILE_AUTHORITY = 0600;
   int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, FILE_AUTHORITY);
@@ -458,23 +774,32 @@ Status ModelCacheHelper::SaveJsonToFile(const string &file_name, const Json &jso
     return INTERNAL_ERROR;
   }
 
-  // Write json into cache file
+  // Write binary cache into cache file
   ofstream ofs;
-  ofs.open(path);
+  ofs.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
   if (!ofs.is_open()) {
     GELOGW("Fail to open the file: %s.", path.c_str());
     return INTERNAL_ERROR;
   }
-  ofs << json << std::endl;
+  (void)ofs.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
   ofs.close();
+  if (!ofs.good()) {
+    GELOGW("Fail to write the file: %s.", path.c_str());
+    return INTERNAL_ERROR;
+  }
+
+  // Export readable json for debugging
+  if (IsLogEnable(GE_MODULE_NAME, DLOG_DEBUG)) {
+    ofstream json_ofs(path + kJsonExportSuffix);
+    if (json_ofs.is_open()) {
+      json_ofs << json.dump(kJsonIndent) << std::endl;
+      json_ofs.close();
+    }
+  }
   return SUCCESS;
 }
 
-Status ModelCacheHelper::LoadJsonFromFile(const string &file_name, Json &json) const {
-  if (!json.is_null()) {
-    GELOGW("Input param json type should be null.");
-    return PARAM_INVALID;
-  }
+Status ModelCacheHelper::OpenCacheFile(const string &file_name, CacheFileReader &reader) const {
   string real_path = RealPath(cache_path_.c_str());
   if (real_path.empty()) {
     GELOGW("File path is invalid. please check cache path: %s", cache_path_.c_str());
@@ -490,16 +815,28 @@ Status ModelCacheHelper::LoadJsonFromFile(const string &file_name, Json &json) c
     GELOGI("File[%s] is not found.", path.c_str());
     return FAILED;
   }
-  // Read json from cache file
-  ifstream ifs;
-  ifs.open(path);
-  if (!ifs.is_open()) {
-    GELOGW("Fail to open the file: %s.", path.c_str());
-    return INTERNAL_ERROR;
+  Status ret = reader.Open(cache_real_path);
+  if (ret != SUCCESS) {
+    GELOGW("Fail to open the cache file: %s.", path.c_str());
+    return ret;
   }
-  ifs >> json;
-  if (!json.is_object()) {
-    GELOGW("Fail to load the json file: %s.", path.c_str());
+  return SUCCESS;
+}
+
+Status ModelCacheHelper::LoadCacheFromFile(const string &file_name, const std::set<string> &keys, Json &json) const {
+  if (!json.is_null()) {
+    GELOGW("Input param json type should be null.");
+    return PARAM_INVALID;
+  }
+  // Read the sections from cache file
+  CacheFileReader reader;
+  Status ret = OpenCacheFile(file_name, reader);
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  ret = reader.ReadSections(keys, json);
+  if ((ret != SUCCESS) || !json.is_object()) {
+    GELOGW("Fail to load the cache file: %s.", file_name.c_str());
     return INTERNAL_ERROR;
   }
   return SUCCESS;
@@ -538,7 +875,7 @@ Status ModelCacheHelper::SaveCacheInfoToCache() const {
   }
   string cache_manifest = to_string(graph_id_) + "_" + to_string(graph_id_run_times_[graph_id_]) + kManifestSuffix;
 
-  auto ret = SaveJsonToFile(cache_manifest, cache_json);
+  auto ret = SaveCacheToFile(cache_manifest, cache_json);
   if (ret != SUCCESS) {
     GELOGW("Fail to save cache info to json file, path: %s.", cache_path_.c_str());
     return ret;
@@ -546,28 +883,38 @@ Status ModelCacheHelper::SaveCacheInfoToCache() const {
   return SUCCESS;
 }
 
-Status ModelCacheHelper::GetCacheInfo(CacheInfo &cache_info) const {
-  string cache_manifest = to_string(graph_id_) + "_" + to_string(graph_id_run_times_[graph_id_]) + kManifestSuffix;
+Status ModelCacheHelper::GetCacheInfo(const CacheFileReader &manifest, CacheInfo &cache_info) const {
   Json cache_json;
-  if (LoadJsonFromFile(cache_manifest, cache_json) != SUCCESS) {
-    GELOGW("Fail to load json from cache file: %s", cache_manifest.c_str());
-    return INTERNAL_ERROR;
-  }
-  if (!cache_json.is_object()) {
-    GELOGW("Manifest should be a json object");
+  if (manifest.ReadSections({kNodeNum, kEdgeNum, kGraphHash}, cache_json) != SUCCESS) {
+    GELOGW("Fail to load cache info from manifest of graph id[%u].", graph_id_);
     return INTERNAL_ERROR;
   }
   try {
     cache_info.node_num = cache_json[kNodeNum];
     cache_info.edge_num = cache_json[kEdgeNum];
     cache_info.graph_hash = cache_json[kGraphHash];
+  } catch (const std::exception &e) {
+    GELOGW("Fail to get info from json file. Error message: %s", e.what());
+    return INTERNAL_ERROR;
+  }
+  return SUCCESS;
+}
+
+Status ModelCacheHelper::GetNodesHashFromCache(const CacheFileReader &manifest,
+                                               map<std::string, size_t> &hash_map) const {
+  Json cache_json;
+  if (manifest.ReadSections({kNodeHash}, cache_json) != SUCCESS) {
+    GELOGW("Fail to load nodes hash from manifest of graph id[%u].", graph_id_);
+    return INTERNAL_ERROR;
+  }
+  try {
     Json nodes_hash_json = cache_json[kNodeHash];
     if (!(nodes_hash_json.is_null() || nodes_hash_json.is_array())) {
       GELOGW("Nodes hash in cache should be null or array.");
       return FAILED;
     }
     for (const auto &iter : nodes_hash_json) {
-      cache_info.nodes_hash[iter[kName].get<std::string>()] = iter[kHash].get<size_t>();
+      hash_map[iter[kName].get<std::string>()] = iter[kHash].get<size_t>();
     }
   } catch (const std::exception &e) {
     GELOGW("Fail to get info from json file. Error message: %s", e.what());
@@ -1440,7 +1787,7 @@ Status ModelCacheHelper::SaveVarManagerToCache(bool before_build) const {
   }
   string var_manager_path = to_string(graph_id_) + "_" + to_string(graph_id_run_times_[graph_id_]) +
                             (before_build ? kBeforeVarManagerSuffix : kAfterVarManagerSuffix);
-  ret = SaveJsonToFile(var_manager_path, var_manager_json);
+  ret = SaveCacheToFile(var_manager_path, var_manager_json);
   if (ret != SUCCESS) {
     GELOGW("Fail to save VarManager info to json file, path: %s.", cache_path_.c_str());
     return ret;
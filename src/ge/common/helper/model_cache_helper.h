@@ -29,6 +29,8 @@
 namespace ge {
 using Json = nlohmann::json;
 
+class CacheFileReader;
+
 struct CacheInfo {
   size_t node_num;
   size_t edge_num;
@@ -51,10 +53,29 @@ class ModelCacheHelper {
   Status RefreshComputeGraph(const ComputeGraphPtr &compute_graph);
   Status ClearCache(uint32_t graph_id) const;
 
+  ///
+  /// @brief Get the 128-bit digest of graph which does not depend on ids of nodes, it covers nodes with their
+  ///        names, edges, attributes and digest of weights of graph and its subgraphs. The name of the root graph
+  ///        is excluded, callers which keep it in the model add it to their keys.
+  /// @param [in] compute_graph
+  /// @param [out] digest
+  /// @return Status
+  ///
+  static Status GetCanonicalGraphDigest(const ComputeGraphPtr &compute_graph, std::string &digest);
+
+  ///
+  /// @brief Get the canonical text of graph which GetCanonicalGraphDigest is computed from
+  /// @param [in] compute_graph
+  /// @param [out] canonical_graph
+  /// @return Status
+  ///
+  static Status GetCanonicalGraph(const ComputeGraphPtr &compute_graph, std::string &canonical_graph);
+
  private:
   Status GetComputeGraphHash(size_t &hash) const;
   Status GetNodesHash(map<std::string, size_t> &hash_map) const;
-  Status GetCacheInfo(CacheInfo &cache_info) const;
+  Status GetCacheInfo(const CacheFileReader &manifest, CacheInfo &cache_info) const;
+  Status GetNodesHashFromCache(const CacheFileReader &manifest, map<std::string, size_t> &hash_map) const;
 
   Status RecoverMemResource(const Json &json) const;
   Status RecoverAllocatedGraphId(const Json &json) const;
@@ -76,8 +97,30 @@ class ModelCacheHelper {
   bool IsVarManagerSameAsCache(Json &json) const;
   bool IsVarManagerParamSameAsCache(Json &json) const;
 
-  Status SaveJsonToFile(const string &file_name, const Json &json) const;
-  Status LoadJsonFromFile(const string &file_name, Json &json) const;
+  ///
+  /// @brief Save json to cache file in binary format, readable json is exported as well when debug log is enabled
+  /// @param [in] file_name
+  /// @param [in] json
+  /// @return Status
+  ///
+  Status SaveCacheToFile(const string &file_name, const Json &json) const;
+
+  ///
+  /// @brief Load json from cache file, only the sections of the top level items in keys are decoded
+  /// @param [in] file_name
+  /// @param [in] keys top level items to load, all items are loaded if it is empty
+  /// @param [out] json
+  /// @return Status
+  ///
+  Status LoadCacheFromFile(const string &file_name, const std::set<string> &keys, Json &json) const;
+
+  ///
+  /// @brief Open cache file, the file keeps mapped until the reader is destroyed
+  /// @param [in] file_name
+  /// @param [out] reader
+  /// @return Status
+  ///
+  Status OpenCacheFile(const string &file_name, CacheFileReader &reader) const;
 
   Status GetNodesHashMapJson(Json &json) const;
   Status GetMemResourceMap(Json &json) const;
@@ -15,6 +15,7 @@
  */
 
 #include "common/model_parser/base.h"
+#include "common/auth/file_saver.h"
 #include "common/helper/model_helper.h"
 #include <securec.h>
 #include <sys/sysinfo.h>
@@ -62,6 +63,12 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status ModelParserBase::LoadFro
 
   // read data as a block:
   (void)fs.read(data, len);
+  // the om file is verified by the chunk checksums saved beside it, see ge.omChunkChecksum
+  Status ret = FileSaver::CheckChecksumFile(real_path, data, len);
+  if (ret != SUCCESS) {
+    delete[] data;
+    return ret;
+  }
   ModelHelper model_helper;
   model_helper.GetBaseNameFromFileName(model_path, model_data.om_name);
   // Set the model data parameter
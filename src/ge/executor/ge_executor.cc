@@ -19,6 +19,7 @@
 #include <cce/compiler_stub.h>
 #include <ctime>
 #include <iostream>
+#include "common/debug/async_log_sink.h"
 #include "common/debug/log.h"
 #include "common/ge/ge_util.h"
 #include "common/helper/model_helper.h"
@@ -35,6 +36,7 @@
 #include "graph/utils/graph_utils.h"
 #include "mmpa/mmpa_api.h"
 #include "single_op/single_op_manager.h"
+#include "single_op/single_op_plan.h"
 
 using std::string;
 using std::vector;
@@ -206,10 +208,15 @@ Status GeExecutor::Initialize() {
     return ge::SUCCESS;
   }
 
+  if (AsyncLogSink::Instance().Start() != SUCCESS) {
+    GELOGW("Failed to start async log sink, logs are written synchronously.");
+  }
+
   std::vector<rtMemType_t> mem_type(1, RT_MEMORY_HBM);
   auto ret = MemManager::Instance().Initialize(mem_type);
   if (ret != SUCCESS) {
     GELOGE(ret, "Memory Manager init failed.");
+    AsyncLogSink::Instance().Stop();
     return ret;
   }
 
@@ -238,6 +245,7 @@ Status GeExecutor::Finalize() {
   }
 
   GELOGI("Uninit GeExecutor over.");
+  AsyncLogSink::Instance().Stop();
   return ge::SUCCESS;
 }
 
@@ -958,6 +966,38 @@ Status GeExecutor::ExecuteAsync(SingleOp *executor, const std::vector<DataBuffer
   return executor->ExecuteAsync(inputs, outputs);
 }
 
+Status GeExecutor::CreateSingleOpPlan(SingleOpPlan **plan) {
+  GE_CHECK_NOTNULL(plan);
+  *plan = new (std::nothrow) SingleOpPlan();
+  if (*plan == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "new SingleOpPlan failed");
+    return MEMALLOC_FAILED;
+  }
+  return SUCCESS;
+}
+
+Status GeExecutor::CaptureSingleOp(SingleOpPlan *plan, SingleOp *executor, const std::vector<DataBuffer> &inputs,
+                                   const std::vector<DataBuffer> &outputs) {
+  GE_CHECK_NOTNULL(plan);
+  return plan->Capture(executor, inputs, outputs);
+}
+
+Status GeExecutor::RebindSingleOp(SingleOpPlan *plan, size_t index, const std::vector<DataBuffer> &inputs,
+                                  const std::vector<DataBuffer> &outputs) {
+  GE_CHECK_NOTNULL(plan);
+  return plan->Rebind(index, inputs, outputs);
+}
+
+Status GeExecutor::ReplaySingleOpPlan(SingleOpPlan *plan) {
+  GE_CHECK_NOTNULL(plan);
+  return plan->Replay();
+}
+
+Status GeExecutor::DestroySingleOpPlan(SingleOpPlan *plan) {
+  delete plan;
+  return SUCCESS;
+}
+
 ge::Status GeExecutor::ExecuteAsync(DynamicSingleOp *executor, const vector<GeTensorDesc> &input_desc,
                                     const vector<DataBuffer> &inputs, vector<GeTensorDesc> &output_desc,
                                     vector<DataBuffer> &outputs) {
@@ -965,6 +1005,18 @@ ge::Status GeExecutor::ExecuteAsync(DynamicSingleOp *executor, const vector<GeTe
   return executor->ExecuteAsync(input_desc, inputs, output_desc, outputs);
 }
 
+Status GeExecutor::GetDynamicSingleOpCacheStats(DynamicSingleOp *executor, DynamicSingleOpCacheStats &stats) {
+  GE_CHECK_NOTNULL(executor);
+  executor->GetCacheStats(stats);
+  return SUCCESS;
+}
+
+Status GeExecutor::SetDynamicSingleOpCacheCapacity(DynamicSingleOp *executor, size_t capacity) {
+  GE_CHECK_NOTNULL(executor);
+  executor->SetCacheCapacity(capacity);
+  return SUCCESS;
+}
+
 Status GeExecutor::ReleaseSingleOpResource(void *stream) {
   return SingleOpManager::GetInstance().ReleaseResource(stream);
 }
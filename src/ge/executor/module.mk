@@ -49,6 +49,8 @@ local_ge_executor_src_files :=  \
     ../single_op/single_op_manager.cc \
     ../single_op/single_op_model.cc \
     ../single_op/single_op.cc \
+    ../single_op/single_op_plan.cc \
+    ../single_op/run_info_cache.cc \
     ../single_op/stream_resource.cc \
     ../single_op/task/op_task.cc \
     ../single_op/task/build_task_utils.cc \
@@ -52,6 +52,7 @@ GRAPH_MANAGER_LOCAL_SRC_FILES := \
     graph/partition/engine_place.cc \
     graph/partition/graph_partition.cc \
     graph/partition/dynamic_shape_partition.cc \
+    generator/compile_cache.cc \
     generator/ge_generator.cc \
     generator/generator_api.cc \
     graph/manager/graph_var_manager.cc \
@@ -99,6 +100,7 @@ OMG_HOST_SRC_FILES := \
     graph/passes/mark_graph_unknown_status_pass.cc \
     graph/common/omg_util.cc \
     graph/common/bcast.cc \
+    graph/common/constant_folding_cache.cc \
     graph/passes/dimension_compute_pass.cc \
     graph/passes/dimension_adjust_pass.cc \
     graph/passes/get_original_format_pass.cc \
@@ -237,6 +239,8 @@ OME_HOST_SRC_FILES := \
     single_op/task/aicpu_task_builder.cc                                 \
     single_op/task/aicpu_kernel_task_builder.cc                          \
     single_op/single_op.cc                                               \
+    single_op/single_op_plan.cc                                          \
+    single_op/run_info_cache.cc                                          \
     single_op/single_op_model.cc                                         \
     single_op/stream_resource.cc                                         \
     single_op/single_op_manager.cc                                       \
@@ -284,6 +288,7 @@ NEW_OMG_HOST_SRC_FILES := \
     graph/build/stream_allocator.cc \
     graph/build/logical_stream_allocator.cc \
     graph/build/stream_graph_optimizer.cc \
+    graph/build/sync_event_optimizer.cc \
     graph/build/run_context.cc \
     graph/build/label_allocator.cc \
     graph/label/label_maker.cc \
@@ -28,6 +28,7 @@ LIBGE_LOCAL_SRC_FILES := \
     common/profiling/profiling_manager.cc \
     engine_manager/dnnengine_manager.cc \
     ge_local_engine/engine/host_cpu_engine.cc \
+    generator/compile_cache.cc \
     generator/ge_generator.cc \
     generator/generator_api.cc \
     graph/build/graph_builder.cc \
@@ -37,8 +38,10 @@ LIBGE_LOCAL_SRC_FILES := \
     graph/build/run_context.cc \
     graph/build/stream_allocator.cc \
     graph/build/stream_graph_optimizer.cc \
+    graph/build/sync_event_optimizer.cc \
     graph/build/task_generator.cc \
     graph/common/bcast.cc \
+    graph/common/constant_folding_cache.cc \
     graph/common/omg_util.cc \
     graph/common/transop_util.cc \
     graph/execute/graph_execute.cc \
@@ -234,6 +237,8 @@ LIBGE_LOCAL_SRC_FILES := \
     session/inner_session.cc \
     session/session_manager.cc \
     single_op/single_op.cc \
+    single_op/single_op_plan.cc \
+    single_op/run_info_cache.cc \
     single_op/single_op_manager.cc \
     single_op/single_op_model.cc \
     single_op/stream_resource.cc \
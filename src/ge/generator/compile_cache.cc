@@ -0,0 +1,158 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "generator/compile_cache.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "common/cache_file_util.h"
+#include "common/helper/model_cache_helper.h"
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/util.h"
+
+namespace ge {
+namespace {
+const uint32_t kCacheFileMagic = 0x43434547;  // "GECC"
+// Increase the version when the key or the file content is changed, files of other versions are discarded
+const uint32_t kCacheFileVersion = 3;
+const char *const kCacheFileSuffix = ".om";
+}  // namespace
+
+Status CompileCache::Init(const std::string &cache_dir) {
+  if (cache_dir.empty()) {
+    GELOGE(PARAM_INVALID, "Compile cache dir is empty.");
+    return PARAM_INVALID;
+  }
+  if (CreateDirectory(cache_dir) != 0) {
+    GELOGE(FAILED, "Failed to create compile cache dir %s.", cache_dir.c_str());
+    return FAILED;
+  }
+  cache_dir_ = RealPath(cache_dir.c_str());
+  if (cache_dir_.empty()) {
+    GELOGE(FAILED, "Compile cache dir %s is invalid.", cache_dir.c_str());
+    return FAILED;
+  }
+  enabled_ = true;
+  GELOGI("Compile cache %s opened.", cache_dir_.c_str());
+  return SUCCESS;
+}
+
+Status CompileCache::GenerateKey(const ComputeGraphPtr &compute_graph, const std::vector<GeTensor> &inputs,
+                                 const std::map<std::string, std::string> &fingerprints, CompileCacheKey &key) {
+  GE_CHECK_NOTNULL(compute_graph);
+  std::string canonical_graph;
+  Status ret = ModelCacheHelper::GetCanonicalGraph(compute_graph, canonical_graph);
+  if (ret != SUCCESS) {
+    GELOGW("Failed to get canonical graph of graph %s.", compute_graph->GetName().c_str());
+    return ret;
+  }
+  std::stringstream ss;
+  ss << kCacheFileVersion << ';' << DigestToString(canonical_graph.data(), canonical_graph.size()) << ';';
+  for (const auto &input : inputs) {
+    AppendTensorDesc(input.GetTensorDesc(), ss);
+  }
+  // std::map keeps the options in order, so the key does not depend on the order they are set
+  for (const auto &item : fingerprints) {
+    ss << item.first.size() << ':' << item.first << '=' << item.second.size() << ':' << item.second << ';';
+  }
+  std::string key_material = ss.str();
+  key.key = DigestToString(key_material.data(), key_material.size());
+  // the digests are only used to name the file, the full signature is compared on lookup
+  key.signature = key_material + '\n' + canonical_graph;
+  GELOGD("Compile cache key of graph %s is %s.", compute_graph->GetName().c_str(), key.key.c_str());
+  return SUCCESS;
+}
+
+bool CompileCache::Lookup(const CompileCacheKey &key, ModelBufferData &model) const {
+  if (!enabled_ || key.key.empty()) {
+    return false;
+  }
+  std::string path = GetEntryPath(key.key);
+  std::ifstream ifs(path, std::ios::in | std::ios::binary);
+  if (!ifs.is_open()) {
+    GELOGD("Compile cache %s missed.", key.key.c_str());
+    return false;
+  }
+  CacheFileHeader header = {0, 0, 0};
+  (void)ifs.seekg(0, std::ios::end);
+  uint64_t file_size = static_cast<uint64_t>(ifs.tellg());
+  (void)ifs.seekg(0, std::ios::beg);
+  if (file_size >= sizeof(header)) {
+    (void)ifs.read(reinterpret_cast<char *>(&header), sizeof(header));
+  }
+  uint64_t signature_size = 0;
+  if ((header.magic == kCacheFileMagic) && (header.version == kCacheFileVersion) &&
+      (header.length == file_size - sizeof(header)) && (header.length > sizeof(signature_size))) {
+    (void)ifs.read(reinterpret_cast<char *>(&signature_size), sizeof(signature_size));
+  }
+  if ((signature_size == 0) || (signature_size >= header.length - sizeof(signature_size))) {
+    GELOGW("Compile cache file %s is invalid, version %u, ignore it.", path.c_str(), header.version);
+    return false;
+  }
+  if (signature_size != key.signature.size()) {
+    GELOGW("Compile cache %s is of other graph or options, the digests collide.", key.key.c_str());
+    return false;
+  }
+  std::string signature(signature_size, '\0');
+  if (!ifs.read(&signature[0], signature_size) || (signature != key.signature)) {
+    GELOGW("Compile cache %s is of other graph or options, the digests collide.", key.key.c_str());
+    return false;
+  }
+  uint64_t model_size = header.length - sizeof(signature_size) - signature_size;
+  auto buff = reinterpret_cast<uint8_t *>(malloc(model_size));
+  if (buff == nullptr) {
+    GELOGW("Failed to malloc %lu bytes for compile cache %s.", model_size, key.key.c_str());
+    return false;
+  }
+  std::shared_ptr<uint8_t> data(buff, [](uint8_t *buff) { free(buff); });
+  if (!ifs.read(reinterpret_cast<char *>(buff), model_size)) {
+    GELOGW("Failed to read compile cache file %s.", path.c_str());
+    return false;
+  }
+  model.data = data;
+  model.length = model_size;
+  GELOGI("Compile cache %s hit, size %lu.", key.key.c_str(), model_size);
+  return true;
+}
+
+Status CompileCache::Store(const CompileCacheKey &key, const uint8_t *data, uint64_t size) const {
+  if (!enabled_ || key.key.empty()) {
+    return SUCCESS;
+  }
+  GE_CHECK_NOTNULL(data);
+  if ((size == 0) || key.signature.empty()) {
+    GELOGE(PARAM_INVALID, "Model or signature of compile cache %s is empty.", key.key.c_str());
+    return PARAM_INVALID;
+  }
+  // payload: signature size, signature, om model
+  uint64_t signature_size = key.signature.size();
+  if (WriteCacheFile(GetEntryPath(key.key), kCacheFileMagic, kCacheFileVersion,
+                     {{&signature_size, sizeof(signature_size)},
+                      {key.signature.data(), signature_size},
+                      {data, size}}) != SUCCESS) {
+    GELOGW("Failed to save compile cache %s.", key.key.c_str());
+    return FAILED;
+  }
+  GELOGI("Compile cache %s saved, size %lu.", key.key.c_str(), size);
+  return SUCCESS;
+}
+
+std::string CompileCache::GetEntryPath(const std::string &key) const {
+  return cache_dir_ + "/" + key + kCacheFileSuffix;
+}
+}  // namespace ge
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GENERATOR_COMPILE_CACHE_H_
+#define GE_GENERATOR_COMPILE_CACHE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "framework/common/ge_inner_error_codes.h"
+#include "ge/ge_ir_build.h"
+#include "graph/compute_graph.h"
+#include "graph/ge_tensor.h"
+
+namespace ge {
+struct CompileCacheKey {
+  // digest of the signature, which names the cache file
+  std::string key;
+  // canonical graph, inputs, build options, omg context and versions, saved in the cache file and compared on lookup
+  std::string signature;
+};
+
+///
+/// @brief On-disk cache of the om models generated by GeGenerator. Each entry is a file in the cache directory,
+///        named by the digest of (canonical graph, inputs, build options, omg context, versions). The entry keeps
+///        the full signature, so a digest collision is a miss.
+///
+class CompileCache {
+ public:
+  CompileCache() = default;
+  ~CompileCache() = default;
+  CompileCache(const CompileCache &) = delete;
+  CompileCache &operator=(const CompileCache &) = delete;
+
+  ///
+  /// @brief Open the cache directory, the directory is created if it does not exist
+  /// @param [in] cache_dir
+  /// @return Status
+  ///
+  Status Init(const std::string &cache_dir);
+
+  bool IsEnabled() const { return enabled_; }
+
+  ///
+  /// @brief Generate the key of the model built from graph
+  /// @param [in] compute_graph graph before building
+  /// @param [in] inputs
+  /// @param [in] fingerprints build options and versions which the model depends on, the versions of atc, opp and
+  ///             the engine plugins must be included
+  /// @param [out] key
+  /// @return Status
+  ///
+  static Status GenerateKey(const ComputeGraphPtr &compute_graph, const std::vector<GeTensor> &inputs,
+                            const std::map<std::string, std::string> &fingerprints, CompileCacheKey &key);
+
+  ///
+  /// @brief Thread safe. Get the om model cached by key, the entry is a miss unless its signature is the same
+  /// @param [in] key
+  /// @param [out] model
+  /// @return true if hit
+  ///
+  bool Lookup(const CompileCacheKey &key, ModelBufferData &model) const;
+
+  ///
+  /// @brief Thread safe. Save the om model to the cache
+  /// @param [in] key
+  /// @param [in] data
+  /// @param [in] size
+  /// @return Status
+  ///
+  Status Store(const CompileCacheKey &key, const uint8_t *data, uint64_t size) const;
+
+ private:
+  std::string GetEntryPath(const std::string &key) const;
+
+  bool enabled_ = false;
+  std::string cache_dir_;
+};
+}  // namespace ge
+
+#endif  // GE_GENERATOR_COMPILE_CACHE_H_
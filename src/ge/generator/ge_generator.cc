@@ -15,16 +15,28 @@
  */
 
 #include "generator/ge_generator.h"
+
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <fstream>
+#include <sstream>
+
+#include "common/auth/file_saver.h"
 #include "common/ge/ge_util.h"
 #include "common/ge/plugin_manager.h"
 #include "common/helper/model_helper.h"
 #include "common/helper/om_file_helper.h"
+#include "common/string_util.h"
 #include "common/util.h"
 #include "common/util/error_manager/error_manager.h"
 #include "framework/common/debug/ge_log.h"
 #include "ge/ge_api.h"
+#include "generator/compile_cache.h"
 #include "graph/debug/ge_attr_define.h"
 #include "graph/ge_context.h"
+#include "graph/ge_global_options.h"
 #include "graph/manager/graph_manager.h"
 #include "graph/manager/util/rt_context_util.h"
 #include "graph/opsproto_manager.h"
@@ -43,6 +55,7 @@ const char *const kEngineNameDefault = "default";
 const char *const kVectorEngine = "VectorEngine";
 const char *const kAIcoreEngine = "AIcoreEngine";
 const char *const kFileNameSuffix = "online";
+const char *const kTrueStr = "true";
 
 std::map<ge::OpEngineType, std::string> engine_type_map{
   {ge::ENGINE_SYS, kEngineNameDefault}, {ge::ENGINE_AICORE, kAIcoreEngine}, {ge::ENGINE_VECTOR, kVectorEngine}};
@@ -56,6 +69,48 @@ bool ContainsDynamicInpus(const ge::OpDesc &op_desc) {
   }
   return false;
 }
+
+template <typename T>
+std::string JoinDims(const T &dims) {
+  std::string str;
+  for (auto dim : dims) {
+    str += std::to_string(dim) + ",";
+  }
+  return str;
+}
+
+// Fields of omg context which are set by the parser and atc, and change the built model. They are read from the
+// context bound to the build, single ops built concurrently each have their own one.
+void GetOmgContextFingerprints(std::map<std::string, std::string> &fingerprints) {
+  const ge::OmgContext &context = domi::GetContext();
+  fingerprints["omg.format"] = std::to_string(static_cast<int32_t>(context.format));
+  fingerprints["omg.net_format"] = std::to_string(static_cast<int32_t>(context.net_format));
+  fingerprints["omg.type"] = std::to_string(static_cast<int32_t>(context.type));
+  fingerprints["omg.output_type"] = context.output_type;
+  fingerprints["omg.is_dynamic_input"] = std::to_string(context.is_dynamic_input);
+  fingerprints["omg.dynamic_batch_size"] = context.dynamic_batch_size;
+  fingerprints["omg.dynamic_image_size"] = context.dynamic_image_size;
+  fingerprints["omg.dynamic_dims"] = context.dynamic_dims;
+  for (const auto &item : context.input_nodes_format_map) {
+    fingerprints["omg.input_format." + item.first] = std::to_string(static_cast<int32_t>(item.second));
+  }
+  for (const auto &item : context.input_dims) {
+    fingerprints["omg.input_dims." + item.first] = JoinDims(item.second);
+  }
+  std::string user_input_dims;
+  for (const auto &item : context.user_input_dims) {
+    user_input_dims += item.first + ":" + JoinDims(item.second) + ";";
+  }
+  fingerprints["omg.user_input_dims"] = user_input_dims;
+  for (const auto &item : context.out_nodes_map) {
+    fingerprints["omg.out_nodes." + item.first] = JoinDims(item.second);
+  }
+  std::string user_out_nodes;
+  for (const auto &item : context.user_out_nodes) {
+    user_out_nodes += item.first + ":" + std::to_string(item.second) + ";";
+  }
+  fingerprints["omg.user_out_nodes"] = user_out_nodes;
+}
 }  // namespace
 
 namespace ge {
@@ -189,6 +244,17 @@ static Status AddOutputs(const ComputeGraphPtr &graph, const NodePtr &node, cons
   return SUCCESS;
 }
 
+// Session id is derived from the time, and kept unique since single ops may be built concurrently
+static uint64_t GetUniqueSessionId(uint64_t time_based_id) {
+  static std::atomic<uint64_t> last_session_id(0);
+  uint64_t last_id = last_session_id.load();
+  uint64_t session_id = 0;
+  do {
+    session_id = std::max(time_based_id, last_id + 1);
+  } while (!last_session_id.compare_exchange_weak(last_id, session_id));
+  return session_id;
+}
+
 static void GetOpsProtoPath(string &opsproto_path) {
   GELOGI("Start to get ops proto path schedule.");
   const char *path_env = std::getenv("ASCEND_OPP_PATH");
@@ -221,15 +287,27 @@ class GeGenerator::Impl {
 
   Status GenerateInfershapeGraph(const Graph &graph);
 
+  void GetCompileCacheKey(const ComputeGraphPtr &compute_graph, const vector<GeTensor> &inputs,
+                          const map<string, string> &extra_fingerprints, CompileCacheKey &key);
+
+  bool LoadFromCompileCache(const CompileCacheKey &key, const string &file_name_prefix, ModelBufferData &model);
+
+  void SaveToCompileCache(const CompileCacheKey &key, const string &file_name_prefix, const ModelBufferData &model);
+
   GraphManager graph_manager_;
   SaveParam save_param_;
   bool is_offline_ = true;
   bool is_singleop_unregistered_ = false;
+  map<string, string> options_;
+  CompileCache compile_cache_;
 
  private:
   static std::string Trim(const std::string &str);
   bool ParseVersion(const std::string &line, std::string &version);
   bool GetVersionFromPath(const std::string &file_path, std::string &version);
+  bool GetAtcVersion(std::string &version);
+  bool GetOppVersion(std::string &version);
+  bool GetPluginVersion(std::string &version);
   bool SetAtcVersionInfo(AttrHolder &obj);
   bool SetOppVersionInfo(AttrHolder &obj);
 };
@@ -273,6 +351,14 @@ Status GeGenerator::Initialize(const map<string, string> &options) {
   if (iter != options.end()) {
     impl_->save_param_.pri_key_file = iter->second;
   }
+  // get compile cache dir, the build goes on without cache if it is unavailable
+  impl_->options_ = options;
+  iter = options.find(COMPILE_CACHE_DIR);
+  if ((iter != options.end()) && !iter->second.empty()) {
+    if (impl_->compile_cache_.Init(iter->second) != SUCCESS) {
+      GELOGW("Init compile cache %s failed, models will be built without cache.", iter->second.c_str());
+    }
+  }
   return SUCCESS;
 }
 
@@ -384,30 +470,21 @@ bool GeGenerator::Impl::GetVersionFromPath(const std::string &file_path, std::st
   return true;
 }
 
-// Set package version information in the model
-bool GeGenerator::Impl::SetAtcVersionInfo(AttrHolder &obj) {
+bool GeGenerator::Impl::GetAtcVersion(std::string &version) {
   std::string path_base = ge::GELib::GetPath();
   path_base = path_base.substr(0, path_base.rfind('/'));
   path_base = path_base.substr(0, path_base.rfind('/') + 1);
 
   std::string version_path = path_base + "version.info";
   GELOGI("version_path is %s", version_path.c_str());
-  std::string version;
   if (!GetVersionFromPath(version_path, version)) {
     GELOGW("Get atc version information failed!");
     return false;
   }
-  // set version info
-  if (!ge::AttrUtils::SetStr(obj, ATTR_MODEL_ATC_VERSION, version)) {
-    GELOGW("Ge model set atc version failed!");
-    return false;
-  }
-  GELOGI("Ge model set atc version information success.");
   return true;
 }
 
-// Set package version information in the model
-bool GeGenerator::Impl::SetOppVersionInfo(AttrHolder &obj) {
+bool GeGenerator::Impl::GetOppVersion(std::string &version) {
   const char *path_env = std::getenv("ASCEND_OPP_PATH");
   if (path_env == nullptr) {
     GELOGW("Get environment variable ASCEND_OPP_PATH failed!");
@@ -416,11 +493,59 @@ bool GeGenerator::Impl::SetOppVersionInfo(AttrHolder &obj) {
   std::string version_path = path_env;
   version_path += "/version.info";
   GELOGI("version_path is %s", version_path.c_str());
-  std::string version;
   if (!GetVersionFromPath(version_path, version)) {
     GELOGW("Get opp version information failed!");
     return false;
   }
+  return true;
+}
+
+// The engine plugins have no version file, the size and modify time of their so files are used instead
+bool GeGenerator::Impl::GetPluginVersion(std::string &version) {
+  std::shared_ptr<GELib> instance_ptr = GELib::GetInstance();
+  if ((instance_ptr == nullptr) || !instance_ptr->InitFlag()) {
+    GELOGW("Get plugin version information failed, ge is not initialized!");
+    return false;
+  }
+  std::string engine_path;
+  instance_ptr->OpsKernelManagerObj().GetExternalEnginePath(engine_path);
+  std::stringstream ss;
+  for (const auto &path : StringUtils::Split(engine_path, ':')) {
+    struct stat file_stat;
+    if (path.empty() || (stat(path.c_str(), &file_stat) != 0)) {
+      continue;
+    }
+    ss << path << ',' << file_stat.st_size << ',' << file_stat.st_mtime << ';';
+  }
+  version = ss.str();
+  if (version.empty()) {
+    GELOGW("Get plugin version information failed, no engine so is found in %s!", engine_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+// Set package version information in the model
+bool GeGenerator::Impl::SetAtcVersionInfo(AttrHolder &obj) {
+  std::string version;
+  if (!GetAtcVersion(version)) {
+    return false;
+  }
+  // set version info
+  if (!ge::AttrUtils::SetStr(obj, ATTR_MODEL_ATC_VERSION, version)) {
+    GELOGW("Ge model set atc version failed!");
+    return false;
+  }
+  GELOGI("Ge model set atc version information success.");
+  return true;
+}
+
+// Set package version information in the model
+bool GeGenerator::Impl::SetOppVersionInfo(AttrHolder &obj) {
+  std::string version;
+  if (!GetOppVersion(version)) {
+    return false;
+  }
   // set version info
   if (!ge::AttrUtils::SetStr(obj, ATTR_MODEL_OPP_VERSION, version)) {
     GELOGW("Ge model set opp version failed!");
@@ -443,6 +568,21 @@ Status GeGenerator::GenerateModel(const Graph &graph, const string &file_name_pr
   GeRootModelPtr ge_root_model = nullptr;
   GE_CHECK_NOTNULL_EXEC(impl_, return PARAM_INVALID);
   impl_->is_offline_ = is_offline;
+  // the key is taken before building, since the graph is changed by the build
+  CompileCacheKey cache_key;
+  ComputeGraphPtr compute_graph = GraphUtils::GetComputeGraph(graph);
+  if (compute_graph != nullptr) {
+    // model name is derived from the graph name
+    impl_->GetCompileCacheKey(compute_graph, inputs, {{"graph_name", compute_graph->GetName()}}, cache_key);
+  }
+  if (impl_->LoadFromCompileCache(cache_key, file_name_prefix, model)) {
+    if (RtContextUtil::GetInstance().GetNormalModeContext() != nullptr) {
+      (void)rtCtxSetCurrent(RtContextUtil::GetInstance().GetNormalModeContext());
+    }
+    GELOGI("Generate model from compile cache success.");
+    return SUCCESS;
+  }
+
   Status ret = impl_->BuildModel(graph, inputs, ge_root_model);
   if (ret != SUCCESS) {
     GELOGE(ret, "Build model failed.");
@@ -473,6 +613,7 @@ Status GeGenerator::GenerateModel(const Graph &graph, const string &file_name_pr
     }
     return ret;
   }
+  impl_->SaveToCompileCache(cache_key, file_name_prefix, model);
 
   if (RtContextUtil::GetInstance().GetNormalModeContext() != nullptr) {
     (void)rtCtxSetCurrent(RtContextUtil::GetInstance().GetNormalModeContext());
@@ -495,7 +636,10 @@ Status GeGenerator::BuildSingleOp(OpDescPtr &op_desc, const vector<GeTensor> &in
     return PARAM_INVALID;
   }
 
-  domi::GetContext().is_dynamic_input = ContainsDynamicInpus(*op_desc);
+  // each single op is built with its own copy of the omg context, since single ops may be built concurrently
+  ge::OmgContext omg_context = domi::GetContext();
+  domi::OmgContextGuard omg_context_guard(&omg_context);
+  omg_context.is_dynamic_input = ContainsDynamicInpus(*op_desc);
 
   if (op_desc->HasAttr(ATTR_NAME_UNREGST_OPPATH)) {
     impl_->is_singleop_unregistered_ = true;
@@ -552,6 +696,14 @@ Status GeGenerator::BuildSingleOp(OpDescPtr &op_desc, const vector<GeTensor> &in
   GeRootModelPtr ge_root_model = nullptr;
   GE_CHECK_NOTNULL_EXEC(impl_, return PARAM_INVALID);
   impl_->is_offline_ = is_offline;
+  // graph name is not a part of the key, since it contains the current time
+  CompileCacheKey cache_key;
+  impl_->GetCompileCacheKey(compute_graph, inputs, {{"engine_type", std::to_string(static_cast<int32_t>(engine_type))}},
+                            cache_key);
+  if (impl_->LoadFromCompileCache(cache_key, model_file_name, model_buff)) {
+    GELOGI("Build single op %s from compile cache success.", op_desc->GetName().c_str());
+    return SUCCESS;
+  }
   GE_CHK_STATUS_RET_NOLOG(impl_->BuildModel(graph, inputs, ge_root_model));
   map<string, GeAttrValue> op_attrs = op_desc_tmp->GetAllAttrs();
   GE_CHECK_NOTNULL(ge_root_model);
@@ -565,6 +717,7 @@ Status GeGenerator::BuildSingleOp(OpDescPtr &op_desc, const vector<GeTensor> &in
   GELOGD("The opType in op_desc_tmp is [%s]", op_desc_tmp->GetType().c_str());
   GE_CHK_STATUS_RET_NOLOG(impl_->SaveParams(ge_model, op_desc_tmp->GetType(), op_attrs, inputs, outputs));
   GE_CHK_STATUS_RET_NOLOG(impl_->SaveModel(model_file_name, ge_model, model_buff));
+  impl_->SaveToCompileCache(cache_key, model_file_name, model_buff);
   return SUCCESS;
 }
 
@@ -631,9 +784,98 @@ Status GeGenerator::Impl::SaveModel(const string &file_name_prefix, GeModelPtr &
   return SUCCESS;
 }
 
+void GeGenerator::Impl::GetCompileCacheKey(const ComputeGraphPtr &compute_graph, const vector<GeTensor> &inputs,
+                                           const map<string, string> &extra_fingerprints, CompileCacheKey &key) {
+  key = CompileCacheKey();
+  if (!compile_cache_.IsEnabled()) {
+    return;
+  }
+  // the original model is saved while building, which can not be taken from the cache
+  auto iter = options_.find(SAVE_ORIGINAL_MODEL);
+  if ((iter != options_.end()) && (iter->second == kTrueStr)) {
+    GELOGI("Original model is saved, skip compile cache.");
+    return;
+  }
+
+  map<string, string> fingerprints = extra_fingerprints;
+  map<string, string> build_options = GetMutableGlobalOptions();
+  for (const auto &option : options_) {
+    build_options[option.first] = option.second;
+  }
+  // options which only specify where the outputs are saved do not change the model
+  (void)build_options.erase(COMPILE_CACHE_DIR);
+  (void)build_options.erase(ORIGINAL_MODEL_FILE);
+  for (const auto &option : build_options) {
+    fingerprints["option." + option.first] = option.second;
+  }
+  GetOmgContextFingerprints(fingerprints);
+  // a model built by other versions of atc, opp or the engine plugins is never taken
+  std::string atc_version;
+  std::string opp_version;
+  std::string plugin_version;
+  if (!GetAtcVersion(atc_version) || !GetOppVersion(opp_version) || !GetPluginVersion(plugin_version)) {
+    GELOGW("Version of atc, opp or engine plugins is unknown, skip compile cache.");
+    return;
+  }
+  fingerprints["version.atc"] = atc_version;
+  fingerprints["version.opp"] = opp_version;
+  fingerprints["version.plugin"] = plugin_version;
+  fingerprints["is_offline"] = std::to_string(is_offline_);
+  fingerprints["is_singleop_unregistered"] = std::to_string(is_singleop_unregistered_);
+
+  if (CompileCache::GenerateKey(compute_graph, inputs, fingerprints, key) != SUCCESS) {
+    GELOGW("Generate compile cache key of graph %s failed, skip compile cache.", compute_graph->GetName().c_str());
+    key = CompileCacheKey();
+  }
+}
+
+bool GeGenerator::Impl::LoadFromCompileCache(const CompileCacheKey &key, const string &file_name_prefix,
+                                             ModelBufferData &model) {
+  if (key.key.empty()) {
+    return false;
+  }
+  ModelBufferData cached_model;
+  if (!compile_cache_.Lookup(key, cached_model)) {
+    return false;
+  }
+  if (!is_offline_) {
+    model = cached_model;
+    return true;
+  }
+  if ((cached_model.length > INT_MAX) ||
+      (FileSaver::SaveToFile(file_name_prefix, cached_model.data.get(), static_cast<int>(cached_model.length)) !=
+       SUCCESS)) {
+    GELOGW("Save cached model %s to %s failed, the model will be rebuilt.", key.key.c_str(), file_name_prefix.c_str());
+    return false;
+  }
+  return true;
+}
+
+void GeGenerator::Impl::SaveToCompileCache(const CompileCacheKey &key, const string &file_name_prefix,
+                                           const ModelBufferData &model) {
+  if (key.key.empty()) {
+    return;
+  }
+  if (!is_offline_) {
+    (void)compile_cache_.Store(key, model.data.get(), model.length);
+    return;
+  }
+  // offline model is saved to file directly, so take it back from the file
+  std::ifstream ifs(file_name_prefix, std::ios::in | std::ios::binary);
+  if (!ifs.is_open()) {
+    GELOGW("Open saved model %s failed, skip compile cache.", file_name_prefix.c_str());
+    return;
+  }
+  std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  ifs.close();
+  (void)compile_cache_.Store(key, buffer.data(), buffer.size());
+}
+
 Status GeGenerator::Impl::BuildModel(const Graph &graph, const vector<GeTensor> &inputs,
                                      GeRootModelPtr &ge_root_model) {
-  static GraphId id = 0;
+  // graph id is taken before building, so that concurrent generators never share one
+  static std::atomic<GraphId> next_graph_id(0);
+  GraphId id = next_graph_id++;
   const std::map<std::string, std::string> options;
   Status ret = graph_manager_.AddGraph(id, graph, options);
   if (ret != SUCCESS) {
@@ -649,7 +891,7 @@ Status GeGenerator::Impl::BuildModel(const Graph &graph, const vector<GeTensor>
     GELOGE(INTERNAL_ERROR, "get the time of day failed.");
     return INTERNAL_ERROR;
   }
-  uint64_t session_id = static_cast<uint64_t>(tv.tv_sec * 1000000 + tv.tv_usec);  // 1000000us
+  uint64_t session_id = GetUniqueSessionId(static_cast<uint64_t>(tv.tv_sec * 1000000 + tv.tv_usec));  // 1000000us
   if (is_singleop_unregistered_) {
     ret = graph_manager_.BuildGraphForUnregisteredOp(id, inputs, ge_root_model, session_id);
   } else {
@@ -660,7 +902,6 @@ Status GeGenerator::Impl::BuildModel(const Graph &graph, const vector<GeTensor>
     GELOGE(GE_GENERATOR_GRAPH_MANAGER_BUILD_GRAPH_FAILED, "GraphManager build graph fail, graph id: %u", id);
     return GE_GENERATOR_GRAPH_MANAGER_BUILD_GRAPH_FAILED;
   }
-  id += 1;
 
   return SUCCESS;
 }
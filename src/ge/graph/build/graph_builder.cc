@@ -15,6 +15,7 @@
  */
 
 #include "graph/build/graph_builder.h"
+#include <algorithm>
 #include "common/ge/ge_util.h"
 #include "common/helper/model_helper.h"
 #include "common/opskernel/ops_kernel_info_types.h"
@@ -26,6 +27,7 @@
 #include "graph/utils/node_utils.h"
 #include "graph/utils/type_utils.h"
 #include "graph/common/ge_call_wrapper.h"
+#include "common/thread_pool.h"
 #include "init/gelib.h"
 #include "model/ge_model.h"
 
@@ -33,6 +35,7 @@ using domi::BuildMode;
 
 namespace {
 const int32_t kInvalidPerfLevel = -1;
+const uint32_t kBuildSubgraphThreadNum = 8;
 }  // namespace
 namespace ge {
 GraphBuilder::GraphBuilder() : build_mode_(BuildMode::GEN_TASK_WITH_FUSION), hcom_parallel_(false) {}
@@ -57,6 +60,8 @@ Status GraphBuilder::CalcOpParam(const ge::ComputeGraphPtr &graph) {
     return GE_CLI_GE_NOT_INITIALIZED;
   }
 
+  // the known shape subgraphs are built concurrently, the kernel info stores are called one by one
+  std::lock_guard<std::mutex> lock(instance_ptr->OpsKernelManagerObj().GetPluginCallMutex());
   for (const auto &node_ptr : graph->GetNodes(graph->GetGraphUnknownFlag())) {
     GE_CHECK_NOTNULL(node_ptr->GetOpDesc());
     std::string kernel_lib_name = node_ptr->GetOpDesc()->GetOpKernelLibName();
@@ -173,7 +178,11 @@ Status GraphBuilder::BuildForKnownShapeGraph(ComputeGraphPtr &comp_graph,
   Status ret = SecondPartition(comp_graph, subgraph_ptr_list);
   GE_CHK_STATUS_RET(ret, "Graph[%s] second partition Failed.", comp_graph->GetName().c_str());
   auto subgraph_map = graph_partitioner_.GetSubGraphMap();
+  return BuildKnownShapeModel(comp_graph, subgraph_map, ge_model_ptr, session_id);
+}
 
+Status GraphBuilder::BuildKnownShapeModel(ComputeGraphPtr &comp_graph, Graph2SubGraphInfoList &subgraph_map,
+                                          GeModelPtr &ge_model_ptr, uint64_t session_id) {
   GE_TIMESTAMP_START(BuildSubgraph);
   ge::ModelBuilder builder(session_id, comp_graph, subgraph_map, stream_max_parallel_num_, hcom_parallel_, build_mode_);
   GE_DUMP(comp_graph, "BeforePreBuildModel");
@@ -200,7 +209,7 @@ Status GraphBuilder::BuildForKnownShapeGraph(ComputeGraphPtr &comp_graph,
   GE_DUMP(comp_graph, "AfterBuildModel");
 
   GE_TIMESTAMP_START(GetTaskInfo);
-  ret = GetTaskInfo(builder, model_ptr, comp_graph, subgraph_map, session_id);
+  Status ret = GetTaskInfo(builder, model_ptr, comp_graph, subgraph_map, session_id);
   GE_TIMESTAMP_END(GetTaskInfo, "GraphBuilder::GetTaskInfo");
   GE_DUMP(comp_graph, "AfterGetTask");
   if (ret != SUCCESS) {
@@ -272,16 +281,23 @@ Status GraphBuilder::BuildForDynamicShapeGraph(ComputeGraphPtr &comp_graph,
                         op_desc->GetName().c_str());
     }
   }
-  //
+  // The subgraphs are built in their order. A run of consecutive known shape subgraphs is partitioned serially,
+  // since the partitioner is shared, and built concurrently before the next unknown shape subgraph.
+  std::vector<ComputeGraphPtr> known_graphs;
+  std::vector<Graph2SubGraphInfoList> subgraph_maps;
   for (auto &sub_graph : comp_graph->GetAllSubgraphs()) {
     // exclude functional subgraph in known subgraph
     if (sub_graph->GetParentGraph() != comp_graph && !sub_graph->GetParentGraph()->GetGraphUnknownFlag()) {
       continue;
     }
     if (sub_graph->GetGraphUnknownFlag()) {
+      GE_CHK_STATUS_RET(BuildKnownShapeGraphs(known_graphs, subgraph_maps, ge_root_model_ptr, ge_model_ptr,
+                                              session_id),
+                        "Build for known shape graph failed.");
       // unknown shape build flow
       GE_CHK_STATUS_RET(BuildForUnknownShapeGraph(sub_graph, ge_model_ptr, session_id),
                         "Build for unknown shape graph failed.");
+      ge_root_model_ptr->SetSubgraphInstanceNameToModel(sub_graph->GetName(), ge_model_ptr);
     } else {
       // reset functional subgraph parent graph as known subgraph
       for (const auto &node : sub_graph->GetDirectNode()) {
@@ -290,16 +306,108 @@ Status GraphBuilder::BuildForDynamicShapeGraph(ComputeGraphPtr &comp_graph,
           GE_CHK_STATUS_RET(sub_graph->AddSubgraph(sub_sub_graph), "Failed add subgraph to known graph.");
         }
       }
-      // known shape build flow
-      GE_CHK_STATUS_RET(BuildForKnownShapeGraph(sub_graph, subgraph_ptr_list, ge_model_ptr, session_id),
-                        "Build for known shape graph failed.");
+      GE_CHK_STATUS_RET(SecondPartition(sub_graph, subgraph_ptr_list), "Graph[%s] second partition Failed.",
+                        sub_graph->GetName().c_str());
+      known_graphs.emplace_back(sub_graph);
+      subgraph_maps.emplace_back(graph_partitioner_.GetSubGraphMap());
     }
-    ge_root_model_ptr->SetSubgraphInstanceNameToModel(sub_graph->GetName(), ge_model_ptr);
   }
+  GE_CHK_STATUS_RET(BuildKnownShapeGraphs(known_graphs, subgraph_maps, ge_root_model_ptr, ge_model_ptr, session_id),
+                    "Build for known shape graph failed.");
+  return SUCCESS;
+}
 
+Status GraphBuilder::BuildKnownShapeGraphs(std::vector<ComputeGraphPtr> &known_graphs,
+                                           std::vector<Graph2SubGraphInfoList> &subgraph_maps,
+                                           GeRootModelPtr &ge_root_model_ptr, GeModelPtr &ge_model_ptr,
+                                           uint64_t session_id) {
+  if (known_graphs.empty()) {
+    return SUCCESS;
+  }
+  // known shape build flow
+  std::vector<GeModelPtr> ge_models(known_graphs.size());
+  GE_CHK_STATUS_RET(BuildKnownShapeGraphsWithMultiThreads(known_graphs, subgraph_maps, ge_models, session_id));
+  // set models in the order of subgraphs, so that the result does not depend on the thread scheduling
+  for (size_t i = 0; i < known_graphs.size(); ++i) {
+    ge_root_model_ptr->SetSubgraphInstanceNameToModel(known_graphs[i]->GetName(), ge_models[i]);
+    ge_model_ptr = ge_models[i];
+  }
+  known_graphs.clear();
+  subgraph_maps.clear();
   return SUCCESS;
 }
 
+Status GraphBuilder::BuildKnownShapeGraphsWithMultiThreads(std::vector<ComputeGraphPtr> &known_graphs,
+                                                           std::vector<Graph2SubGraphInfoList> &subgraph_maps,
+                                                           std::vector<GeModelPtr> &ge_models, uint64_t session_id) {
+  rtContext_t rt_context = nullptr;
+  if (rtCtxGetCurrent(&rt_context) != RT_ERROR_NONE) {
+    GELOGD("No rt context in current thread.");
+    rt_context = nullptr;
+  }
+  if (known_graphs.size() <= 1) {
+    for (size_t i = 0; i < known_graphs.size(); ++i) {
+      GE_CHK_STATUS_RET(BuildKnownShapeModelWithMultiThreads(this, known_graphs[i], &subgraph_maps[i], &ge_models[i],
+                                                             session_id, GetThreadLocalContext(),
+                                                             domi::GetBoundContext(), rt_context));
+    }
+    return SUCCESS;
+  }
+
+  GE_TIMESTAMP_START(BuildKnownShapeGraphs);
+  ThreadPool executor(std::min(kBuildSubgraphThreadNum, static_cast<uint32_t>(known_graphs.size())));
+  std::vector<std::future<Status>> vector_future;
+  for (size_t i = 0; i < known_graphs.size(); ++i) {
+    std::future<Status> f =
+      executor.commit(GraphBuilder::BuildKnownShapeModelWithMultiThreads, this, known_graphs[i], &subgraph_maps[i],
+                      &ge_models[i], session_id, GetThreadLocalContext(), domi::GetBoundContext(), rt_context);
+    if (!f.valid()) {
+      GELOGE(FAILED, "Future is invalid");
+      return FAILED;
+    }
+    vector_future.emplace_back(std::move(f));
+  }
+
+  // wait for all of the tasks, which refer to the graphs and the maps of this frame
+  Status ret = SUCCESS;
+  for (size_t i = 0; i < vector_future.size(); ++i) {
+    Status ret_status = vector_future[i].get();
+    if ((ret_status != SUCCESS) && (ret == SUCCESS)) {
+      GELOGE(ret_status, "Build known shape graph[%s] failed.", known_graphs[i]->GetName().c_str());
+      ret = ret_status;
+    }
+  }
+  GE_TIMESTAMP_END(BuildKnownShapeGraphs, "GraphBuilder::BuildKnownShapeGraphs");
+  return ret;
+}
+
+Status GraphBuilder::BuildKnownShapeModelWithMultiThreads(GraphBuilder *graph_builder, ComputeGraphPtr comp_graph,
+                                                          Graph2SubGraphInfoList *subgraph_map,
+                                                          GeModelPtr *ge_model_ptr, uint64_t session_id,
+                                                          const GEThreadLocalContext &ge_context,
+                                                          ge::OmgContext *omg_context, rtContext_t rt_context) {
+  GE_CHECK_NOTNULL(graph_builder);
+  GE_CHECK_NOTNULL(comp_graph);
+  GE_CHECK_NOTNULL(subgraph_map);
+  GE_CHECK_NOTNULL(ge_model_ptr);
+  GetThreadLocalContext() = ge_context;
+  // the pool threads are reused, so the omg context of the builder thread is only bound during the build
+  domi::OmgContextGuard omg_context_guard(omg_context);
+  if (rt_context != nullptr) {
+    rtError_t rt_ret = rtCtxSetCurrent(rt_context);
+    if (rt_ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "Failed to set context, error_code is: 0x%X.", rt_ret);
+      return RT_ERROR_TO_GE_STATUS(rt_ret);
+    }
+  }
+  GELOGI("Begin to build known shape graph[%s], thread id is %lu.", comp_graph->GetName().c_str(), pthread_self());
+  uint64_t start_time = GetCurrentTimestap();
+  Status ret = graph_builder->BuildKnownShapeModel(comp_graph, *subgraph_map, *ge_model_ptr, session_id);
+  GELOGI("[GEPERFTRACE] The time cost of building known shape graph[%s] is [%lu] micro second, node num %zu.",
+         comp_graph->GetName().c_str(), GetCurrentTimestap() - start_time, comp_graph->GetDirectNodesSize());
+  return ret;
+}
+
 Status GraphBuilder::GetTaskInfo(const ge::ModelBuilder &builder, const ModelPtr &model_ptr,
                                  ComputeGraphPtr &comp_graph, Graph2SubGraphInfoList &subgraph_map,
                                  uint64_t session_id) {
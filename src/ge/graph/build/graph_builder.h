@@ -31,6 +31,7 @@
 #include "graph/build/model_builder.h"
 #include "graph/build/task_generator.h"
 #include "graph/compute_graph.h"
+#include "graph/ge_local_context.h"
 #include "graph/graph.h"
 #include "graph/manager/graph_manager_utils.h"
 #include "graph/model.h"
@@ -39,6 +40,7 @@
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/tensor_utils.h"
 #include "model/ge_root_model.h"
+#include "runtime/context.h"
 
 namespace ge {
 class GraphBuilder {
@@ -59,14 +61,33 @@ class GraphBuilder {
   Status UpdateDataInputSize(const ge::NodePtr &node_ptr);
   Status UpdateParentNodeOutputSize(const ge::ComputeGraphPtr &graph, ge::NodePtr &parent_node_ptr);
   Status CalcDynShapeRootGraphDataSize(const ge::OpDescPtr &op_desc);
-  Status SecondPartition(ge::ComputeGraphPtr &comp_graph, vector<ge::SubGraphInfoPtr> &subgraph_ptr_list);
+  // SecondPartition, BuildForUnknownShapeGraph and BuildKnownShapeModel are virtual, so that the UT can check
+  // the build order of the dynamic shape graph without the engines
+  virtual Status SecondPartition(ge::ComputeGraphPtr &comp_graph, vector<ge::SubGraphInfoPtr> &subgraph_ptr_list);
   Status BuildForDynamicShapeGraph(ComputeGraphPtr &comp_graph, std::vector<SubGraphInfoPtr> &subgraph_ptr_list,
                                    GeRootModelPtr &ge_root_model_ptr, GeModelPtr &ge_model_ptr,
                                    uint64_t session_id = INVALID_SESSION_ID);
   Status BuildForKnownShapeGraph(ComputeGraphPtr &comp_graph, std::vector<SubGraphInfoPtr> &subgraph_ptr_list,
                                  GeModelPtr &ge_model_ptr, uint64_t session_id = INVALID_SESSION_ID);
-  Status BuildForUnknownShapeGraph(ComputeGraphPtr &comp_graph, GeModelPtr &ge_model_ptr,
-                                   uint64_t session_id = INVALID_SESSION_ID);
+  virtual Status BuildForUnknownShapeGraph(ComputeGraphPtr &comp_graph, GeModelPtr &ge_model_ptr,
+                                           uint64_t session_id = INVALID_SESSION_ID);
+  virtual Status BuildKnownShapeModel(ComputeGraphPtr &comp_graph, Graph2SubGraphInfoList &subgraph_map,
+                                      GeModelPtr &ge_model_ptr, uint64_t session_id);
+  // Build the pending known shape graphs and set their models to the root model in order, ge_model_ptr is set to
+  // the model of the last one. The pending lists are cleared.
+  Status BuildKnownShapeGraphs(std::vector<ComputeGraphPtr> &known_graphs,
+                               std::vector<Graph2SubGraphInfoList> &subgraph_maps, GeRootModelPtr &ge_root_model_ptr,
+                               GeModelPtr &ge_model_ptr, uint64_t session_id);
+  // The known shape graphs are built concurrently. The stream, label and memory assignment of each graph only touch
+  // that graph, the calls into the ops kernel info stores and graph optimizers, which are not required to be thread
+  // safe, are serialized by the plugin call mutex of OpsKernelManager.
+  Status BuildKnownShapeGraphsWithMultiThreads(std::vector<ComputeGraphPtr> &known_graphs,
+                                               std::vector<Graph2SubGraphInfoList> &subgraph_maps,
+                                               std::vector<GeModelPtr> &ge_models, uint64_t session_id);
+  static Status BuildKnownShapeModelWithMultiThreads(GraphBuilder *graph_builder, ComputeGraphPtr comp_graph,
+                                                     Graph2SubGraphInfoList *subgraph_map, GeModelPtr *ge_model_ptr,
+                                                     uint64_t session_id, const GEThreadLocalContext &ge_context,
+                                                     ge::OmgContext *omg_context, rtContext_t rt_context);
   int build_mode_;
 
   std::map<std::string, int> stream_max_parallel_num_;
@@ -15,6 +15,8 @@
  */
 
 #include "graph/build/logical_stream_allocator.h"
+#include <algorithm>
+#include <climits>
 #include <queue>
 #include "common/ge/ge_util.h"
 #include "framework/common/debug/ge_log.h"
@@ -31,6 +33,12 @@ using std::string;
 using std::vector;
 
 namespace ge {
+namespace {
+// Cost of an op, which could be set from profiling data
+const char *const kAttrNameOpCost = "_op_cost";
+const int64_t kMaxStaticCost = INT64_MAX / 2;
+}  // namespace
+
 LogicalStreamPass::LogicalStreamPass(const string &name) : name_(name) {}
 
 const string &LogicalStreamPass::GetName() const { return name_; }
@@ -297,6 +305,316 @@ void AssignByDependencyPass::UpdateReusedSubgraphs() {
   }
 }
 
+int64_t CriticalPathStreamPass::GetNodeCost(const NodePtr &node) {
+  const string &type = node->GetType();
+  if ((type == PLACEHOLDER) || (type == END) || (type == DATA) || (type == CONSTANT) || (type == CONSTANTOP)) {
+    return 0;
+  }
+  auto op_desc = node->GetOpDesc();
+  if (op_desc == nullptr) {
+    return 0;
+  }
+  int64_t cost = 0;
+  if (AttrUtils::GetInt(op_desc, kAttrNameOpCost, cost) && (cost >= 0)) {
+    return cost;
+  }
+
+  // Without profiling data, the cost of an op is assumed to grow with the size of its outputs.
+  cost = 1;
+  for (const auto &output_desc : op_desc->GetAllOutputsDescPtr()) {
+    if (output_desc != nullptr) {
+      int64_t shape_size = output_desc->GetShape().GetShapeSize();
+      if ((shape_size > 0) && (cost < kMaxStaticCost - shape_size)) {
+        cost += shape_size;
+      }
+    }
+  }
+  return cost;
+}
+
+Status CriticalPathStreamPass::Run(ComputeGraphPtr graph, const vector<SubgraphPtr> &subgraphs, Context &context) {
+  if (!context.enable_critical_path) {
+    return NOT_CHANGED;
+  }
+
+  if (!SortSubgraphs(subgraphs)) {
+    GELOGW("Subgraphs of graph %s are not a DAG, skip critical path assignment.", graph->GetName().c_str());
+    return NOT_CHANGED;
+  }
+
+  vector<int64_t> old_streams;
+  for (const auto &subgraph : sorted_subgraphs_) {
+    old_streams.emplace_back(subgraph->stream_id);
+  }
+  int64_t old_next_stream = context.next_stream;
+  int64_t old_makespan = SimulateMakespan();
+
+  MarkCriticalPath();
+  AssignStreams(context);
+  int64_t new_makespan = SimulateMakespan();
+  GELOGI("Simulated makespan of graph %s: %ld by dependency, %ld by critical path.", graph->GetName().c_str(),
+         old_makespan, new_makespan);
+
+  if (new_makespan >= old_makespan) {
+    for (size_t i = 0; i < sorted_subgraphs_.size(); ++i) {
+      sorted_subgraphs_[i]->stream_id = old_streams[i];
+    }
+    context.next_stream = old_next_stream;
+    GELOGI("Critical path assignment does not shorten graph %s, keep the streams.", graph->GetName().c_str());
+    return NOT_CHANGED;
+  }
+
+  for (const auto &subgraph : sorted_subgraphs_) {
+    GELOGI("Subgraph %s is assigned stream %ld by critical path.", subgraph->name.c_str(), subgraph->stream_id);
+  }
+  return SUCCESS;
+}
+
+bool CriticalPathStreamPass::SortSubgraphs(const vector<SubgraphPtr> &subgraphs) {
+  map<NodePtr, size_t> end_indexes;
+  for (size_t i = 0; i < subgraphs.size(); ++i) {
+    for (const auto &item : subgraphs[i]->subgraph_info.GetEnd2PldMap()) {
+      end_indexes.emplace(item.first, i);
+    }
+  }
+
+  vector<set<size_t>> preds(subgraphs.size());
+  vector<vector<size_t>> succs(subgraphs.size());
+  for (size_t i = 0; i < subgraphs.size(); ++i) {
+    for (const auto &item : subgraphs[i]->subgraph_info.GetPld2EndMap()) {
+      auto iter = end_indexes.find(item.second);
+      if ((iter != end_indexes.end()) && (iter->second != i) && preds[i].insert(iter->second).second) {
+        succs[iter->second].emplace_back(i);
+      }
+    }
+  }
+
+  // Kahn's algorithm, subgraphs are kept in their original order when possible
+  vector<size_t> in_degrees(subgraphs.size());
+  queue<size_t> ready_indexes;
+  for (size_t i = 0; i < subgraphs.size(); ++i) {
+    in_degrees[i] = preds[i].size();
+    if (in_degrees[i] == 0) {
+      ready_indexes.push(i);
+    }
+  }
+  vector<size_t> order;
+  while (!ready_indexes.empty()) {
+    size_t index = ready_indexes.front();
+    ready_indexes.pop();
+    order.emplace_back(index);
+    for (auto succ : succs[index]) {
+      if (--in_degrees[succ] == 0) {
+        ready_indexes.push(succ);
+      }
+    }
+  }
+  if (order.size() != subgraphs.size()) {
+    return false;
+  }
+
+  vector<size_t> positions(subgraphs.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    positions[order[i]] = i;
+  }
+  sorted_subgraphs_.clear();
+  pred_indexes_.assign(order.size(), vector<size_t>());
+  succ_indexes_.assign(order.size(), vector<size_t>());
+  costs_.assign(order.size(), 0);
+  for (size_t i = 0; i < order.size(); ++i) {
+    const SubgraphPtr &subgraph = subgraphs[order[i]];
+    sorted_subgraphs_.emplace_back(subgraph);
+    for (auto pred : preds[order[i]]) {
+      pred_indexes_[i].emplace_back(positions[pred]);
+    }
+    for (auto succ : succs[order[i]]) {
+      succ_indexes_[i].emplace_back(positions[succ]);
+    }
+    ComputeGraphPtr compute_graph = subgraph->subgraph_info.GetSubGraph();
+    if (compute_graph != nullptr) {
+      for (const auto &node : compute_graph->GetDirectNode()) {
+        costs_[i] += GetNodeCost(node);
+      }
+    }
+  }
+  return true;
+}
+
+void CriticalPathStreamPass::MarkCriticalPath() {
+  size_t subgraph_num = sorted_subgraphs_.size();
+  on_critical_path_.assign(subgraph_num, false);
+  if (subgraph_num == 0) {
+    return;
+  }
+
+  // The longest cost from each subgraph to the end of the graph
+  vector<int64_t> bottom_levels(subgraph_num, 0);
+  for (size_t i = subgraph_num; i > 0; --i) {
+    int64_t max_succ_level = 0;
+    for (auto succ : succ_indexes_[i - 1]) {
+      max_succ_level = std::max(max_succ_level, bottom_levels[succ]);
+    }
+    bottom_levels[i - 1] = costs_[i - 1] + max_succ_level;
+  }
+
+  size_t index = subgraph_num;
+  for (size_t i = 0; i < subgraph_num; ++i) {
+    if (pred_indexes_[i].empty() && ((index == subgraph_num) || (bottom_levels[i] > bottom_levels[index]))) {
+      index = i;
+    }
+  }
+  while (index != subgraph_num) {
+    on_critical_path_[index] = true;
+    size_t next_index = subgraph_num;
+    for (auto succ : succ_indexes_[index]) {
+      if ((next_index == subgraph_num) || (bottom_levels[succ] > bottom_levels[next_index])) {
+        next_index = succ;
+      }
+    }
+    index = next_index;
+  }
+}
+
+bool CriticalPathStreamPass::IsMovable(const Subgraph &subgraph) const {
+  return HasAssignedStream(subgraph) && !IsEngineSkip(subgraph) && !IsEngineAttach(subgraph) &&
+         !IsEngineIndependent(subgraph) && !HasStreamLabel(subgraph);
+}
+
+void CriticalPathStreamPass::InitEngineStreams(map<string, EngineStreams> &engine_streams) const {
+  map<string, vector<int64_t>> old_engine_streams;
+  for (size_t i = 0; i < sorted_subgraphs_.size(); ++i) {
+    const Subgraph &subgraph = *sorted_subgraphs_[i];
+    if (!IsMovable(subgraph)) {
+      continue;
+    }
+    const string &engine_name = subgraph.engine_conf.id;
+    auto &streams = engine_streams[engine_name];
+    streams.max_parallel_num = subgraph.max_parallel_num;
+    if (on_critical_path_[i] && (streams.main_stream == kInvalidStream)) {
+      streams.main_stream = subgraph.stream_id;
+    }
+    auto &old_streams = old_engine_streams[engine_name];
+    if (std::find(old_streams.begin(), old_streams.end(), subgraph.stream_id) == old_streams.end()) {
+      old_streams.emplace_back(subgraph.stream_id);
+    }
+  }
+
+  for (auto &item : engine_streams) {
+    auto &streams = item.second;
+    const auto &old_streams = old_engine_streams[item.first];
+    if (streams.main_stream == kInvalidStream) {
+      streams.main_stream = old_streams.front();
+    }
+    for (auto stream_id : old_streams) {
+      if (stream_id != streams.main_stream) {
+        streams.spare_streams.emplace_back(stream_id);
+      }
+    }
+  }
+}
+
+int64_t CriticalPathStreamPass::SelectParallelStream(size_t index, int64_t ready_time,
+                                                     const map<int64_t, int64_t> &stream_free_times,
+                                                     EngineStreams &streams, Context &context) const {
+  auto get_free_time = [&stream_free_times](int64_t stream_id) {
+    auto iter = stream_free_times.find(stream_id);
+    return (iter != stream_free_times.end()) ? iter->second : 0;
+  };
+  auto is_parallel_stream = [&streams](int64_t stream_id) {
+    return std::find(streams.parallel_streams.begin(), streams.parallel_streams.end(), stream_id) !=
+           streams.parallel_streams.end();
+  };
+
+  // Keep a branch on the stream of its predecessor, which saves an event
+  for (auto pred : pred_indexes_[index]) {
+    int64_t stream_id = sorted_subgraphs_[pred]->stream_id;
+    if (is_parallel_stream(stream_id) && (get_free_time(stream_id) <= ready_time)) {
+      return stream_id;
+    }
+  }
+  for (auto stream_id : streams.parallel_streams) {
+    if (get_free_time(stream_id) <= ready_time) {
+      return stream_id;
+    }
+  }
+
+  if (static_cast<int64_t>(streams.parallel_streams.size()) < streams.max_parallel_num - 1) {
+    int64_t stream_id = kInvalidStream;
+    if (!streams.spare_streams.empty()) {
+      stream_id = streams.spare_streams.front();
+      streams.spare_streams.erase(streams.spare_streams.begin());
+    } else {
+      stream_id = context.next_stream++;
+    }
+    streams.parallel_streams.emplace_back(stream_id);
+    return stream_id;
+  }
+
+  // All parallel streams are busy, wait for the one which is free first
+  int64_t selected_stream = streams.parallel_streams.front();
+  for (auto stream_id : streams.parallel_streams) {
+    if (get_free_time(stream_id) < get_free_time(selected_stream)) {
+      selected_stream = stream_id;
+    }
+  }
+  return selected_stream;
+}
+
+void CriticalPathStreamPass::AssignStreams(Context &context) {
+  map<string, EngineStreams> engine_streams;
+  InitEngineStreams(engine_streams);
+
+  // List scheduling in topological order, with the same timing as SimulateMakespan
+  map<int64_t, int64_t> stream_free_times;
+  vector<int64_t> finish_times(sorted_subgraphs_.size(), 0);
+  for (size_t i = 0; i < sorted_subgraphs_.size(); ++i) {
+    Subgraph &subgraph = *sorted_subgraphs_[i];
+    int64_t ready_time = 0;
+    for (auto pred : pred_indexes_[i]) {
+      ready_time = std::max(ready_time, finish_times[pred]);
+    }
+
+    if (IsMovable(subgraph)) {
+      auto &streams = engine_streams[subgraph.engine_conf.id];
+      if (on_critical_path_[i] || (streams.max_parallel_num <= 1)) {
+        subgraph.stream_id = streams.main_stream;
+      } else {
+        subgraph.stream_id = SelectParallelStream(i, ready_time, stream_free_times, streams, context);
+      }
+    } else if (HasAssignedStream(subgraph) && (subgraph.reused_subgraph != nullptr)) {
+      subgraph.stream_id = subgraph.reused_subgraph->stream_id;
+    }
+
+    if (HasAssignedStream(subgraph)) {
+      int64_t &free_time = stream_free_times[subgraph.stream_id];
+      ready_time = std::max(ready_time, free_time);
+      free_time = ready_time + costs_[i];
+    }
+    finish_times[i] = ready_time + costs_[i];
+  }
+}
+
+int64_t CriticalPathStreamPass::SimulateMakespan() const {
+  map<int64_t, int64_t> stream_free_times;
+  vector<int64_t> finish_times(sorted_subgraphs_.size(), 0);
+  int64_t makespan = 0;
+  for (size_t i = 0; i < sorted_subgraphs_.size(); ++i) {
+    int64_t start_time = 0;
+    for (auto pred : pred_indexes_[i]) {
+      start_time = std::max(start_time, finish_times[pred]);
+    }
+    int64_t stream_id = sorted_subgraphs_[i]->stream_id;
+    if (stream_id != kInvalidStream) {
+      int64_t &free_time = stream_free_times[stream_id];
+      start_time = std::max(start_time, free_time);
+      free_time = start_time + costs_[i];
+    }
+    finish_times[i] = start_time + costs_[i];
+    makespan = std::max(makespan, finish_times[i]);
+  }
+  return makespan;
+}
+
 Status SingleStreamPass::Run(ComputeGraphPtr graph, const vector<SubgraphPtr> &subgraphs, Context &context) {
   // context.default_stream can be kInvalidStream only when graph is the root graph.
   int64_t new_stream = context.default_stream;
@@ -523,6 +841,8 @@ void LogicalStreamAllocator::EnableSingleStream(bool enable) { context_.enable_s
 
 void LogicalStreamAllocator::EnableHcomParallel(bool enable) { context_.enable_hcom_parallel = enable; }
 
+void LogicalStreamAllocator::EnableCriticalPath(bool enable) { context_.enable_critical_path = enable; }
+
 Status LogicalStreamAllocator::Assign(const ComputeGraphPtr &root_graph, const Graph2SubGraphInfoList &subgraph_map,
                                       int64_t &stream_num) {
   GE_CHECK_NOTNULL(root_graph);
@@ -646,6 +966,7 @@ Status LogicalStreamAllocator::RunPasses(const ComputeGraphPtr &graph, const vec
     passes.emplace_back(MakeShared<AssignByLabelPass>());
     passes.emplace_back(MakeShared<IndependentStreamPass>());
     passes.emplace_back(MakeShared<AssignByDependencyPass>());
+    passes.emplace_back(MakeShared<CriticalPathStreamPass>());
     passes.emplace_back(MakeShared<NodeStreamUpdatePass>());
     passes.emplace_back(MakeShared<AllReduceParallelPass>());
   }
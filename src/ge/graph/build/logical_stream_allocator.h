@@ -64,6 +64,7 @@ class LogicalStreamPass {
     int64_t next_stream = 0;
     bool enable_single_stream = false;
     bool enable_hcom_parallel = false;
+    bool enable_critical_path = false;
   };
 
   explicit LogicalStreamPass(const std::string &name);
@@ -135,6 +136,42 @@ class AssignByDependencyPass : public LogicalStreamPass {
   std::vector<std::pair<SubgraphPtr, SubgraphPtr>> reused_subgraphs_;
 };
 
+// Subgraphs on the critical path are put on the main stream of their engine, and the others are spread on parallel
+// streams. The cost of a node is taken from attr "_op_cost" (set from profiling data), or estimated by its output size.
+class CriticalPathStreamPass : public LogicalStreamPass {
+ public:
+  STREAM_PASS_DEFAULT_FUNC(CriticalPathStreamPass);
+  Status Run(ComputeGraphPtr graph, const std::vector<SubgraphPtr> &subgraphs, Context &context) override;
+
+  static int64_t GetNodeCost(const NodePtr &node);
+
+ private:
+  struct EngineStreams {
+    int64_t main_stream = kInvalidStream;
+    int64_t max_parallel_num = kDefaultMaxParalleNum;
+    std::vector<int64_t> parallel_streams;
+    // Streams assigned to the engine by former passes, which are reused before new streams
+    std::vector<int64_t> spare_streams;
+  };
+
+  bool SortSubgraphs(const std::vector<SubgraphPtr> &subgraphs);
+  void MarkCriticalPath();
+  bool IsMovable(const Subgraph &subgraph) const;
+  void InitEngineStreams(std::map<std::string, EngineStreams> &engine_streams) const;
+  int64_t SelectParallelStream(size_t index, int64_t ready_time, const std::map<int64_t, int64_t> &stream_free_times,
+                               EngineStreams &streams, Context &context) const;
+  void AssignStreams(Context &context);
+
+  // Launch the subgraphs in topological order on their streams, and get the time all of them are done
+  int64_t SimulateMakespan() const;
+
+  std::vector<SubgraphPtr> sorted_subgraphs_;
+  std::vector<std::vector<size_t>> pred_indexes_;
+  std::vector<std::vector<size_t>> succ_indexes_;
+  std::vector<int64_t> costs_;
+  std::vector<bool> on_critical_path_;
+};
+
 // All nodes in the graph are assigned the same stream.
 class SingleStreamPass : public LogicalStreamPass {
  public:
@@ -183,6 +220,7 @@ class LogicalStreamAllocator {
 
   void EnableSingleStream(bool enable);
   void EnableHcomParallel(bool hcom_parallel);
+  void EnableCriticalPath(bool enable);
 
   Status Assign(const ComputeGraphPtr &root_graph, const Graph2SubGraphInfoList &subgraph_map, int64_t &stream_num);
 
@@ -222,7 +222,8 @@ void ModelBuilder::SetInputIsConst(const ge::NodePtr &n) {
   node_op_desc->SetIsInputConst(is_input_const);
 }
 
-Status ModelBuilder::AdjustConstWeightSize(const ge::NodePtr &node, size_t &mem_offset) {
+Status ModelBuilder::AdjustConstWeightSize(const ge::NodePtr &node, size_t &mem_offset,
+                                           ContentHashIndex &weight_index) {
   GE_CHECK_NOTNULL(node);
   if (node->GetType() == CONSTANT) {
     vector<GeTensorPtr> weights = OpDescUtils::MutableWeights(node);
@@ -236,7 +237,15 @@ Status ModelBuilder::AdjustConstWeightSize(const ge::NodePtr &node, size_t &mem_
       return FAILED;
     }
     GeTensorDesc &tensor_desc = weight->MutableTensorDesc();
-    size_t output_size = weight->GetData().size();
+    const Buffer weight_data = weight->GetData();
+    size_t output_size = weight_data.size();
+    size_t offset = mem_offset;
+    if ((output_size > 0) && weight_index.FindOrInsert(weight_data.data(), output_size, {}, offset)) {
+      GELOGD("Const %s has the same weight as a previous const, reuse offset %zu, size %zu",
+             node->GetName().c_str(), offset, output_size);
+      TensorUtils::SetDataOffset(tensor_desc, offset);
+      return SUCCESS;
+    }
     TensorUtils::SetDataOffset(tensor_desc, mem_offset);
     mem_offset += output_size;
   }
@@ -246,6 +255,8 @@ Status ModelBuilder::AdjustConstWeightSize(const ge::NodePtr &node, size_t &mem_
 Status ModelBuilder::SetInputOutputDesc() {
   Status ret;
   GELOGI("Start to SetInputOutputDesc.");
+  // the index refers to the weights of the graph, it is dropped with this function on all returns
+  ContentHashIndex weight_index;
 
   for (const ge::NodePtr &n : compute_graph_->GetNodes(compute_graph_->GetGraphUnknownFlag())) {
     auto node_op_desc = n->GetOpDesc();
@@ -285,12 +296,13 @@ Status ModelBuilder::SetInputOutputDesc() {
     if (IsGeLocalOp(n->GetOpDesc())) {
       GE_CHK_STATUS_RET(CalcOutputSize(n), "Calculate output size failed");
     }
-    ret = AdjustConstWeightSize(n, weight_offset_);
+    ret = AdjustConstWeightSize(n, weight_offset_, weight_index);
     GE_CHK_STATUS_RET(ret, "AdjustConstWeightSize failed");
 
     GE_IF_BOOL_EXEC(((weight_offset_ > 0) && (weight_offset_ % MEM_ALIGN_SIZE != 0)),
                     weight_offset_ = (weight_offset_ + MEM_ALIGN_SIZE - 1) / MEM_ALIGN_SIZE * MEM_ALIGN_SIZE);
   }
+  GELOGI("Weight size after dedup is %zu, unique weights num %zu.", weight_offset_, weight_index.Size());
   GE_CHK_STATUS_RET(compute_graph_->TopologicalSorting(), "TopologicalSorting failed");
   return SUCCESS;
 }
@@ -780,7 +792,11 @@ Status ModelBuilder::CompileSingleOp() {
     OpsKernelInfoStorePtr kernel_info = instance->OpsKernelManagerObj().GetOpsKernelInfoStore(kernel_lib_name);
     GE_CHECK_NOTNULL(kernel_info);
     GE_TIMESTAMP_RESTART(BatchCompileOp);
-    auto ret = kernel_info->CompileOp(node_vector);
+    Status ret = SUCCESS;
+    {
+      std::lock_guard<std::mutex> lock(instance->OpsKernelManagerObj().GetPluginCallMutex());
+      ret = kernel_info->CompileOp(node_vector);
+    }
     GELOGI("[GEPERFTRACE] The node size of compile op of %s is %zu", kernel_lib_name.c_str(), node_vector.size());
     GE_TIMESTAMP_ADD(BatchCompileOp);
     if (ret != ge::SUCCESS) {
@@ -23,6 +23,7 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include "common/content_hash_index.h"
 #include "common/op/ge_op_utils.h"
 #include "common/tbe_kernel_store.h"
 #include "common/types.h"
@@ -70,7 +71,9 @@ class ModelBuilder {
 
   Status CalcOutputSize(const ge::NodePtr &n);
 
-  Status AdjustConstWeightSize(const ge::NodePtr &node, size_t &mem_offset);
+  // consts with identical content share one slot in the weight buffer, weight_index records the slots of the
+  // weights met before
+  Status AdjustConstWeightSize(const ge::NodePtr &node, size_t &mem_offset, ContentHashIndex &weight_index);
 
   Status SetInputOutputDesc();
 
@@ -21,6 +21,7 @@
 #include "framework/common/fmk_error_codes.h"
 #include "framework/common/types.h"
 #include "graph/build/logical_stream_allocator.h"
+#include "graph/build/sync_event_optimizer.h"
 #include "graph/common/omg_util.h"
 #include "graph/debug/ge_attr_define.h"
 #include "graph/ge_context.h"
@@ -67,6 +68,15 @@ StreamAllocator::StreamAllocator(ComputeGraphPtr whole_graph, const Graph2SubGra
 
   enable_single_stream_ = (single_stream_str == kTrueStr) ? true : false;
   GELOGI("Enable single stream: %s.", enable_single_stream_ ? kTrueStr : kFalseStr);
+
+  string critical_path_str;
+  (void)GetContext().GetOption(ENABLE_CRITICAL_PATH_STREAM, critical_path_str);
+  if (stream_options.find(critical_path_str) == stream_options.end()) {
+    GELOGW("The value %s of the %s option is invalid, it should be true or false.", critical_path_str.c_str(),
+           ENABLE_CRITICAL_PATH_STREAM);
+  }
+  enable_critical_path_ = (critical_path_str == kTrueStr);
+  GELOGI("Enable critical path stream: %s.", enable_critical_path_ ? kTrueStr : kFalseStr);
 }
 
 Status StreamAllocator::AssignLogicalStreams(const std::map<std::string, int> &max_parallel_num, bool hcom_parallel) {
@@ -84,6 +94,7 @@ Status StreamAllocator::AssignLogicalStreams(const std::map<std::string, int> &m
   LogicalStreamAllocator logical_allocator(scheduler_confs, max_parallel_num);
   logical_allocator.EnableSingleStream(enable_single_stream_);
   logical_allocator.EnableHcomParallel(hcom_parallel);
+  logical_allocator.EnableCriticalPath(enable_critical_path_);
 
   Status status = logical_allocator.Assign(whole_graph_, subgraphs_, stream_num_);
   if (status != SUCCESS) {
@@ -152,6 +163,12 @@ Status StreamAllocator::RefreshRealStream(int64_t &stream_num, int64_t &event_nu
     return status;
   }
 
+  status = ReuseEventIds();
+  if (status != SUCCESS) {
+    GELOGE(status, "ReuseEventIds failed!");
+    return status;
+  }
+
   status = InsertSyncEventNodes();
   if (status != SUCCESS) {
     GELOGE(status, "InsertSyncEventNode failed!");
@@ -479,6 +496,36 @@ Status StreamAllocator::OptimizeSyncEvents() {
       }
     }
   }
+
+  return OptimizeByTransitiveReduction();
+}
+
+/// Scenario: the order of send node and recv node is already kept by events through other streams
+/// Example:
+/// Stream0            Stream1            Stream2
+///   N1 - - event - - > N2
+///   |                  |
+///   |                  - - - event - - > N3
+///   |                                    ^
+///   - - - - - - - - event - - - - - - - -
+Status StreamAllocator::OptimizeByTransitiveReduction() {
+  uint32_t event_num = 0;
+  for (const auto &one_pair : node_to_send_events_) {
+    event_num += static_cast<uint32_t>(one_pair.second.size());
+  }
+
+  vector<NodePtr> nodes;
+  for (const auto &node : whole_graph_->GetNodes(whole_graph_->GetGraphUnknownFlag())) {
+    nodes.emplace_back(node);
+  }
+  uint32_t removed_num = 0;
+  SyncEventOptimizer optimizer(node_to_send_events_, node_to_recv_events_);
+  if (optimizer.RemoveRedundantEvents(nodes, removed_num) != SUCCESS) {
+    GELOGW("Failed to remove redundant events of graph %s, keep them.", whole_graph_->GetName().c_str());
+    return SUCCESS;
+  }
+  GELOGI("Sync events of graph %s: %u before transitive reduction, %u after.", whole_graph_->GetName().c_str(),
+         event_num, event_num - removed_num);
   return SUCCESS;
 }
 
@@ -1102,8 +1149,28 @@ Status StreamAllocator::RefreshContinuousEvents() {
   return SUCCESS;
 }
 
+// Give one event id to send/recv pairs which never wait at the same time
+Status StreamAllocator::ReuseEventIds() {
+  vector<NodePtr> nodes;
+  for (const auto &node : whole_graph_->GetNodes(whole_graph_->GetGraphUnknownFlag())) {
+    nodes.emplace_back(node);
+  }
+  uint32_t event_num = event_num_;
+  SyncEventOptimizer optimizer(node_to_send_events_, node_to_recv_events_);
+  if (optimizer.ReuseEventIds(nodes, event_num) != SUCCESS) {
+    GELOGW("Failed to reuse event ids of graph %s, keep them.", whole_graph_->GetName().c_str());
+    return SUCCESS;
+  }
+  GELOGI("Event ids of graph %s: %u before reuse, %u after.", whole_graph_->GetName().c_str(), event_num_, event_num);
+  event_num_ = event_num;
+  return SUCCESS;
+}
+
 // Insert the real send/recv node in the graph
 Status StreamAllocator::InsertSyncEventNodes() {
+  // event ids may be reused, so the nodes of the later pairs get a suffix to keep their names unique
+  map<uint32_t, uint32_t> recv_name_count;
+  map<uint32_t, uint32_t> send_name_count;
   for (const auto &node : whole_graph_->GetNodes(whole_graph_->GetGraphUnknownFlag())) {
     // Add the node corresponding to the recv event
     vector<uint32_t> recv_event_id_list;
@@ -1113,6 +1180,10 @@ Status StreamAllocator::InsertSyncEventNodes() {
     GE_CHECK_NOTNULL(node->GetOutControlAnchor());
     for (auto &event_id : recv_event_id_list) {
       string recv_node_name = whole_graph_->GetName() + "_Recv_" + to_string(event_id);
+      uint32_t recv_name_index = recv_name_count[event_id]++;
+      if (recv_name_index > 0) {
+        recv_node_name += "_" + to_string(recv_name_index);
+      }
       OpDescPtr op_desc_ptr = MakeShared<OpDesc>(recv_node_name, RECV);
       GE_CHECK_NOTNULL(op_desc_ptr);
 
@@ -1141,6 +1212,10 @@ Status StreamAllocator::InsertSyncEventNodes() {
 
     for (auto &event_id : send_event_id_list) {
       string send_node_name = whole_graph_->GetName() + "_Send_" + to_string(event_id);
+      uint32_t send_name_index = send_name_count[event_id]++;
+      if (send_name_index > 0) {
+        send_node_name += "_" + to_string(send_name_index);
+      }
       OpDescPtr op_desc_ptr = MakeShared<OpDesc>(send_node_name, SEND);
       GE_CHECK_NOTNULL(op_desc_ptr);
 
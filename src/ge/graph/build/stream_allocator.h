@@ -53,6 +53,7 @@ class StreamAllocator {
   Status OptimizeBySendEvents(const std::map<int64_t, std::vector<NodePtr>> &stream_nodes);
   Status OptimizeByRecvEvents(const std::map<int64_t, std::vector<NodePtr>> &stream_nodes);
   Status OptimizeByStreamActivate();
+  Status OptimizeByTransitiveReduction();
   // Determine if the successor node of RecvNode is directly or indirectly activated by the SendNode precursor node
   bool IsRecvNodeActivatedBySendNode(const NodePtr &send_node_ptr, const NodePtr &recv_node_ptr) const;
   bool IsActiveAfterNextIteration(const NodePtr &active_node_ptr) const;
@@ -71,6 +72,7 @@ class StreamAllocator {
   Status CheckStreamActived() const;
 
   Status RefreshContinuousEvents();
+  Status ReuseEventIds();
 
   Status InsertSyncEventNodes();
   Status ReorderEventNodes() const;
@@ -101,6 +103,7 @@ class StreamAllocator {
   int64_t stream_num_{0};
   uint32_t event_num_{0};
   bool enable_single_stream_{false};
+  bool enable_critical_path_{false};
   vector<int64_t> huge_streams_;
 
   // <stream label, set<stream id>>
@@ -0,0 +1,318 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/build/sync_event_optimizer.h"
+#include <algorithm>
+#include <queue>
+#include <set>
+#include <string>
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "framework/common/types.h"
+#include "graph/build/logical_stream_allocator.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/attr_utils.h"
+
+using std::map;
+using std::set;
+using std::string;
+using std::vector;
+
+namespace {
+// clock value of a stream on which no node is known to complete
+const int64_t kNoNodeCompleted = -1;
+
+bool HasStreamLabel(const ge::OpDescPtr &op_desc) {
+  string stream_label;
+  return ge::AttrUtils::GetStr(op_desc, ge::ATTR_NAME_STREAM_LABEL, stream_label) && !stream_label.empty();
+}
+
+// nodes which decide whether or how many times other streams run
+bool IsStreamControlNode(const ge::OpDescPtr &op_desc) {
+  static const set<string> kStreamControlTypes = {
+    ge::STREAMSWITCH, ge::STREAMSWITCHN, ge::STREAMACTIVE, ge::STREAMMERGE, ge::LABELSET,
+    ge::LABELGOTO,    ge::LABELGOTOEX,   ge::LABELSWITCH,  ge::LABELSWITCHBYINDEX};
+  return kStreamControlTypes.count(op_desc->GetType()) > 0;
+}
+}  // namespace
+
+namespace ge {
+SyncEventOptimizer::SyncEventOptimizer(map<NodePtr, vector<uint32_t>> &node_to_send_events,
+                                       map<NodePtr, vector<uint32_t>> &node_to_recv_events)
+    : node_to_send_events_(node_to_send_events), node_to_recv_events_(node_to_recv_events) {}
+
+Status SyncEventOptimizer::RemoveRedundantEvents(const vector<NodePtr> &nodes, uint32_t &removed_num) {
+  removed_num = 0;
+  GE_CHK_STATUS_RET_NOLOG(Init(nodes));
+  GE_CHK_STATUS_RET_NOLOG(ComputeClocks(true, removed_num));
+  GELOGI("Remove %u redundant events of %zu streams.", removed_num, stream_num_);
+  return SUCCESS;
+}
+
+Status SyncEventOptimizer::ReuseEventIds(const vector<NodePtr> &nodes, uint32_t &event_num) {
+  for (const auto &node : nodes) {
+    GE_CHECK_NOTNULL(node->GetOpDesc());
+    if (HasStreamLabel(node->GetOpDesc()) || IsStreamControlNode(node->GetOpDesc())) {
+      GELOGI("Node %s controls or is controlled by other streams, no need to reuse event ids.",
+             node->GetName().c_str());
+      return SUCCESS;
+    }
+  }
+
+  GE_CHK_STATUS_RET_NOLOG(Init(nodes));
+  if (events_.size() != event_num) {
+    GELOGW("Event ids are not continuous, %zu events but event num is %u, skip reusing.", events_.size(), event_num);
+    return SUCCESS;
+  }
+  uint32_t removed_num = 0;
+  GE_CHK_STATUS_RET_NOLOG(ComputeClocks(false, removed_num));
+
+  // assign ids in the order of send nodes, so that the last pair of an id is the one to check
+  std::unordered_map<const Node *, size_t> node_order;
+  for (size_t i = 0; i < sorted_nodes_.size(); ++i) {
+    node_order[sorted_nodes_[i].get()] = i;
+  }
+  vector<uint32_t> event_ids;
+  for (const auto &event : events_) {
+    event_ids.emplace_back(event.first);
+  }
+  std::stable_sort(event_ids.begin(), event_ids.end(), [this, &node_order](uint32_t lhs, uint32_t rhs) {
+    return node_order[events_[lhs].send_node.get()] < node_order[events_[rhs].send_node.get()];
+  });
+
+  // last event given each new id. Its recv node completes before the send nodes of the events added later, so does
+  // the recv nodes of all events given the id before.
+  vector<uint32_t> last_events;
+  map<uint32_t, uint32_t> old_to_new_events;
+  for (auto event_id : event_ids) {
+    const Clock &clock = send_clocks_[events_[event_id].send_node.get()];
+    size_t new_id = 0;
+    while ((new_id < last_events.size()) && !IsCovered(clock, events_[last_events[new_id]].recv_node)) {
+      ++new_id;
+    }
+    if (new_id == last_events.size()) {
+      last_events.emplace_back(event_id);
+    } else {
+      last_events[new_id] = event_id;
+    }
+    old_to_new_events[event_id] = static_cast<uint32_t>(new_id);
+  }
+
+  for (auto &one_pair : node_to_send_events_) {
+    for (auto &event_id : one_pair.second) {
+      event_id = old_to_new_events[event_id];
+    }
+  }
+  for (auto &one_pair : node_to_recv_events_) {
+    for (auto &event_id : one_pair.second) {
+      event_id = old_to_new_events[event_id];
+    }
+  }
+  GELOGI("Reuse event ids of %zu streams, event num %u -> %zu.", stream_num_, event_num, last_events.size());
+  event_num = static_cast<uint32_t>(last_events.size());
+  return SUCCESS;
+}
+
+Status SyncEventOptimizer::Init(const vector<NodePtr> &nodes) {
+  positions_.clear();
+  map<int64_t, size_t> stream_ids;
+  vector<int64_t> stream_node_nums;
+  for (const auto &node : nodes) {
+    GE_CHECK_NOTNULL(node);
+    auto op_desc = node->GetOpDesc();
+    GE_CHECK_NOTNULL(op_desc);
+    int64_t stream_id = op_desc->GetStreamId();
+    if (stream_id == kInvalidStream) {
+      continue;
+    }
+    auto it = stream_ids.find(stream_id);
+    if (it == stream_ids.end()) {
+      it = stream_ids.emplace(stream_id, stream_node_nums.size()).first;
+      stream_node_nums.emplace_back(0);
+    }
+    positions_[node.get()] = {it->second, stream_node_nums[it->second]++, !HasStreamLabel(op_desc)};
+  }
+  stream_num_ = stream_node_nums.size();
+
+  GE_CHK_STATUS_RET_NOLOG(CollectEvents());
+  return SortNodes(nodes);
+}
+
+Status SyncEventOptimizer::CollectEvents() {
+  events_.clear();
+  for (const auto &one_pair : node_to_send_events_) {
+    for (auto event_id : one_pair.second) {
+      auto &event = events_[event_id];
+      if (event.send_node != nullptr) {
+        GELOGW("Event %u is sent by both node %s and %s.", event_id, event.send_node->GetName().c_str(),
+               one_pair.first->GetName().c_str());
+        return FAILED;
+      }
+      event.send_node = one_pair.first;
+    }
+  }
+  for (const auto &one_pair : node_to_recv_events_) {
+    for (auto event_id : one_pair.second) {
+      auto &event = events_[event_id];
+      if (event.recv_node != nullptr) {
+        GELOGW("Event %u is received by both node %s and %s.", event_id, event.recv_node->GetName().c_str(),
+               one_pair.first->GetName().c_str());
+        return FAILED;
+      }
+      event.recv_node = one_pair.first;
+    }
+  }
+  for (const auto &event : events_) {
+    const NodePtr &send_node = event.second.send_node;
+    const NodePtr &recv_node = event.second.recv_node;
+    if ((send_node == nullptr) || (recv_node == nullptr) || (positions_.count(send_node.get()) == 0) ||
+        (positions_.count(recv_node.get()) == 0)) {
+      GELOGW("Event %u is not between two nodes with stream.", event.first);
+      return FAILED;
+    }
+  }
+  return SUCCESS;
+}
+
+Status SyncEventOptimizer::SortNodes(const vector<NodePtr> &nodes) {
+  std::unordered_map<const Node *, vector<NodePtr>> out_nodes;
+  std::unordered_map<const Node *, size_t> in_num;
+  vector<NodePtr> last_nodes(stream_num_);
+  for (const auto &node : nodes) {
+    auto it = positions_.find(node.get());
+    if (it == positions_.end()) {
+      continue;
+    }
+    NodePtr &last_node = last_nodes[it->second.stream];
+    if (last_node != nullptr) {
+      out_nodes[last_node.get()].emplace_back(node);
+      ++in_num[node.get()];
+    }
+    last_node = node;
+  }
+  for (const auto &event : events_) {
+    out_nodes[event.second.send_node.get()].emplace_back(event.second.recv_node);
+    ++in_num[event.second.recv_node.get()];
+  }
+
+  sorted_nodes_.clear();
+  std::queue<NodePtr> ready_nodes;
+  for (const auto &node : nodes) {
+    if ((positions_.count(node.get()) > 0) && (in_num[node.get()] == 0)) {
+      ready_nodes.push(node);
+    }
+  }
+  while (!ready_nodes.empty()) {
+    NodePtr node = ready_nodes.front();
+    ready_nodes.pop();
+    sorted_nodes_.emplace_back(node);
+    for (const auto &out_node : out_nodes[node.get()]) {
+      if (--in_num[out_node.get()] == 0) {
+        ready_nodes.push(out_node);
+      }
+    }
+  }
+  if (sorted_nodes_.size() != positions_.size()) {
+    GELOGW("Stream order and events form a cycle, %zu of %zu nodes are sorted.", sorted_nodes_.size(),
+           positions_.size());
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+bool SyncEventOptimizer::IsTrackable(const NodePtr &node) const {
+  auto it = positions_.find(node.get());
+  return (it != positions_.end()) && it->second.trackable;
+}
+
+bool SyncEventOptimizer::IsCovered(const Clock &clock, const NodePtr &node) const {
+  const NodePosition &position = positions_.at(node.get());
+  return clock[position.stream] >= position.index;
+}
+
+void SyncEventOptimizer::RemoveEvent(uint32_t event_id) {
+  const EventPair &event = events_[event_id];
+  auto &send_events = node_to_send_events_[event.send_node];
+  send_events.erase(std::remove(send_events.begin(), send_events.end(), event_id), send_events.end());
+  auto &recv_events = node_to_recv_events_[event.recv_node];
+  recv_events.erase(std::remove(recv_events.begin(), recv_events.end(), event_id), recv_events.end());
+  GELOGI("Remove event %u between node %s and node %s, which is implied by other events.", event_id,
+         event.send_node->GetName().c_str(), event.recv_node->GetName().c_str());
+  (void)events_.erase(event_id);
+}
+
+Status SyncEventOptimizer::ComputeClocks(bool remove_redundant, uint32_t &removed_num) {
+  // clock of the last sorted node of each stream
+  vector<Clock> stream_clocks(stream_num_, Clock(stream_num_, kNoNodeCompleted));
+  send_clocks_.clear();
+  for (const auto &node : sorted_nodes_) {
+    const NodePosition &position = positions_[node.get()];
+    Clock &clock = stream_clocks[position.stream];
+    auto recv_it = node_to_recv_events_.find(node);
+    if (position.trackable && (recv_it != node_to_recv_events_.end())) {
+      if (remove_redundant) {
+        // each event is checked against the previous node of the stream and the other events kept
+        vector<uint32_t> recv_events = recv_it->second;
+        set<uint32_t> removed_events;
+        for (auto event_id : recv_events) {
+          const NodePtr &send_node = events_[event_id].send_node;
+          if (!IsTrackable(send_node)) {
+            continue;
+          }
+          bool covered = IsCovered(clock, send_node);
+          for (auto other_id : recv_events) {
+            if (covered) {
+              break;
+            }
+            if ((other_id == event_id) || (removed_events.count(other_id) > 0)) {
+              continue;
+            }
+            const NodePtr &other_send_node = events_[other_id].send_node;
+            auto other_clock = send_clocks_.find(other_send_node.get());
+            covered = IsTrackable(other_send_node) && (other_clock != send_clocks_.end()) &&
+                      IsCovered(other_clock->second, send_node);
+          }
+          if (covered) {
+            RemoveEvent(event_id);
+            (void)removed_events.insert(event_id);
+            ++removed_num;
+          }
+        }
+      }
+
+      for (auto event_id : recv_it->second) {
+        const NodePtr &send_node = events_[event_id].send_node;
+        auto send_clock = send_clocks_.find(send_node.get());
+        if (!IsTrackable(send_node) || (send_clock == send_clocks_.end())) {
+          continue;
+        }
+        for (size_t i = 0; i < stream_num_; ++i) {
+          clock[i] = std::max(clock[i], send_clock->second[i]);
+        }
+      }
+    }
+
+    if (position.trackable) {
+      clock[position.stream] = position.index;
+    }
+    auto send_it = node_to_send_events_.find(node);
+    if ((send_it != node_to_send_events_.end()) && !send_it->second.empty()) {
+      send_clocks_[node.get()] = clock;
+    }
+  }
+  return SUCCESS;
+}
+}  // namespace ge
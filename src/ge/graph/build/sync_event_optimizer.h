@@ -0,0 +1,93 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_BUILD_SYNC_EVENT_OPTIMIZER_H_
+#define GE_GRAPH_BUILD_SYNC_EVENT_OPTIMIZER_H_
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include "common/ge_inner_error_codes.h"
+#include "graph/node.h"
+
+namespace ge {
+///
+/// @brief Reduce the hardware events of the send/recv pairs between streams. Nodes of a stream run in order and a
+///        recv node waits for its send node, so that the order of two nodes is tracked by a vector clock holding the
+///        last node of each stream known to complete before it. An event is redundant if the clock of its recv node
+///        already covers its send node, and pairs whose lifetimes do not overlap can share one event id.
+///        Nodes with stream label may not run, so their events are neither removed nor used to order others.
+///
+class SyncEventOptimizer {
+ public:
+  SyncEventOptimizer(std::map<NodePtr, std::vector<uint32_t>> &node_to_send_events,
+                     std::map<NodePtr, std::vector<uint32_t>> &node_to_recv_events);
+  ~SyncEventOptimizer() = default;
+  SyncEventOptimizer(const SyncEventOptimizer &) = delete;
+  SyncEventOptimizer &operator=(const SyncEventOptimizer &) = delete;
+
+  ///
+  /// @brief Remove events whose order is implied by the stream order and other events
+  /// @param [in] nodes: all nodes in the order they are launched on their streams
+  /// @param [out] removed_num: number of removed events
+  /// @return Status
+  ///
+  Status RemoveRedundantEvents(const std::vector<NodePtr> &nodes, uint32_t &removed_num);
+
+  ///
+  /// @brief Give the same id to events whose recv node completes before the send node of the next one. Event ids
+  ///        should be continuous, they stay unchanged if the graph has control flow between streams
+  /// @param [in] nodes: all nodes in the order they are launched on their streams
+  /// @param [in|out] event_num: number of event ids
+  /// @return Status
+  ///
+  Status ReuseEventIds(const std::vector<NodePtr> &nodes, uint32_t &event_num);
+
+ private:
+  using Clock = std::vector<int64_t>;
+
+  struct NodePosition {
+    size_t stream;
+    int64_t index;
+    bool trackable;
+  };
+
+  struct EventPair {
+    NodePtr send_node;
+    NodePtr recv_node;
+  };
+
+  Status Init(const std::vector<NodePtr> &nodes);
+  Status CollectEvents();
+  Status SortNodes(const std::vector<NodePtr> &nodes);
+  bool IsTrackable(const NodePtr &node) const;
+  bool IsCovered(const Clock &clock, const NodePtr &node) const;
+  void RemoveEvent(uint32_t event_id);
+  Status ComputeClocks(bool remove_redundant, uint32_t &removed_num);
+
+  std::map<NodePtr, std::vector<uint32_t>> &node_to_send_events_;
+  std::map<NodePtr, std::vector<uint32_t>> &node_to_recv_events_;
+
+  size_t stream_num_ = 0;
+  std::unordered_map<const Node *, NodePosition> positions_;
+  std::map<uint32_t, EventPair> events_;
+  // nodes sorted so that each node follows the previous node on its stream and the send nodes of its recv events
+  std::vector<NodePtr> sorted_nodes_;
+  // clocks of send nodes after they complete
+  std::unordered_map<const Node *, Clock> send_clocks_;
+};
+}  // namespace ge
+#endif  // GE_GRAPH_BUILD_SYNC_EVENT_OPTIMIZER_H_
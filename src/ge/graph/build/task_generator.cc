@@ -317,7 +317,11 @@ Status TaskGenerator::GenerateTask(RunContext &run_context, ComputeGraphPtr &gra
     GELOGD("Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task.", op_kernel_lib_name.c_str(),
            name.c_str(), type.c_str(), op_id, stream_id);
     GE_TIMESTAMP_RESTART(GenerateTask);
-    auto ret = kernel_info_store->GenerateTask(*node, run_context, task_def_list);
+    Status ret = SUCCESS;
+    {
+      std::lock_guard<std::mutex> lock(ops_kernel_manager.GetPluginCallMutex());
+      ret = kernel_info_store->GenerateTask(*node, run_context, task_def_list);
+    }
     GE_TIMESTAMP_ADD(GenerateTask);
     if (ret != SUCCESS) {
       GELOGE(ret, "Call %s to generate node[name:%s(%s), id:%ld, stream_id:%ld] task failed.",
@@ -421,7 +425,10 @@ Status TaskGenerator::GenerateTaskForFusionNode(FusionTaskInfo &fusion_task_info
       run_context.stream = run_context.graphStreamList[stream_id];
       GELOGI("Fusion: Call %s to generate fusion_node:[fusion_node_name:%s(%s), id:%ld, stream_id:%ld] task.",
              op_kernel_lib_name.c_str(), fusion_node_name.c_str(), fusion_node_type.c_str(), op_id, stream_id);
-      ret = kernel_info_store->GenerateTask(*fusion_node, run_context, task_def_list);
+      {
+        std::lock_guard<std::mutex> lock(ops_kernel_manager.GetPluginCallMutex());
+        ret = kernel_info_store->GenerateTask(*fusion_node, run_context, task_def_list);
+      }
       if (ret != SUCCESS) {
         GELOGE(ret,
                "Fusion: Call %s to generate fusion_node:[fusion_node_name:%s(%s), "
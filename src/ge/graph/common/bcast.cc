@@ -40,6 +40,57 @@ Status BCast::GenerateBcastInfo(const kVecInt &sx, const kVecInt &sy) {
     GE_RETURN_WITH_LOG_IF_ERROR(SetShapeDifferentInfo(x, y), "GenerateBcastInfo failed.");
   }
   ReverseAllIntermediateShapes();
+  return CollapseDims();
+}
+
+Status BCast::CollapseDims() {
+  bcast_dims_.clear();
+  x_strides_.clear();
+  y_strides_.clear();
+  bcast_elem_num_ = 1;
+  x_elem_num_ = 1;
+  y_elem_num_ = 1;
+
+  // Dims of size 1 are dropped, and adjacent dims which are broadcast on the same input are merged
+  kVecInt x_bcast_flags;
+  kVecInt y_bcast_flags;
+  for (size_t i = 0; i < output_.size(); ++i) {
+    int64_t out_dim = output_[i];
+    if (!CheckInt64MulOverflow(bcast_elem_num_, out_dim)) {
+      GELOGE(domi::PARAM_INVALID, "Element num of broadcast shape is overflow.");
+      return domi::PARAM_INVALID;
+    }
+    bcast_elem_num_ *= out_dim;
+    x_elem_num_ *= x_reshape_[i];
+    y_elem_num_ *= y_reshape_[i];
+    if (out_dim == 1) {
+      continue;
+    }
+    int64_t x_bcast_flag = (x_reshape_[i] == 1) ? 1 : 0;
+    int64_t y_bcast_flag = (y_reshape_[i] == 1) ? 1 : 0;
+    if (!bcast_dims_.empty() && (x_bcast_flags.back() == x_bcast_flag) && (y_bcast_flags.back() == y_bcast_flag)) {
+      bcast_dims_.back() *= out_dim;
+    } else {
+      bcast_dims_.push_back(out_dim);
+      x_bcast_flags.push_back(x_bcast_flag);
+      y_bcast_flags.push_back(y_bcast_flag);
+    }
+  }
+
+  x_strides_.resize(bcast_dims_.size(), 0);
+  y_strides_.resize(bcast_dims_.size(), 0);
+  int64_t x_stride = 1;
+  int64_t y_stride = 1;
+  for (size_t i = bcast_dims_.size(); i > 0; --i) {
+    if (x_bcast_flags[i - 1] == 0) {
+      x_strides_[i - 1] = x_stride;
+      x_stride *= bcast_dims_[i - 1];
+    }
+    if (y_bcast_flags[i - 1] == 0) {
+      y_strides_[i - 1] = y_stride;
+      y_stride *= bcast_dims_[i - 1];
+    }
+  }
   return domi::SUCCESS;
 }
 
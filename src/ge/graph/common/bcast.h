@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include "common/debug/log.h"
@@ -106,43 +107,127 @@ class BCast {
   static kVecInt TransShapeToDimVec(const GeTensorDesc &shape);
 
   void BCastIndexes(kVecInt &x_indexes, kVecInt &y_indexes);
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief compute output[i] = func(x[i'], y[i'']) by the broadcast info, without materialising the indexes
+  /// @param [in] x     data of first input, shape is GetXReshape()
+  /// @param [in] y     data of second input, shape is GetYReshape()
+  /// @param [out] output   buffer of GetOutputShape() elements
+  /// @param [in] func  functor of OutT(const InT &, const InT &), which is inlined into the loops
+  ///
+  template <typename InT, typename OutT, typename Func>
+  Status BCastApply(const InT *x, const InT *y, OutT *output, const Func &func) const {
+    return ForEachRow([x, y, output, &func](int64_t x_offset, int64_t y_offset, int64_t out_offset, int64_t row_len,
+                                            int64_t x_step, int64_t y_step) -> Status {
+      const InT *row_x = x + x_offset;
+      const InT *row_y = y + y_offset;
+      OutT *row_out = output + out_offset;
+      // Unit stride and scalar loops are kept simple, so that they could be vectorized by the compiler
+      if ((x_step != 0) && (y_step != 0)) {
+        for (int64_t i = 0; i < row_len; ++i) {
+          row_out[i] = func(row_x[i], row_y[i]);
+        }
+      } else if (y_step != 0) {
+        const InT x_value = *row_x;
+        for (int64_t i = 0; i < row_len; ++i) {
+          row_out[i] = func(x_value, row_y[i]);
+        }
+      } else if (x_step != 0) {
+        const InT y_value = *row_y;
+        for (int64_t i = 0; i < row_len; ++i) {
+          row_out[i] = func(row_x[i], y_value);
+        }
+      } else {
+        const OutT value = func(*row_x, *row_y);
+        for (int64_t i = 0; i < row_len; ++i) {
+          row_out[i] = value;
+        }
+      }
+      return SUCCESS;
+    });
+  }
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief same as BCastApply, for func of Status(const InT &, const InT &, OutT &) which checks each element
+  ///
+  template <typename InT, typename OutT, typename Func>
+  Status BCastApplyCheck(const InT *x, const InT *y, OutT *output, const Func &func) const {
+    return ForEachRow([x, y, output, &func](int64_t x_offset, int64_t y_offset, int64_t out_offset, int64_t row_len,
+                                            int64_t x_step, int64_t y_step) -> Status {
+      const InT *row_x = x + x_offset;
+      const InT *row_y = y + y_offset;
+      OutT *row_out = output + out_offset;
+      for (int64_t i = 0; i < row_len; ++i) {
+        Status ret = func(row_x[i * x_step], row_y[i * y_step], row_out[i]);
+        if (ret != SUCCESS) {
+          return ret;
+        }
+      }
+      return SUCCESS;
+    });
+  }
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief broadcast the first two inputs, and write func(x, y) into the data of output, whose shape is set to the
+  ///        broadcast shape
+  /// @param [in] input   inputs of kernel
+  /// @param [out] output   output tensor of kernel
+  /// @param [in] func  functor of OutT(const InT &, const InT &)
+  ///
+  template <typename InT, typename OutT, typename Func>
+  Status BCastComputeToTensor(const std::vector<ConstGeTensorPtr> &input, const GeTensorPtr &output,
+                              const Func &func) {
+    std::shared_ptr<AlignedPtr> output_data;
+    int64_t output_num = 0;
+    GE_CHK_STATUS_RET_NOLOG((PrepareOutput<InT, OutT>(input, output, output_data, output_num)));
+    if (output_num > 0) {
+      GE_CHK_STATUS_RET_NOLOG(BCastApply(reinterpret_cast<const InT *>(input[0]->GetData().data()),
+                                         reinterpret_cast<const InT *>(input[1]->GetData().data()),
+                                         reinterpret_cast<OutT *>(output_data->Get()), func));
+    }
+    return SetOutput<OutT>(output_data, output_num, output);
+  }
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief same as BCastComputeToTensor, for func of Status(const InT &, const InT &, OutT &)
+  ///
+  template <typename InT, typename OutT, typename Func>
+  Status BCastComputeCheckToTensor(const std::vector<ConstGeTensorPtr> &input, const GeTensorPtr &output,
+                                   const Func &func) {
+    std::shared_ptr<AlignedPtr> output_data;
+    int64_t output_num = 0;
+    GE_CHK_STATUS_RET_NOLOG((PrepareOutput<InT, OutT>(input, output, output_data, output_num)));
+    if (output_num > 0) {
+      Status ret = BCastApplyCheck(reinterpret_cast<const InT *>(input[0]->GetData().data()),
+                                   reinterpret_cast<const InT *>(input[1]->GetData().data()),
+                                   reinterpret_cast<OutT *>(output_data->Get()), func);
+      if (ret != SUCCESS) {
+        GELOGE(ret, "BCastComputeCheck func execute failed, datatype is %d.", input[0]->GetTensorDesc().GetDataType());
+        return ret;
+      }
+    }
+    return SetOutput<OutT>(output_data, output_num, output);
+  }
+
   template <typename InT, typename OutT>
   Status BCastCompute(const std::vector<ConstGeTensorPtr> &input, std::vector<OutT> &v_output,
                       const std::function<OutT(InT const &, InT const &)> &func) {
-    Status ret;
     if (func == nullptr) {
       GELOGE(domi::PARAM_INVALID, "Param func is null");
       return domi::PARAM_INVALID;
     }
-    // Min input num is 2
-    if (input.size() < kMinDimNum) {
-      GELOGE(domi::PARAM_INVALID, "Input size is smaller than two.");
-      return domi::PARAM_INVALID;
-    }
-    // Only broadcast shape
-    ret =
-      GenerateBcastInfo(TransShapeToDimVec(input[0]->GetTensorDesc()), TransShapeToDimVec(input[1]->GetTensorDesc()));
-    if (ret != domi::SUCCESS) {
-      GELOGE(ret, "Greater broadcasting failed.");
-      return ret;
-    }
-
-    kVecInt x_indexes;
-    kVecInt y_indexes;
-    BCastIndexes(x_indexes, y_indexes);
-
-    const void *x1_data = input[0]->GetData().data();
-    const void *x2_data = input[1]->GetData().data();
-
-    for (size_t i = 0; i < x_indexes.size(); i++) {
-      int64_t x_index = x_indexes[i];
-      int64_t y_index = y_indexes[i];
-      auto value = func((*(reinterpret_cast<const InT *>(x1_data) + x_index)),
-                        (*(reinterpret_cast<const InT *>(x2_data) + y_index)));
-      v_output.push_back(value);
-    }
+    int64_t output_num = 0;
+    GE_CHK_STATUS_RET_NOLOG((PrepareInputs<InT>(input, output_num)));
 
-    return domi::SUCCESS;
+    size_t offset = v_output.size();
+    v_output.resize(offset + static_cast<size_t>(output_num));
+    return BCastApply(reinterpret_cast<const InT *>(input[0]->GetData().data()),
+                      reinterpret_cast<const InT *>(input[1]->GetData().data()), v_output.data() + offset,
+                      [&func](InT const &x, InT const &y) -> OutT { return func(x, y); });
   }
 
   template <typename InT, typename OutT>
@@ -152,11 +237,76 @@ class BCast {
       GELOGE(PARAM_INVALID, "Param func is null");
       return PARAM_INVALID;
     }
+    int64_t output_num = 0;
+    GE_CHK_STATUS_RET_NOLOG((PrepareInputs<InT>(input, output_num)));
+
+    DataType data_type = input[0]->GetTensorDesc().GetDataType();
+    size_t offset = v_output.size();
+    v_output.resize(offset + static_cast<size_t>(output_num));
+    Status ret = BCastApplyCheck(reinterpret_cast<const InT *>(input[0]->GetData().data()),
+                                 reinterpret_cast<const InT *>(input[1]->GetData().data()), v_output.data() + offset,
+                                 [&func, &data_type](InT const &x, InT const &y, OutT &out) -> Status {
+                                   Status status = SUCCESS;
+                                   out = func(x, y, data_type, status);
+                                   return status;
+                                 });
+    if (ret != SUCCESS) {
+      GELOGE(ret, "BCastComputeCheck func execute failed, datatype is %d.", data_type);
+      return ret;
+    }
+    return SUCCESS;
+  }
+
+ private:
+  ///
+  /// @ingroup domi_calibration
+  /// @brief call row_func for each run of the innermost collapsed dim, with the offsets of the run in x, y and output,
+  ///        its length, and the steps of x and y in it, which are 0 if the input is broadcast
+  ///
+  template <typename RowFunc>
+  Status ForEachRow(const RowFunc &row_func) const {
+    if (bcast_elem_num_ == 0) {
+      return SUCCESS;
+    }
+    if (bcast_dims_.empty()) {
+      return row_func(0, 0, 0, 1, 0, 0);
+    }
+    size_t dim_num = bcast_dims_.size();
+    int64_t row_len = bcast_dims_.back();
+    int64_t row_num = bcast_elem_num_ / row_len;
+    kVecInt counters(dim_num, 0);
+    int64_t x_offset = 0;
+    int64_t y_offset = 0;
+    for (int64_t row = 0; row < row_num; ++row) {
+      GE_CHK_STATUS_RET_NOLOG(
+        row_func(x_offset, y_offset, row * row_len, row_len, x_strides_[dim_num - 1], y_strides_[dim_num - 1]));
+      for (size_t i = dim_num - 1; i > 0; --i) {
+        x_offset += x_strides_[i - 1];
+        y_offset += y_strides_[i - 1];
+        if (++counters[i - 1] < bcast_dims_[i - 1]) {
+          break;
+        }
+        x_offset -= x_strides_[i - 1] * bcast_dims_[i - 1];
+        y_offset -= y_strides_[i - 1] * bcast_dims_[i - 1];
+        counters[i - 1] = 0;
+      }
+    }
+    return SUCCESS;
+  }
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief generate broadcast info of the first two inputs, and check their data sizes
+  ///
+  template <typename InT>
+  Status PrepareInputs(const std::vector<ConstGeTensorPtr> &input, int64_t &output_num) {
     // Min input num is 2
     if (input.size() < kMinDimNum) {
       GELOGE(PARAM_INVALID, "Input size is smaller than two.");
       return PARAM_INVALID;
     }
+    GE_CHECK_NOTNULL(input[0]);
+    GE_CHECK_NOTNULL(input[1]);
     // Only broadcast shape
     Status ret =
       GenerateBcastInfo(TransShapeToDimVec(input[0]->GetTensorDesc()), TransShapeToDimVec(input[1]->GetTensorDesc()));
@@ -164,31 +314,50 @@ class BCast {
       GELOGE(ret, "Greater broadcasting failed.");
       return ret;
     }
+    if ((input[0]->GetData().size() < static_cast<size_t>(x_elem_num_) * sizeof(InT)) ||
+        (input[1]->GetData().size() < static_cast<size_t>(y_elem_num_) * sizeof(InT))) {
+      GELOGE(PARAM_INVALID, "Data size of inputs %zu and %zu are less than their shapes.", input[0]->GetData().size(),
+             input[1]->GetData().size());
+      return PARAM_INVALID;
+    }
+    output_num = bcast_elem_num_;
+    return SUCCESS;
+  }
 
-    DataType data_type = input[0]->GetTensorDesc().GetDataType();
-    kVecInt x_indexes;
-    kVecInt y_indexes;
-    BCastIndexes(x_indexes, y_indexes);
-
-    const void *x1_data = input[0]->GetData().data();
-    const void *x2_data = input[1]->GetData().data();
-
-    for (size_t i = 0; i < x_indexes.size(); i++) {
-      int64_t x_index = x_indexes[i];
-      int64_t y_index = y_indexes[i];
-      auto value = func((*(reinterpret_cast<const InT *>(x1_data) + x_index)),
-                        (*(reinterpret_cast<const InT *>(x2_data) + y_index)), data_type, ret);
-      if (ret != SUCCESS) {
-        GELOGE(ret, "BCastComputeCheck func execute failed, datatype is %d.", data_type);
-        return ret;
+  template <typename InT, typename OutT>
+  Status PrepareOutput(const std::vector<ConstGeTensorPtr> &input, const GeTensorPtr &output,
+                       std::shared_ptr<AlignedPtr> &output_data, int64_t &output_num) {
+    GE_CHECK_NOTNULL(output);
+    GE_CHK_STATUS_RET_NOLOG(PrepareInputs<InT>(input, output_num));
+    if (output_num > 0) {
+      output_data = AlignedPtr::Allocate(static_cast<size_t>(output_num) * sizeof(OutT));
+      if (output_data == nullptr) {
+        GELOGE(MEMALLOC_FAILED, "Malloc %ld elements for output of broadcast failed.", output_num);
+        return MEMALLOC_FAILED;
       }
-      v_output.push_back(value);
     }
+    return SUCCESS;
+  }
 
+  template <typename OutT>
+  Status SetOutput(const std::shared_ptr<AlignedPtr> &output_data, int64_t output_num, const GeTensorPtr &output) {
+    graphStatus ret = (output_num > 0)
+                        ? output->SetData(output_data, 0, static_cast<size_t>(output_num) * sizeof(OutT))
+                        : output->SetData(std::vector<uint8_t>());
+    if (ret != GRAPH_SUCCESS) {
+      GELOGE(INTERNAL_ERROR, "Set data of broadcast output failed.");
+      return INTERNAL_ERROR;
+    }
+    output->MutableTensorDesc().SetShape(GeShape(output_));
     return SUCCESS;
   }
 
- private:
+  ///
+  /// @ingroup domi_calibration
+  /// @brief merge adjacent dims which are broadcast in the same way, and compute strides of inputs on them
+  ///
+  Status CollapseDims();
+
   ///
   /// @ingroup domi_calibration
   /// @brief reverse elements in kVecInt
@@ -229,6 +398,14 @@ class BCast {
   kVecInt output_;
   kVecInt grad_x_reduce_idx_;
   kVecInt grad_y_reduce_idx_;
+
+  // Collapsed output dims, and strides of inputs on them
+  kVecInt bcast_dims_;
+  kVecInt x_strides_;
+  kVecInt y_strides_;
+  int64_t bcast_elem_num_ = 0;
+  int64_t x_elem_num_ = 0;
+  int64_t y_elem_num_ = 0;
 };
 }  // namespace ge
 
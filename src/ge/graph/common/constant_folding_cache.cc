@@ -0,0 +1,320 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/common/constant_folding_cache.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include "common/cache_file_util.h"
+#include "common/ge/ge_util.h"
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/util.h"
+#include "graph/model_serialize.h"
+#include "graph/op_desc.h"
+#include "graph/utils/attr_utils.h"
+
+namespace ge {
+namespace {
+const uint32_t kCacheFileMagic = 0x43464547;  // "GEFC"
+// Increase the version when the key or the file content is changed, files of other versions are discarded
+const uint32_t kCacheFileVersion = 2;
+const char *const kCacheFileSuffix = ".fold";
+// Folding small inputs is cheaper than reading a cache file, and the tiny files would crowd the cache out
+const uint64_t kMinCacheInputSize = 4096;
+const char *const kCacheOpName = "constant_folding_cache";
+const char *const kCacheOpType = "ConstantFoldingCache";
+const char *const kAttrNameOutputs = "outputs";
+// The inputs are saved with the outputs and compared on lookup, a hit is never decided by the digest alone
+const char *const kAttrNameInputs = "inputs";
+
+bool IsCacheFile(const std::string &file_name, std::string &key) {
+  std::string suffix(kCacheFileSuffix);
+  if ((file_name.size() <= suffix.size()) ||
+      (file_name.compare(file_name.size() - suffix.size(), suffix.size(), suffix) != 0)) {
+    return false;
+  }
+  key = file_name.substr(0, file_name.size() - suffix.size());
+  return true;
+}
+
+std::string TensorDescToString(const GeTensorDesc &desc) {
+  std::stringstream ss;
+  AppendTensorDesc(desc, ss);
+  return ss.str();
+}
+
+bool IsSameInputs(const std::vector<ConstGeTensorPtr> &inputs, const std::vector<GeTensorPtr> &cached_inputs) {
+  if (inputs.size() != cached_inputs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if ((inputs[i] == nullptr) || (cached_inputs[i] == nullptr)) {
+      return false;
+    }
+    if (TensorDescToString(inputs[i]->GetTensorDesc()) != TensorDescToString(cached_inputs[i]->GetTensorDesc())) {
+      return false;
+    }
+    const auto &data = inputs[i]->GetData();
+    const auto &cached_data = cached_inputs[i]->GetData();
+    if ((data.size() != cached_data.size()) ||
+        ((data.size() > 0) && (memcmp(data.data(), cached_data.data(), data.size()) != 0))) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+Status ConstantFoldingCache::Init(const std::string &cache_dir, uint64_t max_size, const std::string &version) {
+  if (cache_dir.empty()) {
+    GELOGE(PARAM_INVALID, "Constant folding cache dir is empty.");
+    return PARAM_INVALID;
+  }
+  if (CreateDirectory(cache_dir) != 0) {
+    GELOGE(FAILED, "Failed to create constant folding cache dir %s.", cache_dir.c_str());
+    return FAILED;
+  }
+  cache_dir_ = RealPath(cache_dir.c_str());
+  if (cache_dir_.empty()) {
+    GELOGE(FAILED, "Constant folding cache dir %s is invalid.", cache_dir.c_str());
+    return FAILED;
+  }
+
+  DIR *dir = opendir(cache_dir_.c_str());
+  if (dir == nullptr) {
+    GELOGE(FAILED, "Failed to open constant folding cache dir %s.", cache_dir_.c_str());
+    return FAILED;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  total_size_ = 0;
+  struct dirent *dir_ent = nullptr;
+  while ((dir_ent = readdir(dir)) != nullptr) {
+    std::string key;
+    if ((dir_ent->d_type != DT_REG) || !IsCacheFile(dir_ent->d_name, key)) {
+      continue;
+    }
+    struct stat file_stat;
+    if (stat(GetEntryPath(key).c_str(), &file_stat) != 0) {
+      continue;
+    }
+    entries_[key] = {static_cast<uint64_t>(file_stat.st_size), static_cast<int64_t>(file_stat.st_mtime)};
+    total_size_ += static_cast<uint64_t>(file_stat.st_size);
+  }
+  (void)closedir(dir);
+
+  max_size_ = max_size;
+  version_ = version;
+  enabled_ = true;
+  GELOGI("Constant folding cache %s opened, %zu entries, total size %lu, max size %lu.", cache_dir_.c_str(),
+         entries_.size(), total_size_, max_size_);
+  return SUCCESS;
+}
+
+std::string ConstantFoldingCache::GenerateKey(const NodePtr &node,
+                                              const std::vector<ConstGeTensorPtr> &inputs) const {
+  if ((node == nullptr) || (node->GetOpDesc() == nullptr)) {
+    return "";
+  }
+  uint64_t input_size = 0;
+  for (const auto &input : inputs) {
+    if (input == nullptr) {
+      return "";
+    }
+    input_size += input->GetData().size();
+  }
+  if (input_size < kMinCacheInputSize) {
+    return "";
+  }
+  auto op_desc = node->GetOpDesc();
+  std::stringstream ss;
+  ss << version_.size() << ':' << version_ << ';' << node->GetType() << ';' << AttrUtils::GetAllAttrsStr(op_desc)
+     << ';';
+  for (const auto &desc : op_desc->GetAllInputsDesc()) {
+    AppendTensorDesc(desc, ss);
+  }
+  for (const auto &desc : op_desc->GetAllOutputsDesc()) {
+    AppendTensorDesc(desc, ss);
+  }
+  for (const auto &input : inputs) {
+    AppendTensorDesc(input->GetTensorDesc(), ss);
+    const auto &data = input->GetData();
+    ss << data.size() << ',' << DigestToString(data.data(), data.size()) << ';';
+  }
+  std::string key_material = ss.str();
+  return DigestToString(key_material.data(), key_material.size());
+}
+
+bool ConstantFoldingCache::Lookup(const std::string &key, const std::vector<ConstGeTensorPtr> &inputs,
+                                  std::vector<GeTensorPtr> &outputs) {
+  if (!enabled_ || key.empty()) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.count(key) == 0) {
+      miss_count_++;
+      return false;
+    }
+  }
+
+  std::string path = GetEntryPath(key);
+  std::vector<char> buffer;
+  OpDescPtr op_desc;
+  std::vector<GeTensorPtr> tensors;
+  std::vector<GeTensorPtr> cached_inputs;
+  std::ifstream ifs(path, std::ios::in | std::ios::binary);
+  if (ifs.is_open()) {
+    buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    ifs.close();
+  }
+  CacheFileHeader header = {0, 0, 0};
+  if (buffer.size() >= sizeof(header)) {
+    header = *reinterpret_cast<const CacheFileHeader *>(buffer.data());
+  }
+  if ((header.magic == kCacheFileMagic) && (header.version == kCacheFileVersion) &&
+      (header.length == buffer.size() - sizeof(header))) {
+    op_desc = ModelSerialize().UnserializeOpDesc(reinterpret_cast<const uint8_t *>(buffer.data()) + sizeof(header),
+                                                 header.length);
+  }
+  if ((op_desc == nullptr) || !AttrUtils::MutableListTensor(op_desc, kAttrNameOutputs, tensors) || tensors.empty() ||
+      !AttrUtils::MutableListTensor(op_desc, kAttrNameInputs, cached_inputs)) {
+    GELOGW("Constant folding cache file %s is invalid, version %u, remove it.", path.c_str(), header.version);
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveEntry(key);
+    miss_count_++;
+    return false;
+  }
+  if (!IsSameInputs(inputs, cached_inputs)) {
+    GELOGW("Constant folding cache %s is of other inputs, the digests collide.", key.c_str());
+    miss_count_++;
+    return false;
+  }
+
+  // refresh the modify time for LRU eviction
+  (void)utime(path.c_str(), nullptr);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(key);
+    if (iter != entries_.end()) {
+      iter->second.access_time = static_cast<int64_t>(time(nullptr));
+    }
+  }
+  hit_count_++;
+  outputs.swap(tensors);
+  return true;
+}
+
+Status ConstantFoldingCache::Store(const std::string &key, const std::vector<ConstGeTensorPtr> &inputs,
+                                   const std::vector<GeTensorPtr> &outputs) {
+  if (!enabled_ || key.empty() || outputs.empty()) {
+    return SUCCESS;
+  }
+  for (const auto &input : inputs) {
+    GE_CHECK_NOTNULL(input);
+  }
+  for (const auto &output : outputs) {
+    GE_CHECK_NOTNULL(output);
+  }
+  auto op_desc = MakeShared<OpDesc>(kCacheOpName, kCacheOpType);
+  GE_CHECK_NOTNULL(op_desc);
+  if (!AttrUtils::SetListTensor(op_desc, kAttrNameOutputs, outputs)) {
+    GELOGE(FAILED, "Failed to set folding result of constant folding cache %s.", key.c_str());
+    return FAILED;
+  }
+  if (!AttrUtils::SetListTensor(op_desc, kAttrNameInputs, inputs)) {
+    GELOGE(FAILED, "Failed to set folding inputs of constant folding cache %s.", key.c_str());
+    return FAILED;
+  }
+  Buffer buffer = ModelSerialize().SerializeOpDesc(op_desc);
+  if (buffer.GetSize() == 0) {
+    GELOGE(FAILED, "Failed to serialize folding result of constant folding cache %s.", key.c_str());
+    return FAILED;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.count(key) > 0) {
+      return SUCCESS;
+    }
+  }
+  // the file is written without the lock, a result computed by several threads is renamed into place more than
+  // once with the same content
+  if (WriteCacheFile(GetEntryPath(key), kCacheFileMagic, kCacheFileVersion, buffer.GetData(), buffer.GetSize()) !=
+      SUCCESS) {
+    GELOGW("Failed to save constant folding cache %s.", key.c_str());
+    return FAILED;
+  }
+  uint64_t file_size = sizeof(CacheFileHeader) + buffer.GetSize();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entries_.count(key) == 0) {
+    entries_[key] = {file_size, static_cast<int64_t>(time(nullptr))};
+    total_size_ += file_size;
+  }
+  GELOGD("Constant folding cache %s saved, size %lu.", key.c_str(), file_size);
+  return SUCCESS;
+}
+
+void ConstantFoldingCache::Evict() {
+  if (!enabled_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (total_size_ <= max_size_) {
+    return;
+  }
+  std::vector<std::pair<int64_t, std::string>> access_order;
+  for (const auto &entry : entries_) {
+    access_order.emplace_back(entry.second.access_time, entry.first);
+  }
+  std::sort(access_order.begin(), access_order.end());
+  size_t evict_num = 0;
+  for (const auto &item : access_order) {
+    if (total_size_ <= max_size_) {
+      break;
+    }
+    RemoveEntry(item.second);
+    ++evict_num;
+  }
+  GELOGI("Constant folding cache evicted %zu entries, total size %lu, max size %lu.", evict_num, total_size_,
+         max_size_);
+}
+
+std::string ConstantFoldingCache::GetEntryPath(const std::string &key) const {
+  return cache_dir_ + "/" + key + kCacheFileSuffix;
+}
+
+void ConstantFoldingCache::RemoveEntry(const std::string &key) {
+  auto iter = entries_.find(key);
+  if (iter == entries_.end()) {
+    return;
+  }
+  if (remove(GetEntryPath(key).c_str()) != 0) {
+    GELOGW("Failed to remove constant folding cache file of %s.", key.c_str());
+  }
+  total_size_ -= iter->second.size;
+  entries_.erase(iter);
+}
+}  // namespace ge
@@ -0,0 +1,114 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_COMMON_CONSTANT_FOLDING_CACHE_H_
+#define GE_GRAPH_COMMON_CONSTANT_FOLDING_CACHE_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "framework/common/ge_inner_error_codes.h"
+#include "graph/ge_tensor.h"
+#include "graph/node.h"
+
+namespace ge {
+///
+/// @brief On-disk cache of constant folding results, shared by builds. Each entry is a file in the cache
+///        directory, named by the digest of (op type, attributes, tensor descs, input data). The least recently
+///        used entries are removed when the total size exceeds the limit. The inputs are saved in the entry and
+///        compared on lookup, so a digest collision is a miss.
+///
+class ConstantFoldingCache {
+ public:
+  ConstantFoldingCache() = default;
+  ~ConstantFoldingCache() = default;
+  ConstantFoldingCache(const ConstantFoldingCache &) = delete;
+  ConstantFoldingCache &operator=(const ConstantFoldingCache &) = delete;
+
+  ///
+  /// @brief Open the cache directory, the directory is created if it does not exist
+  /// @param [in] cache_dir
+  /// @param [in] max_size max total byte size of the cache files
+  /// @param [in] version versions of GE and the op kernels, the results of other versions are not used
+  /// @return Status
+  ///
+  Status Init(const std::string &cache_dir, uint64_t max_size, const std::string &version);
+
+  bool IsEnabled() const { return enabled_; }
+
+  ///
+  /// @brief Generate the key of the folding result of node with inputs
+  /// @param [in] node
+  /// @param [in] inputs constant inputs of node
+  /// @return key, empty if failed or the inputs are too small to be worth caching
+  ///
+  std::string GenerateKey(const NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs) const;
+
+  ///
+  /// @brief Thread safe. Get the folding result cached by key, the entry is a miss unless its inputs have the
+  ///        same descs and data as inputs
+  /// @param [in] key
+  /// @param [in] inputs the inputs the key is generated from
+  /// @param [out] outputs
+  /// @return true if hit
+  ///
+  bool Lookup(const std::string &key, const std::vector<ConstGeTensorPtr> &inputs, std::vector<GeTensorPtr> &outputs);
+
+  ///
+  /// @brief Thread safe. Save the folding result to the cache
+  /// @param [in] key
+  /// @param [in] inputs the inputs the key is generated from, they are saved to verify hits
+  /// @param [in] outputs
+  /// @return Status
+  ///
+  Status Store(const std::string &key, const std::vector<ConstGeTensorPtr> &inputs,
+               const std::vector<GeTensorPtr> &outputs);
+
+  ///
+  /// @brief Remove the least recently used entries until the total size is within the limit
+  ///
+  void Evict();
+
+  uint64_t GetHitCount() const { return hit_count_.load(); }
+  uint64_t GetMissCount() const { return miss_count_.load(); }
+  uint64_t GetTotalSize() const { return total_size_; }
+
+ private:
+  struct CacheEntry {
+    uint64_t size;
+    // modify time of the cache file, which is refreshed when hit
+    int64_t access_time;
+  };
+
+  std::string GetEntryPath(const std::string &key) const;
+  void RemoveEntry(const std::string &key);
+
+  bool enabled_ = false;
+  std::string cache_dir_;
+  std::string version_;
+  uint64_t max_size_ = 0;
+  uint64_t total_size_ = 0;
+  std::map<std::string, CacheEntry> entries_;
+  std::mutex mutex_;
+  std::atomic<uint64_t> hit_count_{0};
+  std::atomic<uint64_t> miss_count_{0};
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_COMMON_CONSTANT_FOLDING_CACHE_H_
@@ -16,9 +16,11 @@
 
 #include "graph/execute/graph_execute.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
+#include "common/ge/ge_util.h"
 #include "common/ge_inner_error_codes.h"
 #include "common/model_parser/base.h"
 #include "graph/load/new_model_manager/model_manager.h"
@@ -106,11 +108,14 @@ Status GraphExecutor::FreeInOutBuffer() {
       rt_ret = rtFreeHost(*iter);
       if (rt_ret != RT_ERROR_NONE) {
         GELOGE(RT_FAILED, "[GraphManager] subgraph free buffer failed, ret: 0x%X", rt_ret);
+        auto freed_num = static_cast<size_t>(iter - buffer_addr_.begin());
         (void)buffer_addr_.erase(buffer_addr_.begin(), iter);
+        (void)buffer_size_.erase(buffer_size_.begin(), buffer_size_.begin() + std::min(freed_num, buffer_size_.size()));
         return GE_GRAPH_FREE_FAILED;
       }
     }
     buffer_addr_.clear();
+    buffer_size_.clear();
 
     malloc_flag_ = false;
     return SUCCESS;
@@ -121,65 +126,94 @@ Status GraphExecutor::FreeInOutBuffer() {
 }
 
 Status GraphExecutor::MallocInOutBuffer(const std::vector<uint64_t> &buffer_size, std::vector<void *> &data_addr) {
-  if (malloc_flag_) {
-    auto all_size_same = true;
-    if (buffer_size.size() == buffer_size_.size()) {
-      for (size_t i = 0; i < buffer_size.size(); i++) {
-        if (buffer_size[i] != buffer_size_[i]) {
-          all_size_same = false;
-          break;
-        }
+  // Each slot keeps its pinned buffer while it is large enough, only the slots which grow are reallocated
+  for (size_t i = 0; i < buffer_size.size(); ++i) {
+    if (i < buffer_addr_.size()) {
+      if (buffer_size_[i] >= buffer_size[i]) {
+        data_addr.push_back(buffer_addr_[i]);
+        continue;
       }
-    } else {
-      all_size_same = false;
-    }
-    if (all_size_same) {
-      data_addr = buffer_addr_;
-      return SUCCESS;
-    }
-    buffer_size_.clear();
-    auto rt_ret = FreeInOutBuffer();
-    if (rt_ret != SUCCESS) {
-      GELOGE(RT_FAILED, "[SubGraphInfo] MallocInOutBuffer free buffer failed, ret: 0x%X", rt_ret);
-      return RT_FAILED;
+      rtError_t rt_ret = rtFreeHost(buffer_addr_[i]);
+      if (rt_ret != RT_ERROR_NONE) {
+        GELOGE(RT_FAILED, "[GraphManager] subgraph free buffer failed, ret: 0x%X", rt_ret);
+        return GE_GRAPH_FREE_FAILED;
+      }
+      buffer_addr_[i] = nullptr;
+      buffer_size_[i] = 0;
     }
-  }
 
-  rtError_t rt_ret;
-  for (size_t i = 0; i < buffer_size.size(); ++i) {
     void *tmp_buf = nullptr;
-    rt_ret = rtMallocHost(&tmp_buf, buffer_size[i]);
+    rtError_t rt_ret = rtMallocHost(&tmp_buf, buffer_size[i]);
     if (rt_ret != RT_ERROR_NONE) {
       GELOGE(RT_FAILED, "[GraphManager] subgraph malloc buffer failed, ret: 0x%X", rt_ret);
+      if (i < buffer_addr_.size()) {
+        (void)buffer_addr_.erase(buffer_addr_.begin() + i);
+        (void)buffer_size_.erase(buffer_size_.begin() + i);
+      }
       return GE_GRAPH_MALLOC_FAILED;
     }
     malloc_flag_ = true;
     data_addr.push_back(tmp_buf);
-    buffer_addr_.push_back(tmp_buf);
+    if (i < buffer_addr_.size()) {
+      buffer_addr_[i] = tmp_buf;
+      buffer_size_[i] = buffer_size[i];
+    } else {
+      buffer_addr_.push_back(tmp_buf);
+      buffer_size_.push_back(buffer_size[i]);
+    }
+  }
+  return SUCCESS;
+}
+
+Status GraphExecutor::GetIoPlan(uint32_t model_id, std::shared_ptr<const IoPlan> &io_plan) {
+  std::lock_guard<std::mutex> lock(io_plan_mutex_);
+  auto iter = io_plans_.find(model_id);
+  if (iter != io_plans_.end()) {
+    io_plan = iter->second;
+    return SUCCESS;
+  }
+
+  auto plan = MakeShared<IoPlan>();
+  GE_CHECK_NOTNULL(plan);
+  IoPlan &new_plan = *plan;
+  GELOGI("[ExecuteGraph] GetInputOutputDescInfo via new ome begin.");
+  Status ret = GetInputOutputDescInfo(model_id, new_plan.inputs_desc, new_plan.outputs_desc);
+  if (ret != SUCCESS) {
+    GELOGE(GE_GRAPH_GET_IN_OUT_FAILED, "[GraphExecutor] GetInputOutputDescInfo failed, modelId=%u.", model_id);
+    return GE_GRAPH_GET_IN_OUT_FAILED;
   }
-  buffer_size_ = buffer_size;
+  for (const auto &desc : new_plan.outputs_desc) {
+    std::vector<int64_t> shape_dims;
+    for (const auto &dim : desc.shape_info.dims) {
+      shape_dims.push_back(dim);
+    }
+    GeTensorDesc tensor_desc;
+    tensor_desc.SetShape(GeShape(shape_dims));
+    tensor_desc.SetDataType(static_cast<DataType>(desc.data_type));
+    new_plan.output_tensor_desc.push_back(tensor_desc);
+  }
+  io_plan = plan;
+  io_plans_[model_id] = io_plan;
+  GELOGI("[GraphExecutor] I/O plan of model %u is cached, input num %zu, output num %zu.", model_id,
+         io_plan->inputs_desc.size(), io_plan->outputs_desc.size());
   return SUCCESS;
 }
 
-Status GraphExecutor::PrepareInputData(const std::vector<GeTensor> &input_tensor, InputData &graph_input_data,
-                                       OutputData &graph_output_data, std::vector<InputOutputDescInfo> &output_desc) {
+void GraphExecutor::ReleaseIoPlan(uint32_t model_id) {
+  std::lock_guard<std::mutex> lock(io_plan_mutex_);
+  (void)io_plans_.erase(model_id);
+}
+
+Status GraphExecutor::PrepareInputData(const std::vector<GeTensor> &input_tensor, InputData &graph_input_data) {
   // Preprocessing input data
   graph_input_data.index = 0;
   graph_input_data.timeout = 0;
   graph_input_data.timestamp = 0;
-  std::size_t inputSize = input_tensor.size();
-  std::size_t output_size = output_desc.size();
   std::vector<uint64_t> bufferSizeVec;
   std::vector<void *> addrVec;
 
-  for (std::size_t i = 0; i < inputSize; ++i) {
-    const GeTensor *InTensor = &input_tensor[i];
-    GE_CHECK_NOTNULL(InTensor);
-    bufferSizeVec.push_back(InTensor->GetData().size());
-  }
-
-  for (const auto &desc : output_desc) {
-    bufferSizeVec.push_back(desc.size);
+  for (const auto &in_tensor : input_tensor) {
+    bufferSizeVec.push_back(in_tensor.GetData().size());
   }
 
   Status ret = MallocInOutBuffer(bufferSizeVec, addrVec);
@@ -190,7 +224,6 @@ Status GraphExecutor::PrepareInputData(const std::vector<GeTensor> &input_tensor
 
   for (std::size_t i = 0; i < input_tensor.size() && i < addrVec.size(); ++i) {
     const GeTensor *in_tensor = &input_tensor[i];
-    GE_CHECK_NOTNULL(in_tensor);
     if ((addrVec[i] != nullptr) && (in_tensor->GetData().data() != nullptr)) {
       rtError_t rt_ret = rtMemcpy(addrVec[i], bufferSizeVec[i], in_tensor->GetData().data(),
                                   in_tensor->GetData().size(), RT_MEMCPY_HOST_TO_HOST);
@@ -207,14 +240,33 @@ Status GraphExecutor::PrepareInputData(const std::vector<GeTensor> &input_tensor
     graph_input_data.blobs.push_back(in_data_buf);
   }
 
-  graph_output_data.index = 0;
+  return SUCCESS;
+}
 
-  for (std::size_t j = 0; j < output_size; j++) {
-    auto desc = output_desc[j];
-    uint64_t buffer_size = desc.size;
+Status GraphExecutor::PrepareOutputData(const IoPlan &io_plan, OutputData &graph_output_data,
+                                        std::vector<GeTensor> &new_output_tensor) {
+  graph_output_data.index = 0;
+  const auto &outputs_desc = io_plan.outputs_desc;
+  for (size_t i = 0; i < outputs_desc.size(); ++i) {
+    uint64_t buffer_size = outputs_desc[i].size;
+    CHECK_FALSE_EXEC(buffer_size != 0, GELOGE(GE_GRAPH_EXECUTE_FAILED, "Failed to allocate memory, length is 0.");
+                     return GE_GRAPH_EXECUTE_FAILED);
+    // The model copies the result into the storage of the new output tensor directly
+    auto aligned_ptr = AlignedPtr::Allocate(buffer_size);
+    if ((aligned_ptr == nullptr) || (aligned_ptr->Get() == nullptr)) {
+      GELOGE(FAILED, "Failed to allocate memory.");
+      return FAILED;
+    }
+    GE_PRINT_DYNAMIC_MEMORY(new, "the output memory of data on training.", sizeof(uint8_t) * buffer_size)
+    GeTensor out_tensor(io_plan.output_tensor_desc[i]);
+    if (out_tensor.SetData(aligned_ptr, 0, buffer_size) != GRAPH_SUCCESS) {
+      GELOGE(FAILED, "Failed to set data of output %zu.", i);
+      return FAILED;
+    }
+    new_output_tensor.push_back(out_tensor);
 
     DataBuffer out_data_buf;
-    out_data_buf.data = reinterpret_cast<uint8_t *>(addrVec[inputSize + j]);
+    out_data_buf.data = aligned_ptr->Get();
     out_data_buf.length = buffer_size;
     out_data_buf.isDataSupportMemShare = false;
     graph_output_data.blobs.push_back(out_data_buf);
@@ -233,21 +285,21 @@ Status GraphExecutor::SyncExecuteModel(uint32_t model_id, const std::vector<GeTe
   }
 
   // Prepare input and output
-  std::vector<InputOutputDescInfo> inputs_desc;
-  std::vector<InputOutputDescInfo> output_desc;
-
-  GELOGI("[ExecuteGraph] GetInputOutputDescInfo via new ome begin.");
-  Status ret = GetInputOutputDescInfo(model_id, inputs_desc, output_desc);
+  std::shared_ptr<const IoPlan> io_plan;
+  Status ret = GetIoPlan(model_id, io_plan);
   if (ret != SUCCESS) {
-    GELOGE(GE_GRAPH_GET_IN_OUT_FAILED, "[GraphExecutor] GetInputOutputDescInfo failed, modelId=%u.", model_id);
-    return GE_GRAPH_GET_IN_OUT_FAILED;
+    return ret;
   }
-  outputs_desc_.assign(output_desc.begin(), output_desc.end());
+  outputs_desc_.assign(io_plan->outputs_desc.begin(), io_plan->outputs_desc.end());
 
   InputData input_data;
   OutputData output_data;
+  std::vector<GeTensor> new_output_tensor;
   input_data.model_id = model_id;
-  ret = PrepareInputData(input_tensor, input_data, output_data, output_desc);
+  ret = PrepareInputData(input_tensor, input_data);
+  if (ret == SUCCESS) {
+    ret = PrepareOutputData(*io_plan, output_data, new_output_tensor);
+  }
   if (ret != SUCCESS) {
     GELOGE(GE_GRAPH_PREPARE_FAILED, "[GraphExecutor] PrepareInputData failed, modelId=%u.", model_id);
     return GE_GRAPH_PREPARE_FAILED;
@@ -282,34 +334,8 @@ Status GraphExecutor::SyncExecuteModel(uint32_t model_id, const std::vector<GeTe
       return GE_GRAPH_EXECUTE_FAILED;
     }
   }
-  for (size_t i = 0; i < output_data.blobs.size(); ++i) {
-    DataBuffer outputDataTmp = output_data.blobs[i];
-    CHECK_FALSE_EXEC(outputDataTmp.length != 0,
-                     GELOGE(GE_GRAPH_EXECUTE_FAILED, "Failed to allocate memory, length is 0.");
-                     return GE_GRAPH_EXECUTE_FAILED);
-    std::unique_ptr<uint8_t> outBufTmp(new (std::nothrow) uint8_t[outputDataTmp.length]);
-    if (outBufTmp == nullptr) {
-      GELOGE(FAILED, "Failed to allocate memory.");
-      return FAILED;
-    }
-    GE_PRINT_DYNAMIC_MEMORY(new, "the output memory of data on training.", sizeof(uint8_t) * outputDataTmp.length)
-    rtError_t ret_value =
-      rtMemcpy(outBufTmp.get(), outputDataTmp.length, outputDataTmp.data, outputDataTmp.length, RT_MEMCPY_HOST_TO_HOST);
-    CHECK_FALSE_EXEC(ret_value == RT_ERROR_NONE,
-                     GELOGE(GE_GRAPH_EXECUTE_FAILED, "Call rt api rtMemcpy failed, ret: 0x%X", ret);
-                     return GE_GRAPH_EXECUTE_FAILED);
-    GeTensor outTensor;
-    std::vector<int64_t> shapeDims;
-    for (const auto &dim : output_desc[i].shape_info.dims) {
-      shapeDims.push_back(dim);
-    }
-
-    GeShape outShape(shapeDims);
-    outTensor.MutableTensorDesc().SetShape(outShape);
-    outTensor.MutableTensorDesc().SetDataType((DataType)output_desc[i].data_type);
-    (void)outTensor.SetData(outBufTmp.get(), outputDataTmp.length);
-    output_tensor.push_back(outTensor);
-  }
+  // Results were copied into the new output tensors by the model, which are appended as before
+  output_tensor.insert(output_tensor.end(), new_output_tensor.begin(), new_output_tensor.end());
 
   GELOGI("[GraphExecutor] execute model success, modelId=%u.", model_id);
 
@@ -328,6 +354,10 @@ void GraphExecutor::InitModelIdInfo(std::vector<uint32_t> &out_model_id_info,
 }
 
 Status GraphExecutor::FreeExecuteMemory() {
+  {
+    std::lock_guard<std::mutex> lock(io_plan_mutex_);
+    io_plans_.clear();
+  }
   auto ret = FreeInOutBuffer();
   if (ret != SUCCESS) {
     GELOGE(ret, "[FreeExecuteMemory] FreeInOutBuffer Error!");
@@ -339,8 +369,9 @@ Status GraphExecutor::FreeExecuteMemory() {
 
 Status GraphExecutor::ExecuteGraph(GraphId graph_id, const GeRootModelPtr &ge_root_model,
                                    const std::vector<GeTensor> &input_tensor, std::vector<GeTensor> &output_tensor) {
+  // the staging buffers are sized for the last graph, the I/O plans are kept since they are keyed by model id
   if (graph_id != last_graph_id_) {
-    auto ret = FreeExecuteMemory();
+    auto ret = FreeInOutBuffer();
     if (ret != SUCCESS) {
       return ret;
     }
@@ -364,8 +395,9 @@ Status GraphExecutor::ExecuteGraph(GraphId graph_id, const GeRootModelPtr &ge_ro
 Status GraphExecutor::ExecuteGraphAsync(GraphId graph_id, const GeRootModelPtr &ge_root_model,
                                         const std::vector<InputTensorInfo> &input_tensor) {
   GELOGI("[GraphExecutor] Start to async execute graph, graph_id=%u", graph_id);
+  // the staging buffers are sized for the last graph, the I/O plans are kept since they are keyed by model id
   if (graph_id != last_graph_id_) {
-    auto ret = FreeExecuteMemory();
+    auto ret = FreeInOutBuffer();
     if (ret != SUCCESS) {
       return ret;
     }
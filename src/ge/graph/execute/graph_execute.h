@@ -21,7 +21,9 @@
 
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "common/debug/log.h"
@@ -64,6 +66,13 @@ class GraphExecutor {
 
   Status FreeExecuteMemory();
 
+  ///
+  /// @ingroup ge
+  /// @brief Drop the I/O plan of a model, it is called when the model is unloaded
+  /// @param [in] model_id
+  ///
+  void ReleaseIoPlan(uint32_t model_id);
+
   static Status DataInput(const InputData &input_data, OutputData &output_data);
 
   static Status GetInputOutputDescInfo(const uint32_t model_id, vector<InputOutputDescInfo> &input_desc,
@@ -108,8 +117,26 @@ class GraphExecutor {
                                           std::vector<InputOutputDims> &output_dims);
 
  private:
-  Status PrepareInputData(const std::vector<GeTensor> &input_tensor, InputData &graph_input_data,
-                          OutputData &graph_output_data, std::vector<InputOutputDescInfo> &output_desc);
+  ///
+  /// @ingroup ge
+  /// @brief I/O plan of a loaded model, which is computed on the first execution and reused by the later ones
+  ///
+  struct IoPlan {
+    std::vector<InputOutputDescInfo> inputs_desc;
+    std::vector<InputOutputDescInfo> outputs_desc;
+    std::vector<GeTensorDesc> output_tensor_desc;
+  };
+
+  ///
+  /// @ingroup ge
+  /// @brief Get the I/O plan of the model, the plan is shared so that it outlives a concurrent ReleaseIoPlan
+  ///
+  Status GetIoPlan(uint32_t model_id, std::shared_ptr<const IoPlan> &io_plan);
+
+  Status PrepareInputData(const std::vector<GeTensor> &input_tensor, InputData &graph_input_data);
+
+  static Status PrepareOutputData(const IoPlan &io_plan, OutputData &graph_output_data,
+                                  std::vector<GeTensor> &new_output_tensor);
 
   Status SyncExecuteModel(uint32_t model_id, const std::vector<GeTensor> &input_tensor,
                           std::vector<GeTensor> &output_tensor);
@@ -138,6 +165,11 @@ class GraphExecutor {
   std::vector<InputOutputDescInfo> outputs_desc_;
   GraphId last_graph_id_;
 
+  // I/O plans of the executed models, kept until the model is unloaded, which may happen in the thread loading graphs
+  std::mutex io_plan_mutex_;
+  std::map<uint32_t, std::shared_ptr<const IoPlan>> io_plans_;
+
+  // Pinned staging buffers of inputs, reused by the executions while large enough
   bool malloc_flag_;
   std::vector<void *> buffer_addr_;
   std::vector<uint64_t> buffer_size_;
@@ -18,6 +18,8 @@
 
 #include <pthread.h>
 #include <algorithm>
+#include <cstdlib>
+#include <fstream>
 #include <future>
 #include <set>
 #include <sstream>
@@ -33,6 +35,7 @@
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
 #include "framework/common/ge_types.h"
+#include "graph/common/constant_folding_cache.h"
 #include "graph/common/ge_call_wrapper.h"
 #include "graph/common/transop_util.h"
 #include "graph/debug/ge_attr_define.h"
@@ -102,6 +105,10 @@ const char *const kNetOutput = "NetOutput";
 const char *const kVariable = "Variable";
 const char *const kSend = "Send";
 const char *const kRecv = "Recv";
+const uint32_t kConstantFoldingThreadNum = 8;
+const uint64_t kDefaultConstantFoldingCacheSize = 1024;
+const size_t kMaxConstantFoldingCacheSizeLen = 10;
+const uint64_t kMByteSize = 1024 * 1024;
 
 bool IsTailingOptimization() {
   string is_tailing_optimization_option;
@@ -114,6 +121,53 @@ bool IsTailingOptimization() {
   GELOGW("OPTION_EXEC_ENABLE_TAILING_OPTIMIZATION not set, use BFSTopologicalSorting by default.");
   return false;
 }
+
+std::string ReadVersionInfo(const std::string &version_path) {
+  std::ifstream ifs(version_path);
+  if (!ifs.is_open()) {
+    GELOGW("Failed to open version file %s.", version_path.c_str());
+    return "";
+  }
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+// The folding results depend on the host kernels of GE and the kernels of opp, the cache is keyed by the contents
+// of their version.info, which are found the same way as atc does
+std::string GetConstantFoldingCacheVersion() {
+  std::string path_base = ge::GELib::GetPath();
+  path_base = path_base.substr(0, path_base.rfind('/'));
+  path_base = path_base.substr(0, path_base.rfind('/') + 1);
+  std::string version = "ge:" + ReadVersionInfo(path_base + "version.info");
+  const char *opp_path = std::getenv("ASCEND_OPP_PATH");
+  if (opp_path != nullptr) {
+    version += ";opp:" + ReadVersionInfo(std::string(opp_path) + "/version.info");
+  }
+  return version;
+}
+
+void InitConstantFoldingCache(ge::ConstantFoldingCache &folding_cache) {
+  std::string cache_path;
+  if ((ge::GetContext().GetOption(ge::OPTION_EXEC_CONSTANT_FOLDING_CACHE_PATH, cache_path) != ge::GRAPH_SUCCESS) ||
+      cache_path.empty()) {
+    return;
+  }
+  uint64_t cache_size = kDefaultConstantFoldingCacheSize;
+  std::string cache_size_str;
+  if (ge::GetContext().GetOption(ge::OPTION_EXEC_CONSTANT_FOLDING_CACHE_SIZE, cache_size_str) == ge::GRAPH_SUCCESS) {
+    bool is_digit = !cache_size_str.empty() && std::all_of(cache_size_str.begin(), cache_size_str.end(), ::isdigit);
+    if (is_digit && (cache_size_str.size() < kMaxConstantFoldingCacheSizeLen)) {
+      cache_size = std::stoull(cache_size_str);
+    } else {
+      GELOGW("Option %s is invalid: %s, use default %lu MB.", ge::OPTION_EXEC_CONSTANT_FOLDING_CACHE_SIZE,
+             cache_size_str.c_str(), cache_size);
+    }
+  }
+  if (folding_cache.Init(cache_path, cache_size * kMByteSize, GetConstantFoldingCacheVersion()) != ge::SUCCESS) {
+    GELOGW("Failed to init constant folding cache %s, run without cache.", cache_path.c_str());
+  }
+}
 }  // namespace
 
 namespace ge {
@@ -322,7 +376,7 @@ Status GraphManager::SetSubgraph(uint64_t session_id, ComputeGraphPtr compute_gr
   const auto &root_subgraph_list = sub_graph_map[compute_graph];
   for (const auto &subgraph : root_subgraph_list) {
     std::future<Status> f = executor.commit(GraphManager::ProcessSubGraphWithMultiThreads, this, subgraph, session_id,
-                                            GetThreadLocalContext());
+                                            GetThreadLocalContext(), domi::GetBoundContext());
     if (!f.valid()) {
       GELOGE(FAILED, "Future is invalid");
       return FAILED;
@@ -334,7 +388,7 @@ Status GraphManager::SetSubgraph(uint64_t session_id, ComputeGraphPtr compute_gr
     auto subgraph_list = sub_graph_map[function_graph];
     for (const auto &subgraph : subgraph_list) {
       std::future<Status> f = executor.commit(GraphManager::ProcessSubGraphWithMultiThreads, this, subgraph, session_id,
-                                              GetThreadLocalContext());
+                                              GetThreadLocalContext(), domi::GetBoundContext());
       if (!f.valid()) {
         GELOGE(FAILED, "Future is invalid");
         return FAILED;
@@ -898,6 +952,7 @@ Status GraphManager::RemoveGraph(const GraphId &graph_id) {
              graph_id);
       return FAILED;
     }
+    graph_executor_.ReleaseIoPlan(ge_root_model->GetModelId());
     middle_ret = GraphLoader::UnloadModel(ge_root_model->GetModelId());
     if (middle_ret != SUCCESS) {
       GELOGE(middle_ret, "[GraphManager:] unload model failed, modelId=%u, graph_id=%u.", ge_root_model->GetModelId(),
@@ -1688,6 +1743,19 @@ Status GraphManager::OptimizeStage1(ge::ComputeGraphPtr &compute_graph) {
   names_to_passes.emplace_back("DimensionComputePass", &dimension_compute_pass);
   names_to_passes.emplace_back("ConstantFoldingPass", &constant_folding_pass);
   names_to_passes.emplace_back("DimensionAdjustPass", &dimension_adjust_pass);
+  ConstantFoldingCache folding_cache;
+  InitConstantFoldingCache(folding_cache);
+  if (folding_cache.IsEnabled()) {
+    constant_folding_pass.SetFoldingCache(&folding_cache);
+  }
+  // Fold the constant sub graphs with multi threads first, the rest nodes are folded by the passes below
+  GE_TIMESTAMP_START(constant_folding_frontiers);
+  ret = constant_folding_pass.RunFrontiers(compute_graph, kConstantFoldingThreadNum);
+  GE_TIMESTAMP_END(constant_folding_frontiers, "GraphManager::OptimizeStage1_2::ConstantFoldingFrontiers");
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Run constant folding frontiers when OptimizeStage1_2 failed, ret:%u.", ret);
+    return ret;
+  }
   GE_TIMESTAMP_START(names_to_passes);
   ret = GEPass(compute_graph).Run(names_to_passes);
   GE_TIMESTAMP_END(names_to_passes, "GraphManager::OptimizeStage1_2");
@@ -1708,6 +1776,14 @@ Status GraphManager::OptimizeStage1(ge::ComputeGraphPtr &compute_graph) {
     GELOGI("The time cost of %s constant folding is [%lu] micro second, calls is %lu.", it.first.c_str(),
            it.second.second, it.second.first);
   }
+  // Compare with the time cost of ConstantFoldingFrontiers to get the gain of multi threads
+  GEEVENT("[GEPERFTRACE] The time cost of all constant folding kernels is [%lu] micro second.",
+          op_constant_folding_cost);
+  if (folding_cache.IsEnabled()) {
+    folding_cache.Evict();
+    GEEVENT("[GEPERFTRACE] The constant folding cache hits %lu, misses %lu, size is %lu.", folding_cache.GetHitCount(),
+            folding_cache.GetMissCount(), folding_cache.GetTotalSize());
+  }
 
   GraphUtils::DumpGEGraphToOnnx(*compute_graph, "OptimizeStage1_2");
   PassManager graph_pass;
@@ -2072,6 +2148,7 @@ Status GraphManager::CheckAndReleaseMemory(const GeModelPtr &ge_model, const Gra
       GELOGE(RT_FAILED, "[GraphManager:] rtSetDevice failed, modelId=%u, graphId=%u.", model_id, graph_id);
       continue;
     }
+    graph_executor_.ReleaseIoPlan(model_id);
     result = GraphLoader::UnloadModel(model_id);
     if (result != SUCCESS) {
       GELOGW("[GraphManager:] unload model failed, modelId=%u, graphId=%u.", model_id, graph_id);
@@ -2094,9 +2171,11 @@ Status GraphManager::CheckAndReleaseMemory(const GeModelPtr &ge_model, const Gra
 
 Status GraphManager::ProcessSubGraphWithMultiThreads(GraphManager *graph_manager,
                                                      const SubGraphInfoPtr &sub_graph_info_ptr, uint64_t session_id,
-                                                     const GEThreadLocalContext &ge_context) {
+                                                     const GEThreadLocalContext &ge_context,
+                                                     ge::OmgContext *omg_context) {
   Status ret = SUCCESS;
   GetThreadLocalContext() = ge_context;
+  domi::OmgContextGuard omg_context_guard(omg_context);
   if (sub_graph_info_ptr != nullptr && graph_manager != nullptr) {
     ComputeGraphPtr compute_graph_tmp = sub_graph_info_ptr->GetSubGraph();
     const std::string &engine_name = sub_graph_info_ptr->GetEngineName();
@@ -182,7 +182,8 @@ class GraphManager {
   std::shared_ptr<GraphModelListener> GetModelListener() const { return graph_run_listener_; }
 
   static Status ProcessSubGraphWithMultiThreads(GraphManager *graph_manager, const SubGraphInfoPtr &sub_graph_info_ptr,
-                                                uint64_t session_id, const GEThreadLocalContext &ge_context);
+                                                uint64_t session_id, const GEThreadLocalContext &ge_context,
+                                                ge::OmgContext *omg_context);
   Status PreRun(const GraphNodePtr &graph_node, const std::vector<GeTensor> &inputs, GeRootModelPtr &ge_root_model,
                 uint64_t session_id = INVALID_SESSION_ID);
 
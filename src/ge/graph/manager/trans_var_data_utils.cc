@@ -147,69 +147,50 @@ Status CopyVarFromDevice(uint64_t session_id, const NodePtr &var, std::unique_pt
 }
 
 Status TransVarOnHost(uint8_t *var_data, const VarTransRoad &trans_road, formats::TransResult &result) {
-  formats::TransResult result_last_time{};
-  bool use_init_data = true;
+  std::vector<formats::TransStep> steps;
   for (const auto &trans_info : trans_road) {
     if (trans_info.node_type == RESHAPE || trans_info.node_type == REFORMAT) {
       GELOGD("Skip to trans variable data on the reshape/reformat node");
       continue;
     }
-    uint8_t *src_data = nullptr;
-    if (use_init_data) {
-      src_data = var_data;
-      use_init_data = false;
-    } else {
-      src_data = result_last_time.data.get();
-    }
-
-    formats::TransResult tmp_result{};
+    formats::TransStep step{formats::kTransStepFormat,
+                            trans_info.input.GetFormat(),
+                            trans_info.output.GetFormat(),
+                            trans_info.input.GetShape().GetDims(),
+                            trans_info.output.GetShape().GetDims(),
+                            trans_info.input.GetDataType(),
+                            trans_info.output.GetDataType()};
     if (trans_info.node_type == TRANSDATA || trans_info.node_type == TRANSPOSED) {
-      auto src_format = trans_info.input.GetFormat();
-      auto src_shape = trans_info.input.GetShape().GetDims();
-      auto dst_format = trans_info.output.GetFormat();
-      auto dst_shape = trans_info.output.GetShape().GetDims();
-      auto data_type = trans_info.input.GetDataType();
       GELOGD("Trans format from %s to %s, shape %s to %s, data-type %s",
-             TypeUtils::FormatToSerialString(src_format).c_str(), TypeUtils::FormatToSerialString(dst_format).c_str(),
-             formats::ShapeToString(src_shape).c_str(), formats::ShapeToString(dst_shape).c_str(),
-             TypeUtils::DataTypeToSerialString(data_type).c_str());
-      auto ret = formats::TransFormat({src_data, src_format, dst_format, src_shape, dst_shape, data_type}, tmp_result);
-      if (ret != SUCCESS) {
-        GELOGE(INTERNAL_ERROR,
-               "Failed to trans format from %s to %s, shape %s to %s, "
-               "data type %s error code %u",
-               TypeUtils::FormatToSerialString(src_format).c_str(), TypeUtils::FormatToSerialString(dst_format).c_str(),
-               formats::ShapeToString(src_shape).c_str(), formats::ShapeToString(dst_shape).c_str(),
-               TypeUtils::DataTypeToSerialString(data_type).c_str(), ret);
-        return ret;
-      }
+             TypeUtils::FormatToSerialString(step.src_format).c_str(),
+             TypeUtils::FormatToSerialString(step.dst_format).c_str(), formats::ShapeToString(step.src_shape).c_str(),
+             formats::ShapeToString(step.dst_shape).c_str(),
+             TypeUtils::DataTypeToSerialString(step.src_data_type).c_str());
+      step.dst_data_type = step.src_data_type;
     } else if (trans_info.node_type == CAST) {
-      auto input_shape = trans_info.input.GetShape();
-      auto src_data_size = input_shape.GetShapeSize() == 0 ? 1 : input_shape.GetShapeSize();
-      auto src_data_type = trans_info.input.GetDataType();
-      auto dst_data_type = trans_info.output.GetDataType();
-      GELOGD("Trans data type from %s to %s, input shape %s, data size %ld",
-             TypeUtils::DataTypeToSerialString(src_data_type).c_str(),
-             TypeUtils::DataTypeToSerialString(dst_data_type).c_str(), formats::ShapeToString(input_shape).c_str(),
-             src_data_size);
-      auto ret = formats::TransDataType({src_data, static_cast<size_t>(src_data_size), src_data_type, dst_data_type},
-                                        tmp_result);
-      if (ret != SUCCESS) {
-        GELOGE(INTERNAL_ERROR, "Failed to trans data type from %s to %s, input shape %s, data size %ld, error code %u",
-               TypeUtils::DataTypeToSerialString(src_data_type).c_str(),
-               TypeUtils::DataTypeToSerialString(dst_data_type).c_str(), formats::ShapeToString(input_shape).c_str(),
-               src_data_size, ret);
-        return ret;
+      // the scalar is cast as one element
+      if (trans_info.input.GetShape().GetShapeSize() == 0) {
+        step.src_shape = {1};
       }
+      GELOGD("Trans data type from %s to %s, input shape %s",
+             TypeUtils::DataTypeToSerialString(step.src_data_type).c_str(),
+             TypeUtils::DataTypeToSerialString(step.dst_data_type).c_str(),
+             formats::ShapeToString(step.src_shape).c_str());
+      step.type = formats::kTransStepDataType;
     } else {
       GELOGE(UNSUPPORTED, "Failed to trans var data, the trans type %s does not supported",
              trans_info.node_type.c_str());
       return UNSUPPORTED;
     }
-    result_last_time = tmp_result;
+    steps.emplace_back(std::move(step));
   }
 
-  result = result_last_time;
+  // a cast next to a transdata is done in the same pass as the transdata, the other steps are done one by one
+  auto ret = formats::TransRoad(var_data, steps, result);
+  if (ret != SUCCESS) {
+    GELOGE(INTERNAL_ERROR, "Failed to trans var data by the road of %zu steps, error code %u", steps.size(), ret);
+    return ret;
+  }
   return SUCCESS;
 }
 
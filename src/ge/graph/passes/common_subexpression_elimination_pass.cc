@@ -16,9 +16,13 @@
 
 #include "common_subexpression_elimination_pass.h"
 
-#include <sstream>
+#include <algorithm>
+#include <deque>
+#include <functional>
 #include <string>
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "graph/utils/node_utils.h"
 #include "ge_local_engine/engine/host_cpu_engine.h"
@@ -26,30 +30,73 @@
 
 namespace ge {
 namespace {
-std::string GetCseKey(const NodePtr &node) {
-  std::stringstream ss;
-  ss << node->GetType() << "-data-inputs-";
+const uint64_t kCseHashSeed = 0xcbf29ce484222325ULL;
+const uint64_t kCseNullInputHash = 0x9ae16a3b2f90404fULL;
+
+inline uint64_t HashCombine(uint64_t seed, uint64_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+inline uint64_t HashPointer(const void *ptr) {
+  return static_cast<uint64_t>(std::hash<const void *>()(ptr));
+}
+
+/// The attributes are hashed only once for each node, the digest is used to build the structural hash, and the
+/// attributes themselves are compared only when two nodes fall into the same hash bucket.
+struct CseNodeInfo {
+  uint64_t attrs_digest = 0;
+  uint64_t hash = 0;
+  bool registered = false;
+};
+
+std::vector<const Node *> GetSortedControlInputs(const NodePtr &node) {
+  std::vector<const Node *> control_inputs;
+  for (auto &src_node : node->GetInControlNodes()) {
+    control_inputs.emplace_back(src_node.get());
+  }
+  std::sort(control_inputs.begin(), control_inputs.end());
+  control_inputs.erase(std::unique(control_inputs.begin(), control_inputs.end()), control_inputs.end());
+  return control_inputs;
+}
+
+uint64_t GetCseHash(const NodePtr &node, const CseNodeInfo &info) {
+  uint64_t hash = HashCombine(kCseHashSeed, std::hash<std::string>()(node->GetType()));
   for (auto &in_anchor : node->GetAllInDataAnchors()) {
+    hash = HashCombine(hash, static_cast<uint64_t>(in_anchor->GetIdx()));
     auto src_anchor = in_anchor->GetPeerOutAnchor();
     if (src_anchor == nullptr) {
-      ss << in_anchor->GetIdx() << "-null-";
+      hash = HashCombine(hash, kCseNullInputHash);
     } else {
-      ss << in_anchor->GetIdx() << "-" << src_anchor->GetOwnerNode()->GetName() << "-" << src_anchor->GetIdx() << "-";
+      hash = HashCombine(hash, HashPointer(src_anchor->GetOwnerNode().get()));
+      hash = HashCombine(hash, static_cast<uint64_t>(src_anchor->GetIdx()));
     }
   }
+  for (auto src_node : GetSortedControlInputs(node)) {
+    hash = HashCombine(hash, HashPointer(src_node));
+  }
+  return HashCombine(hash, info.attrs_digest);
+}
 
-  ss << "control-inputs-";
-  std::set<std::string> control_in_node_names;
-  for (auto &src_node : node->GetInControlNodes()) {
-    control_in_node_names.insert(src_node->GetName());
+bool IsSameCseNode(const NodePtr &lhs, const CseNodeInfo &lhs_info, const NodePtr &rhs,
+                   const CseNodeInfo &rhs_info) {
+  if ((lhs->GetType() != rhs->GetType()) || (lhs_info.attrs_digest != rhs_info.attrs_digest)) {
+    return false;
   }
-  for (auto &name : control_in_node_names) {
-    ss << name << "-";
+  auto lhs_in_anchors = lhs->GetAllInDataAnchors();
+  auto rhs_in_anchors = rhs->GetAllInDataAnchors();
+  if (lhs_in_anchors.size() != rhs_in_anchors.size()) {
+    return false;
   }
-
-  ss << "attrs-" << AttrUtils::GetAllAttrsStr(node->GetOpDesc());
-
-  return ss.str();
+  for (size_t i = 0; i < lhs_in_anchors.size(); ++i) {
+    if ((lhs_in_anchors.at(i)->GetIdx() != rhs_in_anchors.at(i)->GetIdx()) ||
+        (lhs_in_anchors.at(i)->GetPeerOutAnchor() != rhs_in_anchors.at(i)->GetPeerOutAnchor())) {
+      return false;
+    }
+  }
+  if (GetSortedControlInputs(lhs) != GetSortedControlInputs(rhs)) {
+    return false;
+  }
+  return AttrUtils::IsAllAttrsEqual(lhs->GetOpDesc(), rhs->GetOpDesc());
 }
 
 /// As the operator category has not been defined, we do not know what types of node can be processed by CSE.
@@ -65,7 +112,10 @@ bool IsNodeSupportCse(const NodePtr &node) {
 Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
   GELOGD("Begin to run the CSE process on the graph");
   GE_CHECK_NOTNULL(graph);
-  std::map<std::string, NodePtr> keys_to_node;
+  std::unordered_map<uint64_t, std::vector<NodePtr>> hash_to_nodes;
+  std::unordered_map<const Node *, CseNodeInfo> node_infos;
+  std::deque<NodePtr> nodes_to_process;
+  std::unordered_set<const Node *> nodes_in_queue;
   for (const auto &node : graph->GetDirectNode()) {
     if (!IsNodeSupportCse(node)) {
       continue;
@@ -82,17 +132,44 @@ Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
              node->GetType().c_str());
       continue;
     }
-    auto key = GetCseKey(node);
-    GELOGD("The node %s cse key %s", node->GetName().c_str(), key.c_str());
-    auto iter = keys_to_node.find(key);
-    if (iter == keys_to_node.end()) {
-      keys_to_node[key] = node;
+    auto &info = node_infos[node.get()];
+    info.attrs_digest = AttrUtils::GetAllAttrsHash(node->GetOpDesc());
+    nodes_to_process.emplace_back(node);
+    nodes_in_queue.insert(node.get());
+  }
+
+  // Replacing a node changes the inputs of its consumers, the consumers which have been registered already are
+  // pushed back to the queue, so the process stops at a fixpoint without rescanning the whole graph.
+  while (!nodes_to_process.empty()) {
+    auto node = nodes_to_process.front();
+    nodes_to_process.pop_front();
+    nodes_in_queue.erase(node.get());
+    auto &info = node_infos[node.get()];
+    if (info.registered) {
+      auto &bucket = hash_to_nodes[info.hash];
+      bucket.erase(std::remove(bucket.begin(), bucket.end(), node), bucket.end());
+      info.registered = false;
+    }
+
+    info.hash = GetCseHash(node, info);
+    GELOGD("The node %s cse hash %lu", node->GetName().c_str(), info.hash);
+    auto &bucket = hash_to_nodes[info.hash];
+    NodePtr same_node = nullptr;
+    for (auto &candidate : bucket) {
+      if (IsSameCseNode(candidate, node_infos[candidate.get()], node, info)) {
+        same_node = candidate;
+        break;
+      }
+    }
+    if (same_node == nullptr) {
+      bucket.emplace_back(node);
+      info.registered = true;
       continue;
     }
 
-    if (node->GetAllOutDataAnchorsSize() != iter->second->GetAllOutDataAnchorsSize()) {
+    if (node->GetAllOutDataAnchorsSize() != same_node->GetAllOutDataAnchorsSize()) {
       GELOGW("The node %s and %s have the same CSE key, but different output anchor count, skip to fusion them",
-             iter->second->GetName().c_str(), node->GetName().c_str());
+             same_node->GetName().c_str(), node->GetName().c_str());
       continue;
     }
 
@@ -101,10 +178,11 @@ Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
       output_map[i] = i;
     }
 
-    ret = GraphUtils::ReplaceNodeAnchors(iter->second, node, {}, output_map);
+    auto out_nodes = node->GetOutAllNodes();
+    auto ret = GraphUtils::ReplaceNodeAnchors(same_node, node, {}, output_map);
     if (ret != GRAPH_SUCCESS) {
       GELOGE(INTERNAL_ERROR, "Failed to replace node %s by node %s error node %u", node->GetName().c_str(),
-             iter->second->GetName().c_str(), ret);
+             same_node->GetName().c_str(), ret);
       return INTERNAL_ERROR;
     }
 
@@ -115,9 +193,19 @@ Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
       GELOGE(INTERNAL_ERROR, "Failed to remove node %s from graph", node->GetName().c_str());
       return INTERNAL_ERROR;
     }
+    node_infos.erase(node.get());
+
+    for (auto &out_node : out_nodes) {
+      auto iter = node_infos.find(out_node.get());
+      if ((iter == node_infos.end()) || (nodes_in_queue.count(out_node.get()) > 0)) {
+        continue;
+      }
+      nodes_to_process.emplace_back(out_node);
+      nodes_in_queue.insert(out_node.get());
+    }
 
     GELOGI("Remove node %s by the CSE process, replace it with node %s", node->GetName().c_str(),
-           iter->second->GetName().c_str());
+           same_node->GetName().c_str());
   }
   return SUCCESS;
 }
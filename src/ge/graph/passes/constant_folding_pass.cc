@@ -16,11 +16,18 @@
 
 #include "graph/passes/constant_folding_pass.h"
 
+#include <future>
+#include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include "common/debug/log.h"
+#include "common/formats/utils/formats_trans_utils.h"
+#include "common/thread_pool.h"
 #include "common/types.h"
 #include "framework/common/debug/ge_log.h"
+#include "framework/omg/omg_inner_types.h"
+#include "graph/ge_local_context.h"
 #include "graph/operator_factory.h"
 #include "graph/utils/attr_utils.h"
 #include "graph/utils/node_utils.h"
@@ -53,61 +60,194 @@ Status ConstantFoldingPass::Run(ge::NodePtr &node) {
   Format format = node_desc->GetOutputDesc(0).GetFormat();
   GELOGD("Current [node:%s, type:%s] info: format: %s, datatype:%s", node->GetName().c_str(), node->GetType().c_str(),
          TypeUtils::FormatToSerialString(format).c_str(), TypeUtils::DataTypeToSerialString(data_type).c_str());
+  FoldingTask task;
+  task.node = node;
+  if (!GetFoldingInputs(node, task.inputs)) {
+    return SUCCESS;
+  }
+
+  Compute(task);
+  RecordCost(task);
+  bool folded = false;
+  return FoldTask(task, folded);
+}
+
+Status ConstantFoldingPass::RunFrontiers(const ComputeGraphPtr &graph, uint32_t thread_num) {
+  GE_CHECK_NOTNULL(graph);
+  // the pool is created by the first frontier which has more than one node
+  std::unique_ptr<ThreadPool> executor;
+  const GEThreadLocalContext &context = GetThreadLocalContext();
+  ge::OmgContext *omg_context = domi::GetBoundContext();
+  size_t frontier_num = 0;
+  size_t folded_num = 0;
+  // only the consumers of the folded nodes may get all constant data inputs, the graph is scanned only once
+  std::vector<NodePtr> candidates;
+  for (const auto &node : graph->GetDirectNode()) {
+    candidates.emplace_back(node);
+  }
+  while (true) {
+    // the frontier is all the candidates whose data inputs are constant now
+    std::vector<FoldingTask> tasks;
+    std::unordered_set<Node *> visited;
+    for (const auto &node : candidates) {
+      if (!visited.insert(node.get()).second || folding_pass::IsNoNeedConstantFolding(node)) {
+        continue;
+      }
+      FoldingTask task;
+      task.node = node;
+      if (GetFoldingInputs(node, task.inputs)) {
+        tasks.emplace_back(std::move(task));
+      }
+    }
+    if (tasks.empty()) {
+      break;
+    }
+    ++frontier_num;
+    GELOGD("Constant folding frontier %zu of graph %s has %zu nodes", frontier_num, graph->GetName().c_str(),
+           tasks.size());
+
+    std::vector<std::future<void>> vector_future;
+    if ((tasks.size() > 1) && (thread_num > 1) && (executor == nullptr)) {
+      executor.reset(new (std::nothrow) ThreadPool(thread_num));
+      if (executor == nullptr) {
+        GELOGW("Failed to create thread pool of constant folding, compute the nodes in current thread");
+        thread_num = 1;
+      }
+    }
+    for (size_t i = 1; (executor != nullptr) && (i < tasks.size()); ++i) {
+      FoldingTask *task = &tasks[i];
+      std::future<void> f = executor->commit([this, task, &context, omg_context]() {
+        GetThreadLocalContext() = context;
+        domi::OmgContextGuard omg_context_guard(omg_context);
+        // the kernels of a frontier are parallel already, the kernels themselves do not start more threads
+        formats::SerialParallelForGuard serial_guard;
+        Compute(*task);
+      });
+      if (!f.valid()) {
+        GELOGW("Failed to commit folding task of node %s, compute it in current thread", task->node->GetName().c_str());
+        Compute(*task);
+        continue;
+      }
+      vector_future.emplace_back(std::move(f));
+    }
+    if (executor == nullptr) {
+      for (auto &task : tasks) {
+        Compute(task);
+      }
+    } else {
+      formats::SerialParallelForGuard serial_guard;
+      Compute(tasks[0]);
+    }
+    for (auto &f : vector_future) {
+      f.get();
+    }
+
+    // graph modification is not thread safe, splice the results serially
+    candidates.clear();
+    for (auto &task : tasks) {
+      RecordCost(task);
+      auto out_data_nodes = task.node->GetOutDataNodes();
+      bool folded = false;
+      auto ret = FoldTask(task, folded);
+      if (ret != SUCCESS) {
+        return ret;
+      }
+      if (folded) {
+        ++folded_num;
+        candidates.insert(candidates.end(), out_data_nodes.begin(), out_data_nodes.end());
+      }
+    }
+  }
+  GELOGI("Constant folding on graph %s finished, %zu nodes folded in %zu frontiers.", graph->GetName().c_str(),
+         folded_num, frontier_num);
+  return SUCCESS;
+}
+
+bool ConstantFoldingPass::GetFoldingInputs(const NodePtr &node, std::vector<ConstGeTensorPtr> &inputs) {
   auto input_nodes = OpDescUtils::GetConstInputNode(*node);
-  if (input_nodes.empty() || input_nodes.size() != node_desc->GetInputsSize()) {
+  if (input_nodes.empty() || input_nodes.size() != node->GetOpDesc()->GetInputsSize()) {
     GELOGD("Node:%s, const input nodes size is %zu, and nodeDesc inputsSize is %zu.", node->GetName().c_str(),
-           input_nodes.size(), node_desc->GetInputsSize());
-    return SUCCESS;
+           input_nodes.size(), node->GetOpDesc()->GetInputsSize());
+    return false;
+  }
+  inputs = OpDescUtils::GetInputData(input_nodes);
+  return true;
+}
+
+void ConstantFoldingPass::Compute(FoldingTask &task) const {
+  std::string cache_key;
+  if ((folding_cache_ != nullptr) && folding_cache_->IsEnabled()) {
+    cache_key = folding_cache_->GenerateKey(task.node, task.inputs);
+    if (folding_cache_->Lookup(cache_key, task.inputs, task.outputs)) {
+      GELOGD("Node %s type %s, folding result is got from cache.", task.node->GetName().c_str(),
+             task.node->GetType().c_str());
+      task.by_cache = true;
+      task.ret = SUCCESS;
+      return;
+    }
   }
 
-  auto inputs = OpDescUtils::GetInputData(input_nodes);
-  vector<GeTensorPtr> outputs;
   // Statistic of ge constant folding kernel
   uint64_t start_time = GetCurrentTimestap();
-  auto ret = RunOpKernel(node, inputs, outputs);
-  if (ret != SUCCESS) {
-    auto op_kernel = folding_pass::GetKernelByType(node);
+  task.ret = RunOpKernel(task.node, task.inputs, task.outputs);
+  if (task.ret == SUCCESS) {
+    task.by_host_cpu = true;
+    task.cost_time = GetCurrentTimestap() - start_time;
+  } else {
+    auto op_kernel = folding_pass::GetKernelByType(task.node);
     if (op_kernel == nullptr) {
-      GELOGD("No op kernel for node %s type %s, skip the constant folding", node->GetName().c_str(),
-             node->GetType().c_str());
-      return SUCCESS;
+      return;
     }
-
     // Statistic of op and fe constant folding kernel
+    task.has_kernel = true;
     start_time = GetCurrentTimestap();
-    ret = op_kernel->Compute(node_desc, inputs, outputs);
-    uint64_t cost_time = GetCurrentTimestap() - start_time;
-    if (statistic_of_ge_constant_folding_.find(node->GetType()) != statistic_of_ge_constant_folding_.end()) {
-      uint64_t &cnt = statistic_of_ge_constant_folding_[node->GetType()].first;
-      uint64_t &cur_cost_time = statistic_of_ge_constant_folding_[node->GetType()].second;
-      cnt++;
-      cur_cost_time += cost_time;
-    } else {
-      statistic_of_ge_constant_folding_[node->GetType()] = std::pair<uint64_t, uint64_t>(kStartCallNum, cost_time);
+    task.ret = op_kernel->Compute(task.node->GetOpDesc(), task.inputs, task.outputs);
+    task.cost_time = GetCurrentTimestap() - start_time;
+  }
+
+  if (!cache_key.empty() && (task.ret == SUCCESS) && !task.outputs.empty()) {
+    if (folding_cache_->Store(cache_key, task.inputs, task.outputs) != SUCCESS) {
+      GELOGW("Failed to save folding result of node %s to cache.", task.node->GetName().c_str());
     }
-    if (ret != SUCCESS) {
-      if (ret == NOT_CHANGED) {
+  }
+}
+
+void ConstantFoldingPass::RecordCost(const FoldingTask &task) {
+  if (!task.by_host_cpu && !task.has_kernel) {
+    return;
+  }
+  auto &statistic = task.by_host_cpu ? statistic_of_op_constant_folding_ : statistic_of_ge_constant_folding_;
+  auto iter = statistic.find(task.node->GetType());
+  if (iter != statistic.end()) {
+    iter->second.first++;
+    iter->second.second += task.cost_time;
+  } else {
+    statistic[task.node->GetType()] = std::pair<uint64_t, uint64_t>(kStartCallNum, task.cost_time);
+  }
+}
+
+Status ConstantFoldingPass::FoldTask(FoldingTask &task, bool &folded) {
+  folded = false;
+  auto &node = task.node;
+  if (!task.by_cache && !task.by_host_cpu) {
+    if (!task.has_kernel) {
+      GELOGD("No op kernel for node %s type %s, skip the constant folding", node->GetName().c_str(),
+             node->GetType().c_str());
+      return SUCCESS;
+    }
+    if (task.ret != SUCCESS) {
+      if (task.ret == NOT_CHANGED) {
         GELOGD("Node %s type %s, compute terminates and exits the constant folding.", node->GetName().c_str(),
                node->GetType().c_str());
         return SUCCESS;
       }
       GELOGE(INTERNAL_ERROR, "Calculate for node %s failed in constant folding", node->GetName().c_str());
-      return ret;
+      return task.ret;
     }
     GELOGI("Node %s type %s, constant folding compute success.", node->GetName().c_str(), node->GetType().c_str());
-  } else {
-    if (statistic_of_op_constant_folding_.find(node->GetType()) != statistic_of_op_constant_folding_.end()) {
-      uint64_t &cnt = statistic_of_op_constant_folding_[node->GetType()].first;
-      uint64_t &cost_time = statistic_of_op_constant_folding_[node->GetType()].second;
-      cnt++;
-      cost_time += GetCurrentTimestap() - start_time;
-    } else {
-      statistic_of_op_constant_folding_[node->GetType()] =
-        std::pair<uint64_t, uint64_t>(kStartCallNum, GetCurrentTimestap() - start_time);
-    }
   }
 
-  if (outputs.empty()) {
+  if (task.outputs.empty()) {
     GELOGE(INTERNAL_ERROR,
            "Failed to constant folding on node %s,"
            " no output weight",
@@ -115,6 +255,7 @@ Status ConstantFoldingPass::Run(ge::NodePtr &node) {
     return INTERNAL_ERROR;
   }
 
-  return Folding(node, outputs);
+  folded = true;
+  return Folding(node, task.outputs);
 }
 }  // namespace ge
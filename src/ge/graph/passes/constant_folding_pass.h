@@ -18,6 +18,9 @@
 #define GE_GRAPH_PASSES_CONSTANT_FOLDING_PASS_H_
 
 #include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "graph/passes/folding_pass.h"
@@ -26,10 +29,38 @@ namespace ge {
 class ConstantFoldingPass : public FoldingPass {
  public:
   Status Run(ge::NodePtr &node) override;
+  ///
+  /// Fold the nodes of graph whose data inputs are all constant, frontier by frontier. The kernels of
+  /// one frontier are computed concurrently, then the results are spliced into the graph serially.
+  /// The next frontier is looked for only among the consumers of the folded nodes, and the kernels run
+  /// by the pool do not start threads of their own. Nodes which can not be folded are left for Run.
+  /// @param [in] graph
+  /// @param [in] thread_num max number of kernels computed at the same time
+  /// @return Status
+  ///
+  Status RunFrontiers(const ComputeGraphPtr &graph, uint32_t thread_num);
   const std::unordered_map<std::string, std::pair<std::uint64_t, uint64_t>> &GetGeConstantFoldingPerfStatistic() const;
   const std::unordered_map<std::string, std::pair<std::uint64_t, uint64_t>> &GetOpConstantFoldingPerfStatistic() const;
 
  private:
+  struct FoldingTask {
+    NodePtr node;
+    std::vector<ConstGeTensorPtr> inputs;
+    std::vector<GeTensorPtr> outputs;
+    // whether the outputs are got from the folding cache, computed by the host cpu engine or by the ge kernel
+    bool by_cache = false;
+    bool by_host_cpu = false;
+    bool has_kernel = false;
+    uint64_t cost_time = 0;
+    Status ret = SUCCESS;
+  };
+
+  static bool GetFoldingInputs(const NodePtr &node, std::vector<ConstGeTensorPtr> &inputs);
+  void Compute(FoldingTask &task) const;
+  void RecordCost(const FoldingTask &task);
+  // Splice the result of task into the graph, folded is false if the node is left unchanged
+  Status FoldTask(FoldingTask &task, bool &folded);
+
   std::unordered_map<std::string, std::pair<std::uint64_t, uint64_t>> statistic_of_op_constant_folding_;
   std::unordered_map<std::string, std::pair<std::uint64_t, uint64_t>> statistic_of_ge_constant_folding_;
 };
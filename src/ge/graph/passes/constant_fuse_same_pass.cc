@@ -22,6 +22,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/content_hash_index.h"
 #include "common/ge/ge_util.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
@@ -68,14 +69,16 @@ Status ConstantFuseSamePass::Run(ge::ComputeGraphPtr graph) {
   }
   GELOGI("ConstantFuseSamePass in.");
 
-  std::map<SameConstKey, std::vector<NodePtr>> fuse_nodes;
+  std::vector<std::vector<NodePtr>> fuse_nodes;
   GetFuseConstNodes(graph, fuse_nodes);
 
   return FuseConstNodes(graph, fuse_nodes);
 }
 
 void ConstantFuseSamePass::GetFuseConstNodes(ComputeGraphPtr &graph,
-                                             std::map<SameConstKey, std::vector<NodePtr>> &fuse_nodes) {
+                                             std::vector<std::vector<NodePtr>> &fuse_nodes) {
+  // the index maps the const content to the position of its group in fuse_nodes
+  ContentHashIndex const_index;
   int total_const_nums = 0;
   int insert_const_nums = 0;
   for (auto &node : graph->GetDirectNode()) {
@@ -121,22 +124,30 @@ void ConstantFuseSamePass::GetFuseConstNodes(ComputeGraphPtr &graph,
              TypeUtils::DataTypeToSerialString(data_type).c_str());
       continue;
     }
+    // the const holds one origin element, so the first element is all that is compared
+    const Buffer &weight_data = weight->GetData();
+    if (weight_data.GetSize() < static_cast<size_t>(type_size)) {
+      GELOGI("The weight size %zu of const %s is less than its type size %d, skip it", weight_data.GetSize(),
+             node->GetName().c_str(), type_size);
+      continue;
+    }
     ++insert_const_nums;
 
-    SameConstKey map_key;
-    map_key.data_size = type_size;
-    map_key.data = weight->GetData().GetData();
-    map_key.data_type = data_type;
-    map_key.format = output_tensor->GetFormat();
-    map_key.shape = output_tensor->GetShape().GetDims();
-    fuse_nodes[map_key].emplace_back(node);
+    auto format = output_tensor->GetFormat();
+    std::vector<int64_t> tags = {static_cast<int64_t>(data_type), static_cast<int64_t>(format)};
+    auto dims = output_tensor->GetShape().GetDims();
+    tags.insert(tags.end(), dims.begin(), dims.end());
+    size_t group_index = fuse_nodes.size();
+    if (!const_index.FindOrInsert(weight_data.GetData(), static_cast<size_t>(type_size), tags, group_index)) {
+      fuse_nodes.emplace_back();
+    }
+    fuse_nodes[group_index].emplace_back(node);
     GELOGD("ConstantFuseSamePass, format %s, datatype %s, data_size %d, shape_size %zu. node name %s",
-           TypeUtils::FormatToSerialString(map_key.format).c_str(),
-           TypeUtils::DataTypeToSerialString(map_key.data_type).c_str(), map_key.data_size, map_key.shape.size(),
-           node->GetName().c_str());
+           TypeUtils::FormatToSerialString(format).c_str(), TypeUtils::DataTypeToSerialString(data_type).c_str(),
+           type_size, dims.size(), node->GetName().c_str());
   }
-  GELOGI("ConstantFuseSamePass, total_const_nums %d, insert_const_nums %d, fuse_nodes size is %zu.", total_const_nums,
-         insert_const_nums, fuse_nodes.size());
+  GELOGI("ConstantFuseSamePass, total_const_nums %d, insert_const_nums %d, fuse_nodes size is %zu, full compare %zu.",
+         total_const_nums, insert_const_nums, fuse_nodes.size(), const_index.FullCompareCount());
 }
 
 Status ConstantFuseSamePass::MoveOutDataEdges(NodePtr &src_node, NodePtr &dst_node) {
@@ -170,9 +181,9 @@ Status ConstantFuseSamePass::MoveOutDataEdges(NodePtr &src_node, NodePtr &dst_no
 }
 
 Status ConstantFuseSamePass::FuseConstNodes(ComputeGraphPtr &graph,
-                                            std::map<SameConstKey, std::vector<NodePtr>> &fuse_nodes) {
+                                            std::vector<std::vector<NodePtr>> &fuse_nodes) {
   for (auto iter = fuse_nodes.begin(); iter != fuse_nodes.end(); ++iter) {
-    auto nodes = iter->second;
+    auto &nodes = *iter;
     size_t len = nodes.size();
     auto first_node = nodes.at(0);
     for (size_t i = 1; i < len; ++i) {
@@ -21,6 +21,7 @@
 #include <memory>
 #include <vector>
 
+#include "graph/common/constant_folding_cache.h"
 #include "graph/passes/base_pass.h"
 #include "inc/kernel.h"
 
@@ -33,10 +34,19 @@ bool IsNoNeedConstantFolding(const NodePtr &node);
 using IndexsToAnchors = std::map<int, std::vector<InDataAnchorPtr>>;
 
 class FoldingPass : public BaseNodePass {
+ public:
+  ///
+  /// Set the cache of folding results, which is consulted before running the kernels. Not owned by the pass.
+  /// @param folding_cache
+  ///
+  void SetFoldingCache(ConstantFoldingCache *folding_cache) { folding_cache_ = folding_cache; }
+
  protected:
   Status Folding(NodePtr &node, vector<GeTensorPtr> &outputs);
   static Status RunOpKernel(NodePtr &node, const vector<ConstGeTensorPtr> &inputs, vector<GeTensorPtr> &outputs);
 
+  ConstantFoldingCache *folding_cache_ = nullptr;
+
  private:
   Status AddConstNode(NodePtr &node, IndexsToAnchors indexes_to_anchors, std::vector<GeTensorPtr> &v_weight);
   Status DealWithInNodes(NodePtr &node);
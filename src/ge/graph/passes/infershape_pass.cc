@@ -22,7 +22,7 @@
 
 namespace ge {
 Status InferShapePass::Run(NodePtr &node) {
-  auto ret = ShapeRefiner::InferShapeAndType(node, !OptionExists(kOptimizeAfterSubGraph));
+  auto ret = ShapeRefiner::InferShapeAndType(node, !OptionExists(kOptimizeAfterSubGraph), session_);
   if (ret != GRAPH_SUCCESS) {
     ErrorManager::GetInstance().ATCReportErrMessage("E35003", {"opname", "err_msg"},
                                                     {node->GetName(), "check your model!"});
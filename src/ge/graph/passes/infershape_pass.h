@@ -18,6 +18,7 @@
 #define GE_GRAPH_PASSES_INFERSHAPE_PASS_H_
 
 #include "graph/passes/base_pass.h"
+#include "graph/shape_refiner.h"
 
 namespace ge {
 class InferShapePass : public BaseNodePass {
@@ -30,6 +31,10 @@ class InferShapePass : public BaseNodePass {
   /// @author
   ///
   Status Run(ge::NodePtr &node) override;
+
+ private:
+  // inference contexts of the graph passed, so that passes of different graphs never share them
+  ShapeInferenceSession session_;
 };
 }  // namespace ge
 #endif  // GE_GRAPH_PASSES_INFERSHAPE_PASS_H_
@@ -83,49 +83,30 @@ Status AddKernel::OverflowCheck(const T &x, const T &y, DataType data_type) {
 template <typename InT>
 Status AddKernel::BCastAdd(const OpDescPtr &op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
                            std::vector<GeTensorPtr> &v_output) {
-  // only broadcast shape
-  BCast bcast;
-  Status ret = bcast.GenerateBcastInfo(BCast::TransShapeToDimVec(input[kAddFirstInput]->GetTensorDesc()),
-                                       BCast::TransShapeToDimVec(input[kAddSecondInput]->GetTensorDesc()));
-  if (ret != SUCCESS) {
-    GELOGE(ret, "Greater broadcasting failed.");
-    return ret;
-  }
-
-  std::vector<int64_t> x_indexes;
-  std::vector<int64_t> y_indexes;
-  bcast.BCastIndexes(x_indexes, y_indexes);
-
-  auto x1_data = reinterpret_cast<const InT *>(input[kAddFirstInput]->GetData().data());
-  auto x2_data = reinterpret_cast<const InT *>(input[kAddSecondInput]->GetData().data());
-
-  size_t data_num = x_indexes.size();
-  std::unique_ptr<InT[]> buf(new (std::nothrow) InT[data_num]());
-  if (buf == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "New sizeof(T) * data_num(%zu) memory failed", static_cast<size_t>(sizeof(InT) * data_num));
+  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kAddFirstOutput));
+  if (output_ptr == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Make shared failed");
     return MEMALLOC_FAILED;
   }
 
+  // only broadcast shape
+  BCast bcast;
   DataType data_type = input[kAddFirstInput]->GetTensorDesc().GetDataType();
-  for (size_t i = 0; i < data_num; i++) {
-    auto x_index = *(x1_data + x_indexes[i]);
-    auto y_index = *(x2_data + y_indexes[i]);
-    if (OverflowCheck<InT>(x_index, y_index, data_type) != SUCCESS) {
-      GELOGE(PARAM_INVALID, "Result of add is overflow.");
-      return PARAM_INVALID;
-    }
-    *(buf.get() + i) = x_index + y_index;
+  Status ret = bcast.BCastComputeCheckToTensor<InT, InT>(
+    input, output_ptr, [this, data_type](InT x, InT y, InT &out) -> Status {
+      if (OverflowCheck<InT>(x, y, data_type) != SUCCESS) {
+        GELOGE(PARAM_INVALID, "Result of add is overflow.");
+        return PARAM_INVALID;
+      }
+      out = x + y;
+      return SUCCESS;
+    });
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Add broadcasting failed.");
+    return ret;
   }
 
-  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kAddFirstOutput));
-  if (output_ptr == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "Make shared failed");
-    return MEMALLOC_FAILED;
-  }
-  output_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()), data_num * sizeof(InT));
   output_ptr->MutableTensorDesc().SetDataType(data_type);
-  vector<int64_t> bcast_dims = bcast.GetOutputShape();
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast_dims));
   v_output.push_back(output_ptr);
 
   return SUCCESS;
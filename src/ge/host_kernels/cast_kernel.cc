@@ -113,7 +113,7 @@ Status CastKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstG
   if (output_ptr == nullptr) {
     return FAILED;
   }
-  if (output_ptr->SetData(trans_result.data.get(), trans_result.length) != SUCCESS) {
+  if (KernelUtils::SetOutputData(trans_result.data, trans_result.length, output_ptr) != SUCCESS) {
     GELOGW("Compute: SetData failed");
   }
   v_output.push_back(output_ptr);
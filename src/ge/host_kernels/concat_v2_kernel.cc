@@ -16,6 +16,7 @@
 
 #include "host_kernels/concat_v2_kernel.h"
 
+#include <securec.h>
 #include <memory>
 #include <set>
 
@@ -32,33 +33,68 @@ namespace ge {
 namespace {
 const size_t kConcatV2InputNum = 3;
 const int kSupportEmptyTensorRank = 1;
-const std::set<DataType> concatv2_supported_type = {DT_INT32, DT_FLOAT};
-
-template <typename T>
-void GetOutputData(std::vector<T> &y_data, int64_t loop, size_t &input_size,
-                   const std::vector<ConstGeTensorPtr> &input) {
-  for (int64_t i = 0; i < loop; i++) {
-    for (size_t k = 0; k < input_size; k++) {
-      GeShape datak_shape = input.at(k)->GetTensorDesc().GetShape();
-      auto buffer = input.at(k)->GetData();
-      const T *datak = reinterpret_cast<const T *>(buffer.data());
-      if (datak == nullptr || buffer.size() == 0) {
-        GELOGW("input[%zu] is with no data", k);
-        continue;
-      }
-      int64_t gapk = datak_shape.GetShapeSize() / loop;  // [2,3] is 6/loop
-      for (int64_t j = 0; j < gapk; j++) {
-        y_data.push_back(datak[j + gapk * i]);
+const std::set<DataType> concatv2_supported_type = {DT_INT8,  DT_UINT8,  DT_INT16,   DT_UINT16, DT_INT32,  DT_UINT32,
+                                                    DT_INT64, DT_UINT64, DT_FLOAT16, DT_FLOAT,  DT_DOUBLE, DT_BOOL};
+const size_t kMinParallelCopySize = 4 * 1024 * 1024;  // bytes copied by a thread at least
+
+struct ConcatSlab {
+  const uint8_t *data;
+  size_t size;  // bytes of the slab in each row of output
+};
+
+///
+/// The output is loop rows, each row is the concatenation of a contiguous slab of every input,
+/// so the data is copied slab by slab regardless of the data type.
+///
+Status GetOutputData(const std::vector<ConstGeTensorPtr> &input, size_t input_size, int64_t loop, uint32_t length,
+                     const GeTensorPtr &output) {
+  std::vector<ConcatSlab> slabs;
+  size_t row_size = 0;
+  for (size_t k = 0; k < input_size; k++) {
+    const auto &buffer = input.at(k)->GetData();
+    if (buffer.data() == nullptr || buffer.size() == 0) {
+      GELOGW("input[%zu] is with no data", k);
+      continue;
+    }
+    int64_t gapk = input.at(k)->GetTensorDesc().GetShape().GetShapeSize() / loop;  // [2,3] is 6/loop
+    size_t slab_size = static_cast<size_t>(gapk) * length;
+    if (gapk < 0 || buffer.size() / static_cast<size_t>(loop) < slab_size) {
+      GELOGW("input[%zu] data size %zu does not match its shape", k, buffer.size());
+      return NOT_CHANGED;
+    }
+    slabs.push_back({buffer.data(), slab_size});
+    row_size += slab_size;
+  }
+
+  size_t data_size = row_size * static_cast<size_t>(loop);
+  if (data_size == 0) {
+    return output->SetData(std::vector<uint8_t>());
+  }
+  std::shared_ptr<AlignedPtr> aligned_ptr = AlignedPtr::Allocate(data_size);
+  if (aligned_ptr == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Allocate output data failed, size %zu", data_size);
+    return MEMALLOC_FAILED;
+  }
+  uint8_t *dst = aligned_ptr->Get();
+  int64_t min_block_num = static_cast<int64_t>(kMinParallelCopySize / row_size);
+  Status ret = KernelUtils::ParallelFor(loop, min_block_num, [&slabs, row_size, dst](int64_t begin, int64_t end) {
+    uint8_t *row = dst + static_cast<size_t>(begin) * row_size;
+    for (int64_t i = begin; i < end; i++) {
+      for (const auto &slab : slabs) {
+        if (memcpy_s(row, slab.size, slab.data + static_cast<size_t>(i) * slab.size, slab.size) != EOK) {
+          GELOGE(INTERNAL_ERROR, "Copy slab of row %ld failed, size %zu", i, slab.size);
+          return INTERNAL_ERROR;
+        }
+        row += slab.size;
       }
     }
+    return SUCCESS;
+  });
+  if (ret != SUCCESS) {
+    return ret;
   }
+  return output->SetData(aligned_ptr, 0, data_size);
 }
-
-#define SET_OUTPUT(DTYPE, TYPE)                                                                                  \
-  case DTYPE:                                                                                                    \
-    GetOutputData(y_data_##TYPE, loop, input_size, input);                                                       \
-    (void)output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE.data()), y_data_##TYPE.size() * length); \
-    break;
 }  // namespace
 
 Status ConcatV2Kernel::Compute(const ge::OpDescPtr op_desc_ptr, const vector<ge::ConstGeTensorPtr> &input,
@@ -86,9 +122,6 @@ Status ConcatV2Kernel::Compute(const ge::OpDescPtr op_desc_ptr, const vector<ge:
     return NOT_CHANGED;
   }
 
-  std::vector<int32_t> y_data_int32_t;
-  std::vector<float> y_data_float;
-
   // Index 0 can always gets a GeTensorDesc object from any OpDescPtr.
   auto output_tensor_desc = op_desc_ptr->GetOutputDesc(0);
   GeTensorPtr output_ptr = MakeShared<GeTensor>(output_tensor_desc);
@@ -103,11 +136,14 @@ Status ConcatV2Kernel::Compute(const ge::OpDescPtr op_desc_ptr, const vector<ge:
     loop *= data0_shape.GetDim(i);
   }
 
-  switch (data_type) {
-    SET_OUTPUT(DT_INT32, int32_t)
-    SET_OUTPUT(DT_FLOAT, float)
-    default:
-      break;
+  if (loop <= 0) {
+    GELOGW("ConcatV2 info: the dims before axis[%d] have no data, skip fold.", tidx);
+    return NOT_CHANGED;
+  }
+  ret = GetOutputData(input, input_size, loop, length, output_ptr);
+  if (ret != SUCCESS) {
+    GELOGW("ConcatV2 generate output data failed, skip fold.");
+    return NOT_CHANGED;
   }
   output_ptr->MutableTensorDesc().SetDataType(data_type);
   output_ptr->MutableTensorDesc().SetShape(GeShape({op_desc_ptr->GetOutputDesc(0).GetShape()}));
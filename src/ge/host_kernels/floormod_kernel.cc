@@ -25,6 +25,7 @@
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/common/bcast.h"
 #include "graph/utils/type_utils.h"
+#include "host_kernels/kernel_utils.h"
 #include "inc/kernel_factory.h"
 
 namespace ge {
@@ -63,27 +64,29 @@ Status CheckYIsZero(T const &y, DataType &type) {
 }
 
 // mod(x,y) equals to x - y * floor(x/y)
-#define DEFINE_FUNC_BY_TYPE(TYPE)                                                     \
-  std::function<TYPE(TYPE const &, TYPE const &, DataType &, Status &)> func_##TYPE = \
-    [](TYPE const &a, TYPE const &b, DataType &type, Status &ret) -> TYPE {           \
-    ret = CheckYIsZero(b, type);                                                      \
-    if (ret != SUCCESS) {                                                             \
-      return static_cast<TYPE>(0);                                                    \
-    }                                                                                 \
-    return (a - b * FloorDiv(a, b));                                                  \
-  };
-
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                           \
-  case DTYPE:                                                         \
-    ret = bcast.BCastComputeCheck(input, y_data_##TYPE, func_##TYPE); \
-    break;
+template <typename T>
+class FloorModFunc {
+ public:
+  explicit FloorModFunc(DataType data_type) : data_type_(data_type) {}
+
+  Status operator()(T a, T b, T &out) const {
+    DataType data_type = data_type_;
+    Status ret = CheckYIsZero(b, data_type);
+    if (ret != SUCCESS) {
+      return ret;
+    }
+    out = (a - b * FloorDiv(a, b));
+    return SUCCESS;
+  }
 
-#define SET_OUTPUT(DTYPE, TYPE)                                                                                  \
-  case DTYPE:                                                                                                    \
-    (void)output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE.data()), y_data_##TYPE.size() * length); \
-    break;
+ private:
+  DataType data_type_;
+};
 
-DEFINE_FUNC_BY_TYPE(int32_t)
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                                                              \
+  case DTYPE:                                                                                            \
+    ret = bcast.BCastComputeCheckToTensor<TYPE, TYPE>(input, output_ptr, FloorModFunc<TYPE>(data_type)); \
+    break;
 }  // namespace
 
 Status FloorModKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
@@ -98,7 +101,12 @@ Status FloorModKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Co
     return ret;
   }
 
-  std::vector<int32_t> y_data_int32_t;
+  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kFloorModFirstOutput));
+  if (output_ptr == nullptr) {
+    GELOGW("make_shared ge::GeTensor failed, node name %s.", op_desc_ptr->GetName().c_str());
+    return NOT_CHANGED;
+  }
+
   DataType data_type = input[kFloorModInputX]->GetTensorDesc().GetDataType();
   BCast bcast;
   switch (data_type) {
@@ -114,25 +122,6 @@ Status FloorModKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Co
     return NOT_CHANGED;
   }
 
-  uint32_t length = 1;
-  if (!TypeUtils::GetDataTypeLength(data_type, length)) {
-    GELOGW("Can't GetDataTypeLength of data_type: %s", TypeUtils::DataTypeToSerialString(data_type).c_str());
-    return NOT_CHANGED;
-  }
-
-  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kFloorModFirstOutput));
-  if (output_ptr == nullptr) {
-    GELOGW("make_shared ge::GeTensor failed, node name %s.", op_desc_ptr->GetName().c_str());
-    return NOT_CHANGED;
-  }
-
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast.GetOutputShape()));
-  // only return GRAPH_SUCCESS here
-  switch (data_type) {
-    SET_OUTPUT(DT_INT32, int32_t)
-    default:
-      break;
-  }
   output_ptr->MutableTensorDesc().SetDataType(data_type);
   v_output.push_back(output_ptr);
   GELOGD("FloorModKernel success");
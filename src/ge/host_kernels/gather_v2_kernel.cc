@@ -34,245 +34,113 @@ namespace {
 const size_t kGatherV2InputIndexZero = 0;
 const size_t kGatherV2InputIndexOne = 1;
 const size_t kGatherV2InputIndexTwo = 2;
-const size_t kGatherV2InputIndexThree = 3;
-const size_t kGatherV2DimOne = 1;
 const size_t kGatherV2InpotNum = 3;
 const size_t kMaxIndicatesDims = 1;  // only support scalar and 1 dims indicates_
 const std::set<DataType> supported_type = {DT_FLOAT16, DT_DOUBLE, DT_INT8,   DT_INT16,  DT_INT16, DT_INT32,
                                            DT_INT64,   DT_UINT8,  DT_UINT16, DT_UINT32, DT_UINT64};
-}  // namespace
-template <typename T>
-Status GatherV2Kernel::ProcessAxis0(ConstGeTensorPtr tensor_x, GeTensorPtr output) {
-  Status ret = SUCCESS;
-  T *data_ptr_x = reinterpret_cast<T *>(const_cast<unsigned char *>(tensor_x->GetData().data()));
-  T *data_ptr_y = reinterpret_cast<T *>(const_cast<unsigned char *>(output->GetData().data()));
-  // index is valid, and no bigger than kGatherV2InputIndexZero
-  size_t output_size = output->GetData().size();
-  for (int64_t i = 0; i < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexZero); i++) {
-    T *data_ptr_x_tmp = data_ptr_x + indicates_[i] * xstride_[kGatherV2InputIndexZero];
-    T *data_ptr_y_tmp = data_ptr_y + i * ystride_[kGatherV2InputIndexZero];
-    size_t size = sizeof(T) * xstride_[kGatherV2InputIndexZero];
-    if (data_ptr_y_tmp - data_ptr_y < 0) {
-      GELOGE(PARAM_INVALID, "ptr_y - ptr_y_tmp less than zero");
-      return PARAM_INVALID;
-    }
-    size_t offset_size = (data_ptr_y_tmp - data_ptr_y) * sizeof(T);
-    auto ret_mem = memcpy_s(reinterpret_cast<void *>(data_ptr_y_tmp), output_size - offset_size,
-                            reinterpret_cast<void *>(data_ptr_x_tmp), size);
-    if (ret_mem != 0) {
-      GELOGE(MEMALLOC_FAILED, "memcpy failed!");
-      return MEMALLOC_FAILED;
-    }
-  }
-  return ret;
-}
+const size_t kMinParallelCopySize = 4 * 1024 * 1024;  // bytes copied by a thread at least
 
+///
+/// The output is [outer, indices, inner], row r of the output is the inner slab of x at
+/// [r / indices_num, indices[r % indices_num]]
+///
 template <typename T>
-Status GatherV2Kernel::ProcessAxis1(ConstGeTensorPtr tensor_x, GeTensorPtr output) {
-  Status ret = SUCCESS;
-  T *data_ptr_x = reinterpret_cast<T *>(const_cast<unsigned char *>(tensor_x->GetData().data()));
-  T *data_ptr_y = reinterpret_cast<T *>(const_cast<unsigned char *>(output->GetData().data()));
-  // index is valid, and no bigger than kGatherV2InputIndexOne
-  size_t output_size = output->GetData().size();
-  for (int64_t i = 0; i < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexZero); i++) {
-    T *data_ptr_x_i = data_ptr_x + i * xstride_[kGatherV2InputIndexZero];
-    T *data_ptr_y_i = data_ptr_y + i * ystride_[kGatherV2InputIndexZero];
-    for (int64_t j = 0; j < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexOne); j++) {
-      T *data_ptr_x_tmp = data_ptr_x_i + indicates_[j] * xstride_[kGatherV2InputIndexOne];
-      T *data_ptr_y_tmp = data_ptr_y_i + j * ystride_[kGatherV2InputIndexOne];
-      size_t size = sizeof(T) * xstride_[kGatherV2InputIndexOne];
-      if (data_ptr_y_tmp - data_ptr_y < 0) {
-        GELOGE(PARAM_INVALID, "ptr_y - ptr_y_tmp less than zero");
-        return PARAM_INVALID;
-      }
-      size_t offset_size = (data_ptr_y_tmp - data_ptr_y) * sizeof(T);
-      auto ret_mem = memcpy_s(reinterpret_cast<void *>(data_ptr_y_tmp), output_size - offset_size,
-                              reinterpret_cast<void *>(data_ptr_x_tmp), size);
-      if (ret_mem != 0) {
-        GELOGE(MEMALLOC_FAILED, "memcpy failed!");
-        return MEMALLOC_FAILED;
-      }
-    }
+void GatherSlabs(const T *x, const std::vector<int64_t> &indices, int64_t axis_dim, int64_t inner_num, int64_t begin,
+                 int64_t end, T *y) {
+  int64_t indices_num = static_cast<int64_t>(indices.size());
+  for (int64_t row = begin; row < end; ++row) {
+    int64_t outer = row / indices_num;
+    int64_t index = indices[static_cast<size_t>(row % indices_num)];
+    KernelUtils::CopyBlock(y + row * inner_num, x + (outer * axis_dim + index) * inner_num, inner_num);
   }
-  return ret;
 }
+}  // namespace
 
-template <typename T>
-Status GatherV2Kernel::ProcessAxis2(ConstGeTensorPtr tensor_x, GeTensorPtr output) {
-  Status ret = SUCCESS;
-  T *data_ptr_x = reinterpret_cast<T *>(const_cast<unsigned char *>(tensor_x->GetData().data()));
-  T *data_ptr_y = reinterpret_cast<T *>(const_cast<unsigned char *>(output->GetData().data()));
-  // index is valid, and no bigger than kGatherV2InputIndexTwo
-  size_t output_size = output->GetData().size();
-  for (int64_t i = 0; i < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexZero); i++) {
-    T *data_ptr_x_i = data_ptr_x + i * xstride_[kGatherV2InputIndexZero];
-    T *data_ptr_y_i = data_ptr_y + i * ystride_[kGatherV2InputIndexZero];
-    for (int64_t j = 0; j < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexOne); j++) {
-      T *data_ptr_x_j = data_ptr_x_i + j * xstride_[kGatherV2InputIndexOne];
-      T *data_ptr_y_j = data_ptr_y_i + j * ystride_[kGatherV2InputIndexOne];
-      for (int64_t m = 0; m < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexTwo); m++) {
-        T *data_ptr_x_tmp = data_ptr_x_j + indicates_[m] * xstride_[kGatherV2InputIndexTwo];
-        T *data_ptr_y_tmp = data_ptr_y_j + m * ystride_[kGatherV2InputIndexTwo];
-        size_t size = sizeof(T) * xstride_[kGatherV2InputIndexTwo];
-        if (data_ptr_y_tmp - data_ptr_y < 0) {
-          GELOGE(PARAM_INVALID, "ptr_y - ptr_y_tmp less than zero");
-          return PARAM_INVALID;
-        }
-        size_t offset_size = (data_ptr_y_tmp - data_ptr_y) * sizeof(T);
-        auto ret_mem = memcpy_s(reinterpret_cast<void *>(data_ptr_y_tmp), output_size - offset_size,
-                                reinterpret_cast<void *>(data_ptr_x_tmp), size);
-        if (ret_mem != 0) {
-          GELOGE(MEMALLOC_FAILED, "memcpy failed!");
-          return MEMALLOC_FAILED;
-        }
-      }
-    }
+Status GatherV2Kernel::Process(int64_t axis, DataType data_type, ConstGeTensorPtr input_tensor_ptr,
+                               GeTensorPtr output_ptr) {
+  uint32_t length = 0;
+  if (!TypeUtils::GetDataTypeLength(data_type, length)) {
+    GELOGI("GatherV2Kernel does not support this Data type:%s", TypeUtils::DataTypeToSerialString(data_type).c_str());
+    return NOT_CHANGED;
   }
-  return ret;
-}
-
-template <typename T>
-Status GatherV2Kernel::ProcessAxis3(ConstGeTensorPtr tensor_x, GeTensorPtr output) {
-  Status ret = SUCCESS;
-  T *data_ptr_x = reinterpret_cast<T *>(const_cast<unsigned char *>(tensor_x->GetData().data()));
-  T *data_ptr_y = reinterpret_cast<T *>(const_cast<unsigned char *>(output->GetData().data()));
-  // index is valid, and no bigger than kGatherV2InputIndexThree
-  size_t output_size = output->GetData().size();
-  for (int64_t i = 0; i < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexZero); i++) {
-    T *data_ptr_x_i = data_ptr_x + i * xstride_[kGatherV2InputIndexZero];
-    T *data_ptr_y_i = data_ptr_y + i * ystride_[kGatherV2InputIndexZero];
-    for (int64_t j = 0; j < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexOne); j++) {
-      T *data_ptr_x_j = data_ptr_x_i + j * xstride_[kGatherV2InputIndexOne];
-      T *data_ptr_y_j = data_ptr_y_i + j * ystride_[kGatherV2InputIndexOne];
-      for (int64_t m = 0; m < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexTwo); m++) {
-        T *data_ptr_x_m = data_ptr_x_j + m * xstride_[kGatherV2InputIndexTwo];
-        T *data_ptr_y_m = data_ptr_y_j + m * ystride_[kGatherV2InputIndexTwo];
-        for (int64_t n = 0; n < output->GetTensorDesc().GetShape().GetDim(kGatherV2InputIndexThree); n++) {
-          T *data_ptr_x_tmp = data_ptr_x_m + indicates_[n] * xstride_[kGatherV2InputIndexThree];
-          T *data_ptr_y_tmp = data_ptr_y_m + n * ystride_[kGatherV2InputIndexThree];
-          size_t size = sizeof(T) * xstride_[kGatherV2InputIndexThree];
-          if (data_ptr_y_tmp - data_ptr_y < 0) {
-            GELOGE(PARAM_INVALID, "ptr_y - ptr_y_tmp less than zero");
-            return PARAM_INVALID;
-          }
-          size_t offset_size = (data_ptr_y_tmp - data_ptr_y) * sizeof(T);
-          auto ret_mem = memcpy_s(reinterpret_cast<void *>(data_ptr_y_tmp), output_size - offset_size,
-                                  reinterpret_cast<void *>(data_ptr_x_tmp), size);
-          if (ret_mem != 0) {
-            GELOGE(MEMALLOC_FAILED, "memcpy failed!");
-            return MEMALLOC_FAILED;
-          }
-        }
-      }
+  std::vector<int64_t> x_dims = input_tensor_ptr->GetTensorDesc().GetShape().GetDims();
+  int64_t outer_num = 1;
+  int64_t inner_num = 1;
+  int64_t x_num = 1;
+  for (size_t i = 0; i < x_dims.size(); i++) {
+    if (x_dims[i] <= 0 || !CheckInt64MulOverflow(x_num, x_dims[i])) {
+      GELOGW("Dim %zu of x is invalid: %ld", i, x_dims[i]);
+      return NOT_CHANGED;
+    }
+    x_num *= x_dims[i];
+    if (i < static_cast<size_t>(axis)) {
+      outer_num *= x_dims[i];
+    } else if (i > static_cast<size_t>(axis)) {
+      inner_num *= x_dims[i];
     }
   }
-  return ret;
-}
-
-template <typename T>
-Status GatherV2Kernel::GenData(const int64_t data_num, ConstGeTensorPtr tensor_x, int64_t axis, GeTensorPtr output) {
-  if (data_num <= 0) {
-    return PARAM_INVALID;
+  if (!CheckInt64MulOverflow(x_num, length) ||
+      input_tensor_ptr->GetData().size() < static_cast<size_t>(x_num) * length) {
+    GELOGW("Data size %zu of x is less than its shape.", input_tensor_ptr->GetData().size());
+    return NOT_CHANGED;
   }
-  if (!CheckInt64MulOverflow(data_num, sizeof(T))) {
-    GELOGE(PARAM_INVALID, "Int64MulOverflow, data_num:%ld, type_len:%zu.", data_num, sizeof(T));
+
+  int64_t row_num = outer_num * static_cast<int64_t>(indicates_.size());
+  int64_t data_num = row_num * inner_num;
+  if (data_num <= 0 || !CheckInt64MulOverflow(data_num, length)) {
     return PARAM_INVALID;
   }
-
-  std::unique_ptr<T[]> buf(new (std::nothrow) T[data_num]());
-  if (buf == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "New sizeof(T) * data_num(%zu) memory failed", static_cast<size_t>(sizeof(T) * data_num));
+  size_t data_size = static_cast<size_t>(data_num) * length;
+  std::shared_ptr<AlignedPtr> aligned_ptr = AlignedPtr::Allocate(data_size);
+  if (aligned_ptr == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Allocate output data failed, size %zu", data_size);
     return MEMALLOC_FAILED;
   }
-  GE_IF_BOOL_EXEC(
-    output->SetData(reinterpret_cast<uint8_t *>(buf.get()), static_cast<size_t>(data_num * sizeof(T))) != GRAPH_SUCCESS,
-    GELOGE(INTERNAL_ERROR, "set data failed");
-    return INTERNAL_ERROR);
 
-  Status ret = SUCCESS;
-  switch (axis) {
-    case 0:
-      ret = ProcessAxis0<T>(tensor_x, output);
-      break;
-    case 1:
-      ret = ProcessAxis1<T>(tensor_x, output);
-      break;
-    case 2:
-      ret = ProcessAxis2<T>(tensor_x, output);
-      break;
-    case 3:
-      ret = ProcessAxis3<T>(tensor_x, output);
-      break;
-    default:
-      GELOGI("Only support 4 dims and below but input axis is %ld", axis);
-      return NOT_CHANGED;
-  }
-  return ret;
-}
-Status GatherV2Kernel::CalcStride(std::vector<int64_t> &stride, std::vector<int64_t> dims) {
-  if (stride.size() != dims.size() || dims.size() == 0) {
-    return PARAM_INVALID;
-  }
-  int i = static_cast<int>(dims.size() - kGatherV2DimOne);
-  stride[static_cast<size_t>(i)] = static_cast<int64_t>(kGatherV2DimOne);
-  i--;
-  while (i >= 0) {
-    size_t index = static_cast<size_t>(i) + kGatherV2DimOne;
-    if (!CheckInt64MulOverflow(stride[index], dims[index])) {
-      GELOGE(PARAM_INVALID, "Int64MulOverflow, data_num(%ld) type_len(%ld)", stride[index], dims[index]);
-      return PARAM_INVALID;
+  const uint8_t *x = input_tensor_ptr->GetData().data();
+  uint8_t *y = aligned_ptr->Get();
+  int64_t axis_dim = x_dims[static_cast<size_t>(axis)];
+  int64_t min_row_num = static_cast<int64_t>(kMinParallelCopySize / (static_cast<size_t>(inner_num) * length));
+  const std::vector<int64_t> &indices = indicates_;
+  Status ret = KernelUtils::ParallelFor(row_num, min_row_num, [&](int64_t begin, int64_t end) {
+    switch (length) {
+#define CASE(type)                                                                                            \
+  case sizeof(type):                                                                                          \
+    GatherSlabs(reinterpret_cast<const type *>(x), indices, axis_dim, inner_num, begin, end,                  \
+                reinterpret_cast<type *>(y));                                                                 \
+    return SUCCESS;
+      CASE(uint8_t)
+      CASE(uint16_t)
+      CASE(uint32_t)
+      CASE(uint64_t)
+#undef CASE
+      default:
+        GELOGI("GatherV2Kernel does not support data type length: %u", length);
+        return NOT_CHANGED;
     }
-    stride[static_cast<size_t>(i)] = stride[index] * dims[index];
-    i--;
+  });
+  if (ret != SUCCESS) {
+    return ret;
   }
+  GE_IF_BOOL_EXEC(output_ptr->SetData(aligned_ptr, 0, data_size) != GRAPH_SUCCESS,
+                  GELOGE(INTERNAL_ERROR, "set data failed");
+                  return INTERNAL_ERROR);
   return SUCCESS;
 }
-Status GatherV2Kernel::Process(int64_t axis, DataType data_type, ConstGeTensorPtr input_tensor_ptr,
-                               GeTensorPtr output_ptr) {
-  Status ret = SUCCESS;
-  int64_t data_num = output_ptr->GetTensorDesc().GetShape().GetShapeSize();
-  switch (data_type) {
-    case DT_FLOAT16:
-      ret = GenData<fp16_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_DOUBLE:
-      ret = GenData<double>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_INT8:
-      ret = GenData<int8_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_INT16:
-      ret = GenData<int16_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_INT32:
-      ret = GenData<int32_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_INT64:
-      ret = GenData<int64_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_UINT8:
-      ret = GenData<uint8_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_UINT16:
-      ret = GenData<uint16_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_UINT32:
-      ret = GenData<uint32_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    case DT_UINT64:
-      ret = GenData<uint64_t>(data_num, input_tensor_ptr, axis, output_ptr);
-      break;
-    default:
-      GELOGI("GatherV2Kernel does not support this Data type:%s", TypeUtils::DataTypeToSerialString(data_type).c_str());
-      return NOT_CHANGED;
-  }
-  return ret;
-}
 Status GatherV2Kernel::SaveIndicesByDataType(ConstGeTensorPtr indices_tensor_ptr, GeShape &x_shape,
                                              GeShape &indices_shape, DataType indices_data_type, size_t axis) {
+  // scalar indices has one element
+  int64_t indices_num = indices_shape.GetDimNum() == 0 ? 1 : indices_shape.GetShapeSize();
+  size_t indices_len = indices_data_type == DT_INT32 ? sizeof(int32_t) : sizeof(int64_t);
+  if (indices_num < 0 || indices_tensor_ptr->GetData().size() < static_cast<size_t>(indices_num) * indices_len) {
+    GELOGW("Data size %zu of indices is less than its shape.", indices_tensor_ptr->GetData().size());
+    return NOT_CHANGED;
+  }
+  indicates_.clear();
+  indicates_.reserve(static_cast<size_t>(indices_num));
   if (indices_data_type == DT_INT32) {
     auto indices_ptr = const_cast<int32_t *>(reinterpret_cast<const int32_t *>(indices_tensor_ptr->GetData().data()));
-    for (int64_t i = 0; i < indices_shape.GetShapeSize(); i++) {
+    for (int64_t i = 0; i < indices_num; i++) {
       if (*(indices_ptr + i) < 0 || *(indices_ptr + i) >= x_shape.GetDim(axis)) {
         GELOGW("indices %ld value is not in range [0, %ld)", i, x_shape.GetDim(axis));
         return NOT_CHANGED;
@@ -282,7 +150,7 @@ Status GatherV2Kernel::SaveIndicesByDataType(ConstGeTensorPtr indices_tensor_ptr
   } else {
     // int64
     auto indices_ptr = const_cast<int64_t *>(reinterpret_cast<const int64_t *>(indices_tensor_ptr->GetData().data()));
-    for (int64_t i = 0; i < indices_shape.GetShapeSize(); i++) {
+    for (int64_t i = 0; i < indices_num; i++) {
       if (*(indices_ptr + i) < 0 || *(indices_ptr + i) >= x_shape.GetDim(axis)) {
         GELOGW("indices %ld value is not in range [0, %ld)", i, x_shape.GetDim(axis));
         return NOT_CHANGED;
@@ -429,19 +297,6 @@ Status GatherV2Kernel::Compute(const OpDescPtr op_desc_ptr, const vector<ConstGe
   // added for debug
   DebugPrint(axis, x_shape, indices_shape, y_shape);
 
-  // calc stride
-  std::vector<int64_t> xstride(x_shape.GetDimNum());
-  std::vector<int64_t> ystride(y_shape.size());
-  xstride_ = xstride;
-  ystride_ = ystride;
-  auto ret_x = CalcStride(xstride_, x_shape.GetDims());
-  auto ret_y = CalcStride(ystride_, y_shape);
-  ret = (ret_x == SUCCESS && ret_y == SUCCESS) ? SUCCESS : NOT_CHANGED;
-  if (ret != SUCCESS) {
-    GELOGE(ret, "CalcStride Failed");
-    return ret;
-  }
-
   ret = Process(axis, x_data_type, tensor0, output_ptr);
   if (ret != SUCCESS) {
     GELOGE(ret, "GenData failed, data_type: %s", TypeUtils::DataTypeToSerialString(x_data_type).c_str());
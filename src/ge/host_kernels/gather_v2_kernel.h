@@ -28,19 +28,8 @@ class GatherV2Kernel : public Kernel {
                  std::vector<GeTensorPtr> &v_output) override;
 
  private:
-  template <typename T>
-  Status ProcessAxis0(ConstGeTensorPtr tensor_x, GeTensorPtr output);
-  template <typename T>
-  Status ProcessAxis1(ConstGeTensorPtr tensor_x, GeTensorPtr output);
-  template <typename T>
-  Status ProcessAxis2(ConstGeTensorPtr tensor_x, GeTensorPtr output);
-  template <typename T>
-  Status ProcessAxis3(ConstGeTensorPtr tensor_x, GeTensorPtr output);
-  template <typename T>
-  Status GenData(const int64_t data_num, ConstGeTensorPtr tensor_x, int64_t axis, GeTensorPtr output);
   Status Check(const OpDescPtr &op_desc_ptr, const vector<ConstGeTensorPtr> &input,
                vector<GeTensorPtr> &v_output) const;
-  Status CalcStride(std::vector<int64_t> &stride, std::vector<int64_t> dims);
   Status SaveIndicesByDataType(ConstGeTensorPtr indices_tensor_ptr, GeShape &x_shape, GeShape &indices_shape,
                                DataType indices_data_type, size_t axis);
   Status Process(int64_t axis, DataType data_type, ConstGeTensorPtr input_tensor_ptr, GeTensorPtr output_ptr);
@@ -49,8 +38,6 @@ class GatherV2Kernel : public Kernel {
 
  private:
   std::vector<int64_t> indicates_;
-  std::vector<int64_t> xstride_;
-  std::vector<int64_t> ystride_;
 };
 }  // namespace ge
 
@@ -36,28 +36,15 @@ namespace ge {
 namespace {
 const size_t kGreaterInputNum = 2;
 
-#define DEFINE_FUNC_BY_TYPE(TYPE)                                                                                \
-  std::function<uint8_t(TYPE const &, TYPE const &)> func_##TYPE = [](TYPE const &a, TYPE const &b) -> uint8_t { \
-    return a > b;                                                                                                \
-  };
-
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)               \
-  case DTYPE:                                             \
-    ret = bcast.BCastCompute(input, y_data, func_##TYPE); \
+template <typename T>
+struct GreaterFunc {
+  uint8_t operator()(T const &a, T const &b) const { return a > b; }
+};
+
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                                                    \
+  case DTYPE:                                                                                  \
+    ret = bcast.BCastComputeToTensor<TYPE, uint8_t>(input, output_ptr, GreaterFunc<TYPE>()); \
     break;
-
-DEFINE_FUNC_BY_TYPE(int8_t)
-DEFINE_FUNC_BY_TYPE(int16_t)
-DEFINE_FUNC_BY_TYPE(int32_t)
-DEFINE_FUNC_BY_TYPE(int64_t)
-DEFINE_FUNC_BY_TYPE(uint8_t)
-DEFINE_FUNC_BY_TYPE(uint16_t)
-DEFINE_FUNC_BY_TYPE(uint32_t)
-DEFINE_FUNC_BY_TYPE(uint64_t)
-DEFINE_FUNC_BY_TYPE(fp16_t)
-DEFINE_FUNC_BY_TYPE(float)
-DEFINE_FUNC_BY_TYPE(double)
-DEFINE_FUNC_BY_TYPE(bool)
 }  // namespace
 
 Status GreaterKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
@@ -72,7 +59,12 @@ Status GreaterKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Con
     return ret;
   }
 
-  std::vector<uint8_t> y_data;
+  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(0));
+  if (output_ptr == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Make shared failed %s.", op_desc_ptr->GetName().c_str());
+    return MEMALLOC_FAILED;
+  }
+
   GE_CHECK_NOTNULL(input[0]);
   DataType data_type = input[0]->GetTensorDesc().GetDataType();
   BCast bcast;
@@ -100,16 +92,6 @@ Status GreaterKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Con
     return NOT_CHANGED;
   }
 
-  GeTensorPtr output_ptr;
-  output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(0));
-  if (output_ptr == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "Make shared failed %s.", op_desc_ptr->GetName().c_str());
-    return MEMALLOC_FAILED;
-  }
-
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast.GetOutputShape()));
-  // only return GRAPH_SUCCESS here
-  GE_CHK_STATUS_RET(output_ptr->SetData(y_data));
   output_ptr->MutableTensorDesc().SetDataType(DT_BOOL);
   v_output.push_back(output_ptr);
   GELOGD("GreaterKernel success");
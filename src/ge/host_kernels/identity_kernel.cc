@@ -50,7 +50,7 @@ Status IdentityKernel::Compute(const ge::OpDescPtr op_desc, const std::vector<ge
     GELOGE(PARAM_INVALID, "Node [%s] get input failed.", op_desc->GetName().c_str());
     return NOT_CHANGED;
   }
-  if (output_ptr->SetData(input_tensor_ptr->GetData()) != GRAPH_SUCCESS) {
+  if (output_ptr->ShareData(input_tensor_ptr->GetData()) != GRAPH_SUCCESS) {
     GELOGW("Compute: SetData failed");
     return NOT_CHANGED;
   }
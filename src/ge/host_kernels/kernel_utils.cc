@@ -16,8 +16,11 @@
 
 #include "host_kernels/kernel_utils.h"
 
+#include <algorithm>
+#include <set>
 #include <vector>
 
+#include "common/formats/utils/formats_trans_utils.h"
 #include "common/ge_inner_error_codes.h"
 #include "common/types.h"
 #include "framework/common/debug/ge_log.h"
@@ -29,6 +32,42 @@ namespace {
 const int kDimensionShapeIndex = 0;
 const int kDimensionDimsIndex = 1;
 const size_t kDimensionNodeInputSize = 2;
+const size_t kMinParallelCopySize = 4 * 1024 * 1024;  // bytes copied by a thread at least
+const std::set<ge::DataType> kSliceSupportedType = {ge::DT_INT8,  ge::DT_UINT8,  ge::DT_INT16,   ge::DT_UINT16,
+                                                    ge::DT_INT32, ge::DT_UINT32, ge::DT_INT64,   ge::DT_UINT64,
+                                                    ge::DT_FLOAT, ge::DT_DOUBLE, ge::DT_FLOAT16, ge::DT_BOOL};
+
+///
+/// Copy the blocks in [begin, end) of the output, the index of outer dims is advanced like an odometer,
+/// and the offset of input is updated by the steps of the dims.
+///
+template <typename T>
+void CopyStridedBlocks(const T *input, const std::vector<int64_t> &outer_dims, const std::vector<int64_t> &steps,
+                       int64_t base, int64_t block_num, int64_t begin, int64_t end, T *output) {
+  size_t rank = outer_dims.size();
+  std::vector<int64_t> index(rank, 0);
+  int64_t offset = base;
+  int64_t rest = begin;
+  for (size_t i = rank; i > 0; --i) {
+    index[i - 1] = rest % outer_dims[i - 1];
+    rest /= outer_dims[i - 1];
+    offset += index[i - 1] * steps[i - 1];
+  }
+
+  T *dst = output + begin * block_num;
+  for (int64_t n = begin; n < end; ++n) {
+    ge::KernelUtils::CopyBlock(dst, input + offset, block_num);
+    dst += block_num;
+    for (size_t i = rank; i > 0; --i) {
+      offset += steps[i - 1];
+      if (++index[i - 1] < outer_dims[i - 1]) {
+        break;
+      }
+      offset -= outer_dims[i - 1] * steps[i - 1];
+      index[i - 1] = 0;
+    }
+  }
+}
 }  // namespace
 
 namespace ge {
@@ -146,4 +185,109 @@ bool KernelUtils::IsUnknownShape(const ge::GeShape &shape) {
   }
   return false;
 }
+
+Status KernelUtils::ParallelFor(int64_t total, int64_t min_block_num,
+                                const std::function<Status(int64_t, int64_t)> &func) {
+  return formats::ParallelFor(total, min_block_num, func);
+}
+
+Status KernelUtils::SetOutputSliceData(const uint8_t *data, size_t data_size, DataType data_type,
+                                       const std::vector<int64_t> &input_dims, const std::vector<int64_t> &begin,
+                                       const std::vector<int64_t> &output_dims, const std::vector<int64_t> &stride,
+                                       const GeTensorPtr &output) {
+  GE_CHECK_NOTNULL(data);
+  GE_CHECK_NOTNULL(output);
+  uint32_t length = 0;
+  if (kSliceSupportedType.count(data_type) == 0 || !TypeUtils::GetDataTypeLength(data_type, length)) {
+    GELOGW("Unsupported data type: %s", TypeUtils::DataTypeToSerialString(data_type).c_str());
+    return PARAM_INVALID;
+  }
+  size_t rank = input_dims.size();
+  if (begin.size() != rank || output_dims.size() != rank || stride.size() != rank) {
+    GELOGW("Rank of input %zu, begin %zu, output %zu and stride %zu are not the same.", rank, begin.size(),
+           output_dims.size(), stride.size());
+    return PARAM_INVALID;
+  }
+
+  // strides of input in elements
+  std::vector<int64_t> input_strides(rank, 1);
+  int64_t input_num = 1;
+  for (size_t i = rank; i > 0; --i) {
+    int64_t dim = input_dims[i - 1];
+    if (dim <= 0) {
+      GELOGW("Dim %zu of input is %ld, which can not be sliced.", i - 1, dim);
+      return PARAM_INVALID;
+    }
+    input_strides[i - 1] = input_num;
+    if (!CheckInt64MulOverflow(input_num, dim)) {
+      GELOGW("Int64MulOverflow, input_num(%ld) dim(%ld)", input_num, dim);
+      return PARAM_INVALID;
+    }
+    input_num *= dim;
+  }
+  if (static_cast<uint64_t>(input_num) * length > data_size) {
+    GELOGW("Data size %zu of input is less than its shape, element num %ld.", data_size, input_num);
+    return PARAM_INVALID;
+  }
+
+  int64_t output_num = 1;
+  int64_t base = 0;
+  for (size_t i = 0; i < rank; ++i) {
+    if (output_dims[i] <= 0 || stride[i] <= 0 || begin[i] < 0 ||
+        begin[i] + (output_dims[i] - 1) * stride[i] >= input_dims[i]) {
+      GELOGW("Slice of dim %zu is out of range, begin %ld, size %ld, stride %ld, dim %ld.", i, begin[i],
+             output_dims[i], stride[i], input_dims[i]);
+      return PARAM_INVALID;
+    }
+    output_num *= output_dims[i];  // no more than input_num
+    base += begin[i] * input_strides[i];
+  }
+
+  // the inner dims of unit stride are contiguous, until a dim is not sliced entirely
+  int64_t block_num = 1;
+  size_t outer_rank = rank;
+  while (outer_rank > 0 && stride[outer_rank - 1] == 1) {
+    --outer_rank;
+    block_num *= output_dims[outer_rank];
+    if (output_dims[outer_rank] != input_dims[outer_rank]) {
+      break;
+    }
+  }
+  std::vector<int64_t> outer_dims(output_dims.begin(), output_dims.begin() + outer_rank);
+  std::vector<int64_t> steps(outer_rank);
+  for (size_t i = 0; i < outer_rank; ++i) {
+    steps[i] = stride[i] * input_strides[i];
+  }
+
+  size_t output_size = static_cast<size_t>(output_num) * length;
+  std::shared_ptr<AlignedPtr> aligned_ptr = AlignedPtr::Allocate(output_size);
+  if (aligned_ptr == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Allocate output data failed, size %zu", output_size);
+    return MEMALLOC_FAILED;
+  }
+  uint8_t *output_data = aligned_ptr->Get();
+  size_t block_size = static_cast<size_t>(block_num) * length;
+  int64_t min_block_num = static_cast<int64_t>(kMinParallelCopySize / block_size);
+  Status ret = ParallelFor(output_num / block_num, min_block_num, [&](int64_t begin_block, int64_t end_block) {
+    switch (length) {
+#define CASE(type)                                                                                           \
+  case sizeof(type):                                                                                         \
+    CopyStridedBlocks(reinterpret_cast<const type *>(data), outer_dims, steps, base, block_num, begin_block, \
+                      end_block, reinterpret_cast<type *>(output_data));                                     \
+    return SUCCESS;
+      CASE(uint8_t)
+      CASE(uint16_t)
+      CASE(uint32_t)
+      CASE(uint64_t)
+#undef CASE
+      default:
+        GELOGW("Unsupported data type length: %u", length);
+        return PARAM_INVALID;
+    }
+  });
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  return output->SetData(aligned_ptr, 0, output_size);
+}
 }  // namespace ge
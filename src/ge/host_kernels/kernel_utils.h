@@ -17,6 +17,9 @@
 #ifndef GE_GRAPH_PASSES_FOLDING_KERNEL_KERNEL_UTILS_H_
 #define GE_GRAPH_PASSES_FOLDING_KERNEL_KERNEL_UTILS_H_
 
+#include <securec.h>
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -50,16 +53,24 @@ class KernelUtils {
         return PARAM_INVALID;
       }
 
-      std::unique_ptr<T[]> buf(new (std::nothrow) T[data_num]());
-      if (buf == nullptr) {
-        GELOGE(MEMALLOC_FAILED, "new sizeof(T) * data_num(%ld) memory failed", sizeof(T) * data_num);
+      size_t data_size = static_cast<size_t>(data_num) * sizeof(T);
+      std::shared_ptr<AlignedPtr> aligned_ptr = AlignedPtr::Allocate(data_size);
+      if (aligned_ptr == nullptr) {
+        GELOGE(MEMALLOC_FAILED, "new sizeof(T) * data_num(%zu) memory failed", data_size);
         return MEMALLOC_FAILED;
       }
 
-      for (int64_t i = 0; i < data_num; ++i) {
-        buf[i] = value;
+      T *buf = reinterpret_cast<T *>(aligned_ptr->Get());
+      const int64_t kMinParallelFillNum = 1024 * 1024;
+      Status ret = ParallelFor(data_num, kMinParallelFillNum, [buf, &value](int64_t begin, int64_t end) {
+        FillData(buf + begin, end - begin, value);
+        return SUCCESS;
+      });
+      if (ret != SUCCESS) {
+        GELOGE(ret, "Fill data failed, data_num(%ld)", data_num);
+        return ret;
       }
-      Status ret = output->SetData(reinterpret_cast<uint8_t *>(buf.get()), data_num * sizeof(T));
+      ret = output->SetData(aligned_ptr, 0, data_size);
       if (ret != SUCCESS) {
         GELOGE(ret, " buf must not be null.");
         return ret;
@@ -69,6 +80,122 @@ class KernelUtils {
     return SUCCESS;
   }
 
+  /**
+   * Fill the buffer with value, the filled part is doubled by block copy which is independent of the type
+   * @param [out] buf the buffer to fill
+   * @param [in] data_num the num of elements to fill
+   * @param [in] value the value to write to buffer
+   * @author
+   */
+  template <typename T>
+  static void FillData(T *buf, int64_t data_num, const T &value) {
+    if (data_num <= 0) {
+      return;
+    }
+    const int64_t kFillBlockNum = 4096;
+    buf[0] = value;
+    int64_t filled = 1;
+    while (filled < data_num) {
+      // copy from the head of buf, which stays in cache once it reaches kFillBlockNum
+      int64_t copy_num = std::min(std::min(filled, kFillBlockNum), data_num - filled);
+      size_t copy_size = static_cast<size_t>(copy_num) * sizeof(T);
+      (void)memcpy_s(buf + filled, copy_size, buf, copy_size);
+      filled += copy_num;
+    }
+  }
+
+  /**
+   * Copy a block of elements, short blocks are copied by a loop which is cheaper than calling memcpy
+   * @param [out] dst the destination of block
+   * @param [in] src the source of block
+   * @param [in] data_num the num of elements in block
+   * @author
+   */
+  template <typename T>
+  static void CopyBlock(T *dst, const T *src, int64_t data_num) {
+    const int64_t kMinMemcpySize = 256;
+    size_t copy_size = static_cast<size_t>(data_num) * sizeof(T);
+    if (copy_size >= kMinMemcpySize) {
+      (void)memcpy_s(dst, copy_size, src, copy_size);
+      return;
+    }
+    for (int64_t i = 0; i < data_num; ++i) {
+      dst[i] = src[i];
+    }
+  }
+
+  /**
+   * Slice the input of input_dims with strides, and set the result as the data of output.
+   * The unit-stride inner dims are copied as contiguous blocks, the outer dims are walked by a stride iterator.
+   * @param [in] data the data of input
+   * @param [in] data_size the size of data in bytes
+   * @param [in] data_type the data type of input
+   * @param [in] input_dims the dims of input
+   * @param [in] begin the index of first element to slice on each dim
+   * @param [in] output_dims the num of elements to slice on each dim
+   * @param [in] stride the positive stride on each dim
+   * @param [out] output the tensor to save the result
+   * @author
+   */
+  static Status SetOutputSliceData(const uint8_t *data, size_t data_size, DataType data_type,
+                                   const std::vector<int64_t> &input_dims, const std::vector<int64_t> &begin,
+                                   const std::vector<int64_t> &output_dims, const std::vector<int64_t> &stride,
+                                   const GeTensorPtr &output);
+
+  /**
+   * Split [0, total) into ranges and compute them on multiple threads, each range has min_block_num units at least.
+   * It runs in the current thread if total is too small to split. The same as formats::ParallelFor.
+   * @param [in] total the num of units
+   * @param [in] min_block_num the least num of units computed by a thread
+   * @param [in] func compute the units in [begin, end)
+   * @return the first failure of func
+   * @author
+   */
+  static Status ParallelFor(int64_t total, int64_t min_block_num, const std::function<Status(int64_t, int64_t)> &func);
+
+  /**
+   * Move the data into the output tensor without copying
+   * @param [in] data the result of the kernel, it is empty after the call
+   * @param [out] output the tensor to take over data
+   * @author
+   */
+  template <typename T>
+  static Status SetOutputData(std::vector<T> &&data, const GeTensorPtr &output) {
+    GE_CHECK_NOTNULL(output);
+    if (data.empty()) {
+      return output->SetData(std::vector<uint8_t>());
+    }
+    auto holder = std::make_shared<std::vector<T>>(std::move(data));
+    size_t data_size = holder->size() * sizeof(T);
+    auto aligned_ptr = AlignedPtr::Adopt(reinterpret_cast<uint8_t *>(holder->data()), data_size,
+                                         [holder](uint8_t *) mutable { holder.reset(); });
+    if (aligned_ptr == nullptr) {
+      GELOGE(MEMALLOC_FAILED, "Adopt output data failed, size %zu", data_size);
+      return MEMALLOC_FAILED;
+    }
+    return output->SetData(aligned_ptr, 0, data_size);
+  }
+
+  /**
+   * Share the data with the output tensor without copying
+   * @param [in] data the result of the kernel, e.g. the data of formats::TransResult
+   * @param [in] size the size of data in bytes
+   * @param [out] output the tensor to share data
+   * @author
+   */
+  static Status SetOutputData(const std::shared_ptr<uint8_t> &data, size_t size, const GeTensorPtr &output) {
+    GE_CHECK_NOTNULL(output);
+    if (data == nullptr || size == 0) {
+      return output->SetData(std::vector<uint8_t>());
+    }
+    auto aligned_ptr = AlignedPtr::Adopt(data.get(), size, [data](uint8_t *) {});
+    if (aligned_ptr == nullptr) {
+      GELOGE(MEMALLOC_FAILED, "Adopt output data failed, size %zu", size);
+      return MEMALLOC_FAILED;
+    }
+    return output->SetData(aligned_ptr, 0, size);
+  }
+
   /**
    * Calculate dimension
    * @param [in] dims save the tensor of the dimension
@@ -27,6 +27,7 @@
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/common/bcast.h"
 #include "graph/utils/type_utils.h"
+#include "host_kernels/kernel_utils.h"
 #include "inc/kernel_factory.h"
 
 namespace ge {
@@ -38,35 +39,15 @@ const size_t kMaximumFirstOutput = 0;
 const std::set<DataType> kMaximumSupportedType = {DT_FLOAT, DT_FLOAT16, DT_INT8,   DT_INT16,  DT_UINT16, DT_UINT8,
                                                   DT_INT32, DT_INT64,   DT_UINT32, DT_UINT64, DT_DOUBLE};
 
-#define DEFINE_FUNC_BY_TYPE(TYPE)                                                                          \
-  std::function<TYPE(TYPE const &, TYPE const &)> func_##TYPE = [](TYPE const &a, TYPE const &b) -> TYPE { \
-    return (a > b ? a : b);                                                                                \
-  };
+template <typename T>
+struct MaximumFunc {
+  T operator()(T const &a, T const &b) const { return (a > b ? a : b); }
+};
 
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                      \
-  case DTYPE:                                                    \
-    ret = bcast.BCastCompute(input, y_data_##TYPE, func_##TYPE); \
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                                                 \
+  case DTYPE:                                                                               \
+    ret = bcast.BCastComputeToTensor<TYPE, TYPE>(input, output_ptr, MaximumFunc<TYPE>()); \
     break;
-
-#define SET_OUTPUT(DTYPE, TYPE)                                                                                  \
-  case DTYPE:                                                                                                    \
-    if (output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE.data()), y_data_##TYPE.size() * length) != \
-        GRAPH_SUCCESS) {                                                                                         \
-      GELOGW("GenData: SetData failed");                                                                         \
-    }                                                                                                            \
-    break;
-
-DEFINE_FUNC_BY_TYPE(int8_t)
-DEFINE_FUNC_BY_TYPE(int16_t)
-DEFINE_FUNC_BY_TYPE(int32_t)
-DEFINE_FUNC_BY_TYPE(int64_t)
-DEFINE_FUNC_BY_TYPE(uint8_t)
-DEFINE_FUNC_BY_TYPE(uint16_t)
-DEFINE_FUNC_BY_TYPE(uint32_t)
-DEFINE_FUNC_BY_TYPE(uint64_t)
-DEFINE_FUNC_BY_TYPE(fp16_t)
-DEFINE_FUNC_BY_TYPE(float)
-DEFINE_FUNC_BY_TYPE(double)
 }  // namespace
 
 Status MaximumKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
@@ -81,22 +62,16 @@ Status MaximumKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Con
     return ret;
   }
 
-  std::vector<int8_t> y_data_int8_t;
-  std::vector<int16_t> y_data_int16_t;
-  std::vector<int32_t> y_data_int32_t;
-  std::vector<int64_t> y_data_int64_t;
-  std::vector<uint8_t> y_data_uint8_t;
-  std::vector<uint16_t> y_data_uint16_t;
-  std::vector<uint32_t> y_data_uint32_t;
-  std::vector<uint64_t> y_data_uint64_t;
-  std::vector<fp16_t> y_data_fp16_t;
-  std::vector<float> y_data_float;
-  std::vector<double> y_data_double;
-
   if (input.empty()) {
     GELOGE(FAILED, "input is empty.");
     return FAILED;
   }
+  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kMaximumFirstOutput));
+  if (output_ptr == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Make shared failed");
+    return MEMALLOC_FAILED;
+  }
+
   DataType data_type = input[kMaximumFirstInput]->GetTensorDesc().GetDataType();
   BCast bcast;
   switch (data_type) {
@@ -122,35 +97,6 @@ Status MaximumKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Con
     return NOT_CHANGED;
   }
 
-  uint32_t length = 1;
-  if (!TypeUtils::GetDataTypeLength(data_type, length)) {
-    GELOGW("Can't GetDataTypeLength of data_type: %s", TypeUtils::DataTypeToSerialString(data_type).c_str());
-    return NOT_CHANGED;
-  }
-
-  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kMaximumFirstOutput));
-  if (output_ptr == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "Make shared failed");
-    return MEMALLOC_FAILED;
-  }
-
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast.GetOutputShape()));
-  // only return GRAPH_SUCCESS here
-  switch (data_type) {
-    SET_OUTPUT(DT_INT8, int8_t)
-    SET_OUTPUT(DT_INT16, int16_t)
-    SET_OUTPUT(DT_INT32, int32_t)
-    SET_OUTPUT(DT_INT64, int64_t)
-    SET_OUTPUT(DT_UINT8, uint8_t)
-    SET_OUTPUT(DT_UINT16, uint16_t)
-    SET_OUTPUT(DT_UINT32, uint32_t)
-    SET_OUTPUT(DT_UINT64, uint64_t)
-    SET_OUTPUT(DT_FLOAT16, fp16_t)
-    SET_OUTPUT(DT_FLOAT, float)
-    SET_OUTPUT(DT_DOUBLE, double)
-    default:
-      break;
-  }
   output_ptr->MutableTensorDesc().SetDataType(data_type);
   v_output.push_back(output_ptr);
   GELOGD("MaximumKernel success");
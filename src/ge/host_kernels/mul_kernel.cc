@@ -27,6 +27,7 @@
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/common/bcast.h"
 #include "graph/utils/type_utils.h"
+#include "host_kernels/kernel_utils.h"
 #include "inc/kernel_factory.h"
 
 namespace ge {
@@ -76,38 +77,29 @@ Status OverflowCheck(T const &x, T const &y, DataType &type) {
   return SUCCESS;
 }
 
-#define DEFINE_FUNC_WITH_STATUS_BY_TYPE(TYPE)                                         \
-  std::function<TYPE(TYPE const &, TYPE const &, DataType &, Status &)> func_##TYPE = \
-    [](TYPE const &a, TYPE const &b, DataType &type, Status &ret) -> TYPE {           \
-    ret = OverflowCheck(a, b, type);                                                  \
-    if (ret != SUCCESS) {                                                             \
-      GELOGE(PARAM_INVALID, "Result of mul is overflow.");                            \
-      return static_cast<TYPE>(0);                                                    \
-    }                                                                                 \
-    return static_cast<TYPE>(a) * static_cast<TYPE>(b);                               \
-  };
-
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                              \
-  case DTYPE:                                                            \
-    ret = bcast.BCastComputeCheck(input, y_data_##TYPE##_, func_##TYPE); \
-    break;
+template <typename T>
+class MulFunc {
+ public:
+  explicit MulFunc(DataType data_type) : data_type_(data_type) {}
+
+  Status operator()(T a, T b, T &out) const {
+    DataType data_type = data_type_;
+    if (OverflowCheck(a, b, data_type) != SUCCESS) {
+      GELOGE(PARAM_INVALID, "Result of mul is overflow.");
+      return PARAM_INVALID;
+    }
+    out = a * b;
+    return SUCCESS;
+  }
 
-#define SET_OUTPUT(DTYPE, TYPE)                                                                                        \
-  case DTYPE:                                                                                                          \
-    (void)output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE##_.data()), y_data_##TYPE##_.size() * length); \
+ private:
+  DataType data_type_;
+};
+
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                                                         \
+  case DTYPE:                                                                                       \
+    ret = bcast.BCastComputeCheckToTensor<TYPE, TYPE>(input, output_ptr, MulFunc<TYPE>(data_type)); \
     break;
-// [no need to check result]
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int8_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int32_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int64_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint8_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint32_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint64_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(fp16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(float)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(double)
 }  // namespace
 
 Status MulKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
@@ -122,6 +114,12 @@ Status MulKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGe
     return ret;
   }
 
+  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(0));
+  if (output_ptr == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Make shared failed");
+    return MEMALLOC_FAILED;
+  }
+
   DataType data_type = input[0]->GetTensorDesc().GetDataType();
   BCast bcast;
   switch (data_type) {
@@ -147,35 +145,6 @@ Status MulKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGe
     return NOT_CHANGED;
   }
 
-  uint32_t length = 1;
-  if (!TypeUtils::GetDataTypeLength(data_type, length)) {
-    GELOGW("Can't GetDataTypeLength of data_type: %s", TypeUtils::DataTypeToSerialString(data_type).c_str());
-    return NOT_CHANGED;
-  }
-
-  GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(0));
-  if (output_ptr == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "Make shared failed");
-    return MEMALLOC_FAILED;
-  }
-
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast.GetOutputShape()));
-  // only return GRAPH_SUCCESS here
-  switch (data_type) {
-    SET_OUTPUT(DT_INT8, int8_t)
-    SET_OUTPUT(DT_INT16, int16_t)
-    SET_OUTPUT(DT_INT32, int32_t)
-    SET_OUTPUT(DT_INT64, int64_t)
-    SET_OUTPUT(DT_UINT8, uint8_t)
-    SET_OUTPUT(DT_UINT16, uint16_t)
-    SET_OUTPUT(DT_UINT32, uint32_t)
-    SET_OUTPUT(DT_UINT64, uint64_t)
-    SET_OUTPUT(DT_FLOAT16, fp16_t)
-    SET_OUTPUT(DT_FLOAT, float)
-    SET_OUTPUT(DT_DOUBLE, double)
-    default:
-      break;
-  }
   output_ptr->MutableTensorDesc().SetDataType(data_type);
   v_output.push_back(output_ptr);
   GELOGD("MulKernel success");
@@ -126,7 +126,7 @@ Status PermuteKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Con
 
   GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(0));
   GE_CHECK_NOTNULL(output_ptr);
-  GE_CHK_STATUS_RET(output_ptr->SetData(trans_result.data.get(), trans_result.length));
+  GE_CHK_STATUS_RET(KernelUtils::SetOutputData(trans_result.data, trans_result.length, output_ptr));
   v_output.push_back(output_ptr);
   return SUCCESS;
 }
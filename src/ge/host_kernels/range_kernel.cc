@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <set>
+#include <type_traits>
 
 #include "common/debug/log.h"
 #include "common/fp16_t.h"
@@ -26,6 +27,7 @@
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/utils/type_utils.h"
+#include "host_kernels/kernel_utils.h"
 #include "inc/kernel_factory.h"
 
 namespace ge {
@@ -33,6 +35,36 @@ namespace {
 constexpr size_t kRangeInputNum = 3;
 constexpr uint32_t kRangeDimNum = 0;
 const std::set<DataType> kRangeSupportedType = {DT_INT32, DT_FLOAT};
+const int64_t kMinParallelRangeNum = 1024 * 1024;
+
+///
+/// Integers are computed as start + i * delta, which is independent between elements so that it is vectorized and
+/// split among threads. The result is the same as accumulating delta since the size keeps it in the range of T.
+///
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, Status>::type FillRange(const T start, const T delta, int64_t size,
+                                                                             T *buf) {
+  return KernelUtils::ParallelFor(size, kMinParallelRangeNum, [start, delta, buf](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      buf[i] = static_cast<T>(static_cast<int64_t>(start) + i * static_cast<int64_t>(delta));
+    }
+    return SUCCESS;
+  });
+}
+
+///
+/// Floats keep accumulating delta, as the rounding errors of start + i * delta are different.
+///
+template <typename T>
+typename std::enable_if<!std::is_integral<T>::value, Status>::type FillRange(const T start, const T delta,
+                                                                              int64_t size, T *buf) {
+  T val = start;
+  for (int64_t i = 0; i < size; ++i) {
+    buf[i] = val;
+    val += delta;
+  }
+  return SUCCESS;
+}
 }  // namespace
 
 Status RangeKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
@@ -144,18 +176,18 @@ Status RangeKernel::GetRange(const T start, const T limit, const T delta, GeTens
   output->MutableTensorDesc().SetShape(GeShape());  // when size is 0
 
   if (size > 0) {
-    unique_ptr<T[]> buf(new (std::nothrow) T[size]);
-    if (buf == nullptr) {
+    size_t data_size = static_cast<size_t>(size) * sizeof(T);
+    std::shared_ptr<AlignedPtr> aligned_ptr = AlignedPtr::Allocate(data_size);
+    if (aligned_ptr == nullptr) {
       GELOGE(MEMALLOC_FAILED, "New buf failed.");
       return MEMALLOC_FAILED;
     }
 
-    T val = start;
-    for (int64_t i = 0; i < size; ++i) {
-      buf[i] = val;
-      val += delta;
+    if (FillRange(start, delta, size, reinterpret_cast<T *>(aligned_ptr->Get())) != SUCCESS) {
+      GELOGE(INTERNAL_ERROR, "Fill range failed, size %ld.", size);
+      return INTERNAL_ERROR;
     }
-    if (output->SetData(reinterpret_cast<uint8_t *>(buf.get()), size * sizeof(T)) != GRAPH_SUCCESS) {
+    if (output->SetData(aligned_ptr, 0, data_size) != GRAPH_SUCCESS) {
       GELOGW("GetRange: SetData failed");
     }
     output->MutableTensorDesc().SetShape(GeShape({size}));
@@ -16,6 +16,7 @@
 
 #include "host_kernels/reduce_prod_kernel.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 
@@ -36,6 +37,48 @@ const size_t kReduceProdMaxAxisRank = 1;
 const size_t kReduceProdInputOnlyData = 1;
 const size_t kReduceProdInputSize = 2;
 const std::set<DataType> kReduceProdSupportedType = {DT_INT32};
+const int64_t kReduceProdBlockNum = 256;            // elements of a row accumulated together
+const int64_t kMinParallelReduceNum = 1024 * 1024;  // input elements reduced by a thread at least
+
+inline bool IsInt32Overflow(int64_t value) { return (value > INT32_MAX) || (value < INT32_MIN); }
+
+///
+/// Reduce the input of [head_dim, axis_dim, end_dim] in the range [begin, end) of output indexes.
+/// The product is accumulated in int64 for a block of contiguous elements along end_dim, which is vectorized,
+/// and the block is checked against the range of int32 after each multiplication. Since both multipliers are
+/// in the range of int32, the check is the same as checking every multiplication of int32.
+///
+Status ReduceProdInt32(const int32_t *input_data, int64_t axis_dim, int64_t end_dim, int64_t begin, int64_t end,
+                       int32_t *output_data) {
+  int64_t acc[kReduceProdBlockNum];
+  int64_t index = begin;
+  while (index < end) {
+    int64_t i = index / end_dim;
+    int64_t j = index % end_dim;
+    int64_t block_num = std::min(std::min(kReduceProdBlockNum, end_dim - j), end - index);
+    const int32_t *src = input_data + i * end_dim * axis_dim + j;
+    for (int64_t n = 0; n < block_num; ++n) {
+      acc[n] = src[n];
+    }
+    for (int64_t k = 1; k < axis_dim; ++k) {
+      src += end_dim;
+      bool overflow = false;
+      for (int64_t n = 0; n < block_num; ++n) {
+        acc[n] *= src[n];
+        overflow |= IsInt32Overflow(acc[n]);
+      }
+      if (overflow) {
+        GELOGW("Product is overflow, axis index: %ld, output index: [%ld, %ld).", k, index, index + block_num);
+        return INTERNAL_ERROR;
+      }
+    }
+    for (int64_t n = 0; n < block_num; ++n) {
+      output_data[index + n] = static_cast<int32_t>(acc[n]);
+    }
+    index += block_num;
+  }
+  return SUCCESS;
+}
 }  // namespace
 
 Status ReduceProdKernel::ReduceProdCheck(const ge::OpDescPtr &op_desc_ptr,
@@ -120,28 +163,26 @@ Status ReduceProdKernel::DataCal(const std::vector<ge::ConstGeTensorPtr> &input,
     int32_t *input_data = const_cast<int32_t *>(reinterpret_cast<const int32_t *>(data_tensor->GetData().GetData()));
     GE_CHECK_NOTNULL(input_data);
     size_t data_num = data_tensor->GetData().size() / sizeof(int32_t);
-    unique_ptr<int32_t[]> buf(new (std::nothrow) int32_t[data_num]());
+    int64_t output_num = head_dim_ * end_dim_;
+    if (axis_dim_ <= 0 || static_cast<size_t>(output_num) * static_cast<size_t>(axis_dim_) > data_num) {
+      GELOGW("Data num %zu does not match the shape to reduce.", data_num);
+      return INTERNAL_ERROR;
+    }
+    unique_ptr<int32_t[]> buf(new (std::nothrow) int32_t[output_num]());
     if (buf == nullptr) {
       GELOGW("new buf failed");
       return INTERNAL_ERROR;
     }
 
-    int32_t tmp_x = 1;
-    int32_t tmp_y = 1;
-    for (int64_t i = 0; i < head_dim_; ++i) {
-      for (int64_t j = 0; j < end_dim_; ++j) {
-        // all index for input_data is less than size of input_data
-        tmp_x = input_data[static_cast<size_t>(i * end_dim_ * axis_dim_ + j)];
-        for (int64_t k = 1; k < axis_dim_; ++k) {
-          tmp_y = input_data[static_cast<size_t>(i * end_dim_ * axis_dim_ + j + k * end_dim_)];
-          if (ge::CheckInt32MulOverflow(tmp_x, tmp_y) != SUCCESS) {
-            GELOGW("Product is overflow. multiplier 1: %d. multiplier 2: %d.", tmp_x, tmp_y);
-            return INTERNAL_ERROR;
-          }
-          tmp_x *= tmp_y;
-        }
-        buf[static_cast<size_t>(i * end_dim_ + j)] = tmp_x;
-      }
+    int64_t min_block_num = std::max(kMinParallelReduceNum / axis_dim_, static_cast<int64_t>(1));
+    int32_t *output_data = buf.get();
+    int64_t axis_dim = axis_dim_;
+    int64_t end_dim = end_dim_;
+    Status ret = KernelUtils::ParallelFor(output_num, min_block_num, [&](int64_t begin, int64_t end) {
+      return ReduceProdInt32(input_data, axis_dim, end_dim, begin, end, output_data);
+    });
+    if (ret != SUCCESS) {
+      return ret;
     }
 
     GE_IF_BOOL_EXEC(output_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()),
@@ -204,24 +245,16 @@ Status ReduceProdKernel::ComputeNoAxis(const ge::OpDescPtr &op_desc_ptr, const s
     int32_t *input_data = const_cast<int32_t *>(reinterpret_cast<const int32_t *>(data_tensor->GetData().GetData()));
     GE_CHECK_NOTNULL(input_data);
     size_t data_num = data_tensor->GetData().size() / sizeof(int32_t);
-    unique_ptr<int32_t[]> buf(new (std::nothrow) int32_t[data_num]());
-    if (buf == nullptr) {
-      GELOGW("new buf failed");
-      return INTERNAL_ERROR;
-    }
-
-    int32_t tmp_x = input_data[0];
-    int32_t tmp_y = 1;
+    int64_t product = input_data[0];
     for (size_t k = 1; k < data_num; ++k) {
-      tmp_y = input_data[k];
-      if (ge::CheckInt32MulOverflow(tmp_x, tmp_y) != SUCCESS) {
-        GELOGW("Product is overflow. multiplier 1: %d. multiplier 2: %d.", tmp_x, tmp_y);
+      product *= input_data[k];
+      if (IsInt32Overflow(product)) {
+        GELOGW("Product is overflow, index: %zu.", k);
         return INTERNAL_ERROR;
       }
-      tmp_x *= tmp_y;
     }
-    buf[0] = tmp_x;
-    GE_IF_BOOL_EXEC(output_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()), sizeof(int32_t)) != GRAPH_SUCCESS,
+    int32_t buf[] = {static_cast<int32_t>(product)};
+    GE_IF_BOOL_EXEC(output_ptr->SetData(reinterpret_cast<uint8_t *>(buf), sizeof(int32_t)) != GRAPH_SUCCESS,
                     GELOGW("set data failed");
                     return INTERNAL_ERROR);
     output_ptr->MutableTensorDesc().SetDataType(data_type);
@@ -257,7 +290,7 @@ Status ReduceProdKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vec
     // axis tensor value is [], means no process for input
     output_ptr->MutableTensorDesc().SetShape(input.at(kReduceProdDataIndex)->GetTensorDesc().GetShape());
     output_ptr->MutableTensorDesc().SetDataType(input.at(kReduceProdDataIndex)->GetTensorDesc().GetDataType());
-    if (output_ptr->SetData(input.at(kReduceProdDataIndex)->GetData()) != GRAPH_SUCCESS) {
+    if (output_ptr->ShareData(input.at(kReduceProdDataIndex)->GetData()) != GRAPH_SUCCESS) {
       GELOGW("Compute: SetData failed");
     }
   } else {
@@ -76,7 +76,7 @@ Status ReshapeKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vector
   size_t data_dim_size = output_ptr->GetTensorDesc().GetShape().GetDims().size();
   GELOGI("Reshape op %s output tensor dim size is %zu", op_desc_ptr->GetName().c_str(), data_dim_size);
 
-  if (output_ptr->SetData(input.at(kReshapeDataIndex)->GetData()) != GRAPH_SUCCESS) {
+  if (output_ptr->ShareData(input.at(kReshapeDataIndex)->GetData()) != GRAPH_SUCCESS) {
     GELOGW("Compute: SetData failed");
   }
   v_output.emplace_back(output_ptr);
@@ -142,15 +142,14 @@ Status SliceDKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<Cons
   }
 
   void *data = reinterpret_cast<void *>(const_cast<uint8_t *>(x_tensor->GetData().data()));
-  int64_t x_data_size = x_tensor->GetTensorDesc().GetShape().GetShapeSize();
 
   Status ret = CheckOutputDims(size_list, op_desc_ptr);
   if (ret != SUCCESS) {
     return ret;
   }
 
-  ret = OpUtils::SetOutputSliceData(data, x_data_size, x_data_type, x_dims, begin_list, size_list, output_ptr.get(),
-                                    stride_list);
+  ret = KernelUtils::SetOutputSliceData(reinterpret_cast<const uint8_t *>(data), x_tensor->GetData().size(),
+                                        x_data_type, x_dims, begin_list, size_list, stride_list, output_ptr);
   if (ret != SUCCESS) {
     GELOGW("Set output data of SliceD failed.");
     return NOT_CHANGED;
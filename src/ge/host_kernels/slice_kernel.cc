@@ -69,7 +69,6 @@ Status SliceKernel::Compute(const OpDescPtr attr, const std::vector<ConstGeTenso
   GE_CHECK_NOTNULL(begin_data);
   GE_CHECK_NOTNULL(size_data);
 
-  size_t data_size = x_->GetData().size() / sizeof(int32_t);
   size_t begin_size = begin->GetData().size() / sizeof(int32_t);
   size_t size_size = size->GetData().size() / sizeof(int32_t);
   const ge::GeShape &x_shape = x_->GetTensorDesc().GetShape();
@@ -112,8 +111,8 @@ Status SliceKernel::Compute(const OpDescPtr attr, const std::vector<ConstGeTenso
     return ret;
   }
 
-  ret = OpUtils::SetOutputSliceData(data, static_cast<int64_t>(data_size), data_type, input_dims, begin_vec,
-                                    output_dims, output_ptr.get(), stride_vec);
+  ret = KernelUtils::SetOutputSliceData(reinterpret_cast<const uint8_t *>(data), x_->GetData().size(), data_type,
+                                        input_dims, begin_vec, output_dims, stride_vec, output_ptr);
   if (ret != SUCCESS) {
     GELOGW("SetOutputSliceData failed.");
     return NOT_CHANGED;
@@ -70,7 +70,7 @@ Status SqueezeKernel::Compute(const ge::OpDescPtr op_desc, const std::vector<ge:
     GELOGE(PARAM_INVALID, "node [%s] get input failed.", op_desc->GetName().c_str());
     return PARAM_INVALID;
   }
-  if (output_ptr->SetData(ge_tensor->GetData()) != GRAPH_SUCCESS) {
+  if (output_ptr->ShareData(ge_tensor->GetData()) != GRAPH_SUCCESS) {
     GELOGW("Compute: SetData failed");
   }
   v_output.emplace_back(output_ptr);
@@ -196,7 +196,6 @@ Status StridedSliceKernel::Compute(const ge::OpDescPtr attr, const std::vector<g
 
   const GeShape x_shape = weight0->GetTensorDesc().GetShape();
   size_t dim_size = x_shape.GetDimNum();
-  size_t data_size = weight0->GetData().size() / sizeof(int32_t);
 
   const int32_t *begin = reinterpret_cast<const int32_t *>(weight1->GetData().data());
   const int32_t *end = reinterpret_cast<const int32_t *>(weight2->GetData().data());
@@ -260,8 +259,9 @@ Status StridedSliceKernel::Compute(const ge::OpDescPtr attr, const std::vector<g
     return ret;
   }
 
-  ret = OpUtils::SetOutputSliceData(data, static_cast<int64_t>(data_size), args.data_type, input_dims, begin_vec,
-                                    output_dims, output_ptr.get(), stride_vec);
+  ret = KernelUtils::SetOutputSliceData(reinterpret_cast<const uint8_t *>(data), weight0->GetData().size(),
+                                        static_cast<DataType>(args.data_type), input_dims, begin_vec, output_dims,
+                                        stride_vec, output_ptr);
   if (ret != SUCCESS) {
     GELOGW("SetOutputSliceData failed.");
     return NOT_CHANGED;
@@ -25,6 +25,7 @@
 #include "common/op/ge_op_utils.h"
 #include "graph/common/bcast.h"
 #include "graph/utils/type_utils.h"
+#include "host_kernels/kernel_utils.h"
 #include "inc/kernel_factory.h"
 
 namespace ge {
@@ -78,38 +79,29 @@ Status OverflowCheck(T const &x, T const &y, DataType &data_type) {
   return SUCCESS;
 }
 
-#define DEFINE_FUNC_WITH_STATUS_BY_TYPE(TYPE)                                         \
-  std::function<TYPE(TYPE const &, TYPE const &, DataType &, Status &)> func_##TYPE = \
-    [](TYPE const &x, TYPE const &y, DataType &type, Status &ret) -> TYPE {           \
-    ret = OverflowCheck<TYPE>(x, y, type);                                            \
-    if (ret != SUCCESS) {                                                             \
-      GELOGE(PARAM_INVALID, "Result of sub is overflow.");                            \
-      return static_cast<TYPE>(0);                                                    \
-    }                                                                                 \
-    return static_cast<TYPE>(x) - static_cast<TYPE>(y);                               \
-  };
-
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                              \
-  case DTYPE:                                                            \
-    ret = bcast.BCastComputeCheck(input, y_data_##TYPE##_, func_##TYPE); \
-    break;
+template <typename T>
+class SubFunc {
+ public:
+  explicit SubFunc(DataType data_type) : data_type_(data_type) {}
+
+  Status operator()(T x, T y, T &out) const {
+    DataType data_type = data_type_;
+    if (OverflowCheck<T>(x, y, data_type) != SUCCESS) {
+      GELOGE(PARAM_INVALID, "Result of sub is overflow.");
+      return PARAM_INVALID;
+    }
+    out = x - y;
+    return SUCCESS;
+  }
 
-#define SET_OUTPUT(DTYPE, TYPE)                                                                                        \
-  case DTYPE:                                                                                                          \
-    (void)output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE##_.data()), y_data_##TYPE##_.size() * length); \
-    break;
+ private:
+  DataType data_type_;
+};
 
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int8_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int32_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int64_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint8_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint32_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint64_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(fp16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(float)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(double)
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                                                         \
+  case DTYPE:                                                                                       \
+    ret = bcast.BCastComputeCheckToTensor<TYPE, TYPE>(input, output_ptr, SubFunc<TYPE>(data_type)); \
+    break;
 }  // namespace
 
 Status SubKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge::ConstGeTensorPtr> &input,
@@ -126,6 +118,13 @@ Status SubKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge:
   ConstGeTensorPtr weight0 = input[kSubFirstInput];
   ConstGeTensorPtr weight1 = input[kSubSecondInput];
 
+  auto output_tensor_desc = op_desc_ptr->GetOutputDesc(kSubFirstOutput);
+  GeTensorPtr output_ptr = MakeShared<GeTensor>(output_tensor_desc);
+  if (output_ptr == nullptr) {
+    GELOGW("make_shared ge::GeTensor failed, node name %s.", op_desc_ptr->GetName().c_str());
+    return NOT_CHANGED;
+  }
+
   Status ret;
   DataType data_type = input[kSubFirstInput]->GetTensorDesc().GetDataType();
   BCast bcast;
@@ -153,36 +152,6 @@ Status SubKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge:
     return NOT_CHANGED;
   }
 
-  uint32_t length = 1;
-  if (!TypeUtils::GetDataTypeLength(data_type, length)) {
-    GELOGW("Can't GetDataTypeLength of data_type: %s", TypeUtils::DataTypeToSerialString(data_type).c_str());
-    return NOT_CHANGED;
-  }
-
-  auto output_tensor_desc = op_desc_ptr->GetOutputDesc(kSubFirstOutput);
-  GeTensorPtr output_ptr = MakeShared<GeTensor>(output_tensor_desc);
-  if (output_ptr == nullptr) {
-    GELOGW("make_shared ge::GeTensor failed, node name %s.", op_desc_ptr->GetName().c_str());
-    return NOT_CHANGED;
-  }
-
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast.GetOutputShape()));
-  // only return GRAPH_SUCCESS here
-  switch (data_type) {
-    SET_OUTPUT(DT_INT8, int8_t)
-    SET_OUTPUT(DT_INT16, int16_t)
-    SET_OUTPUT(DT_INT32, int32_t)
-    SET_OUTPUT(DT_INT64, int64_t)
-    SET_OUTPUT(DT_UINT8, uint8_t)
-    SET_OUTPUT(DT_UINT16, uint16_t)
-    SET_OUTPUT(DT_UINT32, uint32_t)
-    SET_OUTPUT(DT_UINT64, uint64_t)
-    SET_OUTPUT(DT_FLOAT16, fp16_t)
-    SET_OUTPUT(DT_FLOAT, float)
-    SET_OUTPUT(DT_DOUBLE, double)
-    default:
-      break;
-  }
   output_ptr->MutableTensorDesc().SetDataType(data_type);
   v_output.push_back(output_ptr);
 
@@ -125,7 +125,7 @@ Status TransdataKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<C
     GELOGE(ge::PARAM_INVALID, "Make shared failed");
     return ge::PARAM_INVALID;
   }
-  if (output_ptr->SetData(trans_result.data.get(), trans_result.length) != GRAPH_SUCCESS) {
+  if (KernelUtils::SetOutputData(trans_result.data, trans_result.length, output_ptr) != GRAPH_SUCCESS) {
     GELOGW("Compute: SetData failed");
   }
   v_output.push_back(output_ptr);
@@ -148,7 +148,7 @@ Status TransposeKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<C
 
   GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kTransposeOutputY));
   GE_CHECK_NOTNULL(output_ptr);
-  if (output_ptr->SetData(trans_result.data.get(), trans_result.length) != GRAPH_SUCCESS) {
+  if (KernelUtils::SetOutputData(trans_result.data, trans_result.length, output_ptr) != GRAPH_SUCCESS) {
     GELOGW("Compute: SetData failed");
   }
   v_output.push_back(output_ptr);
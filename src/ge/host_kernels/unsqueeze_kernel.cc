@@ -59,7 +59,7 @@ Status UnsqueezeKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vect
   auto input_tensor = input.at(kInputDescIndex);
   GE_CHECK_NOTNULL(input_tensor);
 
-  if (output_ptr->SetData(input_tensor->GetData()) != GRAPH_SUCCESS) {
+  if (output_ptr->ShareData(input_tensor->GetData()) != GRAPH_SUCCESS) {
     GELOGW("Compute: SetData failed");
   }
   v_output.emplace_back(output_ptr);
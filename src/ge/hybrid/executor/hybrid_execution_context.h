@@ -46,32 +46,28 @@ struct GraphExecutionContext {
   long iteration = 0;
 };
 
-#define RECORD_PROFILING_EVENT(context, evt_type, fmt, category, node_name, ...)                          \
-  do {                                                                                                    \
-    if ((context)->profiler != nullptr) {                                                                 \
-      if (node_name != nullptr) {                                                                         \
-        context->profiler->RecordEvent(evt_type, "tid:%lu [%s] [%s] " fmt, GetTid(), node_name, category, \
-                                       ##__VA_ARGS__);                                                    \
-      } else {                                                                                            \
-        context->profiler->RecordEvent(evt_type, "tid:%lu [%s] " fmt, GetTid(), category, ##__VA_ARGS__); \
-      }                                                                                                   \
-    }                                                                                                     \
+// the node name and the arguments are only read while profiling is enabled
+#define RECORD_PROFILING_EVENT(context, evt_type, fmt, node_name, ...)           \
+  do {                                                                           \
+    if ((context)->profiler != nullptr) {                                        \
+      (context)->profiler->RecordEvent(evt_type, node_name, fmt, ##__VA_ARGS__); \
+    }                                                                            \
   } while (0)
 
 #define RECORD_MODEL_EXECUTION_EVENT(context, fmt, ...) \
-  RECORD_PROFILING_EVENT((context), HybridProfiler::GENERAL, fmt, "ModelExecutor", nullptr, ##__VA_ARGS__)
+  RECORD_PROFILING_EVENT((context), HybridProfiler::GENERAL, fmt, nullptr, ##__VA_ARGS__)
 
 #define RECORD_SHAPE_INFERENCE_EVENT(context, name, fmt, ...) \
-  RECORD_PROFILING_EVENT((context), HybridProfiler::SHAPE_INFERENCE, fmt, "ShapeInference", name, ##__VA_ARGS__)
+  RECORD_PROFILING_EVENT((context), HybridProfiler::SHAPE_INFERENCE, fmt, name, ##__VA_ARGS__)
 
 #define RECORD_COMPILE_EVENT(context, name, fmt, ...) \
-  RECORD_PROFILING_EVENT((context), HybridProfiler::COMPILE, fmt, "Compilation", name, ##__VA_ARGS__)
+  RECORD_PROFILING_EVENT((context), HybridProfiler::COMPILE, fmt, name, ##__VA_ARGS__)
 
 #define RECORD_EXECUTION_EVENT(context, name, fmt, ...) \
-  RECORD_PROFILING_EVENT((context), HybridProfiler::EXECUTION, fmt, "Execution", name, ##__VA_ARGS__)
+  RECORD_PROFILING_EVENT((context), HybridProfiler::EXECUTION, fmt, name, ##__VA_ARGS__)
 
 #define RECORD_CALLBACK_EVENT(context, name, fmt, ...) \
-  RECORD_PROFILING_EVENT((context), HybridProfiler::CALLBACK, fmt, "Callback", name, ##__VA_ARGS__)
+  RECORD_PROFILING_EVENT((context), HybridProfiler::CALLBACK, fmt, name, ##__VA_ARGS__)
 }  // namespace hybrid
 }  // namespace ge
 #endif  // GE_HYBRID_EXECUTOR_HYBRID_EXECUTION_CONTEXT_H_
@@ -15,11 +15,20 @@
  */
 
 #include "hybrid_model_executor.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include "graph/ge_context.h"
 #include "graph/runtime_inference_context.h"
 
 namespace ge {
 namespace hybrid {
+namespace {
+const char *const kEnvProfilingLevel = "HYBRID_PROFILING_LEVEL";
+const char *const kEnvProfilingTracePath = "HYBRID_PROFILING_TRACE_PATH";
+const int kDecimal = 10;
+}  // namespace
+
 HybridModelExecutor::HybridModelExecutor(HybridModel *model, uint32_t device_id, rtStream_t stream)
     : model_(model), device_id_(device_id), stream_(stream) {}
 
@@ -43,6 +52,7 @@ Status HybridModelExecutor::Execute(HybridModelExecutor::ExecuteArgs &args) {
   GELOGD("Model executed successfully.");
 
   if (context_.profiler != nullptr) {
+    DumpProfilingEvents();
     context_.profiler->Reset();
   }
 
@@ -90,9 +100,49 @@ Status HybridModelExecutor::InitExecutionContext() {
   if (IsLogEnable(GE_MODULE_NAME, DLOG_DEBUG)) {
     context_.trace_enabled = true;
   }
+
+  const char *profiling_level = std::getenv(kEnvProfilingLevel);
+  if (profiling_level != nullptr) {
+    context_.profiling_level = std::strtol(profiling_level, nullptr, kDecimal);
+  }
+  if (context_.profiling_level > 0) {
+    context_.profiler.reset(new (std::nothrow) HybridProfiler());
+    GE_CHECK_NOTNULL(context_.profiler);
+    GELOGI("Hybrid profiling is enabled, level = %ld", context_.profiling_level);
+    if (std::getenv(kEnvProfilingTracePath) == nullptr) {
+      GELOGW("%s is not set, the profiling events are written to debug log only.", kEnvProfilingTracePath);
+    }
+  }
   return SUCCESS;
 }
 
+void HybridModelExecutor::DumpProfilingEvents() {
+  const char *trace_path = std::getenv(kEnvProfilingTracePath);
+  if (trace_path == nullptr) {
+    // without a trace path, the events are only logged when debug log is enabled
+    if (IsLogEnable(GE_MODULE_NAME, DLOG_DEBUG)) {
+      std::stringstream ss;
+      context_.profiler->Dump(ss);
+      std::string line;
+      while (std::getline(ss, line)) {
+        GELOGD("%s", line.c_str());
+      }
+    }
+    return;
+  }
+
+  string file_name = string(trace_path) + "/hybrid_trace_" + std::to_string(context_.session_id) + "_" +
+                     std::to_string(context_.iteration) + ".json";
+  std::ofstream ofs(file_name, std::ios::out | std::ios::trunc);
+  if (!ofs.is_open()) {
+    GELOGW("Failed to open trace file %s.", file_name.c_str());
+    return;
+  }
+  context_.profiler->DumpChromeTrace(ofs);
+  GELOGD("Trace of iteration %ld is written to %s, %lu events overwritten.", context_.iteration, file_name.c_str(),
+         context_.profiler->GetOverwrittenNum());
+}
+
 Status HybridModelExecutor::ResetExecutionContext(GraphExecutionContext &context) {
   GE_CHK_STATUS_RET_NOLOG(context.callback_manager->Init());
   string ctx_id = std::to_string(context.session_id);
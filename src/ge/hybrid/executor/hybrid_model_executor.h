@@ -47,6 +47,7 @@ class HybridModelExecutor {
   Status ExecuteGraphInternal(SubgraphExecutor &executor, ExecuteArgs &args);
   Status Cleanup();
   Status InitExecutionContext();
+  void DumpProfilingEvents();
   static Status ResetExecutionContext(GraphExecutionContext &context);
 
   HybridModel *model_;
@@ -15,69 +15,314 @@
  */
 
 #include "hybrid_profiler.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
-#include <cstdarg>
+#include <map>
+#include <tuple>
 #include "framework/common/debug/ge_log.h"
 #include "securec.h"
 
 namespace ge {
 namespace hybrid {
 namespace {
-const int kMaxEvents = 10000;
-const int kEventDescMax = 256;
+const size_t kMaxEventsPerThread = 8192;  // must be power of 2
 const int kMaxEventTypes = 8;
 const int kIndent = 8;
+const double kNsPerUs = 1000.0;
+const char *const kStartSuffix = "Start";
+const char *const kEndSuffix = "End";
+const char *const kEventTypeNames[] = {"ModelExecutor", "ShapeInference", "Compilation", "Execution", "Callback"};
+const char *const kPhaseNames[] = {"Start", "End", ""};
+
+std::atomic<uint64_t> g_profiler_id(0);
+
+// a thread may record to several profilers alternately, e.g. the executors of several models run in the thread
+const size_t kThreadBufferCacheSize = 4;
+
+struct ThreadBufferCache {
+  ThreadBufferCache() {
+    for (auto &profiler_id : profiler_ids) {
+      profiler_id = UINT64_MAX;
+    }
+  }
+  uint64_t profiler_ids[kThreadBufferCacheSize];
+  void *buffers[kThreadBufferCacheSize] = {};
+  size_t next_slot = 0;  // the slot replaced by the next miss
+};
+
+const char *GetEventTypeName(uint8_t event_type) {
+  return event_type < sizeof(kEventTypeNames) / sizeof(kEventTypeNames[0]) ? kEventTypeNames[event_type] : "Unknown";
+}
+
+bool EndsWith(const std::string &str, const char *suffix) {
+  size_t len = strlen(suffix);
+  return (str.size() >= len) && (str.compare(str.size() - len, len, suffix) == 0);
+}
+
+void WriteJsonString(std::ostream &os, const std::string &str) {
+  os << '"';
+  for (char c : str) {
+    if ((c == '"') || (c == '\\')) {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << ' ';
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
 }  // namespace
 
-HybridProfiler::HybridProfiler() : counter_(0) { Reset(); }
+HybridProfiler::HybridProfiler() : profiler_id_(g_profiler_id++) {}
+
+HybridProfiler::~HybridProfiler() = default;
+
+HybridProfiler::ThreadBuffer &HybridProfiler::GetThreadBuffer() {
+  thread_local ThreadBufferCache cache;
+  for (size_t i = 0; i < kThreadBufferCacheSize; ++i) {
+    if (cache.profiler_ids[i] == profiler_id_) {
+      return *static_cast<ThreadBuffer *>(cache.buffers[i]);
+    }
+  }
+
+  auto tid = static_cast<uint32_t>(GetTid());
+  std::lock_guard<std::mutex> lk(mu_);
+  ThreadBuffer *buffer = nullptr;
+  for (auto &thread_buffer : buffers_) {
+    if (thread_buffer->tid == tid) {
+      buffer = thread_buffer.get();
+      break;
+    }
+  }
+  if (buffer == nullptr) {
+    buffers_.emplace_back(new ThreadBuffer());
+    buffer = buffers_.back().get();
+    buffer->tid = tid;
+    buffer->events.resize(kMaxEventsPerThread);
+  }
+  cache.profiler_ids[cache.next_slot] = profiler_id_;
+  cache.buffers[cache.next_slot] = buffer;
+  cache.next_slot = (cache.next_slot + 1) % kThreadBufferCacheSize;
+  return *buffer;
+}
 
-void HybridProfiler::RecordEvent(EventType event_type, const char *fmt, ...) {
-  va_list args;
-  va_start(args, fmt);
+uint32_t HybridProfiler::Intern(const std::string &name, const std::string **interned) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto it = name_ids_.find(name);
+  uint32_t id = 0;
+  if (it != name_ids_.end()) {
+    id = it->second;
+  } else {
+    id = static_cast<uint32_t>(names_.size());
+    names_.emplace_back(name);
+    name_ids_.emplace(name, id);
+  }
+  if (interned != nullptr) {
+    *interned = &names_[id];
+  }
+  return id;
+}
 
-  char buf[kEventDescMax];
-  if (vsnprintf_s(buf, kEventDescMax, kEventDescMax - 1, fmt, args) == -1) {
-    GELOGE(FAILED, "Format %s failed.", fmt);
+const std::string &HybridProfiler::GetName(uint32_t id) const {
+  static const std::string kEmpty;
+  return id < names_.size() ? names_[id] : kEmpty;
+}
+
+uint32_t HybridProfiler::GetNodeId(ThreadBuffer &buffer, const char *node_name) {
+  if (node_name == nullptr) {
+    return kInvalidId;
+  }
+  // names are cached by address, which is checked against the interned name since the address may be reused
+  auto it = buffer.node_ids.find(node_name);
+  if ((it != buffer.node_ids.end()) && (*it->second.second == node_name)) {
+    return it->second.first;
+  }
+  const std::string *interned = nullptr;
+  auto id = Intern(node_name, &interned);
+  buffer.node_ids[node_name] = std::make_pair(id, interned);
+  return id;
+}
+
+const HybridProfiler::FormatInfo &HybridProfiler::GetFormatInfo(ThreadBuffer &buffer, EventType event_type,
+                                                                const char *fmt) {
+  auto it = buffer.formats.find(fmt);
+  if (it != buffer.formats.end()) {
+    return it->second;
+  }
+
+  // "[PrepareTask] Start" is span PrepareTask, and "Start" is a span named after the event type
+  std::string format = fmt;
+  std::string span_name = GetEventTypeName(event_type);
+  if (!format.empty() && (format[0] == '[')) {
+    auto pos = format.find(']');
+    if (pos != std::string::npos) {
+      span_name = format.substr(1, pos - 1);
+    }
+  }
+  FormatInfo info;
+  info.span_id = Intern(span_name);
+  info.phase = EndsWith(format, kStartSuffix) ? BEGIN : (EndsWith(format, kEndSuffix) ? END : INSTANT);
+  info.has_args = format.find('%') != std::string::npos;
+  return buffer.formats.emplace(fmt, info).first->second;
+}
+
+void HybridProfiler::RecordEvent(EventType event_type, const char *node_name, const char *fmt, ...) {
+  auto timestamp = NowNs();
+  auto &buffer = GetThreadBuffer();
+  auto &info = GetFormatInfo(buffer, event_type, fmt);
+  auto &evt = buffer.events[buffer.count & (kMaxEventsPerThread - 1)];
+  evt.timestamp = timestamp;
+  evt.node_id = GetNodeId(buffer, node_name);
+  evt.span_id = info.span_id;
+  evt.tid = buffer.tid;
+  evt.event_type = static_cast<uint8_t>(event_type);
+  evt.phase = static_cast<uint8_t>(info.phase);
+  evt.detail[0] = '\0';
+  if (info.has_args) {
+    va_list args;
+    va_start(args, fmt);
+    // truncated if too long
+    (void)vsnprintf_s(evt.detail, sizeof(evt.detail), sizeof(evt.detail) - 1, fmt, args);
     va_end(args);
-    return;
   }
+  ++buffer.count;
+}
+
+std::vector<HybridProfiler::Event> HybridProfiler::CollectEvents() {
+  std::vector<Event> events;
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto &buffer : buffers_) {
+    // the oldest events are overwritten if the ring buffer is full
+    uint64_t start = buffer->count > kMaxEventsPerThread ? buffer->count - kMaxEventsPerThread : 0;
+    for (uint64_t i = start; i < buffer->count; ++i) {
+      events.emplace_back(buffer->events[i & (kMaxEventsPerThread - 1)]);
+    }
+  }
+  return events;
+}
 
-  va_end(args);
-  std::string event = buf;
-  auto index = counter_++;
-  auto &evt = events_[index];
-  evt.timestamp = std::chrono::system_clock::now();
-  evt.desc = std::move(event);
-  evt.event_type = event_type;
+uint64_t HybridProfiler::GetOverwrittenNum() const {
+  uint64_t overwritten_num = 0;
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto &buffer : buffers_) {
+    overwritten_num += buffer->count > kMaxEventsPerThread ? buffer->count - kMaxEventsPerThread : 0;
+  }
+  return overwritten_num;
 }
 
 void HybridProfiler::Dump(std::ostream &output_stream) {
-  if (events_.empty()) {
+  auto events = CollectEvents();
+  if (events.empty()) {
     return;
   }
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event &lhs, const Event &rhs) { return lhs.timestamp < rhs.timestamp; });
 
-  auto first_evt = events_[0];
-  auto start = first_evt.timestamp;
-  std::vector<decltype(start)> prev_timestamps;
-  prev_timestamps.resize(kMaxEventTypes, start);
-
-  for (int i = 0; i < counter_; ++i) {
-    auto &evt = events_[i];
-    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(evt.timestamp - start).count();
-    auto &prev_ts = prev_timestamps[evt.event_type];
-    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(evt.timestamp - prev_ts).count();
+  auto start = events[0].timestamp;
+  std::vector<int64_t> prev_timestamps(kMaxEventTypes, start);
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto &evt : events) {
+    auto elapsed = (evt.timestamp - start) / static_cast<int64_t>(kNsPerUs);
+    auto &prev_ts = prev_timestamps[evt.event_type % kMaxEventTypes];
+    auto cost = (evt.timestamp - prev_ts) / static_cast<int64_t>(kNsPerUs);
     prev_ts = evt.timestamp;
-    output_stream << std::setw(kIndent) << elapsed << "\t\t" << cost << "\t\t" << evt.desc << std::endl;
+    output_stream << std::setw(kIndent) << elapsed << "\t\t" << cost << "\t\t"
+                  << "tid:" << evt.tid << " ";
+    if (evt.node_id != kInvalidId) {
+      output_stream << "[" << GetName(evt.node_id) << "] ";
+    }
+    output_stream << "[" << GetEventTypeName(evt.event_type) << "] ";
+    if (evt.detail[0] != '\0') {
+      output_stream << evt.detail << std::endl;
+    } else {
+      output_stream << "[" << GetName(evt.span_id) << "] " << kPhaseNames[evt.phase] << std::endl;
+    }
+  }
+}
+
+void HybridProfiler::DumpChromeTrace(std::ostream &output_stream) {
+  auto events = CollectEvents();
+  int64_t start = 0;
+  if (!events.empty()) {
+    start = std::min_element(events.begin(), events.end(), [](const Event &lhs, const Event &rhs) {
+              return lhs.timestamp < rhs.timestamp;
+            })->timestamp;
   }
 
-  events_.clear();
+  std::lock_guard<std::mutex> lk(mu_);
+  bool first = true;
+  auto write_event = [&](const Event &evt, const char *phase, int64_t end_timestamp) {
+    output_stream << (first ? "\n" : ",\n") << "{\"name\":";
+    first = false;
+    WriteJsonString(output_stream, GetName(evt.span_id));
+    output_stream << ",\"cat\":\"" << GetEventTypeName(evt.event_type) << "\",\"ph\":\"" << phase
+                  << "\",\"pid\":0,\"tid\":" << evt.tid << ",\"ts\":" << std::fixed << std::setprecision(3)
+                  << (evt.timestamp - start) / kNsPerUs;
+    if (end_timestamp >= 0) {
+      output_stream << ",\"dur\":" << (end_timestamp - evt.timestamp) / kNsPerUs;
+    } else {
+      output_stream << ",\"s\":\"t\"";
+    }
+    output_stream << ",\"args\":{";
+    if (evt.node_id != kInvalidId) {
+      output_stream << "\"node\":";
+      WriteJsonString(output_stream, GetName(evt.node_id));
+    }
+    if (evt.detail[0] != '\0') {
+      output_stream << (evt.node_id != kInvalidId ? "," : "") << "\"detail\":";
+      WriteJsonString(output_stream, evt.detail);
+    }
+    output_stream << "}}";
+  };
+
+  // events of a thread are in order, pair the spans of each thread into complete events
+  output_stream << "{\"traceEvents\":[";
+  size_t begin_pos = 0;
+  while (begin_pos < events.size()) {
+    size_t end_pos = begin_pos;
+    while ((end_pos < events.size()) && (events[end_pos].tid == events[begin_pos].tid)) {
+      ++end_pos;
+    }
+    std::map<std::tuple<uint32_t, uint32_t, uint8_t>, std::vector<size_t>> open_spans;
+    for (size_t i = begin_pos; i < end_pos; ++i) {
+      auto &evt = events[i];
+      auto key = std::make_tuple(evt.node_id, evt.span_id, evt.event_type);
+      if (evt.phase == BEGIN) {
+        open_spans[key].emplace_back(i);
+        continue;
+      }
+      auto it = open_spans.find(key);
+      if ((evt.phase == END) && (it != open_spans.end()) && !it->second.empty()) {
+        write_event(events[it->second.back()], "X", evt.timestamp);
+        it->second.pop_back();
+      } else {
+        write_event(evt, "i", -1);
+      }
+    }
+    for (auto &it : open_spans) {
+      for (auto index : it.second) {
+        write_event(events[index], "i", -1);
+      }
+    }
+    begin_pos = end_pos;
+  }
+  output_stream << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
 }
 
 void HybridProfiler::Reset() {
-  counter_ = 0;
-  events_.clear();
-  events_.resize(kMaxEvents);
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto &buffer : buffers_) {
+    buffer->count = 0;
+  }
 }
 }  // namespace hybrid
 }  // namespace ge
@@ -19,13 +19,22 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ge {
 namespace hybrid {
+///
+/// @brief Tracer of the hybrid executor. Each thread records events into its own ring buffer of fixed-size records,
+///        so that recording takes no lock and no allocation once the names of nodes and spans are interned.
+///        The events can be dumped as text or exported as Chrome trace json, which is also loaded by Perfetto.
+///
 class HybridProfiler {
  public:
   enum EventType {
@@ -36,24 +45,74 @@ class HybridProfiler {
     CALLBACK,
   };
 
+  enum EventPhase {
+    BEGIN,
+    END,
+    INSTANT,
+  };
+
   struct Event {
-    std::chrono::system_clock::time_point timestamp;
-    EventType event_type;
-    std::string desc;
+    int64_t timestamp;  // ns of steady clock
+    uint32_t node_id;   // interned node name, kInvalidId if the event belongs to no node
+    uint32_t span_id;   // interned span name, e.g. "InferShapeAndType"
+    uint32_t tid;
+    uint8_t event_type;
+    uint8_t phase;
+    char detail[42];  // formatted description, only if the format has arguments
   };
 
+  static const uint32_t kInvalidId = UINT32_MAX;
+
   HybridProfiler();
-  ~HybridProfiler() = default;
+  ~HybridProfiler();
 
-  void RecordEvent(EventType event_type, const char *fmt, ...);
+  ///
+  /// @brief Record an event, the span and phase are parsed from fmt, e.g. "[PrepareTask] Start".
+  ///        fmt must be a string literal since it is cached by its address.
+  ///
+  void RecordEvent(EventType event_type, const char *node_name, const char *fmt, ...);
 
   void Reset();
 
   void Dump(std::ostream &os);
 
+  ///
+  /// @brief Export events as Chrome trace json, spans are paired into complete events per thread
+  ///
+  void DumpChromeTrace(std::ostream &os);
+
+  ///
+  /// @brief Number of events overwritten since the ring buffer of a thread is full
+  ///
+  uint64_t GetOverwrittenNum() const;
+
  private:
-  std::vector<Event> events_;
-  std::atomic_int counter_;
+  struct FormatInfo {
+    uint32_t span_id;
+    EventPhase phase;
+    bool has_args;
+  };
+
+  struct ThreadBuffer {
+    uint32_t tid = 0;
+    uint64_t count = 0;
+    std::vector<Event> events;
+    std::unordered_map<const char *, std::pair<uint32_t, const std::string *>> node_ids;
+    std::unordered_map<const char *, FormatInfo> formats;
+  };
+
+  ThreadBuffer &GetThreadBuffer();
+  uint32_t GetNodeId(ThreadBuffer &buffer, const char *node_name);
+  const FormatInfo &GetFormatInfo(ThreadBuffer &buffer, EventType event_type, const char *fmt);
+  uint32_t Intern(const std::string &name, const std::string **interned = nullptr);
+  std::vector<Event> CollectEvents();
+  const std::string &GetName(uint32_t id) const;
+
+  const uint64_t profiler_id_;
+  mutable std::mutex mu_;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+  std::deque<std::string> names_;  // references are kept valid while interning
+  std::unordered_map<std::string, uint32_t> name_ids_;
 };
 }  // namespace hybrid
 }  // namespace ge
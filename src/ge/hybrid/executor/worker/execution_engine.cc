@@ -115,7 +115,7 @@ Status NodeDoneCallback::PrepareConstInputs(const NodeItem &node_item) {
 
 Status NodeDoneCallback::OnNodeDone() {
   auto &node_item = context_->GetNodeItem();
-  GELOGI("[%s] Start callback process.", node_item.NodeName().c_str());
+  GELOGD("[%s] Start callback process.", node_item.NodeName().c_str());
   RECORD_CALLBACK_EVENT(graph_context_, context_->GetNodeName(), "Start");
 
   // release inputs
@@ -138,7 +138,7 @@ Status NodeDoneCallback::OnNodeDone() {
 
   // release condition variable
   if (node_item.has_observer) {
-    GELOGI("[%s] Notify observer. node_id = %d", node_item.NodeName().c_str(), node_item.node_id);
+    GELOGD("[%s] Notify observer. node_id = %d", node_item.NodeName().c_str(), node_item.node_id);
     context_->NodeDone();
   }
 
@@ -148,7 +148,7 @@ Status NodeDoneCallback::OnNodeDone() {
 
 Status ExecutionEngine::ExecuteAsync(NodeState &node_state, const std::shared_ptr<TaskContext> &task_context,
                                      GraphExecutionContext &execution_context) {
-  GELOGI("[%s] Node is ready for execution", task_context->GetNodeName());
+  GELOGD("[%s] Node is ready for execution", task_context->GetNodeName());
   RECORD_EXECUTION_EVENT(&execution_context, task_context->GetNodeName(), "Start");
   auto cb = std::shared_ptr<NodeDoneCallback>(new (std::nothrow) NodeDoneCallback(&execution_context, task_context));
   GE_CHECK_NOTNULL(cb);
@@ -54,7 +54,8 @@ Status ShapeInferenceEngine::InferShape(NodeState &node_state) {
   {
     std::lock_guard<std::mutex> lk(mu_);
     RECORD_SHAPE_INFERENCE_EVENT(execution_context_, node_item.NodeName().c_str(), "[InferShapeAndType] Start");
-    GE_CHK_STATUS_RET(ShapeRefiner::InferShapeAndType(node_item.node), "Invoke InferShapeAndType failed.");
+    GE_CHK_STATUS_RET(ShapeRefiner::InferShapeAndType(node_item.node, true, infer_session_),
+                      "Invoke InferShapeAndType failed.");
     RECORD_SHAPE_INFERENCE_EVENT(execution_context_, node_item.NodeName().c_str(), "[InferShapeAndType] End");
   }
   // Check again to make sure shape is valid after shape inference
@@ -117,7 +118,7 @@ Status ShapeInferenceEngine::PropagateOutputShapes(const NodeItem &node_item) {
       auto dst_node_state = subgraph_context_->GetOrCreateNodeState(dst_node_item);
       GE_CHECK_NOTNULL(dst_node_state);
 
-      GELOGI("[%s] Update dst node [%s], input index = %d", node_item.NodeName().c_str(),
+      GELOGD("[%s] Update dst node [%s], input index = %d", node_item.NodeName().c_str(),
              dst_node_item->NodeName().c_str(), dst_input_index_and_node.first);
 
       // in case type 3 and 4, shape will be valid after computing is done
@@ -17,6 +17,7 @@
 #ifndef GE_HYBRID_EXECUTOR_INFERSHAPE_SHAPE_INFERENCE_ENGINE_H_
 #define GE_HYBRID_EXECUTOR_INFERSHAPE_SHAPE_INFERENCE_ENGINE_H_
 
+#include "graph/shape_refiner.h"
 #include "hybrid/executor/hybrid_execution_context.h"
 #include "hybrid/executor/subgraph_context.h"
 #include <mutex>
@@ -38,6 +39,7 @@ class ShapeInferenceEngine {
   GraphExecutionContext *execution_context_;
   SubgraphContext *subgraph_context_;
   std::mutex mu_;
+  ShapeInferenceSession infer_session_;
 };
 }  // namespace hybrid
 }  // namespace ge
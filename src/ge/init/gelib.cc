@@ -25,6 +25,7 @@
 #include <utility>
 
 #include "common/ge/ge_util.h"
+#include "common/debug/async_log_sink.h"
 #include "common/ge/plugin_manager.h"
 #include "common/profiling/profiling_manager.h"
 #include "common/properties_manager.h"
@@ -34,6 +35,7 @@
 #include "ge_local_engine/engine/host_cpu_engine.h"
 #include "graph/ge_context.h"
 #include "graph/ge_global_options.h"
+#include "graph/utils/graph_utils.h"
 #include "graph/load/new_model_manager/model_manager.h"
 #include "graph/manager/graph_mem_allocator.h"
 #include "graph/manager/graph_var_manager.h"
@@ -55,12 +57,17 @@ static std::shared_ptr<GELib> instancePtr_ = nullptr;
 
 // Initial each module of GE, if one failed, release all
 Status GELib::Initialize(const map<string, string> &options) {
+  // every Start is stopped by a failed initialization or by Finalize
+  if (AsyncLogSink::Instance().Start() != SUCCESS) {
+    GELOGW("Failed to start async log sink, logs are written synchronously.");
+  }
   GELOGI("initial start");
   GEEVENT("[GEPERFTRACE] GE Init Start");
   // Multiple initializations are not allowed
   instancePtr_ = MakeShared<GELib>();
   if (instancePtr_ == nullptr) {
     GELOGE(GE_CLI_INIT_FAILED, "GeLib initialize failed, malloc shared_ptr failed.");
+    AsyncLogSink::Instance().Stop();
     return GE_CLI_INIT_FAILED;
   }
 
@@ -68,6 +75,7 @@ Status GELib::Initialize(const map<string, string> &options) {
   Status ret = instancePtr_->SetRTSocVersion(options, new_options);
   if (ret != SUCCESS) {
     GELOGE(ret, "GeLib initial failed.");
+    AsyncLogSink::Instance().Stop();
     return ret;
   }
   GetMutableGlobalOptions().insert(new_options.begin(), new_options.end());
@@ -77,6 +85,7 @@ Status GELib::Initialize(const map<string, string> &options) {
   if (ret != SUCCESS) {
     GELOGE(ret, "GeLib initial failed.");
     instancePtr_ = nullptr;
+    AsyncLogSink::Instance().Stop();
     return ret;
   }
   GE_TIMESTAMP_EVENT_END(Init, "GELib::Initialize");
@@ -399,14 +408,17 @@ Status GELib::Finalize() {
   is_train_mode_ = false;
 
   GetMutableGlobalOptions().erase(ENABLE_SINGLE_STREAM);
+  GraphUtils::FlushGraphDump();
 
   instancePtr_ = nullptr;
   init_flag_ = false;
   if (final_state != SUCCESS) {
     GELOGE(FAILED, "MemManager finalization.");
+    AsyncLogSink::Instance().Stop();
     return final_state;
   }
   GELOGI("finalization success.");
+  AsyncLogSink::Instance().Stop();
   return SUCCESS;
 }
 
@@ -367,6 +367,9 @@ int CheckLogParamValidAndSetLogLevel(const std::string log) {
   }
   if (ret != 0) {
     GELOGE(ge::PARAM_INVALID, "Log setlevel fail !");
+  } else {
+    // slog does not notify level changes, drop the cached levels of this process
+    ge::RefreshLogLevel();
   }
   return ret;
 }
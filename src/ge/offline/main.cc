@@ -20,10 +20,13 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <cctype>
+#include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdlib>
 #include <iostream>
 #include "common/gflags_util.h"
+#include "common/thread_pool.h"
 #include "common/util.h"
 #include "common/util/error_manager/error_manager.h"
 #include "common/model_parser/graph_parser_util.h"
@@ -32,6 +35,7 @@
 #include "generator/ge_generator.h"
 #include "graph/anchor.h"
 #include "graph/debug/ge_attr_define.h"
+#include "graph/ge_local_context.h"
 #include "graph/graph.h"
 #include "graph/op_desc.h"
 #include "graph/utils/graph_utils.h"
@@ -71,6 +75,8 @@ const char *const kModeSupport =
   "only support 0(model to framework model), "
   "1(framework model to json), 3(only pre-check), 5(pbtxt to json)";
 const char *const kModelToJsonSupport = "only support 0(Caffe) 3(TensorFlow)";
+const int32_t kMaxSingleOpJobs = 64;
+const size_t kSingleOpSummaryTopNum = 10;
 
 DEFINE_string(model, "", "The model file.");
 DEFINE_string(output, "", "The output file path&name.");
@@ -145,6 +151,13 @@ DEFINE_string(optypelist_for_implmode, "",
 
 DEFINE_string(singleop, "", "Optional; If set, generate single op model with the given json file.");
 
+DEFINE_int32(jobs, 1, "Optional; the number of single ops compiled concurrently in --singleop mode, 1(default)");
+
+DEFINE_string(compile_cache_dir, "", "Optional; the directory of the compile cache, unchanged models are not rebuilt.");
+
+DEFINE_string(om_chunk_checksum, "false",
+              "Optional; whether to save the chunk checksums of the om file beside it, true or false(default).");
+
 DEFINE_int32(disable_reuse_memory, 0, "Optional; If set to 1, disable reuse memory when generating if.");
 
 DEFINE_string(auto_tune_mode, "", "Optional; Set tune mode.");
@@ -220,6 +233,12 @@ class GFlagUtils {
       ".om automatically). \n"
       "                      If --singleop is set, this arg specifies the directory to "
       "which the single op offline model will be generated\n"
+      "  --jobs              Number of single ops compiled concurrently, used with --singleop. "
+      "Default value is: 1\n"
+      "  --compile_cache_dir Directory of the compile cache. Models which are unchanged since last build "
+      "are taken from the cache instead of being rebuilt\n"
+      "  --om_chunk_checksum Save the checksums of the chunks of the om file to <om file>.checksum, they are "
+      "verified when the om file is loaded. true: enable; false(default): disable\n"
       "  --input_shape       Shape of input data. Separate multiple nodes with semicolons (;)."
       "Use double quotation marks (\") to enclose each argument."
       "E.g.: \"input_name1:n1,c1,h1,w1;input_name2:n2,c2,h2,w2\"\n"
@@ -933,6 +952,104 @@ static void SetEnvForSingleOp(std::map<string, string> &options) {
   options.emplace(ge::AUTO_TUNE_MODE, FLAGS_auto_tune_mode);
   options.emplace(ge::GRAPH_MEMORY_MAX_SIZE, kGraphMemoryManagerMallocMaxSize);
   options.emplace(ge::OP_DEBUG_LEVEL, to_string(FLAGS_op_debug_level));
+  options.emplace(ge::COMPILE_CACHE_DIR, FLAGS_compile_cache_dir);
+  options.emplace(ge::OM_CHUNK_CHECKSUM, FLAGS_om_chunk_checksum);
+}
+
+struct SingleOpCompileResult {
+  bool compiled = false;
+  ge::Status status = ge::SUCCESS;
+  uint64_t cost_time = 0;  // us
+};
+
+static void CompileSingleOps(ge::GeGenerator &generator, vector<ge::SingleOpBuildParam> &build_params,
+                             std::atomic<size_t> &next_index, std::atomic<bool> &failed,
+                             vector<SingleOpCompileResult> &results, const ge::GEThreadLocalContext &context) {
+  ge::GetThreadLocalContext() = context;
+  // ops are taken in the order of the json file, and output file names only depend on the op index
+  while (!failed) {
+    size_t index = next_index++;
+    if (index >= build_params.size()) {
+      break;
+    }
+    auto &param = build_params[index];
+    string output_path;
+    if (!FLAGS_output.empty()) {
+      output_path = FLAGS_output + "/";
+    }
+    output_path += param.file_name;
+    uint64_t start_time = ge::GetCurrentTimestap();
+    auto ret = generator.BuildSingleOpModel(param.op_desc, param.inputs, param.outputs, output_path);
+    results[index].compiled = true;
+    results[index].status = ret;
+    results[index].cost_time = ge::GetCurrentTimestap() - start_time;
+    if (ret != SUCCESS) {
+      DOMI_LOGE("Compile op failed. ge ret = %u, op index = %zu", ret, index);
+      failed = true;
+      break;
+    }
+    GELOGI("Compile op success. op index = %zu, output = %s, cost time = %lu us", index, output_path.c_str(),
+           results[index].cost_time);
+  }
+}
+
+static void PrintSingleOpCompileSummary(const vector<ge::SingleOpBuildParam> &build_params,
+                                        const vector<SingleOpCompileResult> &results, uint64_t total_time) {
+  size_t success_num = 0;
+  vector<size_t> failed_indexes;
+  vector<size_t> compiled_indexes;
+  for (size_t i = 0; i < results.size(); ++i) {
+    if (!results[i].compiled) {
+      continue;
+    }
+    compiled_indexes.emplace_back(i);
+    if (results[i].status == SUCCESS) {
+      ++success_num;
+    } else {
+      failed_indexes.emplace_back(i);
+    }
+  }
+  std::stable_sort(compiled_indexes.begin(), compiled_indexes.end(),
+                   [&results](size_t lhs, size_t rhs) { return results[lhs].cost_time > results[rhs].cost_time; });
+
+  std::cout << "Single op compile summary: total " << results.size() << ", success " << success_num << ", failed "
+            << failed_indexes.size() << ", skipped " << (results.size() - compiled_indexes.size()) << ", jobs "
+            << FLAGS_jobs << ", time " << total_time << " us." << std::endl;
+  GEEVENT("Single op compile summary: total %zu, success %zu, failed %zu, skipped %zu, time %lu us.", results.size(),
+          success_num, failed_indexes.size(), results.size() - compiled_indexes.size(), total_time);
+  for (size_t i = 0; (i < compiled_indexes.size()) && (i < kSingleOpSummaryTopNum); ++i) {
+    size_t index = compiled_indexes[i];
+    std::cout << "  op index " << index << ", " << build_params[index].file_name << ", cost time "
+              << results[index].cost_time << " us." << std::endl;
+  }
+  for (size_t index : failed_indexes) {
+    std::cout << "  op index " << index << ", " << build_params[index].file_name << " failed, ge ret "
+              << results[index].status << "." << std::endl;
+  }
+  for (size_t index : compiled_indexes) {
+    GELOGI("Single op index %zu, %s, status %u, cost time %lu us.", index, build_params[index].file_name.c_str(),
+           results[index].status, results[index].cost_time);
+  }
+}
+
+static domi::Status InitGenerators(const std::map<string, string> &options, size_t generator_num,
+                                   vector<std::shared_ptr<ge::GeGenerator>> &generators) {
+  while (generators.size() < generator_num) {
+    auto generator = ge::MakeShared<ge::GeGenerator>();
+    if ((generator == nullptr) || (generator->Initialize(options) != SUCCESS)) {
+      DOMI_LOGE("GeGenerator initialize failed!");
+      return domi::FAILED;
+    }
+    generators.emplace_back(generator);
+  }
+  return domi::SUCCESS;
+}
+
+static void FinalizeGenerators(vector<std::shared_ptr<ge::GeGenerator>> &generators) {
+  for (auto &generator : generators) {
+    (void)generator->Finalize();
+  }
+  generators.clear();
 }
 
 domi::Status GenerateSingleOp(const std::string &json_file_path) {
@@ -945,6 +1062,13 @@ domi::Status GenerateSingleOp(const std::string &json_file_path) {
     ge::CheckImplmodeParamValid(FLAGS_optypelist_for_implmode, FLAGS_op_select_implmode) != ge::SUCCESS,
     return ge::FAILED, "check optypelist_for_implmode and op_select_implmode failed!");
 
+  if ((FLAGS_jobs < 1) || (FLAGS_jobs > kMaxSingleOpJobs)) {
+    ErrorManager::GetInstance().ATCReportErrMessage("E10001", {"parameter", "value", "reason"},
+                                                    {"--jobs", std::to_string(FLAGS_jobs), "it must be in [1, 64]"});
+    DOMI_LOGE("Invalid value for --jobs[%d], it must be in [1, %d].", FLAGS_jobs, kMaxSingleOpJobs);
+    return domi::FAILED;
+  }
+
   std::map<string, string> options;
   // need to be changed when ge.ini plan is done
   SetEnvForSingleOp(options);
@@ -955,10 +1079,9 @@ domi::Status GenerateSingleOp(const std::string &json_file_path) {
     return domi::FAILED;
   }
 
-  ge::GeGenerator generator;
-  ret = generator.Initialize(options);
-  if (ret != SUCCESS) {
-    DOMI_LOGE("GeGenerator initialize failed!");
+  // each job compiles with its own generator, so that graph managers are never shared between threads
+  vector<std::shared_ptr<ge::GeGenerator>> generators;
+  if (InitGenerators(options, 1, generators) != SUCCESS) {
     (void)ge::GELib::GetInstance()->Finalize();
     return domi::FAILED;
   }
@@ -966,31 +1089,47 @@ domi::Status GenerateSingleOp(const std::string &json_file_path) {
   vector<ge::SingleOpBuildParam> build_params;
   if (ge::SingleOpParser::ParseSingleOpList(json_file_path, build_params) != ge::SUCCESS) {
     DOMI_LOGE("parse single op json file failed");
-    (void)generator.Finalize();
+    FinalizeGenerators(generators);
     (void)ge::GELib::GetInstance()->Finalize();
     return domi::FAILED;
   }
 
-  int index = 0;
-  for (auto &param : build_params) {
-    string output_path;
-    if (!FLAGS_output.empty()) {
-      output_path = FLAGS_output + "/";
+  size_t job_num = std::max(std::min(static_cast<size_t>(FLAGS_jobs), build_params.size()), static_cast<size_t>(1));
+  if (InitGenerators(options, job_num, generators) != SUCCESS) {
+    FinalizeGenerators(generators);
+    (void)ge::GELib::GetInstance()->Finalize();
+    return domi::FAILED;
+  }
+
+  vector<SingleOpCompileResult> results(build_params.size());
+  std::atomic<size_t> next_index(0);
+  std::atomic<bool> failed(false);
+  uint64_t start_time = ge::GetCurrentTimestap();
+  if (job_num == 1) {
+    CompileSingleOps(*generators[0], build_params, next_index, failed, results, ge::GetThreadLocalContext());
+  } else {
+    ge::ThreadPool executor(static_cast<uint32_t>(job_num));
+    vector<std::future<void>> vector_future;
+    for (size_t i = 0; i < job_num; ++i) {
+      std::future<void> f = executor.commit(CompileSingleOps, std::ref(*generators[i]), std::ref(build_params),
+                                            std::ref(next_index), std::ref(failed), std::ref(results),
+                                            ge::GetThreadLocalContext());
+      if (!f.valid()) {
+        DOMI_LOGE("Failed to commit single op compile job %zu.", i);
+        failed = true;
+        break;
+      }
+      vector_future.emplace_back(std::move(f));
     }
-    output_path += param.file_name;
-    ret = generator.BuildSingleOpModel(param.op_desc, param.inputs, param.outputs, output_path);
-    if (ret != SUCCESS) {
-      DOMI_LOGE("Compile op failed. ge ret = %u, op index = %d", ret, index);
-      ret = domi::FAILED;
-      break;
+    for (auto &f : vector_future) {
+      f.get();
     }
-    GELOGI("Compile op success. op index = %d, output = %s", index, output_path.c_str());
-    index += 1;
   }
+  PrintSingleOpCompileSummary(build_params, results, ge::GetCurrentTimestap() - start_time);
 
-  (void)generator.Finalize();
+  FinalizeGenerators(generators);
   (void)ge::GELib::GetInstance()->Finalize();
-  return ret;
+  return failed ? domi::FAILED : domi::SUCCESS;
 }
 
 domi::Status GenerateOmModel() {
@@ -1075,6 +1214,8 @@ domi::Status GenerateOmModel() {
   }
 
   options.insert(std::pair<string, string>(string(ge::OP_DEBUG_LEVEL), to_string(FLAGS_op_debug_level)));
+  options.insert(std::pair<string, string>(string(ge::COMPILE_CACHE_DIR), FLAGS_compile_cache_dir));
+  options.insert(std::pair<string, string>(string(ge::OM_CHUNK_CHECKSUM), FLAGS_om_chunk_checksum));
 
   // print atc option map
   ge::PrintOptionMap(options, "atc option");
@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -77,6 +78,13 @@ class OpsKernelManager {
   // Finalize other ops kernel resource
   Status FinalizeOpsKernel();
 
+  // The ops kernel info stores and graph optimizers are not required to be thread safe, the callers which may run
+  // concurrently, such as the builds of known shape subgraphs, call into them under this lock
+  std::mutex &GetPluginCallMutex() const { return plugin_call_mutex_; }
+
+  // get the paths of the engine so files, separated by ':'
+  void GetExternalEnginePath(std::string &path);
+
  private:
   OpsKernelManager();
   ~OpsKernelManager();
@@ -91,8 +99,6 @@ class OpsKernelManager {
 
   Status CheckPluginPtr();
 
-  void GetExternalEnginePath(std::string &path);
-
   void InitOpsKernelInfo();
 
   Status InitGraphOptimzers(const map<string, string> &options);
@@ -125,6 +131,8 @@ class OpsKernelManager {
   bool enable_fe_flag_ = false;
 
   bool enable_aicpu_flag_ = false;
+
+  mutable std::mutex plugin_call_mutex_;
 };
 }  // namespace ge
 #endif  // GE_OPSKERNEL_MANAGER_OPS_KERNEL_MANAGER_H_
@@ -0,0 +1,107 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "single_op/run_info_cache.h"
+
+#include "framework/common/debug/ge_log.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/attr_utils.h"
+
+namespace ge {
+namespace {
+void AppendInt(int64_t value, std::string &key) { key.append(reinterpret_cast<const char *>(&value), sizeof(value)); }
+
+void AppendDims(const std::vector<int64_t> &dims, std::string &key) {
+  AppendInt(static_cast<int64_t>(dims.size()), key);
+  key.append(reinterpret_cast<const char *>(dims.data()), dims.size() * sizeof(int64_t));
+}
+
+// only the shapes are updated to the node before tiling, so they are all that the tiling result depends on
+void AppendTensorDesc(const GeTensorDesc &desc, std::string &key) {
+  int64_t storage_format = static_cast<int64_t>(FORMAT_RESERVED);
+  (void)AttrUtils::GetInt(desc, ATTR_NAME_STORAGE_FORMAT, storage_format);
+  AppendInt(storage_format, key);
+  if (storage_format != static_cast<int64_t>(FORMAT_RESERVED)) {
+    std::vector<int64_t> storage_shape;
+    (void)AttrUtils::GetListInt(desc, ATTR_NAME_STORAGE_SHAPE, storage_shape);
+    AppendDims(storage_shape, key);
+  } else {
+    AppendDims(desc.GetOriginShape().GetDims(), key);
+  }
+  AppendDims(desc.GetShape().GetDims(), key);
+}
+}  // namespace
+
+void RunInfoCache::GenerateKey(const std::vector<GeTensorDesc> &input_desc,
+                               const std::vector<GeTensorDesc> &output_desc, std::string &key) {
+  key.clear();
+  AppendInt(static_cast<int64_t>(input_desc.size()), key);
+  for (const auto &desc : input_desc) {
+    AppendTensorDesc(desc, key);
+  }
+  for (const auto &desc : output_desc) {
+    AppendTensorDesc(desc, key);
+  }
+}
+
+const RunInfoCacheEntry *RunInfoCache::Find(const std::string &key) {
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    ++miss_count_;
+    return nullptr;
+  }
+  ++hit_count_;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return &it->second->second;
+}
+
+void RunInfoCache::Insert(const std::string &key, const RunInfoCacheEntry &entry) {
+  if (capacity_ == 0) {
+    return;
+  }
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    it->second->second = entry;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+  entries_.emplace_front(key, entry);
+  (void)index_.emplace(key, entries_.begin());
+  EvictToCapacity();
+  GELOGD("Run info cached, cache size = %zu", entries_.size());
+}
+
+void RunInfoCache::SetCapacity(size_t capacity) {
+  capacity_ = capacity;
+  EvictToCapacity();
+}
+
+void RunInfoCache::GetStats(DynamicSingleOpCacheStats &stats) const {
+  stats.hit_count = hit_count_;
+  stats.miss_count = miss_count_;
+  stats.evict_count = evict_count_;
+  stats.entry_num = entries_.size();
+  stats.capacity = capacity_;
+}
+
+void RunInfoCache::EvictToCapacity() {
+  while (entries_.size() > capacity_) {
+    (void)index_.erase(entries_.back().first);
+    entries_.pop_back();
+    ++evict_count_;
+  }
+}
+}  // namespace ge
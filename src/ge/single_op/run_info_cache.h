@@ -0,0 +1,97 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_SINGLE_OP_RUN_INFO_CACHE_H_
+#define GE_SINGLE_OP_RUN_INFO_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/ge_inner_error_codes.h"
+#include "framework/executor/ge_executor.h"
+#include "graph/ge_tensor.h"
+
+namespace ge {
+///
+/// @brief Result of tiling a dynamic single op for one shape signature, the workspaces are described by offsets
+///        into a single block, so that they can be carved from the workspace arena of any stream
+///
+struct RunInfoCacheEntry {
+  std::string tiling_data;
+  uint32_t block_dim = 1;
+  std::vector<int64_t> workspace_sizes;
+  std::vector<int64_t> workspace_offsets;
+  int64_t total_workspace_size = 0;
+};
+
+///
+/// @brief LRU cache of tiling results of a dynamic single op, keyed by the shape signature of its tensors.
+///        Not thread safe, as the op owning it is not.
+///
+class RunInfoCache {
+ public:
+  explicit RunInfoCache(size_t capacity) : capacity_(capacity) {}
+  ~RunInfoCache() = default;
+  RunInfoCache(const RunInfoCache &) = delete;
+  RunInfoCache &operator=(const RunInfoCache &) = delete;
+
+  ///
+  /// @brief Generate the shape signature of tensors, which is the cache key
+  /// @param [in] input_desc
+  /// @param [in] output_desc
+  /// @param [out] key
+  ///
+  static void GenerateKey(const std::vector<GeTensorDesc> &input_desc, const std::vector<GeTensorDesc> &output_desc,
+                          std::string &key);
+
+  ///
+  /// @brief Find entry of key and mark it as the most recently used one
+  /// @return entry, or nullptr if missed. It is valid until the next Insert or SetCapacity
+  ///
+  const RunInfoCacheEntry *Find(const std::string &key);
+
+  ///
+  /// @brief Insert entry of key, evicting the least recently used ones if the cache is full
+  ///
+  void Insert(const std::string &key, const RunInfoCacheEntry &entry);
+
+  ///
+  /// @brief Change the max number of entries, 0 disables the cache
+  ///
+  void SetCapacity(size_t capacity);
+
+  bool IsEnabled() const { return capacity_ > 0; }
+
+  void GetStats(DynamicSingleOpCacheStats &stats) const;
+
+ private:
+  using EntryList = std::list<std::pair<std::string, RunInfoCacheEntry>>;
+
+  void EvictToCapacity();
+
+  size_t capacity_;
+  // most recently used entry is at front
+  EntryList entries_;
+  std::unordered_map<std::string, EntryList::iterator> index_;
+  uint64_t hit_count_ = 0;
+  uint64_t miss_count_ = 0;
+  uint64_t evict_count_ = 0;
+};
+}  // namespace ge
+#endif  // GE_SINGLE_OP_RUN_INFO_CACHE_H_
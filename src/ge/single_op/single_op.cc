@@ -28,6 +28,7 @@
 namespace ge {
 namespace {
 const size_t kDataMemAlignSize = 32;
+const size_t kDefaultRunInfoCacheCapacity = 64;
 
 size_t GetAlignedSize(uint32_t size) {
   size_t aligned_size = (size + 2 * kDataMemAlignSize - 1) / kDataMemAlignSize * kDataMemAlignSize;
@@ -111,6 +112,7 @@ Status SingleOp::GetArgs(const std::vector<DataBuffer> &inputs, const std::vecto
 }
 
 Status SingleOp::UpdateArgs(const std::vector<DataBuffer> &inputs, const std::vector<DataBuffer> &outputs) {
+  args_patched_ = false;
   Status ret = GetArgs(inputs, outputs);
   if (ret != SUCCESS) {
     return ret;
@@ -128,6 +130,15 @@ Status SingleOp::UpdateArgs(const std::vector<DataBuffer> &inputs, const std::ve
       *arg_addr = args_[i];
     }
   }
+  ret = UpdateAicpuArgs();
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  args_patched_ = true;
+  return SUCCESS;
+}
+
+Status SingleOp::UpdateAicpuArgs() {
   // update aicpu_TF or aicpu_CC args
   for (auto &task : tasks_) {
     size_t io_addr_num = args_.size();
@@ -161,6 +172,46 @@ Status SingleOp::UpdateArgs(const std::vector<DataBuffer> &inputs, const std::ve
   return SUCCESS;
 }
 
+Status SingleOp::PatchArgs(const std::vector<uintptr_t> &args) {
+  if (args.size() != args_.size()) {
+    GELOGE(PARAM_INVALID, "Args num mismatch. model expect %zu, but given %zu", args_.size(), args.size());
+    return PARAM_INVALID;
+  }
+  bool changed = !args_patched_;
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (args_patched_ && (args[i] == args_[i])) {
+      continue;
+    }
+    changed = true;
+    args_[i] = args[i];
+    if (i < arg_table_.size()) {
+      for (uintptr_t *arg_addr : arg_table_[i]) {
+        *arg_addr = args[i];
+      }
+    }
+  }
+  if (!changed) {
+    return SUCCESS;
+  }
+  Status ret = UpdateAicpuArgs();
+  if (ret != SUCCESS) {
+    args_patched_ = false;
+    return ret;
+  }
+  args_patched_ = true;
+  return SUCCESS;
+}
+
+Status SingleOp::LaunchTasks() {
+  for (auto &task : tasks_) {
+    Status ret = task->LaunchKernel(stream_);
+    if (ret != SUCCESS) {
+      return ret;
+    }
+  }
+  return SUCCESS;
+}
+
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status SingleOp::ExecuteAsync(const std::vector<DataBuffer> &inputs,
                                                                                const std::vector<DataBuffer> &outputs) {
   Status ret = ValidateArgs(inputs, outputs);
@@ -173,20 +224,13 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status SingleOp::ExecuteAsync(c
     return ret;
   }
 
-  for (auto &task : tasks_) {
-    ret = task->LaunchKernel(stream_);
-    if (ret != SUCCESS) {
-      return ret;
-    }
-  }
-
-  return ret;
+  return LaunchTasks();
 }
 
 void SingleOp::SetStream(rtStream_t stream) { stream_ = stream; }
 
 DynamicSingleOp::DynamicSingleOp(uintptr_t resource_id, rtStream_t stream)
-    : resource_id_(resource_id), stream_(stream) {}
+    : resource_id_(resource_id), stream_(stream), run_info_cache_(kDefaultRunInfoCacheCapacity) {}
 
 Status DynamicSingleOp::ValidateParams(const vector<GeTensorDesc> &input_desc, const std::vector<DataBuffer> &inputs,
                                        std::vector<GeTensorDesc> &output_desc, std::vector<DataBuffer> &outputs) const {
@@ -215,33 +259,63 @@ Status DynamicSingleOp::ValidateParams(const vector<GeTensorDesc> &input_desc, c
   return SUCCESS;
 }
 
-Status DynamicSingleOp::AllocateWorkspaces(const std::vector<int64_t> &workspace_sizes,
-                                           std::vector<void *> &workspaces) {
-  static const std::string kPurpose("malloc workspace memory for dynamic op.");
-  if (workspace_sizes.empty()) {
-    GELOGD("No need to allocate workspace.");
-    return SUCCESS;
-  }
+Status DynamicSingleOp::CalcWorkspaceOffsets(RunInfoCacheEntry &run_info) {
   int64_t total_size = 0;
-  std::vector<int64_t> ws_offsets;
-  for (auto ws_size : workspace_sizes) {
+  run_info.workspace_offsets.clear();
+  for (auto ws_size : run_info.workspace_sizes) {
     // alignment and padding should be done in OpParaCalculate
     GE_CHK_STATUS_RET_NOLOG(CheckInt64AddOverflow(total_size, ws_size));
-    ws_offsets.emplace_back(total_size);
+    run_info.workspace_offsets.emplace_back(total_size);
     total_size += ws_size;
   }
-
+  run_info.total_workspace_size = total_size;
   GELOGD("Total workspace size is %ld", total_size);
-  StreamResource *stream_resource = SingleOpManager::GetInstance().GetResource(resource_id_, stream_);
-  GE_CHECK_NOTNULL(stream_resource);
-  auto ws_base = stream_resource->MallocMemory(kPurpose, static_cast<size_t>(total_size));
+  return SUCCESS;
+}
+
+Status DynamicSingleOp::GetRunInfo(const vector<GeTensorDesc> &input_desc, const vector<GeTensorDesc> &output_desc,
+                                   const RunInfoCacheEntry *&run_info) {
+  if (run_info_cache_.IsEnabled()) {
+    RunInfoCache::GenerateKey(input_desc, output_desc, cache_key_);
+    run_info = run_info_cache_.Find(cache_key_);
+    if (run_info != nullptr) {
+      GELOGD("Run info cache hit, skip tiling.");
+      op_task_->SetRunInfo(run_info->tiling_data, run_info->block_dim, run_info->workspace_sizes);
+      return SUCCESS;
+    }
+  }
+
+  GE_CHK_STATUS_RET_NOLOG(op_task_->UpdateRunInfo(input_desc, output_desc));
+  last_run_info_.tiling_data = op_task_->GetTilingData();
+  last_run_info_.block_dim = op_task_->GetBlockDim();
+  last_run_info_.workspace_sizes = op_task_->GetWorkspaceSizes();
+  GE_CHK_STATUS_RET_NOLOG(CalcWorkspaceOffsets(last_run_info_));
+  if (run_info_cache_.IsEnabled()) {
+    run_info_cache_.Insert(cache_key_, last_run_info_);
+  }
+  run_info = &last_run_info_;
+  return SUCCESS;
+}
+
+Status DynamicSingleOp::AllocateWorkspaces(const RunInfoCacheEntry &run_info, std::vector<void *> &workspaces) {
+  static const std::string kPurpose("malloc workspace memory for dynamic op.");
+  if (run_info.workspace_offsets.empty()) {
+    GELOGD("No need to allocate workspace.");
+    return SUCCESS;
+  }
+
+  if (stream_resource_ == nullptr) {
+    stream_resource_ = SingleOpManager::GetInstance().GetResource(resource_id_, stream_);
+    GE_CHECK_NOTNULL(stream_resource_);
+  }
+  auto ws_base = stream_resource_->MallocWorkspace(kPurpose, static_cast<size_t>(run_info.total_workspace_size));
   if (ws_base == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "Failed to allocate memory of size: %ld", total_size);
+    GELOGE(MEMALLOC_FAILED, "Failed to allocate memory of size: %ld", run_info.total_workspace_size);
     return MEMALLOC_FAILED;
   }
   GELOGD("Done allocating workspace memory successfully.");
 
-  for (auto ws_offset : ws_offsets) {
+  for (auto ws_offset : run_info.workspace_offsets) {
     workspaces.emplace_back(ws_base + ws_offset);
   }
 
@@ -252,9 +326,10 @@ Status DynamicSingleOp::ExecuteAsync(const vector<GeTensorDesc> &input_desc, con
                                      vector<GeTensorDesc> &output_desc, vector<DataBuffer> &output_buffers) {
   GE_CHECK_NOTNULL(op_task_);
   GE_CHK_STATUS_RET_NOLOG(ValidateParams(input_desc, input_buffers, output_desc, output_buffers));
-  GE_CHK_STATUS_RET_NOLOG(op_task_->UpdateRunInfo(input_desc, output_desc));
+  const RunInfoCacheEntry *run_info = nullptr;
+  GE_CHK_STATUS_RET_NOLOG(GetRunInfo(input_desc, output_desc, run_info));
   std::vector<void *> workspace_buffers;
-  GE_CHK_STATUS_RET_NOLOG(AllocateWorkspaces(op_task_->GetWorkspaceSizes(), workspace_buffers));
+  GE_CHK_STATUS_RET_NOLOG(AllocateWorkspaces(*run_info, workspace_buffers));
   std::vector<void *> inputs;
   std::vector<void *> outputs;
   for (auto &buffer : input_buffers) {
@@ -265,4 +340,11 @@ Status DynamicSingleOp::ExecuteAsync(const vector<GeTensorDesc> &input_desc, con
   }
   return op_task_->LaunchKernel(inputs, outputs, workspace_buffers, stream_);
 }
+
+void DynamicSingleOp::GetCacheStats(DynamicSingleOpCacheStats &stats) const { run_info_cache_.GetStats(stats); }
+
+void DynamicSingleOp::SetCacheCapacity(size_t capacity) {
+  GELOGI("Set run info cache capacity to %zu", capacity);
+  run_info_cache_.SetCapacity(capacity);
+}
 }  // namespace ge
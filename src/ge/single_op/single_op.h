@@ -25,9 +25,12 @@
 #include "common/ge_inner_error_codes.h"
 #include "framework/executor/ge_executor.h"
 #include "runtime/stream.h"
+#include "single_op/run_info_cache.h"
 #include "task/op_task.h"
 
 namespace ge {
+class StreamResource;
+
 class SingleOp {
  public:
   SingleOp() = default;
@@ -40,8 +43,12 @@ class SingleOp {
   Status ValidateArgs(const std::vector<DataBuffer> &inputs, const std::vector<DataBuffer> &outputs);
   Status UpdateArgs(const std::vector<DataBuffer> &inputs, const std::vector<DataBuffer> &outputs);
   Status GetArgs(const std::vector<DataBuffer> &inputs, const std::vector<DataBuffer> &outputs);
+  Status UpdateAicpuArgs();
+  Status PatchArgs(const std::vector<uintptr_t> &args);
+  Status LaunchTasks();
 
   friend class SingleOpModel;
+  friend class SingleOpPlan;
   rtStream_t stream_ = nullptr;
   std::vector<void *> input_addr_list_;
   std::vector<size_t> input_sizes_;
@@ -52,6 +59,8 @@ class SingleOp {
   std::vector<OpTask *> tasks_;
   std::vector<std::vector<uintptr_t *>> arg_table_;
   bool use_physical_addr_ = false;
+  // whether args_ are written to all tasks, after which only the changed args need to be patched
+  bool args_patched_ = false;
 };
 
 class DynamicSingleOp {
@@ -61,18 +70,32 @@ class DynamicSingleOp {
   Status ExecuteAsync(const vector<GeTensorDesc> &input_desc, const std::vector<DataBuffer> &inputs,
                       std::vector<GeTensorDesc> &output_desc, std::vector<DataBuffer> &outputs);
 
+  void GetCacheStats(DynamicSingleOpCacheStats &stats) const;
+  void SetCacheCapacity(size_t capacity);
+
  private:
   friend class SingleOpModel;
   Status ValidateParams(const vector<GeTensorDesc> &input_desc, const std::vector<DataBuffer> &inputs,
                         std::vector<GeTensorDesc> &output_desc, std::vector<DataBuffer> &outputs) const;
 
-  Status AllocateWorkspaces(const std::vector<int64_t> &workspace_sizes, std::vector<void *> &workspaces);
+  Status GetRunInfo(const vector<GeTensorDesc> &input_desc, const vector<GeTensorDesc> &output_desc,
+                    const RunInfoCacheEntry *&run_info);
+
+  static Status CalcWorkspaceOffsets(RunInfoCacheEntry &run_info);
+
+  Status AllocateWorkspaces(const RunInfoCacheEntry &run_info, std::vector<void *> &workspaces);
 
   std::unique_ptr<TbeOpTask> op_task_;
   uintptr_t resource_id_ = 0;
   rtStream_t stream_ = nullptr;
+  // the op is owned by the resource, so the resource outlives it
+  StreamResource *stream_resource_ = nullptr;
   size_t num_inputs_ = 0;
   size_t num_outputs_ = 0;
+  RunInfoCache run_info_cache_;
+  // run info of the last execution which missed the cache, used when the cache is disabled
+  RunInfoCacheEntry last_run_info_;
+  std::string cache_key_;
 };
 }  // namespace ge
 #endif  // GE_SINGLE_OP_SINGLE_OP_H_
@@ -20,10 +20,54 @@
 #include <string>
 
 namespace ge {
+namespace {
+// resource ids are addresses of streams or contexts, whose low bits are mostly the same
+const uint32_t kResourceIdShiftBits = 4;
+const uint32_t kResourceIdMixBits = 12;
+
+struct OpCacheKey {
+  uintptr_t resource_id;
+  const void *model_data;
+
+  bool operator==(const OpCacheKey &other) const {
+    return (resource_id == other.resource_id) && (model_data == other.model_data);
+  }
+};
+
+struct OpCacheKeyHash {
+  size_t operator()(const OpCacheKey &key) const {
+    return std::hash<uintptr_t>()(key.resource_id) ^ (std::hash<const void *>()(key.model_data) << 1);
+  }
+};
+
+///
+/// @brief Ops got by a thread, which are found again without any lock. Ops live as long as their resource, so the
+///        cache is dropped once any resource is released
+///
+struct ThreadOpCache {
+  uint64_t epoch = 0;
+  std::unordered_map<OpCacheKey, SingleOp *, OpCacheKeyHash> ops;
+  std::unordered_map<OpCacheKey, DynamicSingleOp *, OpCacheKeyHash> dynamic_ops;
+};
+
+ThreadOpCache &GetThreadOpCache(uint64_t epoch) {
+  thread_local ThreadOpCache cache;
+  if (cache.epoch != epoch) {
+    GELOGD("Resource released, drop %zu ops cached by thread", cache.ops.size() + cache.dynamic_ops.size());
+    cache.ops.clear();
+    cache.dynamic_ops.clear();
+    cache.epoch = epoch;
+  }
+  return cache;
+}
+}  // namespace
+
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY SingleOpManager::~SingleOpManager() {
-  for (auto &it : stream_resources_) {
-    delete it.second;
-    it.second = nullptr;
+  for (auto &shard : shards_) {
+    for (auto &it : shard.stream_resources) {
+      delete it.second;
+      it.second = nullptr;
+    }
   }
 }
 
@@ -39,16 +83,27 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status SingleOpManager::GetOpFr
 
   uintptr_t resource_id = 0;
   GE_CHK_STATUS_RET(GetResourceId(stream, resource_id));
-  StreamResource *res = GetResource(resource_id, stream);
+  auto &thread_cache = GetThreadOpCache(release_epoch_.load(std::memory_order_acquire));
+  OpCacheKey cache_key = {resource_id, model_data.model_data};
+  auto cached = thread_cache.ops.find(cache_key);
+  if (cached != thread_cache.ops.end()) {
+    GELOGD("Got operator from thread cache");
+    *single_op = cached->second;
+    return SUCCESS;
+  }
+
+  // ops of the same stream are looked up and built one at a time, so that an op is never built twice
+  std::unique_lock<std::mutex> resource_lock;
+  StreamResource *res = GetLockedResource(resource_id, stream, resource_lock);
   if (res == nullptr) {
     GELOGE(MEMALLOC_FAILED, "GetResource failed");
     return MEMALLOC_FAILED;
   }
-
   SingleOp *op = res->GetOperator(model_data.model_data);
   if (op != nullptr) {
     GELOGD("Got operator from stream cache");
     *single_op = op;
+    thread_cache.ops[cache_key] = op;
     return SUCCESS;
   }
 
@@ -72,32 +127,45 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status SingleOpManager::GetOpFr
   new_op->SetStream(stream);
   *single_op = new_op.get();
   res->CacheOperator(model_data.model_data, std::move(new_op));
+  thread_cache.ops[cache_key] = *single_op;
   return SUCCESS;
 }
 
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status SingleOpManager::ReleaseResource(void *stream) {
   auto resource_id = reinterpret_cast<uintptr_t>(stream);
   GELOGI("ReleaseResource in. resource id = 0x%lx", static_cast<uint64_t>(resource_id));
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = stream_resources_.find(resource_id);
-  if (it == stream_resources_.end()) {
+  auto &shard = GetShard(resource_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.stream_resources.find(resource_id);
+  if (it == shard.stream_resources.end()) {
     return SUCCESS;
   }
-  delete it->second;
-  it->second = nullptr;
-  (void)stream_resources_.erase(it);
+  // invalidate ops cached by threads before they are destroyed
+  (void)release_epoch_.fetch_add(1, std::memory_order_acq_rel);
+  StreamResource *res = it->second;
+  (void)shard.stream_resources.erase(it);
+  {
+    // wait for the op being built on the resource, no one else can find the resource under the shard lock
+    std::lock_guard<std::mutex> resource_lock(res->GetMutex());
+  }
+  delete res;
   return SUCCESS;
 }
 
-StreamResource *SingleOpManager::GetResource(uintptr_t resource_id, rtStream_t stream) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = stream_resources_.find(resource_id);
+SingleOpManager::ResourceShard &SingleOpManager::GetShard(uintptr_t resource_id) {
+  auto index = ((resource_id >> kResourceIdShiftBits) ^ (resource_id >> kResourceIdMixBits)) % kResourceShardNum;
+  return shards_[index];
+}
+
+StreamResource *SingleOpManager::FindOrCreateResource(ResourceShard &shard, uintptr_t resource_id,
+                                                      rtStream_t stream) {
+  auto it = shard.stream_resources.find(resource_id);
   StreamResource *res = nullptr;
-  if (it == stream_resources_.end()) {
+  if (it == shard.stream_resources.end()) {
     res = new (std::nothrow) StreamResource();
     if (res != nullptr) {
       res->SetStream(stream);
-      stream_resources_.emplace(resource_id, res);
+      shard.stream_resources.emplace(resource_id, res);
     }
   } else {
     res = it->second;
@@ -106,10 +174,28 @@ StreamResource *SingleOpManager::GetResource(uintptr_t resource_id, rtStream_t s
   return res;
 }
 
+StreamResource *SingleOpManager::GetResource(uintptr_t resource_id, rtStream_t stream) {
+  auto &shard = GetShard(resource_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return FindOrCreateResource(shard, resource_id, stream);
+}
+
+StreamResource *SingleOpManager::GetLockedResource(uintptr_t resource_id, rtStream_t stream,
+                                                   std::unique_lock<std::mutex> &resource_lock) {
+  auto &shard = GetShard(resource_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  StreamResource *res = FindOrCreateResource(shard, resource_id, stream);
+  if (res != nullptr) {
+    resource_lock = std::unique_lock<std::mutex>(res->GetMutex());
+  }
+  return res;
+}
+
 StreamResource *SingleOpManager::TryGetResource(uintptr_t resource_id) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = stream_resources_.find(resource_id);
-  if (it == stream_resources_.end()) {
+  auto &shard = GetShard(resource_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.stream_resources.find(resource_id);
+  if (it == shard.stream_resources.end()) {
     return nullptr;
   }
 
@@ -121,16 +207,26 @@ Status SingleOpManager::GetDynamicOpFromModel(const string &model_name, const Mo
   GE_CHECK_NOTNULL(single_op);
   uintptr_t resource_id = 0;
   GE_CHK_STATUS_RET(GetResourceId(stream, resource_id));
-  StreamResource *res = GetResource(resource_id, stream);
+  auto &thread_cache = GetThreadOpCache(release_epoch_.load(std::memory_order_acquire));
+  OpCacheKey cache_key = {resource_id, model_data.model_data};
+  auto cached = thread_cache.dynamic_ops.find(cache_key);
+  if (cached != thread_cache.dynamic_ops.end()) {
+    GELOGD("Got operator from thread cache");
+    *single_op = cached->second;
+    return SUCCESS;
+  }
+
+  std::unique_lock<std::mutex> resource_lock;
+  StreamResource *res = GetLockedResource(resource_id, stream, resource_lock);
   if (res == nullptr) {
     GELOGE(MEMALLOC_FAILED, "GetResource failed");
     return MEMALLOC_FAILED;
   }
-
   DynamicSingleOp *op = res->GetDynamicOperator(model_data.model_data);
   if (op != nullptr) {
     GELOGD("Got operator from stream cache");
     *single_op = op;
+    thread_cache.dynamic_ops[cache_key] = op;
     return SUCCESS;
   }
 
@@ -152,6 +248,7 @@ Status SingleOpManager::GetDynamicOpFromModel(const string &model_name, const Mo
   GE_CHK_STATUS_RET(model.BuildDynamicOp(*new_op), "Build op failed. op = %s, ret = %u", model_name.c_str(), ret);
   *single_op = new_op.get();
   res->CacheDynamicOperator(model_data.model_data, std::move(new_op));
+  thread_cache.dynamic_ops[cache_key] = *single_op;
   return SUCCESS;
 }
 
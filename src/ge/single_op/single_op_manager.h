@@ -17,6 +17,7 @@
 #ifndef GE_SINGLE_OP_SINGLE_OP_MANAGER_H_
 #define GE_SINGLE_OP_SINGLE_OP_MANAGER_H_
 
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 #include <string>
@@ -47,13 +48,32 @@ class SingleOpManager {
   void RegisterTilingFunc();
 
  private:
+  // resources are spread over shards by resource id, so that threads using different streams rarely contend
+  static const size_t kResourceShardNum = 16;
+
+  struct ResourceShard {
+    std::mutex mutex;
+    std::unordered_map<uintptr_t, StreamResource *> stream_resources;
+  };
+
   static Status GetResourceId(rtStream_t stream, uintptr_t &resource_id);
 
+  ResourceShard &GetShard(uintptr_t resource_id);
+
   StreamResource *TryGetResource(uintptr_t resource_id);
 
+  // the shard lock must be held
+  static StreamResource *FindOrCreateResource(ResourceShard &shard, uintptr_t resource_id, rtStream_t stream);
+
+  // the resource mutex is locked before the shard lock is dropped, so that the resource can not be released meanwhile
+  StreamResource *GetLockedResource(uintptr_t resource_id, rtStream_t stream,
+                                    std::unique_lock<std::mutex> &resource_lock);
+
   std::mutex mutex_;
-  bool tiling_func_registered_ = false;
-  std::unordered_map<uintptr_t, StreamResource *> stream_resources_;
+  std::atomic<bool> tiling_func_registered_{false};
+  ResourceShard shards_[kResourceShardNum];
+  // increased on each release of resource, upon which the per thread caches of ops are dropped
+  std::atomic<uint64_t> release_epoch_{0};
   OpTilingManager op_tiling_manager_;
 };
 }  // namespace ge
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "single_op/single_op_plan.h"
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/util.h"
+
+namespace ge {
+Status SingleOpPlan::GetEntryArgs(SingleOp *op, const std::vector<DataBuffer> &inputs,
+                                  const std::vector<DataBuffer> &outputs, std::vector<uintptr_t> &args) {
+  GE_CHECK_NOTNULL(op);
+  GE_CHK_STATUS_RET_NOLOG(op->ValidateArgs(inputs, outputs));
+  args.clear();
+  args.reserve(inputs.size() + outputs.size());
+  for (auto &input : inputs) {
+    args.emplace_back(reinterpret_cast<uintptr_t>(input.data));
+  }
+  for (auto &output : outputs) {
+    args.emplace_back(reinterpret_cast<uintptr_t>(output.data));
+  }
+  if (args.size() != op->args_.size()) {
+    GELOGE(PARAM_INVALID, "Args num mismatch. model expect %zu, but given %zu", op->args_.size(), args.size());
+    return PARAM_INVALID;
+  }
+  return SUCCESS;
+}
+
+Status SingleOpPlan::Capture(SingleOp *op, const std::vector<DataBuffer> &inputs,
+                             const std::vector<DataBuffer> &outputs) {
+  PlanEntry entry = {op, {}};
+  GE_CHK_STATUS_RET(GetEntryArgs(op, inputs, outputs, entry.args), "Capture op[%zu] failed.", entries_.size());
+  entries_.emplace_back(std::move(entry));
+  return SUCCESS;
+}
+
+Status SingleOpPlan::Rebind(size_t index, const std::vector<DataBuffer> &inputs,
+                            const std::vector<DataBuffer> &outputs) {
+  if (index >= entries_.size()) {
+    GELOGE(PARAM_INVALID, "Op index %zu is out of range, %zu ops are captured.", index, entries_.size());
+    return PARAM_INVALID;
+  }
+  std::vector<uintptr_t> args;
+  GE_CHK_STATUS_RET(GetEntryArgs(entries_[index].op, inputs, outputs, args), "Rebind op[%zu] failed.", index);
+  entries_[index].args.swap(args);
+  return SUCCESS;
+}
+
+Status SingleOpPlan::Replay() {
+  GELOGD("Replay single op plan, op num = %zu", entries_.size());
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    PlanEntry &entry = entries_[i];
+    GE_CHK_STATUS_RET(entry.op->PatchArgs(entry.args), "Patch args of op[%zu] failed.", i);
+    GE_CHK_STATUS_RET(entry.op->LaunchTasks(), "Launch op[%zu] failed.", i);
+  }
+  return SUCCESS;
+}
+}  // namespace ge
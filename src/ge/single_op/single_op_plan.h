@@ -0,0 +1,78 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_SINGLE_OP_SINGLE_OP_PLAN_H_
+#define GE_SINGLE_OP_SINGLE_OP_PLAN_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "common/ge_inner_error_codes.h"
+#include "framework/executor/ge_executor.h"
+#include "single_op/single_op.h"
+
+namespace ge {
+///
+/// @brief Captured sequence of static single op launches with their buffer bindings. Bindings are validated when
+///        they are captured or rebound, and replay launches the ops back-to-back, patching only the addresses which
+///        differ from the last launch of each op. Not thread safe, and the ops must outlive the plan.
+///
+class SingleOpPlan {
+ public:
+  SingleOpPlan() = default;
+  ~SingleOpPlan() = default;
+  SingleOpPlan(const SingleOpPlan &) = delete;
+  SingleOpPlan &operator=(const SingleOpPlan &) = delete;
+
+  ///
+  /// @brief Append a launch of op with buffers to the plan
+  /// @param [in] op
+  /// @param [in] inputs
+  /// @param [in] outputs
+  /// @return Status
+  ///
+  Status Capture(SingleOp *op, const std::vector<DataBuffer> &inputs, const std::vector<DataBuffer> &outputs);
+
+  ///
+  /// @brief Change buffers of the index-th captured launch
+  /// @param [in] index
+  /// @param [in] inputs
+  /// @param [in] outputs
+  /// @return Status
+  ///
+  Status Rebind(size_t index, const std::vector<DataBuffer> &inputs, const std::vector<DataBuffer> &outputs);
+
+  ///
+  /// @brief Launch all captured ops in order
+  /// @return Status
+  ///
+  Status Replay();
+
+  size_t GetOpNum() const { return entries_.size(); }
+
+ private:
+  struct PlanEntry {
+    SingleOp *op;
+    std::vector<uintptr_t> args;
+  };
+
+  static Status GetEntryArgs(SingleOp *op, const std::vector<DataBuffer> &inputs,
+                             const std::vector<DataBuffer> &outputs, std::vector<uintptr_t> &args);
+
+  std::vector<PlanEntry> entries_;
+};
+}  // namespace ge
+#endif  // GE_SINGLE_OP_SINGLE_OP_PLAN_H_
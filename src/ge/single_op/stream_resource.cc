@@ -36,6 +36,13 @@ StreamResource::~StreamResource() {
       GE_IF_BOOL_EXEC(rt_ret != RT_ERROR_NONE, GELOGE(RT_FAILED, "rtFree failed"));
     }
   }
+
+  for (auto workspace : workspace_list_) {
+    if (workspace != nullptr) {
+      auto rt_ret = rtFree(workspace);
+      GE_IF_BOOL_EXEC(rt_ret != RT_ERROR_NONE, GELOGE(RT_FAILED, "rtFree failed"));
+    }
+  }
 }
 
 void StreamResource::CacheOperator(const void *key, std::unique_ptr<SingleOp> &&single_op) {
@@ -120,4 +127,10 @@ uint8_t *StreamResource::MallocWeight(const std::string &purpose, size_t size) {
   uint8_t *buffer = DoMallocMemory(purpose, size, max_weight_size_, weight_list_);
   return buffer;
 }
+
+uint8_t *StreamResource::MallocWorkspace(const std::string &purpose, size_t size) {
+  GELOGD("To Malloc workspace, size = %zu", size);
+  uint8_t *buffer = DoMallocMemory(purpose, size, max_workspace_size_, workspace_list_);
+  return buffer;
+}
 }  // namespace ge
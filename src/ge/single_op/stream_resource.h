@@ -19,6 +19,7 @@
 
 #include <string>
 #include <cstdint>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 
@@ -40,12 +41,16 @@ class StreamResource {
   void CacheOperator(const void *key, std::unique_ptr<SingleOp> &&single_op);
   void CacheDynamicOperator(const void *key, std::unique_ptr<DynamicSingleOp> &&single_op);
   void SetStream(rtStream_t stream);
+  // guards the ops and memory of the resource while ops are built
+  std::mutex &GetMutex() { return mutex_; }
 
   SingleOp *GetOperator(const void *key);
   DynamicSingleOp *GetDynamicOperator(const void *key);
 
   uint8_t *MallocMemory(const std::string &purpose, size_t size);
   uint8_t *MallocWeight(const std::string &purpose, size_t size);
+  // workspace of dynamic ops is kept apart from the memory of static ops, since growing it frees the old block
+  uint8_t *MallocWorkspace(const std::string &purpose, size_t size);
 
  private:
   uint8_t *DoMallocMemory(const std::string &purpose, size_t size, size_t &max_allocated,
@@ -53,11 +58,14 @@ class StreamResource {
 
   size_t max_memory_size_ = 0;
   size_t max_weight_size_ = 0;
+  size_t max_workspace_size_ = 0;
   std::vector<uint8_t *> memory_list_;
   std::vector<uint8_t *> weight_list_;
+  std::vector<uint8_t *> workspace_list_;
   std::unordered_map<const void *, std::unique_ptr<SingleOp>> op_map_;
   std::unordered_map<const void *, std::unique_ptr<DynamicSingleOp>> dynamic_op_map_;
   rtStream_t stream_ = nullptr;
+  std::mutex mutex_;
 };
 }  // namespace ge
 
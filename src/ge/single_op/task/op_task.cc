@@ -102,6 +102,13 @@ Status TbeOpTask::UpdateRunInfo(const vector<GeTensorDesc> &input_desc, const ve
   return SUCCESS;
 }
 
+void TbeOpTask::SetRunInfo(const std::string &tiling_data, uint32_t block_dim,
+                           const vector<int64_t> &workspace_sizes) {
+  SetWorkspaceSizes(workspace_sizes);
+  block_dim_ = block_dim;
+  tiling_data_ = tiling_data;
+}
+
 Status TbeOpTask::UpdateTensorDesc(const GeTensorDesc &src_tensor, GeTensorDesc &dst_tensor) {
   int64_t storage_format_val = static_cast<Format>(FORMAT_RESERVED);
   (void)AttrUtils::GetInt(src_tensor, ge::ATTR_NAME_STORAGE_FORMAT, storage_format_val);
@@ -66,6 +66,10 @@ class TbeOpTask : public OpTask {
   void SetKernelArgs(std::unique_ptr<uint8_t[]> &&args, size_t arg_size, uint32_t block_dim);
 
   Status UpdateRunInfo(const vector<GeTensorDesc> &input_desc, const vector<GeTensorDesc> &output_desc) override;
+  // restore run info got from a previous UpdateRunInfo, without invoking tiling
+  void SetRunInfo(const std::string &tiling_data, uint32_t block_dim, const vector<int64_t> &workspace_sizes);
+  const std::string &GetTilingData() const { return tiling_data_; }
+  uint32_t GetBlockDim() const { return block_dim_; }
 
   Status LaunchKernel(const vector<void *> &inputs, const vector<void *> &outputs, const vector<void *> &workspaces,
                       rtStream_t stream) override;
@@ -0,0 +1,107 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "graph/utils/graph_utils.h"
+#include "utils/async_graph_dumper.h"
+
+using namespace std;
+using namespace ge;
+
+namespace {
+const size_t kDumpWorkerNum = 2;
+const size_t kMaxPendingDumpNum = 16;
+
+AsyncGraphDumper::DumpTask CreateTask(const string &graph_key, const function<void()> &write) {
+  AsyncGraphDumper::DumpTask task;
+  task.graph_key = graph_key;
+  task.file_name = graph_key + ".txt";
+  task.write = write;
+  return task;
+}
+}  // namespace
+
+class UtestAsyncGraphDumper : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestAsyncGraphDumper, write_in_background) {
+  auto &dumper = AsyncGraphDumper::Instance();
+  auto written_num = dumper.GetWrittenNum();
+  atomic<size_t> write_num(0);
+  for (size_t i = 0; i < kMaxPendingDumpNum; ++i) {
+    EXPECT_TRUE(dumper.Submit(CreateTask("graph_" + to_string(i), [&write_num]() { ++write_num; })));
+  }
+  GraphUtils::FlushGraphDump();
+  dumper.Flush();
+  EXPECT_EQ(write_num.load(), kMaxPendingDumpNum);
+  EXPECT_EQ(dumper.GetWrittenNum(), written_num + kMaxPendingDumpNum);
+}
+
+TEST_F(UtestAsyncGraphDumper, merge_or_drop_when_full) {
+  auto &dumper = AsyncGraphDumper::Instance();
+  auto written_num = dumper.GetWrittenNum();
+  auto merged_num = dumper.GetMergedNum();
+  auto dropped_num = dumper.GetDroppedNum();
+
+  // block all the workers, so that the following dumps are pending
+  atomic<bool> blocked(true);
+  atomic<size_t> running_num(0);
+  for (size_t i = 0; i < kDumpWorkerNum; ++i) {
+    EXPECT_TRUE(dumper.Submit(CreateTask("blocking_" + to_string(i), [&]() {
+      ++running_num;
+      while (blocked) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+      }
+    })));
+  }
+  while (running_num < kDumpWorkerNum) {
+    this_thread::sleep_for(chrono::milliseconds(1));
+  }
+
+  atomic<size_t> write_num(0);
+  atomic<bool> old_written(false);
+  atomic<bool> new_written(false);
+  for (size_t i = 0; i < kMaxPendingDumpNum; ++i) {
+    EXPECT_TRUE(dumper.Submit(CreateTask("graph_" + to_string(i), [&, i]() {
+      ++write_num;
+      old_written = old_written || (i == 1);
+    })));
+  }
+  // replaces the pending dump of the same graph
+  EXPECT_TRUE(dumper.Submit(CreateTask("graph_1", [&]() {
+    ++write_num;
+    new_written = true;
+  })));
+  EXPECT_FALSE(dumper.Submit(CreateTask("graph_new", [&]() { ++write_num; })));
+
+  blocked = false;
+  dumper.Flush();
+  EXPECT_EQ(write_num.load(), kMaxPendingDumpNum);
+  EXPECT_FALSE(old_written);
+  EXPECT_TRUE(new_written);
+  EXPECT_EQ(dumper.GetWrittenNum(), written_num + kDumpWorkerNum + kMaxPendingDumpNum);
+  EXPECT_EQ(dumper.GetMergedNum(), merged_num + 1);
+  EXPECT_EQ(dumper.GetDroppedNum(), dropped_num + 1);
+}
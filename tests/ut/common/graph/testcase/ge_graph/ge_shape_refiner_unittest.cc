@@ -0,0 +1,183 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <unordered_map>
+
+#include "graph/debug/ge_attr_define.h"
+#include "graph/operator_factory_impl.h"
+#include "graph/shape_refiner.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/op_desc_utils.h"
+#include "graph_builder_utils.h"
+
+using namespace std;
+using namespace ge;
+
+namespace {
+const char *const kCopyShapeType = "UtestCopyShape";
+const char *const kNoInferFuncType = "UtestNoInferFunc";
+
+// output 0 gets the shape of input 0
+graphStatus CopyShapeInferFunc(Operator &op) {
+  auto op_desc = OpDescUtils::GetOpDescFromOperator(op);
+  auto output_desc = op_desc->MutableOutputDesc(0);
+  output_desc->SetShape(op_desc->GetInputDesc(0).GetShape());
+  return GRAPH_SUCCESS;
+}
+
+///
+///  data0    data1
+///    |  \     |
+///    a   \    b
+///    |    \  /
+///    c     d
+///     \   /
+///       e
+///
+ComputeGraphPtr BuildDiamondGraph() {
+  ut::GraphBuilder builder("diamond");
+  auto data0 = builder.AddNode("data0", "Data", 0, 1);
+  auto data1 = builder.AddNode("data1", "Data", 0, 1);
+  auto a = builder.AddNode("a", kCopyShapeType, 1, 1);
+  auto b = builder.AddNode("b", kCopyShapeType, 1, 1);
+  auto c = builder.AddNode("c", kCopyShapeType, 1, 1);
+  auto d = builder.AddNode("d", kCopyShapeType, 2, 1);
+  auto e = builder.AddNode("e", kCopyShapeType, 2, 1);
+  builder.AddDataEdge(data0, 0, a, 0);
+  builder.AddDataEdge(data1, 0, b, 0);
+  builder.AddDataEdge(a, 0, c, 0);
+  builder.AddDataEdge(data0, 0, d, 0);
+  builder.AddDataEdge(b, 0, d, 1);
+  builder.AddDataEdge(c, 0, e, 0);
+  builder.AddDataEdge(d, 0, e, 1);
+  builder.AddControlEdge(b, c);
+  return builder.GetGraph();
+}
+}  // namespace
+
+class UtestShapeRefiner : public testing::Test {
+ protected:
+  void SetUp() { (void)OperatorFactoryImpl::RegisterInferShapeFunc(kCopyShapeType, CopyShapeInferFunc); }
+
+  void TearDown() {}
+};
+
+TEST_F(UtestShapeRefiner, infer_nodes_in_dependency_order) {
+  auto graph = BuildDiamondGraph();
+  vector<NodePtr> nodes;
+  for (const auto &node : graph->GetDirectNode()) {
+    nodes.emplace_back(node);
+  }
+
+  for (uint32_t thread_num : {1, 4}) {
+    mutex mu;
+    unordered_map<const Node *, size_t> finish_order;
+    auto ret = ShapeInferenceSession::InferNodes(nodes, thread_num, [&](const NodePtr &node) {
+      lock_guard<mutex> lk(mu);
+      finish_order[node.get()] = finish_order.size();
+      return GRAPH_SUCCESS;
+    });
+    ASSERT_EQ(ret, GRAPH_SUCCESS);
+    ASSERT_EQ(finish_order.size(), nodes.size());
+    for (const auto &node : nodes) {
+      for (const auto &in_node : node->GetInAllNodes()) {
+        EXPECT_LT(finish_order[in_node.get()], finish_order[node.get()]) << node->GetName();
+      }
+    }
+  }
+}
+
+TEST_F(UtestShapeRefiner, infer_nodes_stop_after_failure) {
+  auto graph = BuildDiamondGraph();
+  vector<NodePtr> nodes;
+  for (const auto &node : graph->GetDirectNode()) {
+    nodes.emplace_back(node);
+  }
+
+  atomic<size_t> run_num(0);
+  atomic<bool> e_run(false);
+  auto ret = ShapeInferenceSession::InferNodes(nodes, 4, [&](const NodePtr &node) {
+    ++run_num;
+    if (node->GetName() == "e") {
+      e_run = true;
+    }
+    return (node->GetName() == "d") ? GRAPH_PARAM_INVALID : GRAPH_SUCCESS;
+  });
+  EXPECT_EQ(ret, GRAPH_PARAM_INVALID);
+  EXPECT_FALSE(e_run);
+  EXPECT_LT(run_num.load(), nodes.size());
+}
+
+TEST_F(UtestShapeRefiner, session_contexts) {
+  auto graph = BuildDiamondGraph();
+  auto node = graph->FindNode("a");
+  ShapeInferenceSession session;
+  ShapeInferenceSession other_session;
+  EXPECT_EQ(session.GetContext(node), nullptr);
+
+  InferenceContextPtr context(InferenceContext::Create());
+  session.SetContext(node, context);
+  EXPECT_EQ(session.GetContext(node), context);
+  EXPECT_EQ(other_session.GetContext(node), nullptr);
+
+  session.Clear();
+  EXPECT_EQ(session.GetContext(node), nullptr);
+}
+
+TEST_F(UtestShapeRefiner, infer_shape_in_need_parallel) {
+  auto graph = BuildDiamondGraph();
+  for (const auto &node : graph->GetDirectNode()) {
+    if (node->GetType() != "Data") {
+      (void)AttrUtils::SetBool(node->GetOpDesc(), NEED_INFER, true);
+    }
+  }
+  graph->FindNode("a")->GetOpDesc()->MutableInputDesc(0)->SetShape(GeShape({8, 16}));
+  EXPECT_EQ(graph->InferShapeInNeed(4), GRAPH_SUCCESS);
+  EXPECT_EQ(graph->FindNode("e")->GetOpDesc()->GetOutputDesc(0).GetShape().GetDims(), vector<int64_t>({8, 16}));
+  EXPECT_EQ(graph->FindNode("e")->GetOpDesc()->GetInputDesc(0).GetShape().GetDims(), vector<int64_t>({8, 16}));
+}
+
+TEST_F(UtestShapeRefiner, infer_shape_in_need_parallel_stops_as_serial) {
+  const int kLoopNum = 10;
+  for (int loop = 0; loop < kLoopNum; ++loop) {
+    ComputeGraphPtr graphs[] = {BuildDiamondGraph(), BuildDiamondGraph()};
+    for (const auto &graph : graphs) {
+      for (const auto &node : graph->GetDirectNode()) {
+        if (node->GetType() != "Data") {
+          (void)AttrUtils::SetBool(node->GetOpDesc(), NEED_INFER, true);
+        }
+      }
+      graph->FindNode("c")->GetOpDesc()->SetType(kNoInferFuncType);
+      graph->FindNode("a")->GetOpDesc()->MutableInputDesc(0)->SetShape(GeShape({8, 16}));
+      graph->FindNode("d")->GetOpDesc()->MutableInputDesc(0)->SetShape(GeShape({4}));
+      graph->FindNode("e")->GetOpDesc()->MutableOutputDesc(0)->SetShape(GeShape({7}));
+    }
+    EXPECT_EQ(graphs[0]->InferShapeInNeed(), GRAPH_SUCCESS);
+    EXPECT_EQ(graphs[1]->InferShapeInNeed(4), GRAPH_SUCCESS);
+    // nodes after the op without infer func are not inferred, whichever branch they are on
+    EXPECT_EQ(graphs[1]->FindNode("a")->GetOpDesc()->GetOutputDesc(0).GetShape().GetDims(), vector<int64_t>({8, 16}));
+    EXPECT_EQ(graphs[1]->FindNode("e")->GetOpDesc()->GetOutputDesc(0).GetShape().GetDims(), vector<int64_t>({7}));
+    for (const auto &node : graphs[0]->GetDirectNode()) {
+      auto parallel_node = graphs[1]->FindNode(node->GetName());
+      ASSERT_NE(parallel_node, nullptr);
+      EXPECT_EQ(node->GetOpDesc()->GetOutputDesc(0).GetShape().GetDims(),
+                parallel_node->GetOpDesc()->GetOutputDesc(0).GetShape().GetDims())
+        << node->GetName();
+    }
+  }
+}
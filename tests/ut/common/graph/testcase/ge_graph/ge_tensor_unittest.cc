@@ -23,7 +23,9 @@
 #include "graph/ge_tensor.h"
 
 #include "graph/ge_attr_value.h"
+#include "graph/op_desc.h"
 #include "graph/tensor.h"
+#include "graph/utils/attr_utils.h"
 #include "graph/utils/tensor_utils.h"
 #undef private
 #undef protected
@@ -376,3 +378,80 @@ TEST_F(UtestGeTensor, test_tensor_invalid) {
   Tensor tensor6(tensor_desc6, &data6, 1);
   EXPECT_EQ(tensor6.IsValid(), GRAPH_FAILED);
 }
+
+TEST_F(UtestGeTensor, test_tensor_zero_copy_data) {
+  GeTensor tensor(GeTensorDesc(GeShape({4}), FORMAT_ND, DT_UINT8));
+  std::vector<uint8_t> data{1, 2, 3, 4};
+  const uint8_t *raw = data.data();
+  EXPECT_EQ(tensor.SetData(std::move(data)), GRAPH_SUCCESS);
+  EXPECT_TRUE(tensor.IsExternalData());
+  EXPECT_EQ(tensor.GetData().GetData(), raw);
+
+  // copies share the storage, clone and attributes own a materialized copy
+  GeTensor tensor_copy = tensor;
+  EXPECT_EQ(tensor_copy.GetData().GetData(), raw);
+  GeTensor tensor_clone = tensor.Clone();
+  EXPECT_FALSE(tensor_clone.IsExternalData());
+  EXPECT_EQ(tensor_clone.GetData()[3], 4);
+
+  auto op_desc = std::make_shared<OpDesc>("const", "Const");
+  EXPECT_TRUE(AttrUtils::SetTensor(op_desc, "value", tensor));
+  ConstGeTensorPtr attr_tensor;
+  EXPECT_TRUE(AttrUtils::GetTensor(op_desc, "value", attr_tensor));
+  EXPECT_FALSE(attr_tensor->IsExternalData());
+  EXPECT_EQ(attr_tensor->GetData().size(), 4);
+  EXPECT_EQ(attr_tensor->GetData()[2], 3);
+
+  // tensors viewing attributes fall back to copying
+  GeTensorPtr mutable_tensor;
+  EXPECT_TRUE(AttrUtils::MutableTensor(op_desc, "value", mutable_tensor));
+  EXPECT_EQ(mutable_tensor->SetData(std::vector<uint8_t>{5, 6, 7}), GRAPH_SUCCESS);
+  EXPECT_FALSE(mutable_tensor->IsExternalData());
+  EXPECT_TRUE(AttrUtils::GetTensor(op_desc, "value", attr_tensor));
+  EXPECT_EQ(attr_tensor->GetData().size(), 3);
+}
+
+TEST_F(UtestGeTensor, test_tensor_aligned_ptr) {
+  auto aligned_ptr = AlignedPtr::Allocate(100);
+  ASSERT_NE(aligned_ptr, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned_ptr->Get()) % AlignedPtr::kDefaultAlignment, 0);
+
+  GeTensor tensor;
+  EXPECT_EQ(tensor.SetData(aligned_ptr, 10, 20), GRAPH_SUCCESS);
+  EXPECT_EQ(tensor.GetData().GetData(), aligned_ptr->Get() + 10);
+  EXPECT_EQ(tensor.GetData().size(), 20);
+  EXPECT_EQ(tensor.SetData(aligned_ptr, 90, 20), GRAPH_PARAM_INVALID);
+
+  std::vector<uint8_t> data{9, 9};
+  EXPECT_EQ(tensor.SetData(data), GRAPH_SUCCESS);
+  EXPECT_FALSE(tensor.IsExternalData());
+  EXPECT_EQ(tensor.GetData().size(), 2);
+}
+
+TEST_F(UtestGeTensor, test_tensor_copy_or_share_buffer) {
+  auto aligned_ptr = AlignedPtr::Allocate(8);
+  ASSERT_NE(aligned_ptr, nullptr);
+  GeTensor src;
+  EXPECT_EQ(src.SetData(aligned_ptr, 0, 8), GRAPH_SUCCESS);
+
+  // SetData and the constructor copy the buffer even if it is in external storage
+  GeTensor copied;
+  EXPECT_EQ(copied.SetData(src.GetData()), GRAPH_SUCCESS);
+  EXPECT_FALSE(copied.IsExternalData());
+  EXPECT_NE(copied.GetData().GetData(), aligned_ptr->Get());
+  GeTensor constructed(GeTensorDesc(), src.GetData());
+  EXPECT_FALSE(constructed.IsExternalData());
+  EXPECT_NE(constructed.GetData().GetData(), aligned_ptr->Get());
+
+  GeTensor shared;
+  EXPECT_EQ(shared.ShareData(src.GetData()), GRAPH_SUCCESS);
+  EXPECT_TRUE(shared.IsExternalData());
+  EXPECT_EQ(shared.GetData().GetData(), aligned_ptr->Get());
+  EXPECT_EQ(shared.GetData().size(), 8);
+
+  // buffers in proto messages can only be copied
+  GeTensor proto_tensor(GeTensorDesc(), std::vector<uint8_t>{1, 2});
+  EXPECT_EQ(shared.ShareData(proto_tensor.GetData()), GRAPH_SUCCESS);
+  EXPECT_FALSE(shared.IsExternalData());
+  EXPECT_EQ(shared.GetData()[1], 2);
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#define private public
+#include "common/debug/async_log_sink.h"
+#undef private
+
+using namespace std;
+using namespace ge;
+
+namespace {
+const size_t kThreadNum = 4;
+const size_t kLogNumPerThread = 10000;
+}  // namespace
+
+class UtestAsyncLogSink : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestAsyncLogSink, cached_log_level) {
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(IsLogEnable(GE, DLOG_INFO), CheckLogLevel(GE, DLOG_INFO) == 1);
+    EXPECT_EQ(IsLogEnable(GE, DLOG_DEBUG), CheckLogLevel(GE, DLOG_DEBUG) == 1);
+    RefreshLogLevel();
+  }
+  // out of the cached range
+  EXPECT_EQ(IsLogEnable(INVLID_MOUDLE_ID, DLOG_INFO), CheckLogLevel(INVLID_MOUDLE_ID, DLOG_INFO) == 1);
+  EXPECT_EQ(IsLogEnable(GE, DLOG_EVENT), CheckLogLevel(GE, DLOG_EVENT) == 1);
+}
+
+TEST_F(UtestAsyncLogSink, start_and_stop) {
+  EXPECT_EQ(GetLogState().sink.load(), nullptr);
+  ASSERT_EQ(AsyncLogSink::Instance().ForceStart(), SUCCESS);
+  ASSERT_EQ(AsyncLogSink::Instance().ForceStart(), SUCCESS);
+  EXPECT_TRUE(AsyncLogSink::Instance().IsRunning());
+  EXPECT_EQ(GetLogState().sink.load(), &AsyncLogSink::Write);
+
+  vector<thread> threads;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([i]() {
+      for (size_t j = 0; j < kLogNumPerThread; ++j) {
+        GELOGI("thread %zu writes log %zu.", i, j);
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  // stopped after the last Start is stopped
+  AsyncLogSink::Instance().Stop();
+  EXPECT_TRUE(AsyncLogSink::Instance().IsRunning());
+  AsyncLogSink::Instance().Stop();
+  EXPECT_FALSE(AsyncLogSink::Instance().IsRunning());
+  EXPECT_EQ(GetLogState().sink.load(), nullptr);
+  EXPECT_LE(AsyncLogSink::Instance().GetDroppedNum(), kThreadNum * kLogNumPerThread);
+
+  // nothing to stop
+  AsyncLogSink::Instance().Stop();
+  GELOGI("log is written by dlog after stopped.");
+}
+
+TEST_F(UtestAsyncLogSink, start_disabled_is_counted) {
+  unsetenv("GE_ASYNC_LOG");
+  // the sink is not started by GE_ASYNC_LOG, but the Start still needs a Stop
+  ASSERT_EQ(AsyncLogSink::Instance().Start(), SUCCESS);
+  EXPECT_FALSE(AsyncLogSink::Instance().IsRunning());
+  ASSERT_EQ(AsyncLogSink::Instance().ForceStart(), SUCCESS);
+  EXPECT_TRUE(AsyncLogSink::Instance().IsRunning());
+  AsyncLogSink::Instance().Stop();
+  EXPECT_TRUE(AsyncLogSink::Instance().IsRunning());
+  AsyncLogSink::Instance().Stop();
+  EXPECT_FALSE(AsyncLogSink::Instance().IsRunning());
+  EXPECT_EQ(GetLogState().sink.load(), nullptr);
+}
+
+TEST_F(UtestAsyncLogSink, flush_and_write_after_stopped) {
+  ASSERT_EQ(AsyncLogSink::Instance().ForceStart(), SUCCESS);
+  EXPECT_EQ(GetLogState().flush.load(), &AsyncLogSink::Flush);
+  for (size_t i = 0; i < kLogNumPerThread; ++i) {
+    GELOGI("log %zu is written before a warning.", i);
+  }
+  // the warning waits for the logs before it
+  uint64_t pos = AsyncLogSink::Instance().enqueue_pos_.load();
+  GELOGW("warning after %lu logs.", pos);
+  {
+    std::lock_guard<std::mutex> lock(AsyncLogSink::Instance().flush_mutex_);
+    EXPECT_GE(AsyncLogSink::Instance().flushed_pos_, pos);
+  }
+  AsyncLogSink::Instance().Stop();
+  EXPECT_EQ(GetLogState().flush.load(), nullptr);
+
+  // a writer which took the sink before it is stopped writes the log by dlog
+  pos = AsyncLogSink::Instance().enqueue_pos_.load();
+  AsyncLogSink::Write(GE, DLOG_INFO, "log %s.", "after stopped");
+  EXPECT_EQ(AsyncLogSink::Instance().enqueue_pos_.load(), pos);
+  AsyncLogSink::Flush();
+}
@@ -0,0 +1,73 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common/content_hash_index.h"
+
+namespace ge {
+class UtestContentHashIndex : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestContentHashIndex, content_hash_known_values) {
+  EXPECT_EQ(ContentHash("", 0), 0xEF46DB3751D8E999ULL);
+  EXPECT_EQ(ContentHash("abc", 3), 0x44BC2CF5AD770999ULL);
+}
+
+TEST_F(UtestContentHashIndex, content_hash_long_data) {
+  std::vector<uint8_t> data(1027);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i * 7);
+  }
+  auto hash = ContentHash(data.data(), data.size());
+  EXPECT_EQ(ContentHash(data.data(), data.size()), hash);
+  data[1026] ^= 1;
+  EXPECT_NE(ContentHash(data.data(), data.size()), hash);
+  EXPECT_NE(ContentHash(data.data(), data.size(), 1), ContentHash(data.data(), data.size()));
+}
+
+TEST_F(UtestContentHashIndex, find_or_insert) {
+  std::vector<float> data1(256, 1.0f);
+  std::vector<float> data2(256, 1.0f);
+  std::vector<float> data3(256, 2.0f);
+  size_t bytes = data1.size() * sizeof(float);
+
+  ContentHashIndex index;
+  size_t id = 0;
+  EXPECT_FALSE(index.FindOrInsert(data1.data(), bytes, {0, 256}, id));
+  id = 1;
+  EXPECT_TRUE(index.FindOrInsert(data2.data(), bytes, {0, 256}, id));
+  EXPECT_EQ(id, 0);
+  id = 2;
+  EXPECT_FALSE(index.FindOrInsert(data3.data(), bytes, {0, 256}, id));
+  EXPECT_EQ(id, 2);
+  id = 3;
+  EXPECT_FALSE(index.FindOrInsert(data2.data(), bytes, {0, 16, 16}, id));
+  id = 4;
+  EXPECT_FALSE(index.FindOrInsert(data2.data(), bytes / 2, {0, 256}, id));
+  EXPECT_EQ(index.Size(), 4);
+
+  index.Clear();
+  EXPECT_EQ(index.Size(), 0);
+  id = 5;
+  EXPECT_FALSE(index.FindOrInsert(data2.data(), bytes, {0, 256}, id));
+}
+}  // namespace ge
@@ -15,7 +15,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstring>
 #include <ctime>
+#include <vector>
 
 #include "common/formats/format_transfers/format_transfer_fractal_nz.h"
 
@@ -36,18 +38,40 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape1_uint8_1) {
   uint8_t data[1] = {
       176,
   };
-  uint8_t ret[1 * 1 * 32 * 32] = {
-      176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      0,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      0,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      0,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      0,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      0,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-      0,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  uint8_t ret[1 * 1 * 16 * 32] = {
+      176, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
   };
 
   FormatTransferFractalNz transfer;
-  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {1}, {1, 1, 32, 32}, DT_UINT8};
+  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {1}, {1, 1, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -56,7 +80,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape1_uint8_1) {
   }
 
   FormatTransferFractalNzND transfer2;
-  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {1, 1, 32, 32}, {1}, DT_UINT8};
+  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {1, 1, 16, 32}, {1}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -70,52 +94,40 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape1_uint8_2) {
       194, 182, 243, 9,   141, 3,  25,  168, 123, 253, 25, 2,  76, 207, 206, 214,
       212, 36,  10,  104, 185, 61, 195, 52,  187, 87,  54, 43, 87, 13,  67,  85,
   };
-  uint8_t ret[1 * 1 * 32 * 32] = {
-      194, 182, 243, 9,  141, 3,  25, 168, 123, 253, 25, 2, 76, 207, 206, 214, 212, 36, 10, 104, 185, 61, 195, 52, 187,
-      87,  54,  43,  87, 13,  67, 85, 0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,  0,
-      0,   0,   0,   0,  0,   0,  0,  0,   0,   0,   0,  0, 0,  0,   0,   0,   0,   0,  0,  0,   0,   0,  0,   0,
+  uint8_t ret[1 * 1 * 16 * 32] = {
+      194, 182, 243, 9,   141, 3,   25,  168, 123, 253, 25,  2,   76,  207, 206, 214, 212, 36,
+      10,  104, 185, 61,  195, 52,  187, 87,  54,  43,  87,  13,  67,  85,  0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
   };
 
   FormatTransferFractalNz transfer;
-  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {32}, {1, 1, 32, 32}, DT_UINT8};
+  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {32}, {1, 1, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -124,7 +136,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape1_uint8_2) {
   }
 
   FormatTransferFractalNzND transfer2;
-  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {1, 1, 32, 32}, {32}, DT_UINT8};
+  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {1, 1, 16, 32}, {32}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -138,93 +150,68 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape1_uint8_3) {
       173, 126, 65,  202, 177, 161, 81, 98, 165, 98,  206, 162, 209, 58,  160, 171, 124,
       99,  45,  160, 68,  125, 39,  2,  43, 36,  211, 200, 250, 63,  195, 121, 95,
   };
-  uint8_t ret[2 * 1 * 32 * 32] = {
-      173, 126, 65,  202, 177, 161, 81,  98, 165, 98, 206, 162, 209, 58, 160, 171, 124, 99, 45, 160, 68, 125, 39, 2, 43,
-      36,  211, 200, 250, 63,  195, 121, 0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 95,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,  0, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,  0,   0,  0,   0,   0,   0,  0,   0,   0,   0,  0,  0,   0,  0,   0,
+  uint8_t ret[2 * 1 * 16 * 32] = {
+      173, 126, 65,  202, 177, 161, 81,  98,  165, 98,  206, 162, 209, 58,  160, 171, 124, 99,
+      45,  160, 68,  125, 39,  2,   43,  36,  211, 200, 250, 63,  195, 121, 0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   95,  0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
   };
 
   FormatTransferFractalNz transfer;
-  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {33}, {2, 1, 32, 32}, DT_UINT8};
+  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {33}, {2, 1, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -233,7 +220,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape1_uint8_3) {
   }
 
   FormatTransferFractalNzND transfer2;
-  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 1, 32, 32}, {33}, DT_UINT8};
+  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 1, 16, 32}, {33}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -290,56 +277,68 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape2_uint8_1) {
       130, 116, 52,  230, 149, 30,  185, 119, 207, 99,  104, 228, 198, 52,  192, 69,  97,  237, 142, 19,  2,   194, 34,
       197, 4,   82,  50,  0,   101, 238, 37,  62,  153, 106, 183,
   };
-  uint8_t ret[1 * 1 * 32 * 32] = {
-      47,  78,  47,  180, 246, 76,  157, 127, 63,  0,   168, 23,  148, 198, 180, 190, 43,  187, 76,  67,  77,  246, 11,
-      149, 240, 236, 136, 123, 51,  95,  7,   163, 163, 64,  157, 230, 247, 122, 67,  106, 150, 20,  231, 118, 43,  208,
-      190, 201, 149, 180, 47,  223, 69,  51,  222, 2,   254, 161, 69,  17,  122, 79,  98,  85,  77,  97,  127, 144, 216,
-      217, 230, 175, 115, 121, 86,  110, 81,  37,  143, 189, 23,  63,  214, 235, 188, 193, 125, 236, 57,  76,  192, 144,
-      20,  2,   247, 153, 101, 114, 201, 218, 221, 62,  203, 222, 1,   229, 100, 223, 65,  62,  78,  210, 115, 149, 115,
-      171, 55,  186, 67,  16,  154, 252, 104, 6,   154, 142, 129, 223, 84,  221, 82,  202, 113, 167, 143, 136, 203, 237,
-      195, 40,  47,  228, 125, 49,  156, 201, 187, 96,  2,   120, 227, 239, 134, 105, 153, 232, 228, 42,  65,  11,  203,
-      79,  90,  240, 54,  131, 16,  30,  171, 98,  228, 61,  160, 117, 80,  38,  223, 25,  15,  227, 245, 11,  241, 195,
-      178, 250, 187, 220, 80,  77,  101, 21,  79,  194, 33,  95,  91,  165, 93,  74,  120, 124, 214, 92,  101, 181, 89,
-      79,  159, 229, 184, 133, 188, 200, 200, 97,  223, 92,  42,  56,  51,  21,  103, 65,  8,   10,  25,  232, 29,  9,
-      209, 126, 37,  175, 179, 92,  239, 25,  253, 53,  154, 202, 233, 11,  83,  146, 160, 3,   209, 227, 68,  162, 190,
-      175, 206, 153, 230, 120, 249, 65,  105, 117, 145, 169, 247, 155, 163, 78,  184, 172, 41,  67,  49,  177, 70,  22,
-      44,  205, 35,  95,  188, 140, 27,  123, 187, 116, 80,  189, 11,  161, 20,  181, 10,  159, 29,  36,  48,  165, 108,
-      201, 153, 42,  64,  57,  29,  195, 190, 65,  112, 13,  150, 18,  49,  50,  168, 70,  206, 155, 58,  91,  215, 209,
-      250, 76,  81,  114, 131, 159, 208, 97,  164, 238, 186, 21,  106, 179, 70,  177, 171, 204, 31,  39,  120, 161, 143,
-      43,  15,  28,  218, 8,   95,  43,  134, 116, 33,  160, 123, 184, 235, 8,   245, 131, 111, 239, 159, 42,  71,  224,
-      120, 169, 254, 219, 131, 234, 207, 85,  23,  117, 39,  212, 156, 210, 11,  51,  148, 198, 35,  163, 155, 102, 183,
-      11,  59,  176, 17,  143, 64,  101, 7,   146, 164, 140, 18,  91,  213, 216, 103, 84,  252, 239, 31,  169, 239, 128,
-      99,  7,   94,  175, 129, 185, 97,  175, 200, 231, 100, 44,  242, 246, 73,  211, 89,  143, 141, 23,  116, 118, 97,
-      104, 93,  55,  118, 246, 236, 38,  58,  178, 53,  19,  2,   232, 186, 253, 109, 63,  56,  37,  242, 64,  47,  246,
-      84,  23,  215, 134, 200, 20,  60,  104, 228, 36,  172, 100, 27,  128, 219, 56,  155, 233, 197, 157, 66,  122, 120,
-      4,   73,  240, 165, 70,  225, 193, 40,  124, 120, 57,  213, 109, 159, 162, 254, 76,  5,   183, 184, 98,  104, 138,
-      226, 53,  20,  165, 170, 84,  177, 176, 123, 223, 225, 82,  127, 241, 125, 124, 21,  109, 65,  106, 235, 254, 37,
-      226, 106, 172, 188, 184, 89,  22,  20,  175, 9,   42,  166, 236, 17,  250, 249, 251, 143, 87,  185, 47,  223, 171,
-      217, 43,  147, 129, 126, 175, 105, 65,  213, 205, 116, 136, 6,   126, 195, 87,  150, 85,  29,  2,   144, 10,  165,
-      120, 156, 193, 246, 168, 65,  108, 250, 32,  118, 205, 95,  10,  87,  48,  13,  251, 218, 42,  197, 14,  151, 145,
-      123, 5,   153, 90,  11,  207, 5,   93,  2,   131, 236, 10,  51,  157, 62,  241, 194, 45,  181, 92,  190, 7,   222,
-      194, 95,  121, 31,  92,  188, 69,  39,  238, 63,  19,  155, 144, 178, 235, 34,  200, 158, 89,  69,  59,  74,  97,
-      52,  25,  4,   84,  244, 65,  181, 10,  119, 34,  30,  7,   22,  239, 176, 15,  7,   159, 92,  195, 171, 101, 174,
-      32,  201, 218, 20,  231, 54,  252, 158, 166, 63,  250, 45,  49,  151, 170, 208, 99,  161, 27,  122, 72,  213, 177,
-      218, 140, 56,  99,  185, 216, 95,  240, 139, 108, 116, 138, 253, 146, 41,  130, 114, 66,  241, 140, 117, 196, 35,
-      76,  223, 198, 248, 58,  23,  156, 9,   128, 139, 87,  125, 186, 137, 18,  41,  166, 230, 165, 44,  24,  183, 6,
-      20,  84,  26,  44,  26,  173, 39,  3,   97,  146, 165, 223, 190, 231, 52,  65,  219, 183, 85,  150, 198, 53,  156,
-      220, 30,  42,  95,  107, 245, 122, 93,  124, 217, 227, 188, 154, 169, 51,  246, 143, 219, 60,  180, 42,  211, 99,
-      243, 128, 132, 130, 104, 103, 204, 227, 179, 236, 119, 175, 26,  33,  67,  174, 178, 94,  30,  182, 246, 58,  121,
-      253, 220, 141, 141, 234, 82,  223, 199, 212, 94,  2,   95,  50,  169, 233, 109, 14,  96,  75,  214, 107, 181, 15,
-      141, 180, 100, 75,  247, 159, 212, 177, 126, 166, 112, 192, 111, 100, 91,  150, 236, 62,  140, 60,  158, 150, 53,
-      237, 156, 253, 37,  143, 95,  150, 66,  252, 112, 248, 115, 46,  30,  93,  21,  193, 82,  20,  185, 26,  167, 197,
-      165, 161, 207, 245, 44,  58,  110, 63,  81,  169, 66,  55,  85,  56,  4,   58,  145, 226, 167, 47,  41,  176, 228,
-      238, 190, 28,  111, 216, 142, 230, 229, 4,   205, 52,  105, 40,  159, 222, 41,  189, 195, 20,  254, 15,  141, 37,
-      73,  136, 165, 12,  166, 70,  39,  204, 28,  113, 233, 142, 99,  4,   2,   87,  29,  165, 57,  152, 163, 167, 42,
-      127, 189, 21,  164, 141, 93,  149, 142, 85,  48,  117, 38,  94,  244, 120, 80,  180, 10,  200, 80,  249, 213, 209,
-      104, 27,  145, 116, 144, 180, 182, 89,  166, 127, 19,  214, 210, 165, 16,  158, 31,  166, 62,  235, 38,  229, 12,
-      130, 116, 52,  230, 149, 30,  185, 119, 207, 99,  104, 228, 198, 52,  192, 69,  97,  237, 142, 19,  2,   194, 34,
-      197, 4,   82,  50,  0,   101, 238, 37,  62,  153, 106, 183,
+  uint8_t ret[1 * 2 * 16 * 32] = {
+      47,  78,  47,  180, 246, 76,  157, 127, 63,  0,   168, 23,  148, 198, 180, 190, 43,  187,
+      76,  67,  77,  246, 11,  149, 240, 236, 136, 123, 51,  95,  7,   163, 163, 64,  157, 230,
+      247, 122, 67,  106, 150, 20,  231, 118, 43,  208, 190, 201, 149, 180, 47,  223, 69,  51,
+      222, 2,   254, 161, 69,  17,  122, 79,  98,  85,  77,  97,  127, 144, 216, 217, 230, 175,
+      115, 121, 86,  110, 81,  37,  143, 189, 23,  63,  214, 235, 188, 193, 125, 236, 57,  76,
+      192, 144, 20,  2,   247, 153, 101, 114, 201, 218, 221, 62,  203, 222, 1,   229, 100, 223,
+      65,  62,  78,  210, 115, 149, 115, 171, 55,  186, 67,  16,  154, 252, 104, 6,   154, 142,
+      129, 223, 84,  221, 82,  202, 113, 167, 143, 136, 203, 237, 195, 40,  47,  228, 125, 49,
+      156, 201, 187, 96,  2,   120, 227, 239, 134, 105, 153, 232, 228, 42,  65,  11,  203, 79,
+      90,  240, 54,  131, 16,  30,  171, 98,  228, 61,  160, 117, 80,  38,  223, 25,  15,  227,
+      245, 11,  241, 195, 178, 250, 187, 220, 80,  77,  101, 21,  79,  194, 33,  95,  91,  165,
+      93,  74,  120, 124, 214, 92,  101, 181, 89,  79,  159, 229, 184, 133, 188, 200, 200, 97,
+      223, 92,  42,  56,  51,  21,  103, 65,  8,   10,  25,  232, 29,  9,   209, 126, 37,  175,
+      179, 92,  239, 25,  253, 53,  154, 202, 233, 11,  83,  146, 160, 3,   209, 227, 68,  162,
+      190, 175, 206, 153, 230, 120, 249, 65,  105, 117, 145, 169, 247, 155, 163, 78,  184, 172,
+      41,  67,  49,  177, 70,  22,  44,  205, 35,  95,  188, 140, 27,  123, 187, 116, 80,  189,
+      11,  161, 20,  181, 10,  159, 29,  36,  48,  165, 108, 201, 153, 42,  64,  57,  29,  195,
+      190, 65,  112, 13,  150, 18,  49,  50,  168, 70,  206, 155, 58,  91,  215, 209, 250, 76,
+      81,  114, 131, 159, 208, 97,  164, 238, 186, 21,  106, 179, 70,  177, 171, 204, 31,  39,
+      120, 161, 143, 43,  15,  28,  218, 8,   95,  43,  134, 116, 33,  160, 123, 184, 235, 8,
+      245, 131, 111, 239, 159, 42,  71,  224, 120, 169, 254, 219, 131, 234, 207, 85,  23,  117,
+      39,  212, 156, 210, 11,  51,  148, 198, 35,  163, 155, 102, 183, 11,  59,  176, 17,  143,
+      64,  101, 7,   146, 164, 140, 18,  91,  213, 216, 103, 84,  252, 239, 31,  169, 239, 128,
+      99,  7,   94,  175, 129, 185, 97,  175, 200, 231, 100, 44,  242, 246, 73,  211, 89,  143,
+      141, 23,  116, 118, 97,  104, 93,  55,  118, 246, 236, 38,  58,  178, 53,  19,  2,   232,
+      186, 253, 109, 63,  56,  37,  242, 64,  47,  246, 84,  23,  215, 134, 200, 20,  60,  104,
+      228, 36,  172, 100, 27,  128, 219, 56,  155, 233, 197, 157, 66,  122, 120, 4,   73,  240,
+      165, 70,  225, 193, 40,  124, 120, 57,  213, 109, 159, 162, 254, 76,  5,   183, 184, 98,
+      104, 138, 226, 53,  20,  165, 170, 84,  177, 176, 123, 223, 225, 82,  127, 241, 125, 124,
+      21,  109, 65,  106, 235, 254, 37,  226, 106, 172, 188, 184, 89,  22,  20,  175, 9,   42,
+      166, 236, 17,  250, 249, 251, 143, 87,  185, 47,  223, 171, 217, 43,  147, 129, 126, 175,
+      105, 65,  213, 205, 116, 136, 6,   126, 195, 87,  150, 85,  29,  2,   144, 10,  165, 120,
+      156, 193, 246, 168, 65,  108, 250, 32,  118, 205, 95,  10,  87,  48,  13,  251, 218, 42,
+      197, 14,  151, 145, 123, 5,   153, 90,  11,  207, 5,   93,  2,   131, 236, 10,  51,  157,
+      62,  241, 194, 45,  181, 92,  190, 7,   222, 194, 95,  121, 31,  92,  188, 69,  39,  238,
+      63,  19,  155, 144, 178, 235, 34,  200, 158, 89,  69,  59,  74,  97,  52,  25,  4,   84,
+      244, 65,  181, 10,  119, 34,  30,  7,   22,  239, 176, 15,  7,   159, 92,  195, 171, 101,
+      174, 32,  201, 218, 20,  231, 54,  252, 158, 166, 63,  250, 45,  49,  151, 170, 208, 99,
+      161, 27,  122, 72,  213, 177, 218, 140, 56,  99,  185, 216, 95,  240, 139, 108, 116, 138,
+      253, 146, 41,  130, 114, 66,  241, 140, 117, 196, 35,  76,  223, 198, 248, 58,  23,  156,
+      9,   128, 139, 87,  125, 186, 137, 18,  41,  166, 230, 165, 44,  24,  183, 6,   20,  84,
+      26,  44,  26,  173, 39,  3,   97,  146, 165, 223, 190, 231, 52,  65,  219, 183, 85,  150,
+      198, 53,  156, 220, 30,  42,  95,  107, 245, 122, 93,  124, 217, 227, 188, 154, 169, 51,
+      246, 143, 219, 60,  180, 42,  211, 99,  243, 128, 132, 130, 104, 103, 204, 227, 179, 236,
+      119, 175, 26,  33,  67,  174, 178, 94,  30,  182, 246, 58,  121, 253, 220, 141, 141, 234,
+      82,  223, 199, 212, 94,  2,   95,  50,  169, 233, 109, 14,  96,  75,  214, 107, 181, 15,
+      141, 180, 100, 75,  247, 159, 212, 177, 126, 166, 112, 192, 111, 100, 91,  150, 236, 62,
+      140, 60,  158, 150, 53,  237, 156, 253, 37,  143, 95,  150, 66,  252, 112, 248, 115, 46,
+      30,  93,  21,  193, 82,  20,  185, 26,  167, 197, 165, 161, 207, 245, 44,  58,  110, 63,
+      81,  169, 66,  55,  85,  56,  4,   58,  145, 226, 167, 47,  41,  176, 228, 238, 190, 28,
+      111, 216, 142, 230, 229, 4,   205, 52,  105, 40,  159, 222, 41,  189, 195, 20,  254, 15,
+      141, 37,  73,  136, 165, 12,  166, 70,  39,  204, 28,  113, 233, 142, 99,  4,   2,   87,
+      29,  165, 57,  152, 163, 167, 42,  127, 189, 21,  164, 141, 93,  149, 142, 85,  48,  117,
+      38,  94,  244, 120, 80,  180, 10,  200, 80,  249, 213, 209, 104, 27,  145, 116, 144, 180,
+      182, 89,  166, 127, 19,  214, 210, 165, 16,  158, 31,  166, 62,  235, 38,  229, 12,  130,
+      116, 52,  230, 149, 30,  185, 119, 207, 99,  104, 228, 198, 52,  192, 69,  97,  237, 142,
+      19,  2,   194, 34,  197, 4,   82,  50,  0,   101, 238, 37,  62,  153, 106, 183,
   };
 
   FormatTransferFractalNz transfer;
-  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {32, 32}, {1, 1, 32, 32}, DT_UINT8};
+  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {32, 32}, {1, 2, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -348,7 +347,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape2_uint8_1) {
   }
 
   FormatTransferFractalNzND transfer2;
-  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {1, 1, 32, 32}, {32, 32}, DT_UINT8};
+  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {1, 2, 16, 32}, {32, 32}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -404,101 +403,125 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape2_uint8_2) {
       90,  63,  127, 196, 152, 93,  207, 243, 163, 27,  55,  17,  131, 142, 230, 83,  235, 227, 31,  151, 126, 24,  48,
       110,
   };
-  uint8_t ret[2 * 1 * 32 * 32] = {
-      127, 144, 140, 41,  204, 45,  12,  150, 135, 155, 45,  38,  69,  114, 12,  212, 232, 135, 115, 165, 156, 127, 85,
-      184, 113, 175, 123, 248, 81,  184, 162, 162, 140, 68,  78,  157, 101, 218, 13,  133, 233, 167, 229, 236, 110, 249,
-      168, 0,   45,  159, 73,  121, 70,  110, 127, 115, 171, 68,  237, 38,  121, 119, 114, 192, 95,  167, 216, 200, 80,
-      17,  111, 172, 206, 106, 122, 203, 51,  105, 2,   191, 38,  193, 247, 83,  252, 230, 45,  117, 215, 172, 217, 186,
-      91,  241, 165, 168, 205, 176, 172, 114, 232, 173, 152, 40,  15,  10,  144, 35,  120, 102, 161, 141, 121, 191, 167,
-      69,  49,  69,  18,  105, 98,  56,  82,  78,  28,  150, 122, 223, 125, 38,  72,  225, 248, 124, 205, 12,  74,  18,
-      157, 5,   249, 179, 137, 228, 92,  50,  6,   27,  9,   207, 155, 135, 36,  3,   170, 54,  107, 147, 225, 92,  228,
-      234, 206, 22,  31,  28,  112, 167, 209, 46,  75,  10,  111, 113, 230, 27,  169, 225, 35,  82,  117, 111, 2,   153,
-      96,  33,  243, 118, 174, 168, 164, 161, 137, 161, 23,  13,  53,  51,  240, 236, 185, 16,  62,  175, 63,  80,  97,
-      6,   221, 97,  103, 92,  216, 85,  225, 154, 27,  141, 146, 184, 199, 132, 216, 165, 108, 139, 49,  190, 164, 196,
-      195, 53,  219, 239, 87,  101, 183, 48,  98,  222, 66,  99,  172, 191, 189, 189, 174, 131, 209, 108, 185, 141, 212,
-      124, 169, 117, 131, 155, 107, 122, 212, 95,  9,   246, 202, 13,  188, 25,  35,  20,  138, 155, 7,   18,  33,  251,
-      49,  142, 157, 215, 125, 20,  183, 8,   252, 122, 247, 11,  37,  140, 60,  12,  45,  192, 21,  176, 116, 130, 96,
-      64,  97,  108, 214, 58,  129, 227, 1,   94,  4,   252, 138, 100, 240, 52,  178, 12,  148, 160, 143, 84,  165, 21,
-      112, 249, 173, 171, 83,  218, 72,  126, 157, 45,  78,  150, 65,  165, 107, 158, 11,  165, 136, 20,  37,  209, 141,
-      138, 108, 220, 69,  177, 107, 194, 130, 135, 226, 106, 46,  24,  88,  47,  67,  37,  241, 73,  129, 223, 129, 218,
-      127, 156, 145, 113, 53,  226, 173, 84,  230, 82,  166, 244, 12,  219, 12,  203, 118, 10,  170, 252, 179, 144, 217,
-      185, 130, 149, 22,  58,  38,  142, 246, 77,  186, 214, 121, 129, 120, 125, 192, 205, 231, 165, 1,   3,   246, 53,
-      221, 119, 140, 189, 94,  114, 75,  116, 76,  45,  29,  93,  237, 143, 234, 225, 222, 67,  37,  98,  37,  144, 222,
-      49,  215, 156, 56,  185, 109, 75,  143, 36,  165, 220, 142, 19,  127, 232, 84,  235, 202, 56,  184, 204, 48,  155,
-      75,  183, 74,  75,  55,  77,  246, 21,  202, 184, 248, 84,  89,  47,  213, 194, 167, 144, 184, 108, 60,  78,  12,
-      221, 30,  169, 162, 247, 1,   96,  225, 73,  6,   143, 192, 134, 162, 231, 174, 172, 145, 199, 45,  135, 117, 70,
-      218, 226, 94,  43,  215, 130, 139, 48,  231, 191, 142, 189, 140, 185, 194, 41,  230, 160, 105, 211, 130, 141, 249,
-      88,  240, 38,  13,  12,  152, 248, 143, 250, 120, 215, 176, 246, 236, 131, 187, 172, 136, 95,  143, 154, 59,  111,
-      150, 35,  82,  33,  11,  126, 92,  205, 91,  249, 125, 7,   112, 220, 189, 234, 66,  58,  161, 149, 7,   38,  101,
-      109, 249, 212, 164, 72,  221, 162, 96,  31,  64,  125, 203, 74,  117, 87,  233, 21,  156, 43,  174, 89,  34,  75,
-      217, 164, 145, 84,  201, 105, 178, 155, 54,  73,  102, 39,  31,  138, 164, 23,  167, 250, 239, 44,  47,  181, 11,
-      149, 192, 92,  68,  77,  141, 157, 194, 160, 104, 220, 229, 95,  63,  47,  242, 75,  102, 219, 136, 253, 117, 31,
-      23,  75,  152, 35,  44,  91,  143, 42,  15,  58,  156, 198, 93,  234, 95,  70,  238, 196, 209, 94,  12,  222, 92,
-      177, 87,  205, 222, 17,  67,  94,  109, 145, 156, 155, 40,  50,  188, 145, 221, 174, 61,  117, 57,  100, 151, 59,
-      216, 20,  63,  1,   100, 163, 25,  111, 156, 249, 34,  54,  73,  104, 156, 47,  113, 63,  251, 244, 177, 124, 45,
-      48,  224, 227, 205, 218, 149, 80,  68,  80,  127, 243, 55,  127, 113, 28,  18,  30,  181, 253, 177, 197, 53,  150,
-      103, 195, 219, 178, 126, 167, 156, 4,   240, 69,  34,  89,  213, 200, 239, 133, 164, 42,  46,  165, 47,  121, 209,
-      232, 236, 45,  89,  222, 141, 37,  128, 52,  62,  148, 245, 107, 115, 250, 150, 5,   191, 158, 20,  204, 169, 232,
-      98,  250, 71,  179, 74,  253, 130, 96,  110, 254, 42,  106, 196, 121, 251, 225, 67,  88,  128, 101, 152, 59,  86,
-      241, 200, 76,  202, 2,   26,  166, 211, 92,  63,  39,  18,  250, 116, 0,   61,  238, 71,  218, 20,  118, 125, 144,
-      74,  8,   220, 15,  108, 5,   36,  61,  83,  4,   190, 195, 127, 52,  250, 1,   57,  172, 234, 214, 161, 163, 78,
-      80,  235, 41,  229, 141, 208, 246, 185, 50,  56,  185, 61,  47,  204, 54,  172, 223, 165, 32,  31,  125, 12,  57,
-      11,  20,  148, 141, 92,  107, 13,  76,  89,  59,  182, 40,  120, 21,  104, 202, 210, 61,  114, 239, 150, 58,  74,
-      253, 38,  163, 215, 59,  47,  185, 204, 1,   88,  133, 74,  179, 76,  25,  232, 158, 211, 19,  181, 42,  104, 8,
-      191, 98,  233, 9,   16,  71,  62,  205, 241, 246, 118, 180, 136, 52,  80,  127, 174, 90,  63,  127, 196, 152, 93,
-      207, 243, 163, 27,  55,  17,  131, 142, 230, 83,  235, 227, 31,  151, 126, 24,  48,  0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   56,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   105, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   104, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   175, 0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   47,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   152, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   234, 0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   47,  0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   60,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   144, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   172, 0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   93,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   227, 0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      47,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   161, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   228, 0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   120, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   176, 0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   60,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   19,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   199, 0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   17,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   22,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   27,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   243, 0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   38,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   195, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   110, 0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,
+  uint8_t ret[2 * 2 * 16 * 32] = {
+      127, 144, 140, 41,  204, 45,  12,  150, 135, 155, 45,  38,  69,  114, 12,  212, 232, 135,
+      115, 165, 156, 127, 85,  184, 113, 175, 123, 248, 81,  184, 162, 162, 140, 68,  78,  157,
+      101, 218, 13,  133, 233, 167, 229, 236, 110, 249, 168, 0,   45,  159, 73,  121, 70,  110,
+      127, 115, 171, 68,  237, 38,  121, 119, 114, 192, 95,  167, 216, 200, 80,  17,  111, 172,
+      206, 106, 122, 203, 51,  105, 2,   191, 38,  193, 247, 83,  252, 230, 45,  117, 215, 172,
+      217, 186, 91,  241, 165, 168, 205, 176, 172, 114, 232, 173, 152, 40,  15,  10,  144, 35,
+      120, 102, 161, 141, 121, 191, 167, 69,  49,  69,  18,  105, 98,  56,  82,  78,  28,  150,
+      122, 223, 125, 38,  72,  225, 248, 124, 205, 12,  74,  18,  157, 5,   249, 179, 137, 228,
+      92,  50,  6,   27,  9,   207, 155, 135, 36,  3,   170, 54,  107, 147, 225, 92,  228, 234,
+      206, 22,  31,  28,  112, 167, 209, 46,  75,  10,  111, 113, 230, 27,  169, 225, 35,  82,
+      117, 111, 2,   153, 96,  33,  243, 118, 174, 168, 164, 161, 137, 161, 23,  13,  53,  51,
+      240, 236, 185, 16,  62,  175, 63,  80,  97,  6,   221, 97,  103, 92,  216, 85,  225, 154,
+      27,  141, 146, 184, 199, 132, 216, 165, 108, 139, 49,  190, 164, 196, 195, 53,  219, 239,
+      87,  101, 183, 48,  98,  222, 66,  99,  172, 191, 189, 189, 174, 131, 209, 108, 185, 141,
+      212, 124, 169, 117, 131, 155, 107, 122, 212, 95,  9,   246, 202, 13,  188, 25,  35,  20,
+      138, 155, 7,   18,  33,  251, 49,  142, 157, 215, 125, 20,  183, 8,   252, 122, 247, 11,
+      37,  140, 60,  12,  45,  192, 21,  176, 116, 130, 96,  64,  97,  108, 214, 58,  129, 227,
+      1,   94,  4,   252, 138, 100, 240, 52,  178, 12,  148, 160, 143, 84,  165, 21,  112, 249,
+      173, 171, 83,  218, 72,  126, 157, 45,  78,  150, 65,  165, 107, 158, 11,  165, 136, 20,
+      37,  209, 141, 138, 108, 220, 69,  177, 107, 194, 130, 135, 226, 106, 46,  24,  88,  47,
+      67,  37,  241, 73,  129, 223, 129, 218, 127, 156, 145, 113, 53,  226, 173, 84,  230, 82,
+      166, 244, 12,  219, 12,  203, 118, 10,  170, 252, 179, 144, 217, 185, 130, 149, 22,  58,
+      38,  142, 246, 77,  186, 214, 121, 129, 120, 125, 192, 205, 231, 165, 1,   3,   246, 53,
+      221, 119, 140, 189, 94,  114, 75,  116, 76,  45,  29,  93,  237, 143, 234, 225, 222, 67,
+      37,  98,  37,  144, 222, 49,  215, 156, 56,  185, 109, 75,  143, 36,  165, 220, 142, 19,
+      127, 232, 84,  235, 202, 56,  184, 204, 48,  155, 75,  183, 74,  75,  55,  77,  246, 21,
+      202, 184, 248, 84,  89,  47,  213, 194, 167, 144, 184, 108, 60,  78,  12,  221, 30,  169,
+      162, 247, 1,   96,  225, 73,  6,   143, 192, 134, 162, 231, 174, 172, 145, 199, 45,  135,
+      117, 70,  218, 226, 94,  43,  215, 130, 139, 48,  231, 191, 142, 189, 140, 185, 194, 41,
+      230, 160, 105, 211, 130, 141, 249, 88,  240, 38,  13,  12,  152, 248, 143, 250, 120, 215,
+      176, 246, 236, 131, 187, 172, 136, 95,  143, 154, 59,  111, 150, 35,  82,  33,  11,  126,
+      92,  205, 91,  249, 125, 7,   112, 220, 189, 234, 66,  58,  161, 149, 7,   38,  101, 109,
+      249, 212, 164, 72,  221, 162, 96,  31,  64,  125, 203, 74,  117, 87,  233, 21,  156, 43,
+      174, 89,  34,  75,  217, 164, 145, 84,  201, 105, 178, 155, 54,  73,  102, 39,  31,  138,
+      164, 23,  167, 250, 239, 44,  47,  181, 11,  149, 192, 92,  68,  77,  141, 157, 194, 160,
+      104, 220, 229, 95,  63,  47,  242, 75,  102, 219, 136, 253, 117, 31,  23,  75,  152, 35,
+      44,  91,  143, 42,  15,  58,  156, 198, 93,  234, 95,  70,  238, 196, 209, 94,  12,  222,
+      92,  177, 87,  205, 222, 17,  67,  94,  109, 145, 156, 155, 40,  50,  188, 145, 221, 174,
+      61,  117, 57,  100, 151, 59,  216, 20,  63,  1,   100, 163, 25,  111, 156, 249, 34,  54,
+      73,  104, 156, 47,  113, 63,  251, 244, 177, 124, 45,  48,  224, 227, 205, 218, 149, 80,
+      68,  80,  127, 243, 55,  127, 113, 28,  18,  30,  181, 253, 177, 197, 53,  150, 103, 195,
+      219, 178, 126, 167, 156, 4,   240, 69,  34,  89,  213, 200, 239, 133, 164, 42,  46,  165,
+      47,  121, 209, 232, 236, 45,  89,  222, 141, 37,  128, 52,  62,  148, 245, 107, 115, 250,
+      150, 5,   191, 158, 20,  204, 169, 232, 98,  250, 71,  179, 74,  253, 130, 96,  110, 254,
+      42,  106, 196, 121, 251, 225, 67,  88,  128, 101, 152, 59,  86,  241, 200, 76,  202, 2,
+      26,  166, 211, 92,  63,  39,  18,  250, 116, 0,   61,  238, 71,  218, 20,  118, 125, 144,
+      74,  8,   220, 15,  108, 5,   36,  61,  83,  4,   190, 195, 127, 52,  250, 1,   57,  172,
+      234, 214, 161, 163, 78,  80,  235, 41,  229, 141, 208, 246, 185, 50,  56,  185, 61,  47,
+      204, 54,  172, 223, 165, 32,  31,  125, 12,  57,  11,  20,  148, 141, 92,  107, 13,  76,
+      89,  59,  182, 40,  120, 21,  104, 202, 210, 61,  114, 239, 150, 58,  74,  253, 38,  163,
+      215, 59,  47,  185, 204, 1,   88,  133, 74,  179, 76,  25,  232, 158, 211, 19,  181, 42,
+      104, 8,   191, 98,  233, 9,   16,  71,  62,  205, 241, 246, 118, 180, 136, 52,  80,  127,
+      174, 90,  63,  127, 196, 152, 93,  207, 243, 163, 27,  55,  17,  131, 142, 230, 83,  235,
+      227, 31,  151, 126, 24,  48,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   56,  0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   105, 0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   104, 0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   175, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      47,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   152, 0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   234, 0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   47,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   60,  0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   144, 0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   172, 0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   93,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      227, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   47,  0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   161, 0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   228, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   120, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   176, 0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   60,  0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   19,  0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   199, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      17,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   22,  0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   27,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   243, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   38,  0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   195, 0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   110, 0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
   };
 
   FormatTransferFractalNz transfer;
-  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {30, 33}, {2, 1, 32, 32}, DT_UINT8};
+  TransArgs args{reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {30, 33}, {2, 2, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -507,7 +530,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape2_uint8_2) {
   }
 
   FormatTransferFractalNzND transfer2;
-  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 1, 32, 32}, {30, 33}, DT_UINT8};
+  TransArgs args2{reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 2, 16, 32}, {30, 33}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -609,102 +632,126 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape3_uint8) {
       81,  234, 4,   42,  99,  225, 166, 46,  51,  71,  227, 170, 176, 51,  37,  12,  26,  198, 216, 247, 10,  150, 230,
       15,
   };
-  uint8_t ret[2 * 1 * 1 * 32 * 32] = {
-      110, 223, 166, 62,  135, 226, 67,  118, 86,  236, 22,  196, 106, 156, 36,  141, 249, 66,  207, 150, 50,  223, 43,
-      156, 35,  17,  10,  27,  190, 239, 52,  70,  85,  92,  35,  246, 169, 88,  13,  6,   216, 237, 2,   191, 65,  17,
-      37,  28,  195, 39,  65,  148, 155, 192, 230, 243, 98,  249, 94,  192, 211, 65,  164, 217, 48,  18,  121, 246, 29,
-      63,  196, 155, 208, 28,  79,  207, 111, 148, 44,  180, 233, 12,  157, 211, 227, 6,   59,  103, 0,   9,   164, 65,
-      9,   53,  93,  70,  2,   26,  75,  96,  144, 37,  43,  140, 168, 160, 68,  202, 9,   84,  212, 231, 52,  218, 140,
-      185, 87,  17,  118, 30,  123, 35,  113, 207, 126, 25,  231, 168, 18,  200, 209, 40,  89,  174, 148, 117, 250, 126,
-      45,  240, 5,   187, 70,  142, 32,  49,  30,  88,  67,  154, 63,  100, 62,  120, 115, 132, 189, 69,  177, 79,  147,
-      226, 22,  244, 1,   166, 232, 3,   7,   198, 25,  183, 64,  59,  145, 126, 23,  7,   169, 195, 10,  50,  150, 196,
-      238, 141, 187, 169, 169, 80,  226, 225, 166, 72,  208, 16,  149, 38,  137, 213, 159, 104, 48,  203, 213, 56,  127,
-      26,  182, 242, 111, 31,  140, 117, 251, 59,  84,  42,  205, 204, 79,  235, 196, 245, 74,  148, 91,  26,  182, 240,
-      100, 78,  171, 14,  221, 88,  186, 246, 107, 200, 91,  70,  204, 135, 213, 226, 115, 33,  128, 76,  106, 232, 76,
-      98,  56,  232, 19,  172, 243, 11,  47,  192, 160, 232, 23,  78,  19,  75,  169, 243, 25,  4,   72,  140, 36,  1,
-      44,  31,  232, 247, 15,  79,  140, 103, 181, 140, 24,  117, 155, 96,  151, 112, 17,  209, 204, 139, 223, 89,  122,
-      149, 41,  41,  201, 4,   206, 171, 172, 207, 185, 156, 140, 204, 45,  124, 8,   45,  176, 66,  135, 232, 29,  17,
-      220, 160, 246, 97,  110, 200, 201, 103, 155, 195, 73,  183, 235, 67,  211, 214, 23,  196, 217, 57,  57,  27,  106,
-      100, 90,  190, 155, 38,  143, 164, 12,  140, 30,  36,  175, 229, 177, 121, 164, 92,  181, 221, 26,  239, 184, 229,
-      233, 32,  139, 120, 12,  206, 72,  227, 223, 161, 12,  211, 188, 10,  69,  190, 23,  247, 215, 65,  228, 246, 77,
-      20,  205, 17,  220, 198, 79,  44,  167, 88,  43,  77,  155, 111, 135, 52,  102, 178, 92,  197, 151, 167, 38,  44,
-      246, 84,  140, 126, 192, 12,  215, 172, 233, 98,  52,  189, 30,  222, 98,  195, 149, 83,  160, 227, 26,  37,  207,
-      129, 31,  235, 146, 184, 101, 152, 34,  32,  109, 130, 142, 113, 148, 73,  125, 190, 201, 9,   50,  48,  93,  71,
-      180, 16,  107, 22,  160, 111, 213, 235, 124, 231, 140, 226, 135, 107, 245, 45,  130, 126, 241, 46,  226, 154, 238,
-      241, 148, 10,  192, 60,  110, 89,  31,  194, 221, 217, 118, 242, 243, 220, 76,  201, 164, 29,  6,   26,  162, 133,
-      204, 252, 149, 12,  104, 181, 172, 226, 131, 207, 144, 236, 230, 154, 240, 189, 204, 196, 204, 0,   101, 102, 68,
-      95,  56,  72,  51,  12,  170, 154, 76,  153, 209, 219, 68,  111, 64,  82,  56,  205, 204, 218, 150, 102, 197, 157,
-      103, 133, 35,  186, 36,  144, 74,  150, 74,  110, 178, 143, 137, 45,  169, 106, 114, 250, 67,  217, 248, 46,  244,
-      249, 50,  158, 138, 183, 220, 91,  193, 229, 159, 22,  206, 94,  10,  63,  128, 211, 162, 28,  40,  100, 8,   121,
-      178, 78,  247, 244, 98,  14,  165, 28,  65,  26,  65,  185, 233, 51,  153, 165, 205, 12,  116, 97,  88,  157, 153,
-      23,  160, 141, 162, 119, 10,  86,  122, 21,  240, 141, 100, 248, 87,  190, 170, 204, 162, 68,  216, 196, 129, 254,
-      164, 157, 123, 51,  6,   27,  76,  22,  106, 82,  209, 83,  164, 8,   76,  219, 107, 252, 119, 49,  106, 213, 218,
-      155, 250, 68,  132, 157, 193, 135, 15,  173, 90,  134, 131, 67,  45,  76,  178, 116, 50,  53,  84,  183, 46,  50,
-      123, 92,  167, 230, 223, 55,  208, 228, 165, 247, 254, 177, 21,  187, 192, 75,  182, 209, 243, 11,  0,   189, 72,
-      82,  24,  165, 223, 143, 131, 133, 120, 211, 75,  152, 185, 55,  70,  52,  44,  109, 72,  235, 140, 88,  189, 205,
-      44,  81,  44,  172, 22,  115, 114, 187, 100, 157, 198, 182, 77,  123, 13,  2,   201, 152, 64,  157, 186, 31,  21,
-      17,  242, 30,  116, 178, 88,  140, 232, 36,  133, 123, 86,  58,  181, 34,  126, 241, 67,  147, 95,  151, 245, 9,
-      142, 16,  58,  20,  6,   223, 211, 43,  96,  251, 188, 193, 164, 229, 29,  242, 109, 46,  195, 7,   14,  37,  222,
-      38,  135, 157, 39,  5,   146, 158, 198, 230, 32,  2,   115, 200, 151, 31,  20,  239, 150, 50,  201, 211, 217, 64,
-      106, 232, 109, 101, 102, 32,  0,   153, 92,  233, 50,  243, 78,  12,  155, 16,  45,  34,  127, 138, 41,  249, 11,
-      117, 230, 239, 63,  230, 134, 173, 229, 32,  176, 61,  165, 244, 41,  139, 107, 34,  43,  48,  114, 4,   237, 154,
-      215, 140, 71,  234, 4,   25,  192, 31,  238, 139, 58,  123, 207, 150, 94,  121, 116, 49,  87,  25,  242, 224, 95,
-      205, 189, 205, 9,   20,  51,  25,  175, 73,  91,  139, 117, 86,  75,  52,  106, 201, 10,  70,  93,  124, 203, 107,
-      223, 2,   184, 147, 223, 9,   29,  11,  211, 170, 247, 72,  17,  4,   67,  74,  251, 103, 190, 20,  88,  206, 91,
-      153, 202, 42,  47,  94,  186, 8,   22,  119, 241, 72,  203, 180, 79,  186, 181, 78,  218, 157, 173, 138, 156, 33,
-      149, 175, 246, 179, 166, 117, 108, 148, 147, 181, 67,  11,  163, 99,  248, 161, 31,  195, 49,  122, 35,  214, 65,
-      81,  41,  150, 180, 134, 185, 212, 242, 123, 231, 227, 129, 211, 80,  248, 154, 243, 219, 89,  57,  197, 167, 245,
-      177, 38,  112, 178, 214, 111, 244, 218, 149, 240, 49,  243, 14,  70,  150, 74,  4,   223, 188, 214, 112, 23,  101,
-      176, 118, 207, 106, 156, 240, 62,  19,  206, 120, 181, 145, 239, 229, 166, 189, 35,  168, 145, 144, 106, 189, 87,
-      163, 147, 91,  228, 111, 180, 90,  199, 64,  164, 36,  8,   165, 118, 209, 245, 39,  214, 168, 15,  20,  110, 95,
-      89,  37,  71,  52,  107, 228, 229, 240, 207, 47,  169, 146, 46,  49,  130, 11,  47,  0,   190, 230, 205, 80,  13,
-      209, 238, 146, 131, 187, 175, 27,  41,  249, 252, 148, 178, 23,  207, 124, 219, 7,   156, 31,  105, 116, 19,  140,
-      63,  66,  5,   131, 157, 213, 9,   137, 39,  68,  89,  94,  28,  101, 229, 26,  103, 138, 186, 38,  251, 207, 136,
-      132, 182, 105, 114, 31,  6,   41,  22,  37,  124, 184, 51,  67,  245, 77,  229, 136, 241, 167, 7,   53,  20,  63,
-      246, 35,  97,  80,  150, 79,  51,  252, 89,  1,   29,  228, 130, 123, 32,  5,   51,  252, 105, 46,  236, 16,  209,
-      246, 238, 169, 79,  87,  223, 209, 93,  105, 193, 35,  152, 14,  46,  192, 201, 117, 247, 142, 157, 84,  191, 9,
-      165, 209, 72,  226, 213, 42,  159, 133, 56,  151, 196, 89,  35,  159, 254, 98,  55,  155, 92,  216, 186, 65,  226,
-      98,  121, 58,  157, 167, 112, 201, 194, 32,  139, 164, 119, 225, 246, 51,  68,  187, 40,  39,  162, 248, 107, 254,
-      48,  66,  112, 112, 3,   43,  231, 251, 219, 26,  12,  118, 116, 89,  135, 139, 20,  142, 89,  46,  168, 96,  109,
-      212, 216, 243, 221, 34,  154, 243, 119, 158, 170, 246, 59,  28,  137, 213, 173, 16,  51,  194, 62,  163, 82,  89,
-      11,  54,  164, 146, 92,  42,  61,  110, 97,  116, 8,   117, 193, 140, 30,  99,  50,  174, 115, 72,  102, 96,  153,
-      57,  16,  34,  100, 128, 190, 59,  19,  252, 223, 252, 222, 5,   70,  58,  40,  63,  131, 250, 76,  77,  210, 207,
-      248, 127, 55,  22,  22,  176, 185, 110, 246, 199, 32,  73,  137, 58,  177, 193, 236, 169, 22,  117, 240, 58,  206,
-      115, 23,  51,  243, 188, 139, 32,  219, 233, 162, 246, 242, 209, 197, 210, 78,  235, 31,  190, 61,  115, 218, 243,
-      213, 90,  98,  241, 200, 232, 198, 225, 112, 106, 104, 250, 198, 21,  142, 71,  135, 113, 43,  19,  239, 96,  179,
-      136, 91,  176, 202, 238, 251, 75,  8,   112, 50,  235, 184, 192, 131, 133, 125, 102, 122, 17,  215, 146, 20,  127,
-      130, 207, 149, 21,  47,  240, 9,   151, 131, 41,  37,  201, 36,  99,  202, 108, 195, 162, 252, 240, 172, 66,  243,
-      11,  91,  237, 23,  237, 187, 2,   253, 85,  169, 239, 239, 128, 79,  201, 220, 187, 148, 87,  100, 17,  107, 158,
-      164, 162, 99,  6,   138, 176, 138, 78,  10,  161, 209, 163, 231, 0,   57,  59,  109, 110, 80,  102, 220, 97,  38,
-      10,  3,   119, 172, 72,  180, 125, 48,  63,  78,  127, 252, 80,  18,  205, 106, 230, 85,  27,  235, 116, 211, 7,
-      156, 117, 42,  212, 217, 0,   115, 214, 146, 37,  240, 143, 235, 251, 201, 109, 106, 213, 148, 238, 123, 101, 141,
-      94,  215, 69,  3,   29,  228, 98,  210, 191, 218, 148, 137, 231, 224, 130, 213, 23,  59,  183, 217, 47,  176, 229,
-      210, 118, 209, 175, 166, 250, 207, 156, 60,  161, 169, 63,  179, 214, 231, 97,  144, 28,  115, 212, 106, 206, 244,
-      12,  165, 29,  167, 89,  243, 214, 249, 113, 250, 229, 121, 210, 94,  29,  229, 81,  158, 148, 139, 34,  187, 138,
-      65,  250, 254, 183, 155, 216, 152, 184, 122, 242, 149, 28,  171, 248, 210, 142, 78,  101, 246, 22,  253, 129, 138,
-      225, 179, 234, 188, 15,  50,  145, 87,  192, 223, 46,  245, 87,  10,  0,   39,  207, 41,  62,  213, 233, 10,  45,
-      185, 138, 67,  11,  16,  7,   150, 194, 233, 131, 110, 237, 130, 190, 139, 195, 252, 41,  157, 196, 192, 163, 182,
-      181, 202, 121, 189, 162, 48,  33,  69,  3,   66,  209, 42,  139, 9,   85,  136, 163, 183, 218, 12,  22,  20,  139,
-      26,  33,  245, 179, 199, 120, 76,  239, 206, 181, 117, 231, 173, 216, 96,  98,  253, 250, 171, 31,  214, 228, 14,
-      159, 39,  37,  153, 87,  183, 213, 18,  71,  147, 128, 150, 63,  85,  92,  225, 55,  5,   167, 39,  69,  178, 131,
-      73,  38,  146, 175, 154, 58,  57,  98,  145, 219, 79,  145, 27,  143, 237, 155, 56,  239, 83,  114, 125, 58,  175,
-      187, 35,  109, 36,  160, 85,  251, 192, 94,  194, 83,  22,  42,  104, 93,  103, 32,  217, 110, 131, 227, 142, 199,
-      83,  59,  10,  104, 54,  41,  138, 47,  100, 6,   152, 59,  103, 98,  149, 29,  233, 125, 119, 131, 210, 64,  133,
-      249, 34,  157, 132, 69,  200, 20,  45,  235, 126, 43,  195, 180, 67,  95,  75,  43,  247, 152, 84,  212, 86,  151,
-      159, 167, 197, 107, 175, 230, 14,  99,  252, 54,  138, 74,  152, 75,  245, 88,  99,  114, 32,  146, 187, 156, 39,
-      18,  68,  7,   184, 215, 115, 245, 129, 154, 73,  59,  194, 245, 96,  181, 49,  11,  4,   103, 185, 246, 152, 29,
-      213, 9,   162, 23,  44,  89,  119, 214, 216, 139, 223, 188, 5,   165, 72,  183, 41,  231, 253, 29,  66,  102, 243,
-      44,  92,  122, 32,  164, 63,  128, 38,  178, 162, 21,  164, 9,   29,  153, 244, 199, 192, 206, 249, 115, 142, 118,
-      169, 186, 239, 34,  171, 211, 74,  92,  103, 167, 110, 66,  221, 67,  74,  189, 23,  236, 189, 120, 249, 87,  99,
-      194, 247, 133, 211, 69,  49,  15,  27,  133, 233, 181, 15,  112, 181, 200, 149, 229, 103, 93,  254, 253, 182, 74,
-      35,  171, 114, 50,  230, 106, 138, 170, 4,   95,  23,  53,  181, 87,  90,  85,  18,  98,  233, 194, 16,  18,  83,
-      81,  234, 4,   42,  99,  225, 166, 46,  51,  71,  227, 170, 176, 51,  37,  12,  26,  198, 216, 247, 10,  150, 230,
-      15,
+  uint8_t ret[2 * 1 * 2 * 16 * 32] = {
+      110, 223, 166, 62,  135, 226, 67,  118, 86,  236, 22,  196, 106, 156, 36,  141, 249, 66,
+      207, 150, 50,  223, 43,  156, 35,  17,  10,  27,  190, 239, 52,  70,  85,  92,  35,  246,
+      169, 88,  13,  6,   216, 237, 2,   191, 65,  17,  37,  28,  195, 39,  65,  148, 155, 192,
+      230, 243, 98,  249, 94,  192, 211, 65,  164, 217, 48,  18,  121, 246, 29,  63,  196, 155,
+      208, 28,  79,  207, 111, 148, 44,  180, 233, 12,  157, 211, 227, 6,   59,  103, 0,   9,
+      164, 65,  9,   53,  93,  70,  2,   26,  75,  96,  144, 37,  43,  140, 168, 160, 68,  202,
+      9,   84,  212, 231, 52,  218, 140, 185, 87,  17,  118, 30,  123, 35,  113, 207, 126, 25,
+      231, 168, 18,  200, 209, 40,  89,  174, 148, 117, 250, 126, 45,  240, 5,   187, 70,  142,
+      32,  49,  30,  88,  67,  154, 63,  100, 62,  120, 115, 132, 189, 69,  177, 79,  147, 226,
+      22,  244, 1,   166, 232, 3,   7,   198, 25,  183, 64,  59,  145, 126, 23,  7,   169, 195,
+      10,  50,  150, 196, 238, 141, 187, 169, 169, 80,  226, 225, 166, 72,  208, 16,  149, 38,
+      137, 213, 159, 104, 48,  203, 213, 56,  127, 26,  182, 242, 111, 31,  140, 117, 251, 59,
+      84,  42,  205, 204, 79,  235, 196, 245, 74,  148, 91,  26,  182, 240, 100, 78,  171, 14,
+      221, 88,  186, 246, 107, 200, 91,  70,  204, 135, 213, 226, 115, 33,  128, 76,  106, 232,
+      76,  98,  56,  232, 19,  172, 243, 11,  47,  192, 160, 232, 23,  78,  19,  75,  169, 243,
+      25,  4,   72,  140, 36,  1,   44,  31,  232, 247, 15,  79,  140, 103, 181, 140, 24,  117,
+      155, 96,  151, 112, 17,  209, 204, 139, 223, 89,  122, 149, 41,  41,  201, 4,   206, 171,
+      172, 207, 185, 156, 140, 204, 45,  124, 8,   45,  176, 66,  135, 232, 29,  17,  220, 160,
+      246, 97,  110, 200, 201, 103, 155, 195, 73,  183, 235, 67,  211, 214, 23,  196, 217, 57,
+      57,  27,  106, 100, 90,  190, 155, 38,  143, 164, 12,  140, 30,  36,  175, 229, 177, 121,
+      164, 92,  181, 221, 26,  239, 184, 229, 233, 32,  139, 120, 12,  206, 72,  227, 223, 161,
+      12,  211, 188, 10,  69,  190, 23,  247, 215, 65,  228, 246, 77,  20,  205, 17,  220, 198,
+      79,  44,  167, 88,  43,  77,  155, 111, 135, 52,  102, 178, 92,  197, 151, 167, 38,  44,
+      246, 84,  140, 126, 192, 12,  215, 172, 233, 98,  52,  189, 30,  222, 98,  195, 149, 83,
+      160, 227, 26,  37,  207, 129, 31,  235, 146, 184, 101, 152, 34,  32,  109, 130, 142, 113,
+      148, 73,  125, 190, 201, 9,   50,  48,  93,  71,  180, 16,  107, 22,  160, 111, 213, 235,
+      124, 231, 140, 226, 135, 107, 245, 45,  130, 126, 241, 46,  226, 154, 238, 241, 148, 10,
+      192, 60,  110, 89,  31,  194, 221, 217, 118, 242, 243, 220, 76,  201, 164, 29,  6,   26,
+      162, 133, 204, 252, 149, 12,  104, 181, 172, 226, 131, 207, 144, 236, 230, 154, 240, 189,
+      204, 196, 204, 0,   101, 102, 68,  95,  56,  72,  51,  12,  170, 154, 76,  153, 209, 219,
+      68,  111, 64,  82,  56,  205, 204, 218, 150, 102, 197, 157, 103, 133, 35,  186, 36,  144,
+      74,  150, 74,  110, 178, 143, 137, 45,  169, 106, 114, 250, 67,  217, 248, 46,  244, 249,
+      50,  158, 138, 183, 220, 91,  193, 229, 159, 22,  206, 94,  10,  63,  128, 211, 162, 28,
+      40,  100, 8,   121, 178, 78,  247, 244, 98,  14,  165, 28,  65,  26,  65,  185, 233, 51,
+      153, 165, 205, 12,  116, 97,  88,  157, 153, 23,  160, 141, 162, 119, 10,  86,  122, 21,
+      240, 141, 100, 248, 87,  190, 170, 204, 162, 68,  216, 196, 129, 254, 164, 157, 123, 51,
+      6,   27,  76,  22,  106, 82,  209, 83,  164, 8,   76,  219, 107, 252, 119, 49,  106, 213,
+      218, 155, 250, 68,  132, 157, 193, 135, 15,  173, 90,  134, 131, 67,  45,  76,  178, 116,
+      50,  53,  84,  183, 46,  50,  123, 92,  167, 230, 223, 55,  208, 228, 165, 247, 254, 177,
+      21,  187, 192, 75,  182, 209, 243, 11,  0,   189, 72,  82,  24,  165, 223, 143, 131, 133,
+      120, 211, 75,  152, 185, 55,  70,  52,  44,  109, 72,  235, 140, 88,  189, 205, 44,  81,
+      44,  172, 22,  115, 114, 187, 100, 157, 198, 182, 77,  123, 13,  2,   201, 152, 64,  157,
+      186, 31,  21,  17,  242, 30,  116, 178, 88,  140, 232, 36,  133, 123, 86,  58,  181, 34,
+      126, 241, 67,  147, 95,  151, 245, 9,   142, 16,  58,  20,  6,   223, 211, 43,  96,  251,
+      188, 193, 164, 229, 29,  242, 109, 46,  195, 7,   14,  37,  222, 38,  135, 157, 39,  5,
+      146, 158, 198, 230, 32,  2,   115, 200, 151, 31,  20,  239, 150, 50,  201, 211, 217, 64,
+      106, 232, 109, 101, 102, 32,  0,   153, 92,  233, 50,  243, 78,  12,  155, 16,  45,  34,
+      127, 138, 41,  249, 11,  117, 230, 239, 63,  230, 134, 173, 229, 32,  176, 61,  165, 244,
+      41,  139, 107, 34,  43,  48,  114, 4,   237, 154, 215, 140, 71,  234, 4,   25,  192, 31,
+      238, 139, 58,  123, 207, 150, 94,  121, 116, 49,  87,  25,  242, 224, 95,  205, 189, 205,
+      9,   20,  51,  25,  175, 73,  91,  139, 117, 86,  75,  52,  106, 201, 10,  70,  93,  124,
+      203, 107, 223, 2,   184, 147, 223, 9,   29,  11,  211, 170, 247, 72,  17,  4,   67,  74,
+      251, 103, 190, 20,  88,  206, 91,  153, 202, 42,  47,  94,  186, 8,   22,  119, 241, 72,
+      203, 180, 79,  186, 181, 78,  218, 157, 173, 138, 156, 33,  149, 175, 246, 179, 166, 117,
+      108, 148, 147, 181, 67,  11,  163, 99,  248, 161, 31,  195, 49,  122, 35,  214, 65,  81,
+      41,  150, 180, 134, 185, 212, 242, 123, 231, 227, 129, 211, 80,  248, 154, 243, 219, 89,
+      57,  197, 167, 245, 177, 38,  112, 178, 214, 111, 244, 218, 149, 240, 49,  243, 14,  70,
+      150, 74,  4,   223, 188, 214, 112, 23,  101, 176, 118, 207, 106, 156, 240, 62,  19,  206,
+      120, 181, 145, 239, 229, 166, 189, 35,  168, 145, 144, 106, 189, 87,  163, 147, 91,  228,
+      111, 180, 90,  199, 64,  164, 36,  8,   165, 118, 209, 245, 39,  214, 168, 15,  20,  110,
+      95,  89,  37,  71,  52,  107, 228, 229, 240, 207, 47,  169, 146, 46,  49,  130, 11,  47,
+      0,   190, 230, 205, 80,  13,  209, 238, 146, 131, 187, 175, 27,  41,  249, 252, 148, 178,
+      23,  207, 124, 219, 7,   156, 31,  105, 116, 19,  140, 63,  66,  5,   131, 157, 213, 9,
+      137, 39,  68,  89,  94,  28,  101, 229, 26,  103, 138, 186, 38,  251, 207, 136, 132, 182,
+      105, 114, 31,  6,   41,  22,  37,  124, 184, 51,  67,  245, 77,  229, 136, 241, 167, 7,
+      53,  20,  63,  246, 35,  97,  80,  150, 79,  51,  252, 89,  1,   29,  228, 130, 123, 32,
+      5,   51,  252, 105, 46,  236, 16,  209, 246, 238, 169, 79,  87,  223, 209, 93,  105, 193,
+      35,  152, 14,  46,  192, 201, 117, 247, 142, 157, 84,  191, 9,   165, 209, 72,  226, 213,
+      42,  159, 133, 56,  151, 196, 89,  35,  159, 254, 98,  55,  155, 92,  216, 186, 65,  226,
+      98,  121, 58,  157, 167, 112, 201, 194, 32,  139, 164, 119, 225, 246, 51,  68,  187, 40,
+      39,  162, 248, 107, 254, 48,  66,  112, 112, 3,   43,  231, 251, 219, 26,  12,  118, 116,
+      89,  135, 139, 20,  142, 89,  46,  168, 96,  109, 212, 216, 243, 221, 34,  154, 243, 119,
+      158, 170, 246, 59,  28,  137, 213, 173, 16,  51,  194, 62,  163, 82,  89,  11,  54,  164,
+      146, 92,  42,  61,  110, 97,  116, 8,   117, 193, 140, 30,  99,  50,  174, 115, 72,  102,
+      96,  153, 57,  16,  34,  100, 128, 190, 59,  19,  252, 223, 252, 222, 5,   70,  58,  40,
+      63,  131, 250, 76,  77,  210, 207, 248, 127, 55,  22,  22,  176, 185, 110, 246, 199, 32,
+      73,  137, 58,  177, 193, 236, 169, 22,  117, 240, 58,  206, 115, 23,  51,  243, 188, 139,
+      32,  219, 233, 162, 246, 242, 209, 197, 210, 78,  235, 31,  190, 61,  115, 218, 243, 213,
+      90,  98,  241, 200, 232, 198, 225, 112, 106, 104, 250, 198, 21,  142, 71,  135, 113, 43,
+      19,  239, 96,  179, 136, 91,  176, 202, 238, 251, 75,  8,   112, 50,  235, 184, 192, 131,
+      133, 125, 102, 122, 17,  215, 146, 20,  127, 130, 207, 149, 21,  47,  240, 9,   151, 131,
+      41,  37,  201, 36,  99,  202, 108, 195, 162, 252, 240, 172, 66,  243, 11,  91,  237, 23,
+      237, 187, 2,   253, 85,  169, 239, 239, 128, 79,  201, 220, 187, 148, 87,  100, 17,  107,
+      158, 164, 162, 99,  6,   138, 176, 138, 78,  10,  161, 209, 163, 231, 0,   57,  59,  109,
+      110, 80,  102, 220, 97,  38,  10,  3,   119, 172, 72,  180, 125, 48,  63,  78,  127, 252,
+      80,  18,  205, 106, 230, 85,  27,  235, 116, 211, 7,   156, 117, 42,  212, 217, 0,   115,
+      214, 146, 37,  240, 143, 235, 251, 201, 109, 106, 213, 148, 238, 123, 101, 141, 94,  215,
+      69,  3,   29,  228, 98,  210, 191, 218, 148, 137, 231, 224, 130, 213, 23,  59,  183, 217,
+      47,  176, 229, 210, 118, 209, 175, 166, 250, 207, 156, 60,  161, 169, 63,  179, 214, 231,
+      97,  144, 28,  115, 212, 106, 206, 244, 12,  165, 29,  167, 89,  243, 214, 249, 113, 250,
+      229, 121, 210, 94,  29,  229, 81,  158, 148, 139, 34,  187, 138, 65,  250, 254, 183, 155,
+      216, 152, 184, 122, 242, 149, 28,  171, 248, 210, 142, 78,  101, 246, 22,  253, 129, 138,
+      225, 179, 234, 188, 15,  50,  145, 87,  192, 223, 46,  245, 87,  10,  0,   39,  207, 41,
+      62,  213, 233, 10,  45,  185, 138, 67,  11,  16,  7,   150, 194, 233, 131, 110, 237, 130,
+      190, 139, 195, 252, 41,  157, 196, 192, 163, 182, 181, 202, 121, 189, 162, 48,  33,  69,
+      3,   66,  209, 42,  139, 9,   85,  136, 163, 183, 218, 12,  22,  20,  139, 26,  33,  245,
+      179, 199, 120, 76,  239, 206, 181, 117, 231, 173, 216, 96,  98,  253, 250, 171, 31,  214,
+      228, 14,  159, 39,  37,  153, 87,  183, 213, 18,  71,  147, 128, 150, 63,  85,  92,  225,
+      55,  5,   167, 39,  69,  178, 131, 73,  38,  146, 175, 154, 58,  57,  98,  145, 219, 79,
+      145, 27,  143, 237, 155, 56,  239, 83,  114, 125, 58,  175, 187, 35,  109, 36,  160, 85,
+      251, 192, 94,  194, 83,  22,  42,  104, 93,  103, 32,  217, 110, 131, 227, 142, 199, 83,
+      59,  10,  104, 54,  41,  138, 47,  100, 6,   152, 59,  103, 98,  149, 29,  233, 125, 119,
+      131, 210, 64,  133, 249, 34,  157, 132, 69,  200, 20,  45,  235, 126, 43,  195, 180, 67,
+      95,  75,  43,  247, 152, 84,  212, 86,  151, 159, 167, 197, 107, 175, 230, 14,  99,  252,
+      54,  138, 74,  152, 75,  245, 88,  99,  114, 32,  146, 187, 156, 39,  18,  68,  7,   184,
+      215, 115, 245, 129, 154, 73,  59,  194, 245, 96,  181, 49,  11,  4,   103, 185, 246, 152,
+      29,  213, 9,   162, 23,  44,  89,  119, 214, 216, 139, 223, 188, 5,   165, 72,  183, 41,
+      231, 253, 29,  66,  102, 243, 44,  92,  122, 32,  164, 63,  128, 38,  178, 162, 21,  164,
+      9,   29,  153, 244, 199, 192, 206, 249, 115, 142, 118, 169, 186, 239, 34,  171, 211, 74,
+      92,  103, 167, 110, 66,  221, 67,  74,  189, 23,  236, 189, 120, 249, 87,  99,  194, 247,
+      133, 211, 69,  49,  15,  27,  133, 233, 181, 15,  112, 181, 200, 149, 229, 103, 93,  254,
+      253, 182, 74,  35,  171, 114, 50,  230, 106, 138, 170, 4,   95,  23,  53,  181, 87,  90,
+      85,  18,  98,  233, 194, 16,  18,  83,  81,  234, 4,   42,  99,  225, 166, 46,  51,  71,
+      227, 170, 176, 51,  37,  12,  26,  198, 216, 247, 10,  150, 230, 15,
   };
 
   FormatTransferFractalNz transfer;
   TransArgs args{
-      reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {2, 32, 32}, {2, 1, 1, 32, 32}, DT_UINT8};
+      reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {2, 32, 32}, {2, 1, 2, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -714,7 +761,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape3_uint8) {
 
   FormatTransferFractalNzND transfer2;
   TransArgs args2{
-      reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 1, 1, 32, 32}, {2, 32, 32}, DT_UINT8};
+      reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 1, 2, 16, 32}, {2, 32, 32}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -760,280 +807,183 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape4_uint8_1) {
       231, 78,  143, 118, 8,   100, 133, 27,  59,  188, 61,  105, 165, 183, 81,  96,  26,  106, 153, 151, 186, 232, 54,
       231, 35,  95,  172, 56,  208, 126, 198, 239,
   };
-  uint8_t ret[2 * 3 * 1 * 1 * 32 * 32] = {
-      85,  14,  85,  145, 50,  114, 71,  246, 101, 16,  101, 237, 4,   192, 118, 148, 119, 42,  185, 105, 189, 38,  138,
-      149, 123, 8,   222, 30,  153, 182, 13,  117, 143, 112, 111, 234, 72,  115, 6,   141, 169, 86,  57,  254, 200, 31,
-      111, 214, 190, 130, 221, 182, 236, 153, 120, 251, 98,  178, 35,  197, 176, 50,  34,  102, 72,  217, 134, 139, 230,
-      42,  254, 235, 79,  76,  102, 34,  111, 49,  131, 102, 178, 247, 44,  213, 215, 142, 96,  236, 167, 123, 221, 8,
-      22,  5,   93,  6,   84,  5,   198, 222, 67,  210, 229, 72,  220, 149, 74,  173, 71,  20,  171, 42,  92,  236, 234,
-      249, 27,  25,  21,  156, 93,  173, 14,  252, 90,  251, 177, 32,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   224, 251, 192, 71,  53,  181, 127, 66,  104, 148, 221,
-      27,  82,  233, 102, 107, 138, 182, 181, 159, 136, 71,  97,  40,  22,  133, 112, 159, 229, 252, 34,  122, 115, 52,
-      149, 167, 220, 174, 67,  201, 158, 78,  96,  145, 31,  100, 133, 30,  3,   232, 55,  230, 175, 211, 117, 100, 12,
-      182, 104, 156, 29,  119, 227, 25,  159, 50,  136, 181, 43,  96,  138, 130, 58,  31,  127, 231, 163, 121, 46,  42,
-      133, 238, 69,  19,  81,  147, 87,  28,  84,  57,  140, 37,  3,   15,  114, 34,  119, 215, 77,  71,  178, 127, 130,
-      146, 179, 193, 248, 51,  174, 51,  199, 211, 35,  98,  75,  100, 55,  86,  171, 167, 188, 201, 118, 140, 159, 236,
-      137, 180, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   240, 41,  61,  227, 80,  240, 26,  194, 163, 10,  18,  167, 79,  9,   36,  70,  46,  233, 167, 187, 23,  204,
-      45,  184, 60,  143, 149, 181, 186, 229, 147, 249, 83,  36,  94,  161, 96,  177, 209, 210, 194, 30,  103, 94,  232,
-      215, 156, 35,  220, 252, 128, 85,  161, 115, 209, 254, 11,  229, 69,  68,  16,  173, 115, 51,  188, 84,  197, 166,
-      46,  228, 248, 91,  131, 201, 180, 242, 112, 145, 118, 216, 59,  56,  76,  166, 144, 118, 147, 190, 79,  249, 138,
-      39,  172, 224, 104, 15,  147, 203, 194, 160, 114, 212, 85,  57,  118, 163, 146, 235, 22,  113, 225, 74,  47,  227,
-      151, 187, 3,   104, 222, 52,  63,  176, 183, 228, 48,  57,  210, 240, 0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   244, 33,  140, 109, 150, 236, 111, 6,   122, 34,
-      198, 143, 41,  160, 114, 87,  19,  100, 67,  105, 17,  23,  207, 207, 165, 154, 197, 195, 216, 122, 85,  71,  188,
-      136, 22,  221, 120, 105, 250, 197, 244, 25,  31,  235, 26,  82,  20,  2,   161, 190, 145, 105, 181, 93,  220, 189,
-      123, 28,  125, 146, 40,  136, 233, 195, 243, 90,  188, 166, 191, 143, 81,  162, 172, 155, 171, 81,  193, 146, 241,
-      54,  43,  27,  123, 252, 118, 186, 206, 189, 137, 190, 27,  108, 191, 224, 165, 176, 35,  84,  180, 239, 1,   154,
-      90,  88,  119, 188, 14,  206, 130, 201, 48,  162, 22,  47,  154, 178, 69,  23,  16,  125, 41,  205, 154, 150, 69,
-      38,  232, 246, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   92,  24,  110, 154, 116, 44,  172, 151, 12,  212, 237, 167, 72,  212, 34,  152, 70,  137, 18,  63,  107,
-      49,  62,  47,  55,  73,  23,  94,  82,  198, 25,  15,  205, 206, 55,  193, 27,  105, 182, 226, 43,  114, 78,  239,
-      88,  140, 59,  174, 235, 234, 87,  164, 243, 119, 165, 0,   135, 34,  87,  134, 174, 36,  11,  178, 6,   32,  77,
-      35,  148, 136, 111, 224, 184, 68,  222, 77,  148, 224, 180, 111, 226, 153, 137, 137, 68,  107, 242, 178, 165, 75,
-      29,  58,  180, 55,  68,  149, 97,  179, 170, 65,  214, 104, 212, 186, 175, 231, 205, 157, 108, 127, 17,  233, 201,
-      208, 25,  136, 254, 21,  155, 199, 155, 80,  25,  94,  63,  207, 225, 54,  0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   91,  154, 122, 193, 97,  235, 18,  122, 97,
-      189, 4,   149, 229, 239, 33,  52,  187, 7,   82,  229, 93,  184, 150, 218, 48,  150, 196, 152, 3,   233, 183, 182,
-      25,  178, 0,   236, 49,  20,  189, 6,   173, 95,  227, 105, 161, 27,  250, 121, 14,  135, 103, 229, 188, 81,  9,
-      234, 88,  37,  52,  59,  84,  117, 204, 242, 225, 34,  2,   104, 66,  141, 109, 151, 47,  124, 247, 79,  70,  104,
-      63,  13,  198, 242, 110, 131, 247, 20,  246, 65,  238, 119, 86,  42,  21,  43,  175, 45,  231, 78,  143, 118, 8,
-      100, 133, 27,  59,  188, 61,  105, 165, 183, 81,  96,  26,  106, 153, 151, 186, 232, 54,  231, 35,  95,  172, 56,
-      208, 126, 198, 239, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,
+  uint8_t ret[2 * 3 * 1 * 1 * 16 * 32] = {
+      85,  14,  85,  145, 50,  114, 71,  246, 101, 16,  101, 237, 4,   192, 118, 148, 119, 42,
+      185, 105, 189, 38,  138, 149, 123, 8,   222, 30,  153, 182, 13,  117, 143, 112, 111, 234,
+      72,  115, 6,   141, 169, 86,  57,  254, 200, 31,  111, 214, 190, 130, 221, 182, 236, 153,
+      120, 251, 98,  178, 35,  197, 176, 50,  34,  102, 72,  217, 134, 139, 230, 42,  254, 235,
+      79,  76,  102, 34,  111, 49,  131, 102, 178, 247, 44,  213, 215, 142, 96,  236, 167, 123,
+      221, 8,   22,  5,   93,  6,   84,  5,   198, 222, 67,  210, 229, 72,  220, 149, 74,  173,
+      71,  20,  171, 42,  92,  236, 234, 249, 27,  25,  21,  156, 93,  173, 14,  252, 90,  251,
+      177, 32,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   224, 251, 192, 71,  53,  181, 127, 66,  104, 148,
+      221, 27,  82,  233, 102, 107, 138, 182, 181, 159, 136, 71,  97,  40,  22,  133, 112, 159,
+      229, 252, 34,  122, 115, 52,  149, 167, 220, 174, 67,  201, 158, 78,  96,  145, 31,  100,
+      133, 30,  3,   232, 55,  230, 175, 211, 117, 100, 12,  182, 104, 156, 29,  119, 227, 25,
+      159, 50,  136, 181, 43,  96,  138, 130, 58,  31,  127, 231, 163, 121, 46,  42,  133, 238,
+      69,  19,  81,  147, 87,  28,  84,  57,  140, 37,  3,   15,  114, 34,  119, 215, 77,  71,
+      178, 127, 130, 146, 179, 193, 248, 51,  174, 51,  199, 211, 35,  98,  75,  100, 55,  86,
+      171, 167, 188, 201, 118, 140, 159, 236, 137, 180, 0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   240, 41,
+      61,  227, 80,  240, 26,  194, 163, 10,  18,  167, 79,  9,   36,  70,  46,  233, 167, 187,
+      23,  204, 45,  184, 60,  143, 149, 181, 186, 229, 147, 249, 83,  36,  94,  161, 96,  177,
+      209, 210, 194, 30,  103, 94,  232, 215, 156, 35,  220, 252, 128, 85,  161, 115, 209, 254,
+      11,  229, 69,  68,  16,  173, 115, 51,  188, 84,  197, 166, 46,  228, 248, 91,  131, 201,
+      180, 242, 112, 145, 118, 216, 59,  56,  76,  166, 144, 118, 147, 190, 79,  249, 138, 39,
+      172, 224, 104, 15,  147, 203, 194, 160, 114, 212, 85,  57,  118, 163, 146, 235, 22,  113,
+      225, 74,  47,  227, 151, 187, 3,   104, 222, 52,  63,  176, 183, 228, 48,  57,  210, 240,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   244, 33,  140, 109, 150, 236, 111, 6,   122, 34,  198, 143,
+      41,  160, 114, 87,  19,  100, 67,  105, 17,  23,  207, 207, 165, 154, 197, 195, 216, 122,
+      85,  71,  188, 136, 22,  221, 120, 105, 250, 197, 244, 25,  31,  235, 26,  82,  20,  2,
+      161, 190, 145, 105, 181, 93,  220, 189, 123, 28,  125, 146, 40,  136, 233, 195, 243, 90,
+      188, 166, 191, 143, 81,  162, 172, 155, 171, 81,  193, 146, 241, 54,  43,  27,  123, 252,
+      118, 186, 206, 189, 137, 190, 27,  108, 191, 224, 165, 176, 35,  84,  180, 239, 1,   154,
+      90,  88,  119, 188, 14,  206, 130, 201, 48,  162, 22,  47,  154, 178, 69,  23,  16,  125,
+      41,  205, 154, 150, 69,  38,  232, 246, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   92,  24,  110, 154,
+      116, 44,  172, 151, 12,  212, 237, 167, 72,  212, 34,  152, 70,  137, 18,  63,  107, 49,
+      62,  47,  55,  73,  23,  94,  82,  198, 25,  15,  205, 206, 55,  193, 27,  105, 182, 226,
+      43,  114, 78,  239, 88,  140, 59,  174, 235, 234, 87,  164, 243, 119, 165, 0,   135, 34,
+      87,  134, 174, 36,  11,  178, 6,   32,  77,  35,  148, 136, 111, 224, 184, 68,  222, 77,
+      148, 224, 180, 111, 226, 153, 137, 137, 68,  107, 242, 178, 165, 75,  29,  58,  180, 55,
+      68,  149, 97,  179, 170, 65,  214, 104, 212, 186, 175, 231, 205, 157, 108, 127, 17,  233,
+      201, 208, 25,  136, 254, 21,  155, 199, 155, 80,  25,  94,  63,  207, 225, 54,  0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   91,  154, 122, 193, 97,  235, 18,  122, 97,  189, 4,   149, 229, 239,
+      33,  52,  187, 7,   82,  229, 93,  184, 150, 218, 48,  150, 196, 152, 3,   233, 183, 182,
+      25,  178, 0,   236, 49,  20,  189, 6,   173, 95,  227, 105, 161, 27,  250, 121, 14,  135,
+      103, 229, 188, 81,  9,   234, 88,  37,  52,  59,  84,  117, 204, 242, 225, 34,  2,   104,
+      66,  141, 109, 151, 47,  124, 247, 79,  70,  104, 63,  13,  198, 242, 110, 131, 247, 20,
+      246, 65,  238, 119, 86,  42,  21,  43,  175, 45,  231, 78,  143, 118, 8,   100, 133, 27,
+      59,  188, 61,  105, 165, 183, 81,  96,  26,  106, 153, 151, 186, 232, 54,  231, 35,  95,
+      172, 56,  208, 126, 198, 239, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
   };
 
   FormatTransferFractalNz transfer;
   TransArgs args{
-      reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {2, 3, 4, 32}, {2, 3, 1, 1, 32, 32}, DT_UINT8};
+      reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {2, 3, 4, 32}, {2, 3, 1, 1, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -1043,7 +993,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape4_uint8_1) {
 
   FormatTransferFractalNzND transfer2;
   TransArgs args2{
-      reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 3, 1, 1, 32, 32}, {2, 3, 4, 32}, DT_UINT8};
+      reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 3, 1, 1, 16, 32}, {2, 3, 4, 32}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -1090,547 +1040,354 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape4_uint8_2) {
       102, 35,  254, 142, 116, 215, 252, 242, 124, 98,  178, 243, 172, 158, 144, 108, 201, 24,  202, 243, 114, 35,  74,
       0,   70,  78,  28,  46,  52,  213, 195, 159, 42,
   };
-  uint8_t ret[2 * 3 * 2 * 1 * 32 * 32] = {
-      52,  248, 168, 232, 216, 6,   57,  232, 23,  51,  58,  199, 97,  233, 34,  233, 253, 246, 140, 158, 15,  242, 67,
-      94,  7,   87,  198, 238, 158, 196, 171, 112, 115, 221, 218, 208, 169, 161, 197, 234, 74,  98,  234, 121, 4,   100,
-      8,   63,  109, 26,  23,  160, 242, 143, 227, 74,  30,  1,   39,  128, 38,  136, 2,   23,  92,  57,  72,  172, 185,
-      10,  5,   12,  89,  204, 161, 209, 245, 10,  160, 195, 120, 45,  210, 182, 236, 63,  170, 16,  132, 166, 217, 183,
-      24,  40,  239, 122, 26,  3,   102, 209, 149, 246, 178, 31,  78,  18,  40,  79,  201, 238, 145, 33,  20,  168, 155,
-      222, 111, 200, 235, 123, 191, 25,  143, 222, 114, 81,  105, 60,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   217, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   249, 0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   76,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   210, 22,  87,  144, 187, 226, 115, 42,  96,  18,  197, 34,  19,  160, 152, 174, 1,   206, 196, 253, 187, 180,
-      7,   224, 56,  153, 96,  130, 107, 102, 143, 114, 59,  249, 241, 134, 212, 174, 231, 147, 25,  166, 184, 74,  162,
-      138, 179, 121, 8,   56,  214, 2,   100, 88,  6,   28,  203, 251, 170, 81,  21,  238, 104, 61,  178, 111, 161, 49,
-      241, 117, 28,  55,  171, 112, 29,  162, 205, 57,  99,  236, 129, 114, 148, 209, 116, 72,  220, 195, 93,  151, 206,
-      20,  188, 127, 60,  231, 181, 119, 145, 120, 53,  145, 45,  61,  56,  20,  4,   197, 141, 133, 198, 59,  98,  46,
-      225, 221, 159, 16,  209, 90,  217, 238, 127, 149, 93,  174, 144, 29,  0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   48,  0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   156,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   62,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   27,  0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   46,  94,  126, 32,  182, 183, 123, 60,  183, 242, 8,   104, 52,  107, 58,  147, 90,  0,   23,  95,  51,
-      243, 191, 12,  199, 30,  253, 120, 154, 68,  170, 83,  235, 197, 234, 171, 57,  161, 254, 19,  44,  37,  180, 35,
-      157, 101, 92,  99,  182, 225, 74,  231, 162, 96,  197, 167, 91,  29,  81,  52,  10,  202, 81,  81,  89,  81,  244,
-      52,  78,  239, 123, 6,   164, 186, 91,  170, 46,  135, 134, 126, 199, 118, 153, 32,  82,  181, 130, 97,  16,  36,
-      71,  105, 227, 148, 138, 122, 32,  47,  42,  79,  221, 25,  181, 231, 99,  42,  143, 174, 182, 93,  2,   78,  171,
-      7,   219, 132, 57,  75,  74,  240, 73,  74,  27,  184, 35,  212, 18,  28,  0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   41,  0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      191, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   250, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   154, 0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   59,  88,  129, 148, 228, 191, 104, 163, 157, 23,  67,  202, 171, 1,   187, 132, 216, 233, 152, 231,
-      35,  94,  25,  209, 79,  152, 207, 103, 192, 169, 42,  60,  124, 140, 183, 224, 53,  162, 7,   3,   162, 9,   232,
-      156, 216, 180, 34,  155, 202, 88,  44,  91,  190, 221, 38,  95,  62,  131, 1,   74,  238, 174, 200, 201, 75,  127,
-      125, 131, 76,  132, 62,  169, 211, 173, 29,  142, 162, 226, 237, 166, 252, 12,  85,  164, 76,  228, 23,  126, 189,
-      203, 51,  135, 76,  90,  195, 89,  55,  206, 231, 7,   52,  61,  128, 87,  134, 243, 203, 46,  5,   243, 241, 228,
-      17,  58,  75,  143, 228, 13,  151, 205, 194, 62,  50,  124, 223, 59,  178, 201, 0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   64,  0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   240, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   220, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   181, 0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   27,  129, 9,   241, 214, 241, 177, 110, 63,  215, 104, 118, 117, 137, 89,  16,  57,  46,  13,
-      243, 20,  65,  209, 35,  241, 127, 117, 161, 71,  37,  89,  10,  38,  19,  120, 137, 198, 143, 240, 74,  240, 119,
-      242, 50,  64,  47,  111, 226, 49,  141, 215, 219, 212, 113, 119, 98,  168, 185, 174, 172, 89,  86,  245, 26,  120,
-      155, 12,  209, 131, 232, 147, 65,  181, 184, 75,  185, 195, 10,  62,  174, 77,  194, 129, 30,  48,  247, 199, 251,
-      35,  143, 162, 80,  26,  11,  117, 12,  46,  75,  215, 114, 127, 34,  211, 133, 244, 233, 117, 75,  5,   201, 47,
-      120, 197, 250, 223, 104, 4,   36,  5,   248, 12,  62,  48,  249, 91,  116, 145, 57,  0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   18,  0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   46,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   232, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   213, 0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   121, 104, 191, 33,  158, 12,  138, 107, 70,  105, 110, 189, 17,  58,  112, 45,  178, 110,
-      72,  31,  80,  249, 54,  76,  45,  54,  88,  114, 213, 240, 248, 70,  216, 191, 217, 26,  215, 88,  23,  49,  246,
-      162, 196, 131, 157, 233, 42,  78,  235, 228, 215, 217, 77,  70,  29,  236, 125, 148, 124, 139, 205, 177, 118, 13,
-      93,  44,  62,  155, 86,  190, 219, 230, 13,  193, 174, 233, 35,  14,  107, 61,  83,  181, 89,  198, 200, 127, 161,
-      58,  79,  18,  152, 157, 74,  241, 93,  241, 102, 35,  254, 142, 116, 215, 252, 242, 124, 98,  178, 243, 172, 158,
-      144, 108, 201, 24,  202, 243, 114, 35,  74,  0,   70,  78,  28,  46,  52,  213, 195, 159, 0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   76,  0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   162, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   68,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   42,  0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  uint8_t ret[2 * 3 * 2 * 1 * 16 * 32] = {
+      52,  248, 168, 232, 216, 6,   57,  232, 23,  51,  58,  199, 97,  233, 34,  233, 253, 246,
+      140, 158, 15,  242, 67,  94,  7,   87,  198, 238, 158, 196, 171, 112, 115, 221, 218, 208,
+      169, 161, 197, 234, 74,  98,  234, 121, 4,   100, 8,   63,  109, 26,  23,  160, 242, 143,
+      227, 74,  30,  1,   39,  128, 38,  136, 2,   23,  92,  57,  72,  172, 185, 10,  5,   12,
+      89,  204, 161, 209, 245, 10,  160, 195, 120, 45,  210, 182, 236, 63,  170, 16,  132, 166,
+      217, 183, 24,  40,  239, 122, 26,  3,   102, 209, 149, 246, 178, 31,  78,  18,  40,  79,
+      201, 238, 145, 33,  20,  168, 155, 222, 111, 200, 235, 123, 191, 25,  143, 222, 114, 81,
+      105, 60,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   217, 0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   249, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      76,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   210, 22,
+      87,  144, 187, 226, 115, 42,  96,  18,  197, 34,  19,  160, 152, 174, 1,   206, 196, 253,
+      187, 180, 7,   224, 56,  153, 96,  130, 107, 102, 143, 114, 59,  249, 241, 134, 212, 174,
+      231, 147, 25,  166, 184, 74,  162, 138, 179, 121, 8,   56,  214, 2,   100, 88,  6,   28,
+      203, 251, 170, 81,  21,  238, 104, 61,  178, 111, 161, 49,  241, 117, 28,  55,  171, 112,
+      29,  162, 205, 57,  99,  236, 129, 114, 148, 209, 116, 72,  220, 195, 93,  151, 206, 20,
+      188, 127, 60,  231, 181, 119, 145, 120, 53,  145, 45,  61,  56,  20,  4,   197, 141, 133,
+      198, 59,  98,  46,  225, 221, 159, 16,  209, 90,  217, 238, 127, 149, 93,  174, 144, 29,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   48,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   156, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   62,  0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   27,  0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   46,  94,  126, 32,
+      182, 183, 123, 60,  183, 242, 8,   104, 52,  107, 58,  147, 90,  0,   23,  95,  51,  243,
+      191, 12,  199, 30,  253, 120, 154, 68,  170, 83,  235, 197, 234, 171, 57,  161, 254, 19,
+      44,  37,  180, 35,  157, 101, 92,  99,  182, 225, 74,  231, 162, 96,  197, 167, 91,  29,
+      81,  52,  10,  202, 81,  81,  89,  81,  244, 52,  78,  239, 123, 6,   164, 186, 91,  170,
+      46,  135, 134, 126, 199, 118, 153, 32,  82,  181, 130, 97,  16,  36,  71,  105, 227, 148,
+      138, 122, 32,  47,  42,  79,  221, 25,  181, 231, 99,  42,  143, 174, 182, 93,  2,   78,
+      171, 7,   219, 132, 57,  75,  74,  240, 73,  74,  27,  184, 35,  212, 18,  28,  0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   41,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      191, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   250, 0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   154, 0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   59,  88,  129, 148, 228, 191,
+      104, 163, 157, 23,  67,  202, 171, 1,   187, 132, 216, 233, 152, 231, 35,  94,  25,  209,
+      79,  152, 207, 103, 192, 169, 42,  60,  124, 140, 183, 224, 53,  162, 7,   3,   162, 9,
+      232, 156, 216, 180, 34,  155, 202, 88,  44,  91,  190, 221, 38,  95,  62,  131, 1,   74,
+      238, 174, 200, 201, 75,  127, 125, 131, 76,  132, 62,  169, 211, 173, 29,  142, 162, 226,
+      237, 166, 252, 12,  85,  164, 76,  228, 23,  126, 189, 203, 51,  135, 76,  90,  195, 89,
+      55,  206, 231, 7,   52,  61,  128, 87,  134, 243, 203, 46,  5,   243, 241, 228, 17,  58,
+      75,  143, 228, 13,  151, 205, 194, 62,  50,  124, 223, 59,  178, 201, 0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   64,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   240, 0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   220, 0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   181, 0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   27,  129, 9,   241, 214, 241, 177, 110,
+      63,  215, 104, 118, 117, 137, 89,  16,  57,  46,  13,  243, 20,  65,  209, 35,  241, 127,
+      117, 161, 71,  37,  89,  10,  38,  19,  120, 137, 198, 143, 240, 74,  240, 119, 242, 50,
+      64,  47,  111, 226, 49,  141, 215, 219, 212, 113, 119, 98,  168, 185, 174, 172, 89,  86,
+      245, 26,  120, 155, 12,  209, 131, 232, 147, 65,  181, 184, 75,  185, 195, 10,  62,  174,
+      77,  194, 129, 30,  48,  247, 199, 251, 35,  143, 162, 80,  26,  11,  117, 12,  46,  75,
+      215, 114, 127, 34,  211, 133, 244, 233, 117, 75,  5,   201, 47,  120, 197, 250, 223, 104,
+      4,   36,  5,   248, 12,  62,  48,  249, 91,  116, 145, 57,  0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      18,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   46,  0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   232, 0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   213, 0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   121, 104, 191, 33,  158, 12,  138, 107, 70,  105,
+      110, 189, 17,  58,  112, 45,  178, 110, 72,  31,  80,  249, 54,  76,  45,  54,  88,  114,
+      213, 240, 248, 70,  216, 191, 217, 26,  215, 88,  23,  49,  246, 162, 196, 131, 157, 233,
+      42,  78,  235, 228, 215, 217, 77,  70,  29,  236, 125, 148, 124, 139, 205, 177, 118, 13,
+      93,  44,  62,  155, 86,  190, 219, 230, 13,  193, 174, 233, 35,  14,  107, 61,  83,  181,
+      89,  198, 200, 127, 161, 58,  79,  18,  152, 157, 74,  241, 93,  241, 102, 35,  254, 142,
+      116, 215, 252, 242, 124, 98,  178, 243, 172, 158, 144, 108, 201, 24,  202, 243, 114, 35,
+      74,  0,   70,  78,  28,  46,  52,  213, 195, 159, 0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   76,  0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   162, 0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   68,  0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   42,  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,
   };
 
   FormatTransferFractalNz transfer;
   TransArgs args{
-      reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {2, 3, 4, 33}, {2, 3, 2, 1, 32, 32}, DT_UINT8};
+      reinterpret_cast<uint8_t *>(data), FORMAT_ND, FORMAT_FRACTAL_NZ, {2, 3, 4, 33}, {2, 3, 2, 1, 16, 32}, DT_UINT8};
   TransResult result;
   EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
   EXPECT_EQ(result.length, sizeof(ret) / sizeof(ret[0]));
@@ -1640,7 +1397,7 @@ TEST_F(UtestFormatTransferNdFractNz, nd_shape4_uint8_2) {
 
   FormatTransferFractalNzND transfer2;
   TransArgs args2{
-      reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 3, 2, 1, 32, 32}, {2, 3, 4, 33}, DT_UINT8};
+      reinterpret_cast<uint8_t *>(ret), FORMAT_FRACTAL_NZ, FORMAT_ND, {2, 3, 2, 1, 16, 32}, {2, 3, 4, 33}, DT_UINT8};
   TransResult result2;
   EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
   EXPECT_EQ(result2.length, sizeof(data) / sizeof(data[0]));
@@ -9163,5 +8920,57 @@ TEST_F(UtestFormatTransferNdFractNz, invalid_src_dst_shape_relation) {
   FormatTransferFractalNzND transfer;
   EXPECT_EQ(transfer.TransFormat(args, result), PARAM_INVALID);
 }
+TEST_F(UtestFormatTransferNdFractNz, nd_nz_nd_large_fp16) {
+  std::vector<int64_t> shape = {3, 1000, 1001};
+  std::vector<uint16_t> data(3 * 1000 * 1001);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint16_t>(i * 7 + 1);
+  }
+  FormatTransferFractalNz transfer;
+  TransArgs args{reinterpret_cast<uint8_t *>(data.data()), FORMAT_ND, FORMAT_FRACTAL_NZ, shape,
+                 {3, 63, 63, 16, 16}, DT_FLOAT16};
+  TransResult result;
+  EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
+  EXPECT_EQ(result.length, 3 * 63 * 63 * 16 * 16 * sizeof(uint16_t));
+  auto nz = reinterpret_cast<uint16_t *>(result.data.get());
+  // the last column of w and the rows out of h are padded by 0
+  EXPECT_EQ(nz[(62 * 63 * 16 + 999) * 16], data[999 * 1001 + 992]);
+  EXPECT_EQ(nz[(62 * 63 * 16 + 999) * 16 + 9], 0);
+  EXPECT_EQ(nz[(62 * 63 * 16 + 1000) * 16], 0);
+
+  FormatTransferFractalNzND transfer2;
+  TransArgs args2{result.data.get(), FORMAT_FRACTAL_NZ, FORMAT_ND, {3, 63, 63, 16, 16}, shape, DT_FLOAT16};
+  TransResult result2;
+  EXPECT_EQ(transfer2.TransFormat(args2, result2), SUCCESS);
+  EXPECT_EQ(result2.length, data.size() * sizeof(uint16_t));
+  EXPECT_EQ(memcmp(result2.data.get(), data.data(), result2.length), 0);
+}
+
+TEST_F(UtestFormatTransferNdFractNz, road_nd_nz_cast_fused) {
+  std::vector<int64_t> shape = {2, 33, 50};
+  std::vector<int64_t> nz_shape = {2, 4, 3, 16, 16};
+  std::vector<float> data(2 * 33 * 50);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<float>(i) * 0.37f - 500.0f;
+  }
+
+  FormatTransferFractalNz transfer;
+  TransResult nz_result;
+  EXPECT_EQ(transfer.TransFormat({reinterpret_cast<uint8_t *>(data.data()), FORMAT_ND, FORMAT_FRACTAL_NZ, shape,
+                                  nz_shape, DT_FLOAT}, nz_result),
+            SUCCESS);
+  TransResult expect;
+  EXPECT_EQ(TransDataType({nz_result.data.get(), static_cast<size_t>(2 * 4 * 3 * 16 * 16), DT_FLOAT, DT_FLOAT16},
+                          expect),
+            SUCCESS);
+
+  std::vector<TransStep> road = {
+      {kTransStepFormat, FORMAT_ND, FORMAT_FRACTAL_NZ, shape, nz_shape, DT_FLOAT, DT_FLOAT},
+      {kTransStepDataType, FORMAT_FRACTAL_NZ, FORMAT_FRACTAL_NZ, nz_shape, nz_shape, DT_FLOAT, DT_FLOAT16}};
+  TransResult result;
+  EXPECT_EQ(TransRoad(reinterpret_cast<uint8_t *>(data.data()), road, result), SUCCESS);
+  EXPECT_EQ(result.length, expect.length);
+  EXPECT_EQ(memcmp(result.data.get(), expect.data.get(), expect.length), 0);
+}
 }  // namespace formats
-}  // namespace ge
\ No newline at end of file
+}  // namespace ge
@@ -16,9 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <vector>
+
 #include "common/formats/format_transfers/format_transfer_fractal_z.h"
 
 #include "common/formats/format_transfers/format_transfer.h"
+#include "common/formats/formats.h"
 
 namespace ge {
 namespace formats {
@@ -16872,5 +16876,62 @@ TEST_F(UtestFormatTransferNchwFz, build_transfer_uint8) {
   auto transfer = BuildFormatTransfer(args);
   EXPECT_NE(transfer, nullptr);
 }
+
+TEST_F(UtestFormatTransferNchwFz, road_cast_fused_same_as_step_by_step) {
+  const int64_t n = 40;
+  const int64_t c = 35;
+  const int64_t h = 3;
+  const int64_t w = 3;
+  std::vector<float> data(n * c * h * w);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<float>(static_cast<int64_t>(i % 2003) - 1001) / 7.0f;
+  }
+  std::vector<int64_t> src_shape = {n, c, h, w};
+  std::vector<int64_t> dst_shape = {3 * 3 * 3, 3, 16, 16};
+
+  TransResult cast_result;
+  EXPECT_EQ(TransDataType({reinterpret_cast<uint8_t *>(data.data()), data.size(), DT_FLOAT, DT_FLOAT16}, cast_result),
+            SUCCESS);
+  TransResult expect;
+  FormatTransferFractalZ transfer;
+  EXPECT_EQ(transfer.TransFormat({cast_result.data.get(), FORMAT_NCHW, FORMAT_FRACTAL_Z, src_shape, dst_shape,
+                                  DT_FLOAT16}, expect),
+            SUCCESS);
+
+  // cast before and after the transdata
+  std::vector<TransStep> cast_first = {
+      {kTransStepDataType, FORMAT_NCHW, FORMAT_NCHW, src_shape, src_shape, DT_FLOAT, DT_FLOAT16},
+      {kTransStepFormat, FORMAT_NCHW, FORMAT_FRACTAL_Z, src_shape, dst_shape, DT_FLOAT16, DT_FLOAT16}};
+  std::vector<TransStep> cast_last = {
+      {kTransStepFormat, FORMAT_NCHW, FORMAT_FRACTAL_Z, src_shape, dst_shape, DT_FLOAT, DT_FLOAT},
+      {kTransStepDataType, FORMAT_FRACTAL_Z, FORMAT_FRACTAL_Z, dst_shape, dst_shape, DT_FLOAT, DT_FLOAT16}};
+  for (const auto &road : {cast_first, cast_last}) {
+    TransResult result;
+    EXPECT_EQ(TransRoad(reinterpret_cast<uint8_t *>(data.data()), road, result), SUCCESS);
+    EXPECT_EQ(result.length, expect.length);
+    EXPECT_EQ(memcmp(result.data.get(), expect.data.get(), expect.length), 0);
+  }
+}
+
+TEST_F(UtestFormatTransferNchwFz, road_not_fused_step_by_step) {
+  // the cube size of uint8 is different from int32, so the cast is not fused
+  std::vector<int32_t> data(17 * 40);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int32_t>(i % 251);
+  }
+  std::vector<int64_t> src_shape = {17, 40, 1, 1};
+  std::vector<int64_t> dst_shape = {2, 2, 16, 32};
+  std::vector<TransStep> road = {
+      {kTransStepDataType, FORMAT_NCHW, FORMAT_NCHW, src_shape, src_shape, DT_INT32, DT_UINT8},
+      {kTransStepFormat, FORMAT_NCHW, FORMAT_FRACTAL_Z, src_shape, dst_shape, DT_UINT8, DT_UINT8}};
+  TransResult result;
+  EXPECT_EQ(TransRoad(reinterpret_cast<uint8_t *>(data.data()), road, result), SUCCESS);
+  EXPECT_EQ(result.length, 2 * 2 * 16 * 32);
+  auto dst = result.data.get();
+  // (c1 1, n 16, c0 7) is c 39 of n 16
+  EXPECT_EQ(dst[((1 * 2 + 1) * 16 + 0) * 32 + 7], (16 * 40 + 39) % 251);
+  // c 40 of c1 1 is padded
+  EXPECT_EQ(dst[((1 * 2 + 1) * 16 + 0) * 32 + 8], 0);
+}
 }  // namespace formats
-}  // namespace ge
\ No newline at end of file
+}  // namespace ge
@@ -15,6 +15,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
 
 #include "common/formats/format_transfers/format_transfer_fractal_z.h"
 
@@ -5350,5 +5352,35 @@ TEST_F(UtestFormatTransferNhwcFz, build_transfer_uint8) {
   auto transfer = BuildFormatTransfer(args);
   EXPECT_NE(transfer, nullptr);
 }
+TEST_F(UtestFormatTransferNhwcFz, large_same_as_nchw) {
+  const int64_t n = 100;
+  const int64_t h = 3;
+  const int64_t w = 3;
+  const int64_t c = 300;
+  std::vector<uint16_t> nhwc(n * h * w * c);
+  std::vector<uint16_t> nchw(n * c * h * w);
+  for (int64_t ni = 0; ni < n; ++ni) {
+    for (int64_t hwi = 0; hwi < h * w; ++hwi) {
+      for (int64_t ci = 0; ci < c; ++ci) {
+        auto value = static_cast<uint16_t>((ni * 131 + hwi * 17 + ci) % 65521);
+        nhwc[(ni * h * w + hwi) * c + ci] = value;
+        nchw[(ni * c + ci) * h * w + hwi] = value;
+      }
+    }
+  }
+  std::vector<int64_t> dst_shape = {19 * 3 * 3, 7, 16, 16};
+  FormatTransferFractalZ transfer;
+  TransArgs args{reinterpret_cast<uint8_t *>(nhwc.data()), FORMAT_NHWC, FORMAT_FRACTAL_Z, {n, h, w, c}, dst_shape,
+                 DT_FLOAT16};
+  TransResult result;
+  EXPECT_EQ(transfer.TransFormat(args, result), SUCCESS);
+  TransArgs args2{reinterpret_cast<uint8_t *>(nchw.data()), FORMAT_NCHW, FORMAT_FRACTAL_Z, {n, c, h, w}, dst_shape,
+                  DT_FLOAT16};
+  TransResult result2;
+  EXPECT_EQ(transfer.TransFormat(args2, result2), SUCCESS);
+  EXPECT_EQ(result.length, 19 * 3 * 3 * 7 * 16 * 16 * sizeof(uint16_t));
+  EXPECT_EQ(result2.length, result.length);
+  EXPECT_EQ(memcmp(result.data.get(), result2.data.get(), result.length), 0);
+}
 }  // namespace formats
-}  // namespace ge
\ No newline at end of file
+}  // namespace ge
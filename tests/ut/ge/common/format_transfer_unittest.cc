@@ -15,6 +15,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
 
 #include "common/formats/format_transfers/format_transfer_nchw_nc1hwc0.h"
 
@@ -77,5 +78,20 @@ TEST_F(UtestFormatTransfer, get_size_by_data_type) {
   EXPECT_EQ(GetSizeByDataType(DT_UNDEFINED), -1);
   EXPECT_EQ(DT_UNDEFINED, 26);
 }
+
+TEST_F(UtestFormatTransfer, parallel_for_serial_guard) {
+  std::atomic<int> calls(0);
+  auto func = [&calls](int64_t begin, int64_t end) {
+    ++calls;
+    return SUCCESS;
+  };
+  {
+    SerialParallelForGuard guard;
+    EXPECT_TRUE(IsParallelForSerial());
+    EXPECT_EQ(ParallelFor(1024, 1, func), SUCCESS);
+    EXPECT_EQ(calls.load(), 1);
+  }
+  EXPECT_FALSE(IsParallelForSerial());
+}
 }  // namespace formats
 }  // namespace ge
\ No newline at end of file
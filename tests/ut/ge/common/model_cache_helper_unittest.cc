@@ -0,0 +1,118 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#define private public
+#include "common/helper/model_cache_helper.h"
+#undef private
+
+namespace ge {
+class UtestModelCacheHelper : public testing::Test {
+ protected:
+  void SetUp() {
+    char dir[] = "/tmp/ut_model_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    cache_dir_ = std::string(dir) + "/";
+  }
+  void TearDown() {
+    for (const auto &file : files_) {
+      (void)remove((cache_dir_ + file).c_str());
+      (void)remove((cache_dir_ + file + ".json").c_str());  // exported when debug log is enabled
+    }
+    (void)rmdir(cache_dir_.c_str());
+  }
+
+  void InitHelper(ModelCacheHelper &helper, const std::string &file_name) {
+    helper.cache_path_ = cache_dir_;
+    helper.is_cache_path_valid_for_output = true;
+    files_.emplace_back(file_name);
+  }
+
+  static Json CreateJson() {
+    Json json;
+    json["nodeNum"] = 3;
+    json["graphHash"] = 12345678901234ULL;
+    json["nodeHash"] = Json::array({{{"name", "add"}, {"hash", 1}}, {{"name", "mul"}, {"hash", 2}}});
+    json["varManager"]["sessionId"] = 1;
+    json["varManager"]["varAddrMgrMap"] = Json::array({1, 2, 3});
+    json["empty"] = Json::object();
+    return json;
+  }
+
+  std::string cache_dir_;
+  std::vector<std::string> files_;
+};
+
+TEST_F(UtestModelCacheHelper, sections_round_trip) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("g1");
+  ModelCacheHelper helper(0, 0, graph);
+  InitHelper(helper, "0_1.manifest");
+  auto json = CreateJson();
+  ASSERT_EQ(helper.SaveCacheToFile("0_1.manifest", json), SUCCESS);
+
+  Json all;
+  ASSERT_EQ(helper.LoadCacheFromFile("0_1.manifest", {}, all), SUCCESS);
+  EXPECT_EQ(all, json);
+
+  // the members of an object are separated sections, they are decoded with their top level item
+  Json part;
+  ASSERT_EQ(helper.LoadCacheFromFile("0_1.manifest", {"nodeNum", "varManager"}, part), SUCCESS);
+  EXPECT_EQ(part.size(), 2);
+  EXPECT_EQ(part["nodeNum"], json["nodeNum"]);
+  EXPECT_EQ(part["varManager"], json["varManager"]);
+
+  Json missing;
+  ASSERT_EQ(helper.LoadCacheFromFile("0_1.manifest", {"edgeNum"}, missing), SUCCESS);
+  EXPECT_TRUE(missing.is_object());
+  EXPECT_TRUE(missing.empty());
+}
+
+TEST_F(UtestModelCacheHelper, broken_sections) {
+  ComputeGraphPtr graph = std::make_shared<ComputeGraph>("g1");
+  ModelCacheHelper helper(0, 0, graph);
+  InitHelper(helper, "0_2.manifest");
+  ASSERT_EQ(helper.SaveCacheToFile("0_2.manifest", CreateJson()), SUCCESS);
+
+  // the last section is "varManager/varAddrMgrMap", only the readers of it see the damage
+  std::string path = cache_dir_ + "0_2.manifest";
+  std::ifstream ifs(path, std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  ifs.close();
+  ASSERT_FALSE(data.empty());
+  data.back() ^= 0x1;
+  std::ofstream(path, std::ios::binary | std::ios::trunc).write(data.data(), data.size());
+
+  Json part;
+  EXPECT_EQ(helper.LoadCacheFromFile("0_2.manifest", {"nodeNum"}, part), SUCCESS);
+  Json all;
+  EXPECT_NE(helper.LoadCacheFromFile("0_2.manifest", {}, all), SUCCESS);
+
+  // a file of other format or version is missed
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "{\"nodeNum\":3}";
+  Json json;
+  EXPECT_NE(helper.LoadCacheFromFile("0_2.manifest", {}, json), SUCCESS);
+  Json not_null = Json::object();
+  EXPECT_EQ(helper.LoadCacheFromFile("0_2.manifest", {}, not_null), PARAM_INVALID);
+}
+}  // namespace ge
@@ -0,0 +1,156 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "common/auth/file_saver.h"
+#include "common/cache_file_util.h"
+#include "common/content_hash_index.h"
+#include "external/ge/ge_api_types.h"
+#include "framework/common/helper/om_file_helper.h"
+#include "graph/ge_local_context.h"
+
+using namespace std;
+
+namespace ge {
+namespace {
+const char *const kOmFile = "ut_om_file_save_helper.om";
+const char *const kChecksumFile = "ut_om_file_save_helper.om.checksum";
+const size_t kStampSize = 3 * sizeof(uint64_t);  // size and modify time of the om file in the checksum file
+
+vector<uint8_t> ReadFile(const char *file) {
+  ifstream ifs(file, ios::binary);
+  return vector<uint8_t>((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+}
+
+vector<uint8_t> CreatePartitionData(size_t size, uint8_t seed) {
+  vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<uint8_t>(i * 31 + seed + i / 4093);
+  }
+  return data;
+}
+
+void SaveAndCheck(vector<vector<uint8_t>> &datas) {
+  OmFileSaveHelper save_helper;
+  for (size_t i = 0; i < datas.size(); ++i) {
+    ModelPartition partition;
+    partition.type = static_cast<ModelPartitionType>(i);
+    partition.data = datas[i].data();
+    partition.size = static_cast<uint32_t>(datas[i].size());
+    EXPECT_EQ(save_helper.AddPartition(partition), SUCCESS);
+  }
+  ModelBufferData model;
+  EXPECT_EQ(save_helper.SaveModelToFile(kOmFile, model, true), SUCCESS);
+
+  vector<uint8_t> file_data = ReadFile(kOmFile);
+  (void)remove(kOmFile);
+
+  ModelData model_data;
+  model_data.model_data = file_data.data();
+  model_data.model_len = static_cast<uint32_t>(file_data.size());
+  OmFileLoadHelper load_helper;
+  ASSERT_EQ(load_helper.Init(model_data), SUCCESS);
+  for (size_t i = 0; i < datas.size(); ++i) {
+    ModelPartition partition;
+    EXPECT_EQ(load_helper.GetModelPartition(static_cast<ModelPartitionType>(i), partition), SUCCESS);
+    ASSERT_EQ(partition.size, datas[i].size());
+    EXPECT_EQ(memcmp(partition.data, datas[i].data(), partition.size), 0);
+  }
+}
+}  // namespace
+
+class UtestOmFileSaveHelper : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestOmFileSaveHelper, save_small_partitions) {
+  vector<vector<uint8_t>> datas = {CreatePartitionData(1000, 1), CreatePartitionData(4097, 2),
+                                   CreatePartitionData(33, 3), CreatePartitionData(100000, 4)};
+  SaveAndCheck(datas);
+}
+
+TEST_F(UtestOmFileSaveHelper, save_large_weights_in_chunks) {
+  // the weights are larger than the parallel write threshold and not a multiple of the chunk size
+  vector<vector<uint8_t>> datas = {CreatePartitionData(1000, 1), CreatePartitionData(70 * 1024 * 1024 + 3, 2),
+                                   CreatePartitionData(5000, 3)};
+  SaveAndCheck(datas);
+}
+
+TEST_F(UtestOmFileSaveHelper, save_chunk_checksums) {
+  vector<vector<uint8_t>> datas = {CreatePartitionData(1000, 1), CreatePartitionData(17 * 1024 * 1024, 2)};
+  OmFileSaveHelper save_helper;
+  for (size_t i = 0; i < datas.size(); ++i) {
+    ModelPartition partition;
+    partition.type = static_cast<ModelPartitionType>(i);
+    partition.data = datas[i].data();
+    partition.size = static_cast<uint32_t>(datas[i].size());
+    EXPECT_EQ(save_helper.AddPartition(partition), SUCCESS);
+  }
+  ModelBufferData model;
+  GetThreadLocalContext().SetGlobalOption({{OM_CHUNK_CHECKSUM, "true"}});
+  EXPECT_EQ(save_helper.SaveModelToFile(kOmFile, model, true), SUCCESS);
+  GetThreadLocalContext().SetGlobalOption({});
+
+  // size and modify time of the om file, header, partition table, one chunk of the small partition and two chunks
+  // of the large one
+  vector<uint8_t> file_data = ReadFile(kOmFile);
+  vector<uint8_t> checksum_data = ReadFile(kChecksumFile);
+  ASSERT_EQ(checksum_data.size(), sizeof(CacheFileHeader) + kStampSize + 5 * sizeof(OmChunkChecksum));
+  auto header = reinterpret_cast<const CacheFileHeader *>(checksum_data.data());
+  EXPECT_EQ(header->length, kStampSize + 5 * sizeof(OmChunkChecksum));
+  auto checksums =
+      reinterpret_cast<const OmChunkChecksum *>(checksum_data.data() + sizeof(CacheFileHeader) + kStampSize);
+  uint64_t offset = 0;
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_EQ(checksums[i].offset, offset);
+    ASSERT_LE(checksums[i].offset + checksums[i].size, file_data.size());
+    EXPECT_EQ(checksums[i].hash, ContentHash(file_data.data() + checksums[i].offset, checksums[i].size));
+    offset += checksums[i].size;
+  }
+  EXPECT_EQ(offset, file_data.size());
+
+  // the chunks are verified when the om file is loaded
+  EXPECT_EQ(FileSaver::CheckChecksumFile(kOmFile, file_data.data(), file_data.size()), SUCCESS);
+  file_data[file_data.size() - 1] ^= 0x1;
+  EXPECT_EQ(FileSaver::CheckChecksumFile(kOmFile, file_data.data(), file_data.size()),
+            GE_EXEC_READ_MODEL_FILE_FAILED);
+
+  // the checksum file is kept when the om file is saved again without checksums, but it does not belong to the new
+  // om file any more
+  OmFileSaveHelper other_helper;
+  ModelPartition partition;
+  partition.type = static_cast<ModelPartitionType>(0);
+  partition.data = datas[0].data();
+  partition.size = static_cast<uint32_t>(datas[0].size());
+  EXPECT_EQ(other_helper.AddPartition(partition), SUCCESS);
+  EXPECT_EQ(other_helper.SaveModelToFile(kOmFile, model, true), SUCCESS);
+  EXPECT_EQ(ReadFile(kChecksumFile), checksum_data);
+  file_data = ReadFile(kOmFile);
+  file_data[file_data.size() - 1] ^= 0x1;
+  EXPECT_EQ(FileSaver::CheckChecksumFile(kOmFile, file_data.data(), file_data.size()), SUCCESS);
+  (void)remove(kChecksumFile);
+  (void)remove(kOmFile);
+}
+}  // namespace ge
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "generator/compile_cache.h"
+
+#include "common/helper/model_cache_helper.h"
+#include "common/types.h"
+#include "compute_graph.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+
+using namespace ge;
+
+namespace {
+const char *const kCacheDir = "./compile_cache_ut";
+
+void RemoveCacheDir() {
+  std::string cmd = std::string("rm -rf ") + kCacheDir;
+  (void)system(cmd.c_str());
+}
+
+///   data   const
+///      \   /
+///       add
+ComputeGraphPtr CreateGraph(const std::string &graph_name, const std::string &add_name, uint8_t weight) {
+  auto graph = std::make_shared<ComputeGraph>(graph_name);
+  GeTensorDesc desc(GeShape({2}), FORMAT_ND, DT_UINT8);
+  auto data_desc = std::make_shared<OpDesc>("data", DATA);
+  data_desc->AddOutputDesc(desc);
+  auto const_desc = std::make_shared<OpDesc>("const", CONSTANT);
+  const_desc->AddOutputDesc(desc);
+  (void)AttrUtils::SetTensor(const_desc, ATTR_NAME_WEIGHTS,
+                             std::make_shared<GeTensor>(desc, std::vector<uint8_t>({1, weight})));
+  auto add_desc = std::make_shared<OpDesc>(add_name, ADD);
+  add_desc->AddInputDesc(desc);
+  add_desc->AddInputDesc(desc);
+  add_desc->AddOutputDesc(desc);
+  auto data = graph->AddNode(data_desc);
+  auto constant = graph->AddNode(const_desc);
+  auto add = graph->AddNode(add_desc);
+  (void)GraphUtils::AddEdge(data->GetOutDataAnchor(0), add->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(constant->GetOutDataAnchor(0), add->GetInDataAnchor(1));
+  return graph;
+}
+}  // namespace
+
+class UtestCompileCache : public testing::Test {
+ protected:
+  void SetUp() { RemoveCacheDir(); }
+  void TearDown() { RemoveCacheDir(); }
+};
+
+TEST_F(UtestCompileCache, canonical_graph_digest) {
+  std::string digest;
+  EXPECT_EQ(ModelCacheHelper::GetCanonicalGraphDigest(CreateGraph("graph", "add", 2), digest), SUCCESS);
+  EXPECT_EQ(digest.size(), 32);
+
+  // the name of root graph is left to the callers
+  std::string other_digest;
+  EXPECT_EQ(ModelCacheHelper::GetCanonicalGraphDigest(CreateGraph("other_graph", "add", 2), other_digest), SUCCESS);
+  EXPECT_EQ(digest, other_digest);
+
+  // the om keeps the names of ops, so a renamed op is a different model
+  EXPECT_EQ(ModelCacheHelper::GetCanonicalGraphDigest(CreateGraph("graph", "add_renamed", 2), other_digest),
+            SUCCESS);
+  EXPECT_NE(digest, other_digest);
+
+  EXPECT_EQ(ModelCacheHelper::GetCanonicalGraphDigest(CreateGraph("graph", "add", 3), other_digest), SUCCESS);
+  EXPECT_NE(digest, other_digest);
+}
+
+TEST_F(UtestCompileCache, generate_key) {
+  auto graph = CreateGraph("graph", "add", 2);
+  std::vector<GeTensor> inputs{GeTensor(GeTensorDesc(GeShape({2}), FORMAT_ND, DT_UINT8))};
+  CompileCacheKey key;
+  EXPECT_EQ(CompileCache::GenerateKey(graph, inputs, {{"option", "1"}}, key), SUCCESS);
+  EXPECT_EQ(key.key.size(), 32);
+  EXPECT_NE(key.signature.find("option"), std::string::npos);
+
+  CompileCacheKey other_key;
+  EXPECT_EQ(CompileCache::GenerateKey(graph, inputs, {{"option", "1"}}, other_key), SUCCESS);
+  EXPECT_EQ(key.key, other_key.key);
+  EXPECT_EQ(key.signature, other_key.signature);
+  EXPECT_EQ(CompileCache::GenerateKey(graph, inputs, {{"option", "2"}}, other_key), SUCCESS);
+  EXPECT_NE(key.key, other_key.key);
+  std::vector<GeTensor> other_inputs{GeTensor(GeTensorDesc(GeShape({4}), FORMAT_ND, DT_UINT8))};
+  EXPECT_EQ(CompileCache::GenerateKey(graph, other_inputs, {{"option", "1"}}, other_key), SUCCESS);
+  EXPECT_NE(key.key, other_key.key);
+  EXPECT_EQ(CompileCache::GenerateKey(graph, inputs, {{"option", "1"}, {"version.plugin", "2"}}, other_key),
+            SUCCESS);
+  EXPECT_NE(key.key, other_key.key);
+}
+
+TEST_F(UtestCompileCache, store_and_lookup) {
+  CompileCacheKey key = {"00000000000000000000000000000001", "graph;option=1"};
+  std::vector<uint8_t> om(100, 7);
+  {
+    CompileCache cache;
+    EXPECT_EQ(cache.Init(kCacheDir), SUCCESS);
+    ModelBufferData model;
+    EXPECT_FALSE(cache.Lookup(key, model));
+    EXPECT_EQ(cache.Store(key, om.data(), om.size()), SUCCESS);
+  }
+
+  // the model is shared by another build
+  CompileCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir), SUCCESS);
+  ModelBufferData model;
+  ASSERT_TRUE(cache.Lookup(key, model));
+  ASSERT_EQ(model.length, om.size());
+  EXPECT_EQ(memcmp(model.data.get(), om.data(), om.size()), 0);
+
+  // an entry of other signature under the same file name is a miss
+  CompileCacheKey colliding_key = {key.key, "graph;option=2"};
+  EXPECT_FALSE(cache.Lookup(colliding_key, model));
+  colliding_key.signature = "graph";
+  EXPECT_FALSE(cache.Lookup(colliding_key, model));
+}
+
+TEST_F(UtestCompileCache, invalid_file) {
+  CompileCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir), SUCCESS);
+  CompileCacheKey key = {"00000000000000000000000000000001", "graph;option=1"};
+  std::ofstream ofs(std::string(kCacheDir) + "/" + key.key + ".om", std::ios::binary);
+  ofs << "invalid";
+  ofs.close();
+  ModelBufferData model;
+  EXPECT_FALSE(cache.Lookup(key, model));
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define protected public
+#define private public
+#include "graph/build/graph_builder.h"
+#undef protected
+#undef private
+
+#include "common/types.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/graph_utils.h"
+
+namespace ge {
+namespace {
+const size_t kKnownGraphNum = 8;
+
+///   data
+///    |
+///  relu
+///    |
+/// netoutput
+ComputeGraphPtr BuildKnownGraph(const std::string &name) {
+  auto graph = std::make_shared<ComputeGraph>(name);
+  GeTensorDesc desc(GeShape({1, 16}), FORMAT_ND, DT_FLOAT);
+  auto data_desc = std::make_shared<OpDesc>(name + "_data", DATA);
+  data_desc->AddOutputDesc(desc);
+  auto relu_desc = std::make_shared<OpDesc>(name + "_relu", RELU);
+  relu_desc->AddInputDesc(desc);
+  relu_desc->AddOutputDesc(desc);
+  auto netoutput_desc = std::make_shared<OpDesc>(name + "_netoutput", NETOUTPUT);
+  netoutput_desc->AddInputDesc(desc);
+  auto data = graph->AddNode(data_desc);
+  auto relu = graph->AddNode(relu_desc);
+  auto netoutput = graph->AddNode(netoutput_desc);
+  (void)GraphUtils::AddEdge(data->GetOutDataAnchor(0), relu->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(relu->GetOutDataAnchor(0), netoutput->GetInDataAnchor(0));
+  (void)graph->TopologicalSorting();
+  return graph;
+}
+
+// Record the builds of the subgraphs, each model is named after its graph
+class OrderRecordingGraphBuilder : public GraphBuilder {
+ public:
+  std::vector<std::string> build_order;
+
+ private:
+  Status SecondPartition(ComputeGraphPtr &comp_graph, vector<SubGraphInfoPtr> &subgraph_ptr_list) override {
+    subgraph_ptr_list.clear();
+    return SUCCESS;
+  }
+  Status BuildForUnknownShapeGraph(ComputeGraphPtr &comp_graph, GeModelPtr &ge_model_ptr,
+                                   uint64_t session_id) override {
+    return CreateModel(comp_graph, ge_model_ptr);
+  }
+  Status BuildKnownShapeModel(ComputeGraphPtr &comp_graph, Graph2SubGraphInfoList &subgraph_map,
+                              GeModelPtr &ge_model_ptr, uint64_t session_id) override {
+    return CreateModel(comp_graph, ge_model_ptr);
+  }
+  Status CreateModel(const ComputeGraphPtr &comp_graph, GeModelPtr &ge_model_ptr) {
+    ge_model_ptr = std::make_shared<GeModel>();
+    ge_model_ptr->SetName(comp_graph->GetName());
+    std::lock_guard<std::mutex> lock(mutex_);
+    build_order.emplace_back(comp_graph->GetName());
+    return SUCCESS;
+  }
+  std::mutex mutex_;
+};
+
+///         root
+///  /    /    \     \
+/// k0   u1     k2    k3
+ComputeGraphPtr BuildDynamicShapeGraph(const std::vector<std::string> &subgraph_names) {
+  auto root_graph = std::make_shared<ComputeGraph>("root");
+  (void)AttrUtils::SetBool(root_graph, ATTR_NAME_DYNAMIC_SHAPE_PARTITIONED, true);
+  for (const auto &name : subgraph_names) {
+    auto op_desc = std::make_shared<OpDesc>(name + "_call", PARTITIONEDCALL);
+    op_desc->AddSubgraphName("f");
+    (void)op_desc->SetSubgraphInstanceName(0, name);
+    auto node = root_graph->AddNode(op_desc);
+    auto sub_graph = BuildKnownGraph(name);
+    sub_graph->SetGraphUnknownFlag(name[0] == 'u');
+    sub_graph->SetParentGraph(root_graph);
+    sub_graph->SetParentNode(node);
+    (void)root_graph->AddSubgraph(sub_graph);
+  }
+  return root_graph;
+}
+}  // namespace
+
+class UtestGraphBuilder : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestGraphBuilder, build_known_shape_graphs_with_multi_threads) {
+  std::vector<ComputeGraphPtr> known_graphs;
+  for (size_t i = 0; i < kKnownGraphNum; ++i) {
+    known_graphs.emplace_back(BuildKnownGraph("known_graph_" + std::to_string(i)));
+  }
+  std::vector<Graph2SubGraphInfoList> subgraph_maps(kKnownGraphNum);
+  std::vector<GeModelPtr> ge_models(kKnownGraphNum);
+
+  // the graphs are pre-built concurrently, then all the builds stop at the plugin calls since ge is not initialized
+  GraphBuilder builder;
+  EXPECT_EQ(builder.BuildKnownShapeGraphsWithMultiThreads(known_graphs, subgraph_maps, ge_models, 0),
+            GE_CLI_GE_NOT_INITIALIZED);
+  for (size_t i = 0; i < kKnownGraphNum; ++i) {
+    EXPECT_EQ(ge_models[i], nullptr);
+    auto relu = known_graphs[i]->FindNode(known_graphs[i]->GetName() + "_relu");
+    ASSERT_NE(relu, nullptr);
+    EXPECT_EQ(relu->GetOpDesc()->GetSrcName(), std::vector<std::string>({known_graphs[i]->GetName() + "_data"}));
+  }
+}
+
+TEST_F(UtestGraphBuilder, build_dynamic_shape_graph_in_subgraph_order) {
+  auto root_graph = BuildDynamicShapeGraph({"k0", "u1", "k2", "k3"});
+  OrderRecordingGraphBuilder builder;
+  std::vector<SubGraphInfoPtr> subgraph_ptr_list;
+  GeRootModelPtr ge_root_model = std::make_shared<GeRootModel>(root_graph);
+  GeModelPtr ge_model;
+  ASSERT_EQ(builder.BuildForDynamicShapeGraph(root_graph, subgraph_ptr_list, ge_root_model, ge_model, 0), SUCCESS);
+
+  // the unknown shape subgraph is built after the known ones before it and before the ones after it, the known
+  // shape subgraphs in a run are built concurrently in any order
+  ASSERT_EQ(builder.build_order.size(), 4);
+  EXPECT_EQ(builder.build_order[0], "k0");
+  EXPECT_EQ(builder.build_order[1], "u1");
+  std::sort(builder.build_order.begin() + 2, builder.build_order.end());
+  EXPECT_EQ(builder.build_order[2], "k2");
+  EXPECT_EQ(builder.build_order[3], "k3");
+
+  // each subgraph has its own model, ge_model is the model of the last subgraph
+  const auto &models = ge_root_model->GetSubgraphInstanceNameToModel();
+  ASSERT_EQ(models.size(), 4);
+  for (const auto &name : {"k0", "u1", "k2", "k3"}) {
+    auto iter = models.find(name);
+    ASSERT_NE(iter, models.end());
+    ASSERT_NE(iter->second, nullptr);
+    EXPECT_EQ(iter->second->GetName(), name);
+  }
+  ASSERT_NE(ge_model, nullptr);
+  EXPECT_EQ(ge_model->GetName(), "k3");
+
+  GeRootModelPtr built_root_model;
+  auto other_root_graph = BuildDynamicShapeGraph({"u0", "k1"});
+  OrderRecordingGraphBuilder other_builder;
+  ASSERT_EQ(other_builder.Build(other_root_graph, subgraph_ptr_list, built_root_model, 0), SUCCESS);
+  EXPECT_EQ(other_builder.build_order, std::vector<std::string>({"u0", "k1"}));
+  ASSERT_NE(built_root_model, nullptr);
+  EXPECT_EQ(built_root_model->GetSubgraphInstanceNameToModel().size(), 2);
+}
+}  // namespace ge
@@ -216,8 +216,11 @@ class UtestLogicalStreamAllocator : public testing::Test {
     map<string, SchedulerConf> scheduler_confs;
     scheduler_confs["scheduler"] = scheduler_conf;
     LogicalStreamAllocator allocator(scheduler_confs, max_parallel_num);
+    allocator.EnableCriticalPath(enable_critical_path_);
     int64_t stream_num = 0;
-    return allocator.Assign(whole_graph, subgraphs, stream_num);
+    Graph2SubGraphInfoList subgraph_map;
+    subgraph_map[whole_graph] = subgraphs;
+    return allocator.Assign(whole_graph, subgraph_map, stream_num);
   }
 
   Status AssignLogicalStreams(vector<SubGraphInfoPtr> subgraphs, std::map<std::string, int> &max_parallel_num,
@@ -315,6 +318,14 @@ class UtestLogicalStreamAllocator : public testing::Test {
     }
   }
 
+  void SetCost(SubGraphInfoPtr subgraph, int64_t cost) {
+    NodePtr node = subgraph->GetSubGraph()->FindNode("relu");
+    assert(node != nullptr);
+    (void)AttrUtils::SetInt(node->GetOpDesc(), "_op_cost", cost);
+  }
+
+  bool enable_critical_path_ = false;
+
   /// Set one graph:
   ///  stream id:       1     1                1
   ///                   B --> C(AllReduce) --- D
@@ -858,7 +869,7 @@ TEST_F(UtestLogicalStreamAllocator, test_all_reduce_parallel_pass) {
   std::map<std::string, int> max_parallel_num;
   LogicalStreamPass::Context context;
   context.next_stream = 5;
-  context.hcom_parallel = true;
+  context.enable_hcom_parallel = true;
   vector<LogicalStreamPass::SubgraphPtr> subgraphs;
   LogicalStreamPassPtr allreduce_pass = std::make_shared<AllReduceParallelPass>();
   ret = allreduce_pass->Run(graph, subgraphs, context);
@@ -866,4 +877,45 @@ TEST_F(UtestLogicalStreamAllocator, test_all_reduce_parallel_pass) {
   EXPECT_EQ(ret, NOT_CHANGED);
 }
 
+///                 -> B(100) -
+///                /           \
+/// Data -> A(1) --> C(50) -----> D(1)
+///                \           /
+///                 -> E(50) -
+/// By dependency, C and E take turns on two streams with A and B, E is launched after B.
+/// By critical path, A, B and D are on one stream, and C and E are on the other one.
+TEST_F(UtestLogicalStreamAllocator, test_critical_path_stream_pass) {
+  auto data = CreateDataSubgraph();
+  auto node_a = CreateSubgraphWithName("A", "aicore", "", 1, 3);
+  auto node_b = CreateSubgraphWithName("B", "aicore", "", 1, 1);
+  auto node_c = CreateSubgraphWithName("C", "aicore", "", 1, 1);
+  auto node_e = CreateSubgraphWithName("E", "aicore", "", 1, 1);
+  auto node_d = CreateSubgraphWithName("D", "aicore", "", 3, 1);
+  LinkSubGraph(data, "end", node_a, "placeholder");
+  LinkSubGraph(node_a, "end1", node_b, "placeholder");
+  LinkSubGraph(node_a, "end2", node_c, "placeholder");
+  LinkSubGraph(node_a, "end3", node_e, "placeholder");
+  LinkSubGraph(node_b, "end", node_d, "placeholder1");
+  LinkSubGraph(node_c, "end", node_d, "placeholder2");
+  LinkSubGraph(node_e, "end", node_d, "placeholder3");
+  SetCost(node_a, 1);
+  SetCost(node_b, 100);
+  SetCost(node_c, 50);
+  SetCost(node_e, 50);
+  SetCost(node_d, 1);
+
+  std::map<std::string, int> max_parallel_num;
+  max_parallel_num["aicore"] = 2;
+  Status status = AssignLogicalStreams({data, node_a, node_b, node_c, node_e, node_d}, max_parallel_num);
+  EXPECT_EQ(status, ge::SUCCESS);
+  EXPECT_EQ(GetStream(node_b), GetStream(node_e));
+
+  enable_critical_path_ = true;
+  status = AssignLogicalStreams({data, node_a, node_b, node_c, node_e, node_d}, max_parallel_num);
+  EXPECT_EQ(status, ge::SUCCESS);
+  EXPECT_EQ(GetStream(node_a), GetStream(node_b));
+  EXPECT_EQ(GetStream(node_b), GetStream(node_d));
+  EXPECT_EQ(GetStream(node_c), GetStream(node_e));
+  EXPECT_NE(GetStream(node_a), GetStream(node_c));
+}
 }  // namespace ge
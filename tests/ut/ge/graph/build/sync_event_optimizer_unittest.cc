@@ -0,0 +1,301 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "graph/build/sync_event_optimizer.h"
+
+#include "common/types.h"
+#include "graph/compute_graph.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+
+using namespace std;
+
+namespace ge {
+namespace {
+const int64_t kSyntheticStreamNum = 200;
+const int64_t kSyntheticLayerNum = 8;
+}  // namespace
+
+class UtestSyncEventOptimizer : public testing::Test {
+ protected:
+  void SetUp() { graph_ = make_shared<ComputeGraph>("graph"); }
+
+  void TearDown() {}
+
+  NodePtr AddNode(const string &name, int64_t stream_id, int in_num = 1) {
+    OpDescPtr op_desc = make_shared<OpDesc>(name, "testa");
+    for (int i = 0; i < in_num; ++i) {
+      op_desc->AddInputDesc(GeTensorDesc());
+    }
+    op_desc->AddOutputDesc(GeTensorDesc());
+    op_desc->SetStreamId(stream_id);
+    return graph_->AddNode(op_desc);
+  }
+
+  // insert an event for each edge between streams, as StreamAllocator::InsertSyncEvents does
+  void InsertEvents() {
+    for (const auto &node : graph_->GetDirectNode()) {
+      for (const auto &out_node : node->GetOutAllNodes()) {
+        if (node->GetOpDesc()->GetStreamId() != out_node->GetOpDesc()->GetStreamId()) {
+          send_events_[node].emplace_back(event_num_);
+          recv_events_[out_node].emplace_back(event_num_);
+          cross_stream_edges_.emplace_back(node, out_node);
+          ++event_num_;
+        }
+      }
+    }
+  }
+
+  vector<NodePtr> GetNodes() {
+    vector<NodePtr> nodes;
+    for (const auto &node : graph_->GetDirectNode()) {
+      nodes.emplace_back(node);
+    }
+    return nodes;
+  }
+
+  uint32_t CountEvents() const {
+    uint32_t event_num = 0;
+    for (const auto &one_pair : send_events_) {
+      event_num += one_pair.second.size();
+    }
+    return event_num;
+  }
+
+  // compute which nodes are launched after each node through stream order and events. Sends and receives of one
+  // event id are paired in order, as the hardware does
+  void BuildReachability() {
+    vector<NodePtr> nodes = GetNodes();
+    map<NodePtr, size_t> node_index;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      node_index[nodes[i]] = i;
+    }
+    vector<vector<size_t>> out_nodes(nodes.size());
+    map<int64_t, size_t> last_nodes;
+    map<uint32_t, vector<size_t>> id_to_senders;
+    map<uint32_t, size_t> id_to_recv_num;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      auto iter = last_nodes.find(nodes[i]->GetOpDesc()->GetStreamId());
+      if (iter != last_nodes.end()) {
+        out_nodes[iter->second].emplace_back(i);
+      }
+      last_nodes[nodes[i]->GetOpDesc()->GetStreamId()] = i;
+      for (auto event_id : recv_events_[nodes[i]]) {
+        const auto &senders = id_to_senders[event_id];
+        size_t recv_index = id_to_recv_num[event_id]++;
+        ASSERT_LT(recv_index, senders.size()) << nodes[i]->GetName() << " waits before event is sent";
+        out_nodes[senders[recv_index]].emplace_back(i);
+      }
+      for (auto event_id : send_events_[nodes[i]]) {
+        id_to_senders[event_id].emplace_back(i);
+      }
+    }
+
+    // nodes are in topological order, so successors are done before a node in reverse order
+    reachable_.assign(nodes.size(), vector<bool>(nodes.size(), false));
+    for (size_t i = nodes.size(); i > 0; --i) {
+      auto &reachable = reachable_[i - 1];
+      reachable[i - 1] = true;
+      for (auto out_index : out_nodes[i - 1]) {
+        for (size_t j = out_index; j < nodes.size(); ++j) {
+          if (reachable_[out_index][j]) {
+            reachable[j] = true;
+          }
+        }
+      }
+    }
+    node_index_.swap(node_index);
+  }
+
+  bool IsOrdered(const NodePtr &src, const NodePtr &dst) { return reachable_[node_index_[src]][node_index_[dst]]; }
+
+  void CheckEdgesOrdered() {
+    BuildReachability();
+    for (const auto &edge : cross_stream_edges_) {
+      EXPECT_TRUE(IsOrdered(edge.first, edge.second))
+          << edge.first->GetName() << " -> " << edge.second->GetName() << " is not ordered";
+    }
+  }
+
+  // pairs given the same id must wait one after another
+  void CheckReusedEventsOrdered() {
+    map<uint32_t, vector<NodePtr>> id_to_senders;
+    map<uint32_t, vector<NodePtr>> id_to_receivers;
+    for (const auto &node : graph_->GetDirectNode()) {
+      for (auto event_id : send_events_[node]) {
+        id_to_senders[event_id].emplace_back(node);
+      }
+      for (auto event_id : recv_events_[node]) {
+        id_to_receivers[event_id].emplace_back(node);
+      }
+    }
+    for (const auto &one_pair : id_to_senders) {
+      const auto &receivers = id_to_receivers[one_pair.first];
+      ASSERT_EQ(one_pair.second.size(), receivers.size());
+      for (size_t i = 1; i < receivers.size(); ++i) {
+        EXPECT_TRUE(IsOrdered(receivers[i - 1], one_pair.second[i]))
+            << "event " << one_pair.first << " is sent by " << one_pair.second[i]->GetName() << " before "
+            << receivers[i - 1]->GetName() << " waits";
+      }
+    }
+  }
+
+  void Optimize(const string &graph_desc) {
+    uint32_t inserted_num = CountEvents();
+    uint32_t removed_num = 0;
+    SyncEventOptimizer optimizer(send_events_, recv_events_);
+    ASSERT_EQ(optimizer.RemoveRedundantEvents(GetNodes(), removed_num), SUCCESS);
+    CheckEdgesOrdered();
+    ASSERT_EQ(CountEvents(), inserted_num - removed_num);
+
+    // make event ids continuous as StreamAllocator::RefreshContinuousEvents does
+    map<uint32_t, uint32_t> old_to_new_events;
+    for (auto &one_pair : send_events_) {
+      for (auto &event_id : one_pair.second) {
+        old_to_new_events.emplace(event_id, old_to_new_events.size());
+      }
+    }
+    for (auto &one_pair : send_events_) {
+      for (auto &event_id : one_pair.second) {
+        event_id = old_to_new_events[event_id];
+      }
+    }
+    for (auto &one_pair : recv_events_) {
+      for (auto &event_id : one_pair.second) {
+        event_id = old_to_new_events[event_id];
+      }
+    }
+    event_num_ = old_to_new_events.size();
+    ASSERT_EQ(optimizer.ReuseEventIds(GetNodes(), event_num_), SUCCESS);
+    CheckEdgesOrdered();
+    CheckReusedEventsOrdered();
+    cout << graph_desc << ": " << inserted_num << " events inserted, " << inserted_num - removed_num
+         << " after transitive reduction, " << event_num_ << " ids after reuse." << endl;
+  }
+
+  ComputeGraphPtr graph_;
+  map<NodePtr, vector<uint32_t>> send_events_;
+  map<NodePtr, vector<uint32_t>> recv_events_;
+  vector<pair<NodePtr, NodePtr>> cross_stream_edges_;
+  uint32_t event_num_ = 0;
+  map<NodePtr, size_t> node_index_;
+  vector<vector<bool>> reachable_;
+};
+
+///  stream id:       1     1                1
+///                   B --> C(AllReduce) --- D
+///                  /
+///  stream id:  0  A
+///                  \
+///                   E --> F(AllReduce) --- G
+///  stream id:       2     2                2
+TEST_F(UtestSyncEventOptimizer, all_reduce_graph) {
+  auto node_a = AddNode("A", 0);
+  auto node_b = AddNode("B", 1);
+  auto node_c = AddNode("C", 1);
+  auto node_d = AddNode("D", 1);
+  auto node_e = AddNode("E", 2);
+  auto node_f = AddNode("F", 2);
+  auto node_g = AddNode("G", 2);
+  GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_b->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_e->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_b->GetOutDataAnchor(0), node_c->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_c->GetOutDataAnchor(0), node_d->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_e->GetOutDataAnchor(0), node_f->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_f->GetOutDataAnchor(0), node_g->GetInDataAnchor(0));
+  InsertEvents();
+
+  Optimize("all reduce graph");
+  EXPECT_EQ(CountEvents(), 2);
+  EXPECT_EQ(event_num_, 2);
+}
+
+/// Stream0            Stream1            Stream2
+///    A - - - - - - >  B - - - - - - - >  C
+///    |                                   ^
+///     - - - - - - - - - - - - - - - - - -
+///    D < - - - - - - - - - - - - - - - - C
+TEST_F(UtestSyncEventOptimizer, transitive_reduction_and_reuse) {
+  auto node_a = AddNode("A", 0);
+  auto node_b = AddNode("B", 1);
+  auto node_c = AddNode("C", 2, 2);
+  auto node_d = AddNode("D", 0);
+  GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_b->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_b->GetOutDataAnchor(0), node_c->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_c->GetInDataAnchor(1));
+  GraphUtils::AddEdge(node_c->GetOutDataAnchor(0), node_d->GetInDataAnchor(0));
+  InsertEvents();
+
+  Optimize("transitive graph");
+  // A -> C is implied by A -> B -> C
+  EXPECT_EQ(CountEvents(), 3);
+  EXPECT_TRUE(send_events_[node_a].size() == 1);
+  // each event is sent after the previous one is received, so all of them share one id
+  EXPECT_EQ(event_num_, 1);
+}
+
+TEST_F(UtestSyncEventOptimizer, stream_label_not_optimized) {
+  auto node_a = AddNode("A", 0);
+  auto node_b = AddNode("B", 1);
+  auto node_c = AddNode("C", 2, 2);
+  GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_b->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_b->GetOutDataAnchor(0), node_c->GetInDataAnchor(0));
+  GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_c->GetInDataAnchor(1));
+  (void)AttrUtils::SetStr(node_b->GetOpDesc(), ATTR_NAME_STREAM_LABEL, "label");
+  InsertEvents();
+
+  Optimize("labeled graph");
+  EXPECT_EQ(CountEvents(), 3);
+  EXPECT_EQ(event_num_, 3);
+}
+
+/// Layers of nodes, one on each stream. Each node reads the nodes of the previous layer on its own stream and the
+/// next two streams, and the first node of the previous layer.
+TEST_F(UtestSyncEventOptimizer, synthetic_multi_stream_graph) {
+  vector<NodePtr> last_layer;
+  for (int64_t layer = 0; layer < kSyntheticLayerNum; ++layer) {
+    vector<NodePtr> cur_layer;
+    for (int64_t stream = 0; stream < kSyntheticStreamNum; ++stream) {
+      auto node = AddNode("node_" + to_string(layer) + "_" + to_string(stream), stream, 4);
+      if (!last_layer.empty()) {
+        GraphUtils::AddEdge(last_layer[stream]->GetOutDataAnchor(0), node->GetInDataAnchor(0));
+        GraphUtils::AddEdge(last_layer[(stream + 1) % kSyntheticStreamNum]->GetOutDataAnchor(0),
+                            node->GetInDataAnchor(1));
+        GraphUtils::AddEdge(last_layer[(stream + 2) % kSyntheticStreamNum]->GetOutDataAnchor(0),
+                            node->GetInDataAnchor(2));
+        if (stream > 2) {
+          GraphUtils::AddEdge(last_layer[0]->GetOutDataAnchor(0), node->GetInDataAnchor(3));
+        }
+      }
+      cur_layer.emplace_back(node);
+    }
+    last_layer.swap(cur_layer);
+  }
+  InsertEvents();
+
+  uint32_t inserted_num = CountEvents();
+  Optimize(to_string(kSyntheticStreamNum) + " streams graph");
+  EXPECT_LT(CountEvents(), inserted_num);
+  EXPECT_LT(event_num_, CountEvents());
+}
+}  // namespace ge
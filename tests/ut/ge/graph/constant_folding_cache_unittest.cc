@@ -0,0 +1,182 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include "graph/common/constant_folding_cache.h"
+
+#include "compute_graph.h"
+#include "graph/utils/attr_utils.h"
+
+using namespace ge;
+
+namespace {
+const char *const kCacheDir = "./constant_folding_cache_ut";
+
+const char *const kVersion = "ge:1.0;opp:1.0";
+
+GeTensorPtr CreateTensor(const std::vector<uint8_t> &data) {
+  GeTensorDesc desc(GeShape({static_cast<int64_t>(data.size())}), FORMAT_ND, DT_UINT8);
+  return std::make_shared<GeTensor>(desc, data);
+}
+
+// inputs large enough to be cached
+GeTensorPtr CreateInput(uint8_t value) { return CreateTensor(std::vector<uint8_t>(4096, value)); }
+
+void RemoveCacheDir() {
+  std::string cmd = std::string("rm -rf ") + kCacheDir;
+  (void)system(cmd.c_str());
+}
+}  // namespace
+
+class UtestConstantFoldingCache : public testing::Test {
+ protected:
+  void SetUp() {
+    RemoveCacheDir();
+    graph_ = std::make_shared<ComputeGraph>("test");
+    auto op_desc = std::make_shared<OpDesc>("add", "Add");
+    op_desc->AddInputDesc(GeTensorDesc(GeShape({2}), FORMAT_ND, DT_UINT8));
+    op_desc->AddOutputDesc(GeTensorDesc(GeShape({2}), FORMAT_ND, DT_UINT8));
+    node_ = graph_->AddNode(op_desc);
+  }
+
+  void TearDown() { RemoveCacheDir(); }
+
+  ComputeGraphPtr graph_;
+  NodePtr node_;
+};
+
+TEST_F(UtestConstantFoldingCache, generate_key) {
+  ConstantFoldingCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+  std::vector<ConstGeTensorPtr> inputs{CreateInput(1)};
+  std::string key = cache.GenerateKey(node_, inputs);
+  EXPECT_EQ(key.size(), 32);
+  EXPECT_EQ(key, cache.GenerateKey(node_, inputs));
+
+  std::vector<ConstGeTensorPtr> other_inputs{CreateInput(2)};
+  EXPECT_NE(key, cache.GenerateKey(node_, other_inputs));
+  (void)AttrUtils::SetInt(node_->GetOpDesc(), "axis", 1);
+  EXPECT_NE(key, cache.GenerateKey(node_, inputs));
+  EXPECT_EQ(cache.GenerateKey(nullptr, inputs), "");
+
+  // the results of other versions are not used
+  ConstantFoldingCache upgraded_cache;
+  EXPECT_EQ(upgraded_cache.Init(kCacheDir, 1024 * 1024, "ge:1.1;opp:1.0"), SUCCESS);
+  EXPECT_NE(cache.GenerateKey(node_, inputs), upgraded_cache.GenerateKey(node_, inputs));
+
+  // small inputs are folded without cache
+  std::vector<ConstGeTensorPtr> small_inputs{CreateTensor({1, 2})};
+  EXPECT_EQ(cache.GenerateKey(node_, small_inputs), "");
+}
+
+TEST_F(UtestConstantFoldingCache, store_and_lookup) {
+  std::vector<ConstGeTensorPtr> inputs{CreateInput(1)};
+  std::string key;
+  {
+    ConstantFoldingCache cache;
+    EXPECT_EQ(cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+    key = cache.GenerateKey(node_, inputs);
+    std::vector<GeTensorPtr> outputs;
+    EXPECT_FALSE(cache.Lookup(key, inputs, outputs));
+    EXPECT_EQ(cache.Store(key, inputs, {CreateTensor({3, 4})}), SUCCESS);
+    EXPECT_EQ(cache.GetMissCount(), 1);
+  }
+
+  // the result is shared by another build
+  ConstantFoldingCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+  std::vector<GeTensorPtr> outputs;
+  ASSERT_TRUE(cache.Lookup(key, inputs, outputs));
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_EQ(outputs[0]->GetTensorDesc().GetShape().GetDims(), std::vector<int64_t>({2}));
+  EXPECT_EQ(outputs[0]->GetData().size(), 2);
+  EXPECT_EQ(outputs[0]->GetData()[1], 4);
+  EXPECT_EQ(cache.GetHitCount(), 1);
+}
+
+TEST_F(UtestConstantFoldingCache, digest_collision) {
+  ConstantFoldingCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+  std::vector<ConstGeTensorPtr> inputs{CreateInput(1)};
+  std::string key = cache.GenerateKey(node_, inputs);
+  EXPECT_EQ(cache.Store(key, inputs, {CreateTensor({3, 4})}), SUCCESS);
+
+  // inputs of other data or desc under the same key are a miss
+  std::vector<GeTensorPtr> outputs;
+  EXPECT_FALSE(cache.Lookup(key, {CreateInput(2)}, outputs));
+  GeTensorPtr reshaped = CreateInput(1);
+  reshaped->MutableTensorDesc().SetShape(GeShape({64, 64}));
+  EXPECT_FALSE(cache.Lookup(key, {reshaped}, outputs));
+  EXPECT_FALSE(cache.Lookup(key, {}, outputs));
+  EXPECT_TRUE(outputs.empty());
+  EXPECT_TRUE(cache.Lookup(key, inputs, outputs));
+}
+
+TEST_F(UtestConstantFoldingCache, invalid_file) {
+  ConstantFoldingCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+  std::string key = "00000000000000000000000000000001";
+  std::ofstream ofs(std::string(kCacheDir) + "/" + key + ".fold", std::ios::binary);
+  ofs << "invalid";
+  ofs.close();
+
+  ConstantFoldingCache reopened_cache;
+  EXPECT_EQ(reopened_cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+  std::vector<GeTensorPtr> outputs;
+  EXPECT_FALSE(reopened_cache.Lookup(key, {CreateInput(1)}, outputs));
+  EXPECT_EQ(reopened_cache.GetTotalSize(), 0);
+}
+
+TEST_F(UtestConstantFoldingCache, evict) {
+  ConstantFoldingCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir, 0, kVersion), SUCCESS);
+  std::vector<ConstGeTensorPtr> inputs{CreateInput(1)};
+  std::string key = cache.GenerateKey(node_, inputs);
+  EXPECT_EQ(cache.Store(key, inputs, {CreateTensor({3, 4})}), SUCCESS);
+  EXPECT_GT(cache.GetTotalSize(), 0);
+  cache.Evict();
+  EXPECT_EQ(cache.GetTotalSize(), 0);
+  std::vector<GeTensorPtr> outputs;
+  EXPECT_FALSE(cache.Lookup(key, inputs, outputs));
+}
+
+TEST_F(UtestConstantFoldingCache, concurrent_store) {
+  ConstantFoldingCache cache;
+  EXPECT_EQ(cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+  std::vector<ConstGeTensorPtr> inputs{CreateInput(1)};
+  std::string key = cache.GenerateKey(node_, inputs);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back(
+        [&cache, &key, &inputs]() { EXPECT_EQ(cache.Store(key, inputs, {CreateTensor({3, 4})}), SUCCESS); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  uint64_t total_size = cache.GetTotalSize();
+  EXPECT_GT(total_size, 0);
+
+  // the entry is counted once
+  ConstantFoldingCache reopened_cache;
+  EXPECT_EQ(reopened_cache.Init(kCacheDir, 1024 * 1024, kVersion), SUCCESS);
+  EXPECT_EQ(reopened_cache.GetTotalSize(), total_size);
+  std::vector<GeTensorPtr> outputs;
+  EXPECT_TRUE(reopened_cache.Lookup(key, inputs, outputs));
+}
@@ -0,0 +1,137 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#define private public
+#define protected public
+#include "graph/execute/graph_execute.h"
+#undef private
+#undef protected
+
+using namespace std;
+
+namespace ge {
+namespace {
+GraphExecutor::IoPlan CreateIoPlan(const vector<uint64_t> &output_sizes) {
+  GraphExecutor::IoPlan io_plan;
+  for (auto size : output_sizes) {
+    InputOutputDescInfo desc;
+    desc.size = size;
+    desc.data_type = DT_UINT8;
+    desc.shape_info.dims = {static_cast<int64_t>(size)};
+    io_plan.outputs_desc.push_back(desc);
+    io_plan.output_tensor_desc.emplace_back(GeShape({static_cast<int64_t>(size)}), FORMAT_ND, DT_UINT8);
+  }
+  return io_plan;
+}
+}  // namespace
+
+class UtestGraphExecute : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestGraphExecute, io_plan_keyed_by_model_id) {
+  GraphExecutor executor;
+  executor.io_plans_[1] = make_shared<GraphExecutor::IoPlan>(CreateIoPlan({16}));
+  executor.io_plans_[2] = make_shared<GraphExecutor::IoPlan>(CreateIoPlan({16, 32}));
+
+  shared_ptr<const GraphExecutor::IoPlan> io_plan;
+  EXPECT_EQ(executor.GetIoPlan(1, io_plan), SUCCESS);
+  ASSERT_NE(io_plan, nullptr);
+  EXPECT_EQ(io_plan->outputs_desc.size(), 1);
+  EXPECT_EQ(executor.GetIoPlan(2, io_plan), SUCCESS);
+  ASSERT_NE(io_plan, nullptr);
+  EXPECT_EQ(io_plan->outputs_desc.size(), 2);
+
+  // switching graphs keeps the plans
+  vector<GeTensor> outputs;
+  EXPECT_NE(executor.ExecuteGraph(1, nullptr, {}, outputs), SUCCESS);
+  EXPECT_NE(executor.ExecuteGraph(2, nullptr, {}, outputs), SUCCESS);
+  EXPECT_EQ(executor.io_plans_.size(), 2);
+
+  // a plan released by another thread stays valid for the execution holding it
+  shared_ptr<const GraphExecutor::IoPlan> held_plan;
+  EXPECT_EQ(executor.GetIoPlan(1, held_plan), SUCCESS);
+  executor.ReleaseIoPlan(1);
+  EXPECT_EQ(executor.io_plans_.count(1), 0);
+  ASSERT_NE(held_plan, nullptr);
+  EXPECT_EQ(held_plan->outputs_desc.size(), 1);
+
+  // the plan of an unloaded model is rebuilt, which fails since the model is not loaded
+  EXPECT_NE(executor.GetIoPlan(1, io_plan), SUCCESS);
+  EXPECT_EQ(executor.io_plans_.size(), 1);
+
+  EXPECT_EQ(executor.FreeExecuteMemory(), SUCCESS);
+  EXPECT_TRUE(executor.io_plans_.empty());
+}
+
+TEST_F(UtestGraphExecute, prepare_output_data_creates_new_tensors) {
+  auto io_plan = CreateIoPlan({16, 64});
+  OutputData output_data;
+  vector<GeTensor> new_output_tensor;
+  EXPECT_EQ(GraphExecutor::PrepareOutputData(io_plan, output_data, new_output_tensor), SUCCESS);
+  ASSERT_EQ(output_data.blobs.size(), 2);
+  ASSERT_EQ(new_output_tensor.size(), 2);
+  for (size_t i = 0; i < new_output_tensor.size(); ++i) {
+    EXPECT_EQ(output_data.blobs[i].length, io_plan.outputs_desc[i].size);
+    EXPECT_EQ(output_data.blobs[i].data, new_output_tensor[i].GetData().data());
+    EXPECT_EQ(new_output_tensor[i].GetData().size(), io_plan.outputs_desc[i].size);
+    EXPECT_EQ(new_output_tensor[i].GetTensorDesc().GetShape().GetDims(),
+              vector<int64_t>({static_cast<int64_t>(io_plan.outputs_desc[i].size)}));
+  }
+
+  // each execution gets its own output storage
+  OutputData next_output_data;
+  vector<GeTensor> next_output_tensor;
+  EXPECT_EQ(GraphExecutor::PrepareOutputData(io_plan, next_output_data, next_output_tensor), SUCCESS);
+  ASSERT_EQ(next_output_data.blobs.size(), 2);
+  EXPECT_NE(next_output_data.blobs[0].data, output_data.blobs[0].data);
+}
+
+TEST_F(UtestGraphExecute, input_staging_buffers_reused_while_large_enough) {
+  GraphExecutor executor;
+  vector<GeTensor> inputs(2);
+  vector<uint8_t> small(8, 1);
+  vector<uint8_t> large(128, 2);
+  inputs[0].SetData(small);
+  inputs[1].SetData(large);
+
+  InputData input_data;
+  EXPECT_EQ(executor.PrepareInputData(inputs, input_data), SUCCESS);
+  ASSERT_EQ(input_data.blobs.size(), 2);
+  auto second_addr = input_data.blobs[1].data;
+
+  // the first slot grows and is reallocated, the second one is kept
+  inputs[0].SetData(large);
+  inputs[1].SetData(small);
+  InputData next_input_data;
+  EXPECT_EQ(executor.PrepareInputData(inputs, next_input_data), SUCCESS);
+  ASSERT_EQ(next_input_data.blobs.size(), 2);
+  EXPECT_EQ(next_input_data.blobs[0].length, large.size());
+  EXPECT_EQ(next_input_data.blobs[1].data, second_addr);
+  EXPECT_EQ(next_input_data.blobs[1].length, small.size());
+  EXPECT_EQ(executor.buffer_size_[0], large.size());
+  EXPECT_EQ(executor.buffer_size_[1], large.size());
+
+  EXPECT_EQ(executor.FreeExecuteMemory(), SUCCESS);
+  EXPECT_TRUE(executor.buffer_addr_.empty());
+}
+}  // namespace ge
@@ -0,0 +1,114 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/passes/common_subexpression_elimination_pass.h"
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common/types.h"
+#include "graph/utils/attr_utils.h"
+#include "graph_builder_utils.h"
+#include "inc/kernel.h"
+#include "inc/kernel_factory.h"
+
+namespace ge {
+const char *CseAdd = "CseAdd";
+
+namespace {
+class TestCseAddKernel : public Kernel {
+ public:
+  Status Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge::ConstGeTensorPtr> &input,
+                 std::vector<ge::GeTensorPtr> &v_output) override {
+    return NOT_CHANGED;
+  }
+};
+REGISTER_KERNEL(CseAdd, TestCseAddKernel);
+
+///      netoutput
+///      /       \
+///   add3       add4
+///    |          |
+///   add1       add2
+///     \\       //
+///        data
+ComputeGraphPtr BuildGraph(NodePtr &add1, NodePtr &add2, NodePtr &add3, NodePtr &add4) {
+  ut::GraphBuilder builder("g1");
+  auto data = builder.AddNode("data", DATA, 0, 1);
+  add1 = builder.AddNode("add1", CseAdd, 2, 1);
+  add2 = builder.AddNode("add2", CseAdd, 2, 1);
+  add3 = builder.AddNode("add3", CseAdd, 1, 1);
+  add4 = builder.AddNode("add4", CseAdd, 1, 1);
+  auto netoutput = builder.AddNode("netoutput", NETOUTPUT, 2, 0);
+  builder.AddDataEdge(data, 0, add1, 0);
+  builder.AddDataEdge(data, 0, add1, 1);
+  builder.AddDataEdge(data, 0, add2, 0);
+  builder.AddDataEdge(data, 0, add2, 1);
+  builder.AddDataEdge(add1, 0, add3, 0);
+  builder.AddDataEdge(add2, 0, add4, 0);
+  builder.AddDataEdge(add3, 0, netoutput, 0);
+  builder.AddDataEdge(add4, 0, netoutput, 1);
+  return builder.GetGraph();
+}
+}  // namespace
+
+class UtestCommonSubexpressionEliminationPass : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestCommonSubexpressionEliminationPass, same_nodes_removed_to_fixpoint) {
+  NodePtr add1, add2, add3, add4;
+  auto graph = BuildGraph(add1, add2, add3, add4);
+  // the attrs are equal regardless of the order they are set
+  (void)AttrUtils::SetInt(add1->GetOpDesc(), "axis", 1);
+  (void)AttrUtils::SetListFloat(add1->GetOpDesc(), "alpha", {1.0, 2.0});
+  (void)AttrUtils::SetListFloat(add2->GetOpDesc(), "alpha", {1.0, 2.0});
+  (void)AttrUtils::SetInt(add2->GetOpDesc(), "axis", 1);
+
+  CommonSubexpressionEliminationPass pass;
+  EXPECT_EQ(pass.Run(graph), SUCCESS);
+  EXPECT_EQ(graph->GetDirectNodesSize(), 4);
+  auto netoutput = graph->FindNode("netoutput");
+  ASSERT_NE(netoutput, nullptr);
+  auto src_node0 = netoutput->GetInDataAnchor(0)->GetPeerOutAnchor()->GetOwnerNode();
+  auto src_node1 = netoutput->GetInDataAnchor(1)->GetPeerOutAnchor()->GetOwnerNode();
+  EXPECT_EQ(src_node0, src_node1);
+}
+
+TEST_F(UtestCommonSubexpressionEliminationPass, different_attrs_kept) {
+  NodePtr add1, add2, add3, add4;
+  auto graph = BuildGraph(add1, add2, add3, add4);
+  (void)AttrUtils::SetListFloat(add1->GetOpDesc(), "alpha", {1.0, 2.0});
+  (void)AttrUtils::SetListFloat(add2->GetOpDesc(), "alpha", {1.0, 3.0});
+
+  CommonSubexpressionEliminationPass pass;
+  EXPECT_EQ(pass.Run(graph), SUCCESS);
+  EXPECT_EQ(graph->GetDirectNodesSize(), 6);
+
+  // a tensor attr is only told apart by the full comparison
+  auto graph2 = BuildGraph(add1, add2, add3, add4);
+  GeTensorDesc desc(GeShape({1}), FORMAT_ND, DT_UINT8);
+  (void)AttrUtils::SetTensor(add1->GetOpDesc(), "value", std::make_shared<GeTensor>(desc, std::vector<uint8_t>{1}));
+  (void)AttrUtils::SetTensor(add2->GetOpDesc(), "value", std::make_shared<GeTensor>(desc, std::vector<uint8_t>{2}));
+  EXPECT_EQ(AttrUtils::GetAllAttrsHash(add1->GetOpDesc()), AttrUtils::GetAllAttrsHash(add2->GetOpDesc()));
+  EXPECT_FALSE(AttrUtils::IsAllAttrsEqual(add1->GetOpDesc(), add2->GetOpDesc()));
+  EXPECT_EQ(pass.Run(graph2), SUCCESS);
+  EXPECT_EQ(graph2->GetDirectNodesSize(), 6);
+}
+}  // namespace ge
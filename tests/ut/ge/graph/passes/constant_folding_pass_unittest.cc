@@ -625,6 +625,37 @@ TEST_F(UtestGraphPassesConstantFoldingPass, continues_fold) {
   }
 }
 
+TEST_F(UtestGraphPassesConstantFoldingPass, continues_fold_frontiers) {
+  auto graph = BuildGraph6();
+  ConstantFoldingPass pass;
+  EXPECT_EQ(pass.RunFrontiers(graph, 4), SUCCESS);
+  EXPECT_EQ(graph->GetAllNodes().size(), 3);
+  auto shape1 = graph->FindNode("shape1");
+  EXPECT_NE(shape1, nullptr);
+  EXPECT_EQ(shape1->GetInNodes().size(), 1);
+
+  auto folded_const = shape1->GetInDataNodes().at(0);
+  EXPECT_EQ(folded_const->GetType(), CONSTANT);
+  auto tensor = folded_const->GetOpDesc()->GetOutputDesc(0);
+  EXPECT_EQ(tensor.GetDataType(), DT_UINT8);
+  EXPECT_EQ(tensor.GetShape().GetDims(), std::vector<int64_t>({5}));
+  EXPECT_EQ(pass.GetGeConstantFoldingPerfStatistic().size(), 2);
+}
+
+TEST_F(UtestGraphPassesConstantFoldingPass, multiple_output_frontiers) {
+  auto graph = BuildGraph7();
+  ConstantFoldingPass pass;
+  EXPECT_EQ(pass.RunFrontiers(graph, 4), SUCCESS);
+  EXPECT_EQ(graph->GetAllNodes().size(), 5);
+
+  auto shape2 = graph->FindNode("shape2");
+  EXPECT_NE(shape2, nullptr);
+  auto folded_const2 = shape2->GetInDataNodes().at(0);
+  EXPECT_EQ(folded_const2->GetType(), CONSTANT);
+  auto tensor2 = folded_const2->GetOpDesc()->GetOutputDesc(0);
+  EXPECT_EQ(tensor2.GetShape().GetDims(), std::vector<int64_t>({2, 3}));
+}
+
 TEST_F(UtestGraphPassesConstantFoldingPass, multiple_output) {
   auto graph = BuildGraph7();
   NamesToPass names_to_pass;
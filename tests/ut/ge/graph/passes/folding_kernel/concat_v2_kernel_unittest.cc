@@ -34,6 +34,7 @@
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/op_desc_utils.h"
 #include "graph/utils/tensor_utils.h"
+#include "graph/utils/type_utils.h"
 #include "inc/kernel_factory.h"
 #undef protected
 #undef private
@@ -288,3 +289,69 @@ TEST_F(UtestGraphPassesFoldingKernelConcatV2Kernel, CheckNotChange) {
   status = kernel->Compute(op_desc_ptr, input_not_support, outputs);
   EXPECT_EQ(status, NOT_CHANGED);
 }
+
+namespace {
+// the inputs of [2, 3, N, 4] with N of 1, 2 and 3, filled by the byte index
+vector<ConstGeTensorPtr> CreateConcatInputs(DataType data_type, int32_t axis, vector<vector<uint8_t>> &data) {
+  uint32_t length = 0;
+  (void)TypeUtils::GetDataTypeLength(data_type, length);
+  vector<ConstGeTensorPtr> input;
+  for (int64_t n = 1; n <= 3; n++) {
+    vector<int64_t> dims = {2, 3, 4};
+    dims.insert(dims.begin() + axis, n);
+    GeShape shape(dims);
+    vector<uint8_t> bytes(static_cast<size_t>(shape.GetShapeSize()) * length);
+    for (size_t i = 0; i < bytes.size(); i++) {
+      bytes[i] = static_cast<uint8_t>(i * 7 + n);
+    }
+    GeTensorDesc tensor_desc(shape, FORMAT_ND, data_type);
+    input.push_back(std::make_shared<GeTensor>(tensor_desc, bytes.data(), bytes.size()));
+    data.push_back(bytes);
+  }
+  vector<int32_t> axis_data = {axis};
+  GeTensorDesc axis_desc(GeShape(), FORMAT_ND, DT_INT32);
+  input.push_back(std::make_shared<GeTensor>(axis_desc, (uint8_t *)axis_data.data(), sizeof(int32_t)));
+  return input;
+}
+
+// the element by element implementation of ConcatV2
+vector<uint8_t> ConcatReference(const vector<ConstGeTensorPtr> &input, int32_t axis, uint32_t length) {
+  int64_t loop = 1;
+  for (int32_t i = 0; i < axis; i++) {
+    loop *= input[0]->GetTensorDesc().GetShape().GetDim(i);
+  }
+  vector<uint8_t> output;
+  for (int64_t i = 0; i < loop; i++) {
+    for (size_t k = 0; k + 1 < input.size(); k++) {
+      int64_t gapk = input[k]->GetTensorDesc().GetShape().GetShapeSize() / loop;
+      const uint8_t *datak = input[k]->GetData().data();
+      for (int64_t j = 0; j < gapk * length; j++) {
+        output.push_back(datak[j + gapk * length * i]);
+      }
+    }
+  }
+  return output;
+}
+}  // namespace
+
+TEST_F(UtestGraphPassesFoldingKernelConcatV2Kernel, AllTypesSameAsReference) {
+  vector<DataType> data_types = {DT_INT8,  DT_UINT8,  DT_INT16,   DT_UINT16, DT_INT32,  DT_UINT32,
+                                 DT_INT64, DT_UINT64, DT_FLOAT16, DT_FLOAT,  DT_DOUBLE, DT_BOOL};
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(CONCATV2);
+  for (auto data_type : data_types) {
+    uint32_t length = 0;
+    ASSERT_TRUE(TypeUtils::GetDataTypeLength(data_type, length));
+    for (int32_t axis = 0; axis < 4; axis++) {
+      OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("ConcatV2", CONCATV2);
+      vector<vector<uint8_t>> data;
+      auto input = CreateConcatInputs(data_type, axis, data);
+      vector<GeTensorPtr> outputs;
+      ASSERT_EQ(kernel->Compute(op_desc_ptr, input, outputs), SUCCESS);
+      auto expected = ConcatReference(input, axis, length);
+      const auto &output_data = outputs[0]->GetData();
+      ASSERT_EQ(output_data.size(), expected.size());
+      EXPECT_EQ(memcmp(output_data.data(), expected.data(), expected.size()), 0)
+          << TypeUtils::DataTypeToSerialString(data_type) << " axis " << axis;
+    }
+  }
+}
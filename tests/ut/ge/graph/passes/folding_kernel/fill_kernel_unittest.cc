@@ -78,6 +78,27 @@ class UtestGraphPassesFoldingKernelFillKernel : public testing::Test {
     }
   }
 
+  // large enough to be filled by block copy on multi threads, every element is compared
+  template <typename T>
+  void TestLargeShape(DataType type, T value) {
+    vector<int32_t> dims_value_vec = {1031, 2053};
+    GeTensorDesc dims_tensor_desc(GeShape({2}), FORMAT_ND, DT_INT32);
+    GeTensorPtr dim_tensor = std::make_shared<GeTensor>(dims_tensor_desc, (uint8_t *)dims_value_vec.data(),
+                                                        dims_value_vec.size() * sizeof(int32_t));
+    GeTensorDesc value_tensor_desc(GeShape(), FORMAT_ND, type);
+    GeTensorPtr value_tensor = std::make_shared<GeTensor>(value_tensor_desc, (uint8_t *)&value, sizeof(T));
+
+    std::vector<ge::ConstGeTensorPtr> input = {dim_tensor, value_tensor};
+    std::vector<GeTensorPtr> outputs;
+    ASSERT_EQ(kernel->Compute(op_desc_ptr, input, outputs), SUCCESS);
+    size_t data_num = 1031 * 2053;
+    ASSERT_EQ(outputs[0]->GetData().size(), data_num * sizeof(T));
+    const uint8_t *ptr = outputs[0]->GetData().data();
+    for (size_t i = 0; i < data_num; i++) {
+      ASSERT_EQ(memcmp(ptr + i * sizeof(T), &value, sizeof(T)), 0) << "index " << i;
+    }
+  }
+
   ge::ComputeGraphPtr graph;
   OpDescPtr op_desc_ptr;
   NodePtr node;
@@ -341,3 +362,18 @@ TEST_F(UtestGraphPassesFoldingKernelFillKernel, FillDimsMulDataTypeOverflow) {
 
   EXPECT_EQ(PARAM_INVALID, status);
 }
+
+TEST_F(UtestGraphPassesFoldingKernelFillKernel, FillLargeShapeAllTypes) {
+  TestLargeShape<float>(DT_FLOAT, 1.5f);
+  TestLargeShape<fp16_t>(DT_FLOAT16, fp16_t(0x3c00));
+  TestLargeShape<int8_t>(DT_INT8, -3);
+  TestLargeShape<int16_t>(DT_INT16, -300);
+  TestLargeShape<uint16_t>(DT_UINT16, 300);
+  TestLargeShape<uint8_t>(DT_UINT8, 200);
+  TestLargeShape<int32_t>(DT_INT32, -70000);
+  TestLargeShape<int64_t>(DT_INT64, -5000000000);
+  TestLargeShape<uint32_t>(DT_UINT32, 70000);
+  TestLargeShape<uint64_t>(DT_UINT64, 5000000000);
+  TestLargeShape<bool>(DT_BOOL, true);
+  TestLargeShape<double>(DT_DOUBLE, -2.25);
+}
@@ -35,6 +35,7 @@
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/op_desc_utils.h"
 #include "graph/utils/tensor_utils.h"
+#include "graph/utils/type_utils.h"
 #include "inc/kernel_factory.h"
 #undef protected
 #undef private
@@ -984,4 +985,83 @@ TEST_F(UtestGraphPassesFoldingKernelGatherV2Kernel, AbnormalTest) {
     status = kernel->Compute(op_desc_ptr, input_7, outputs);
     EXPECT_NE(ge::SUCCESS, status);
   }
-}
\ No newline at end of file
+}
+namespace {
+vector<ConstGeTensorPtr> CreateGatherInputs(const vector<int64_t> &x_dims, DataType data_type,
+                                            const vector<int64_t> &indices_dims, const vector<int64_t> &indices,
+                                            int64_t axis) {
+  uint32_t length = 0;
+  (void)TypeUtils::GetDataTypeLength(data_type, length);
+  GeShape x_shape(x_dims);
+  vector<uint8_t> x_data(static_cast<size_t>(x_shape.GetShapeSize()) * length);
+  for (size_t i = 0; i < x_data.size(); i++) {
+    x_data[i] = static_cast<uint8_t>(i * 13 + 5);
+  }
+  GeTensorDesc x_desc(x_shape, FORMAT_ND, data_type);
+  GeTensorDesc indices_desc(GeShape(indices_dims), FORMAT_ND, DT_INT64);
+  GeTensorDesc axis_desc(GeShape(), FORMAT_ND, DT_INT64);
+  return {std::make_shared<GeTensor>(x_desc, x_data.data(), x_data.size()),
+          std::make_shared<GeTensor>(indices_desc, (uint8_t *)indices.data(), indices.size() * sizeof(int64_t)),
+          std::make_shared<GeTensor>(axis_desc, (uint8_t *)&axis, sizeof(int64_t))};
+}
+
+// the element by element implementation of GatherV2
+vector<uint8_t> GatherReference(const vector<int64_t> &x_dims, const uint8_t *x, const vector<int64_t> &indices,
+                                int64_t axis, uint32_t length) {
+  int64_t outer_num = 1;
+  int64_t inner_num = length;
+  for (int64_t i = 0; i < axis; i++) {
+    outer_num *= x_dims[i];
+  }
+  for (size_t i = axis + 1; i < x_dims.size(); i++) {
+    inner_num *= x_dims[i];
+  }
+  vector<uint8_t> output;
+  for (int64_t i = 0; i < outer_num; i++) {
+    for (auto index : indices) {
+      for (int64_t j = 0; j < inner_num; j++) {
+        output.push_back(x[(i * x_dims[axis] + index) * inner_num + j]);
+      }
+    }
+  }
+  return output;
+}
+}  // namespace
+
+TEST_F(UtestGraphPassesFoldingKernelGatherV2Kernel, AnyRankSameAsReference) {
+  vector<DataType> data_types = {DT_INT8, DT_INT16, DT_INT32, DT_INT64, DT_FLOAT16, DT_DOUBLE};
+  vector<int64_t> x_dims = {2, 3, 4, 5, 3};
+  vector<int64_t> indices = {1, 0, 1, 1};
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(GATHERV2);
+  for (auto data_type : data_types) {
+    uint32_t length = 0;
+    ASSERT_TRUE(TypeUtils::GetDataTypeLength(data_type, length));
+    for (int64_t axis = 0; axis < static_cast<int64_t>(x_dims.size()); axis++) {
+      OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("GatherV2", GATHERV2);
+      auto input = CreateGatherInputs(x_dims, data_type, {4}, indices, axis);
+      vector<GeTensorPtr> outputs;
+      ASSERT_EQ(kernel->Compute(op_desc_ptr, input, outputs), SUCCESS);
+      auto expected = GatherReference(x_dims, input[0]->GetData().data(), indices, axis, length);
+      const auto &output_data = outputs[0]->GetData();
+      ASSERT_EQ(output_data.size(), expected.size());
+      EXPECT_EQ(memcmp(output_data.data(), expected.data(), expected.size()), 0)
+          << TypeUtils::DataTypeToSerialString(data_type) << " axis " << axis;
+    }
+  }
+}
+
+TEST_F(UtestGraphPassesFoldingKernelGatherV2Kernel, ScalarIndices) {
+  vector<int64_t> x_dims = {3, 4};
+  vector<int64_t> indices = {2};
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(GATHERV2);
+  for (int64_t axis = 0; axis < 2; axis++) {
+    OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("GatherV2", GATHERV2);
+    auto input = CreateGatherInputs(x_dims, DT_INT32, {}, indices, axis);
+    vector<GeTensorPtr> outputs;
+    ASSERT_EQ(kernel->Compute(op_desc_ptr, input, outputs), SUCCESS);
+    EXPECT_EQ(outputs[0]->GetTensorDesc().GetShape().GetDims(), vector<int64_t>({x_dims[1 - axis]}));
+    auto expected = GatherReference(x_dims, input[0]->GetData().data(), indices, axis, sizeof(int32_t));
+    ASSERT_EQ(outputs[0]->GetData().size(), expected.size());
+    EXPECT_EQ(memcmp(outputs[0]->GetData().data(), expected.data(), expected.size()), 0);
+  }
+}
@@ -226,3 +226,38 @@ TEST_F(UtestGraphPassesFoldingKernelMulKernel, MulOptimizerErrtypeFail) {
   status = kernel->Compute(op_desc_ptr, input_other3, outputs);
   EXPECT_EQ(status, NOT_CHANGED);
 }
+
+TEST_F(UtestGraphPassesFoldingKernelMulKernel, BroadcastInt32Success) {
+  OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("Mul", "Mul");
+
+  vector<int64_t> dims_vec_0 = {2, 1, 3};
+  vector<int32_t> data_vec_0 = {1, 2, 3, 4, 5, 6};
+  GeTensorDesc tensor_desc_0(GeShape(dims_vec_0), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_0 =
+      std::make_shared<GeTensor>(tensor_desc_0, (uint8_t *)data_vec_0.data(), data_vec_0.size() * sizeof(int32_t));
+
+  vector<int64_t> dims_vec_1 = {4, 1};
+  vector<int32_t> data_vec_1 = {1, 10, 100, 1000};
+  GeTensorDesc tensor_desc_1(GeShape(dims_vec_1), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_1 =
+      std::make_shared<GeTensor>(tensor_desc_1, (uint8_t *)data_vec_1.data(), data_vec_1.size() * sizeof(int32_t));
+
+  vector<ConstGeTensorPtr> input = {tensor_0, tensor_1};
+  vector<GeTensorPtr> outputs;
+
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(MUL);
+  Status status = kernel->Compute(op_desc_ptr, input, outputs);
+  EXPECT_EQ(SUCCESS, status);
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_EQ(outputs[0]->GetTensorDesc().GetShape().GetDims(), vector<int64_t>({2, 4, 3}));
+  ASSERT_EQ(outputs[0]->GetData().size(), 24 * sizeof(int32_t));
+
+  int32_t *out_data = (int32_t *)outputs[0]->GetData().data();
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      for (size_t k = 0; k < 3; ++k) {
+        EXPECT_EQ(out_data[(i * 4 + j) * 3 + k], data_vec_0[i * 3 + k] * data_vec_1[j]);
+      }
+    }
+  }
+}
@@ -33,6 +33,7 @@
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/op_desc_utils.h"
 #include "graph/utils/tensor_utils.h"
+#include "graph/utils/type_utils.h"
 #include "inc/kernel_factory.h"
 #undef protected
 #undef private
@@ -360,3 +361,40 @@ TEST_F(UtestGraphPassesFoldingKernelRangeKernel, RangeError) {
 
   EXPECT_EQ(PARAM_INVALID, status);
 }
+
+namespace {
+template <typename T>
+vector<ConstGeTensorPtr> CreateRangeInputs(T start, T limit, T delta, DataType data_type) {
+  vector<ConstGeTensorPtr> input;
+  for (T value : {start, limit, delta}) {
+    GeTensorDesc tensor_desc(GeShape(), FORMAT_ND, data_type);
+    input.push_back(std::make_shared<GeTensor>(tensor_desc, (uint8_t *)&value, sizeof(T)));
+  }
+  return input;
+}
+
+// the result of Range accumulating delta element by element
+template <typename T>
+void CheckRange(T start, T limit, T delta, DataType data_type) {
+  OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("Range", RANGE);
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(RANGE);
+  vector<GeTensorPtr> outputs;
+  ASSERT_EQ(kernel->Compute(op_desc_ptr, CreateRangeInputs(start, limit, delta, data_type), outputs), SUCCESS);
+  int64_t size = outputs[0]->GetTensorDesc().GetShape().GetDim(0);
+  ASSERT_EQ(outputs[0]->GetData().size(), size * sizeof(T));
+  const T *output_data = reinterpret_cast<const T *>(outputs[0]->GetData().data());
+  T val = start;
+  for (int64_t i = 0; i < size; ++i) {
+    ASSERT_EQ(memcmp(&output_data[i], &val, sizeof(T)), 0) << "index " << i;
+    val += delta;
+  }
+}
+}  // namespace
+
+TEST_F(UtestGraphPassesFoldingKernelRangeKernel, AllTypesSameAsAccumulation) {
+  CheckRange<int32_t>(-7, 1000, 3, DT_INT32);
+  CheckRange<int32_t>(1000, -7, -3, DT_INT32);
+  CheckRange<int32_t>(-1000000000, 1000000000, 997, DT_INT32);  // computed by multi threads
+  CheckRange<float>(-0.7f, 100.0f, 0.1f, DT_FLOAT);
+  CheckRange<float>(100.0f, -0.7f, -0.3f, DT_FLOAT);
+}
@@ -22,6 +22,7 @@
 
 #include "common/debug/log.h"
 #include "common/debug/memory_dumper.h"
+#include "common/math/math_util.h"
 #include "common/op/ge_op_utils.h"
 #include "common/types.h"
 #include "graph/passes/folding_kernel/concat_v2_kernel.h"
@@ -193,3 +194,90 @@ TEST_F(UtestGraphPassesFoldingKernelReduceProdKernel, OverflowDataNotChanged) {
 
   EXPECT_EQ(NOT_CHANGED, status);
 }
+
+namespace {
+vector<ConstGeTensorPtr> CreateReduceProdInputs(const vector<int64_t> &dims, const vector<int32_t> &data,
+                                                int32_t axis) {
+  GeTensorDesc data_desc(GeShape(dims), FORMAT_ND, DT_INT32);
+  ConstGeTensorPtr data_tensor =
+      std::make_shared<GeTensor>(data_desc, (uint8_t *)data.data(), data.size() * sizeof(int32_t));
+  vector<int32_t> axis_data = {axis};
+  GeTensorDesc axis_desc(GeShape({1}), FORMAT_ND, DT_INT32);
+  ConstGeTensorPtr axis_tensor = std::make_shared<GeTensor>(axis_desc, (uint8_t *)axis_data.data(), sizeof(int32_t));
+  return {data_tensor, axis_tensor};
+}
+
+// the scalar implementation of ReduceProd, which checks every multiplication
+bool ReduceProdReference(const vector<int64_t> &dims, const vector<int32_t> &data, int32_t axis,
+                         vector<int32_t> &output) {
+  int64_t head_dim = 1;
+  int64_t end_dim = 1;
+  for (int32_t i = 0; i < static_cast<int32_t>(dims.size()); i++) {
+    if (i < axis) {
+      head_dim *= dims[i];
+    } else if (i > axis) {
+      end_dim *= dims[i];
+    }
+  }
+  int64_t axis_dim = dims[axis];
+  for (int64_t i = 0; i < head_dim; ++i) {
+    for (int64_t j = 0; j < end_dim; ++j) {
+      int32_t tmp_x = data[i * end_dim * axis_dim + j];
+      for (int64_t k = 1; k < axis_dim; ++k) {
+        int32_t tmp_y = data[i * end_dim * axis_dim + j + k * end_dim];
+        if (CheckInt32MulOverflow(tmp_x, tmp_y) != SUCCESS) {
+          return false;
+        }
+        tmp_x *= tmp_y;
+      }
+      output.push_back(tmp_x);
+    }
+  }
+  return true;
+}
+
+void CheckReduceProd(const vector<int64_t> &dims, const vector<int32_t> &data) {
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(REDUCEPROD);
+  for (int32_t axis = 0; axis < static_cast<int32_t>(dims.size()); axis++) {
+    OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("ReduceProd", REDUCEPROD);
+    vector<GeTensorPtr> outputs;
+    Status status = kernel->Compute(op_desc_ptr, CreateReduceProdInputs(dims, data, axis), outputs);
+    vector<int32_t> expected;
+    if (!ReduceProdReference(dims, data, axis, expected)) {
+      EXPECT_EQ(status, NOT_CHANGED) << "axis " << axis;
+      continue;
+    }
+    ASSERT_EQ(status, SUCCESS) << "axis " << axis;
+    ASSERT_EQ(outputs[0]->GetData().size(), expected.size() * sizeof(int32_t));
+    EXPECT_EQ(memcmp(outputs[0]->GetData().data(), expected.data(), outputs[0]->GetData().size()), 0)
+        << "axis " << axis;
+  }
+}
+}  // namespace
+
+TEST_F(UtestGraphPassesFoldingKernelReduceProdKernel, Int32SameAsReference) {
+  vector<int64_t> dims = {5, 6, 300};
+  vector<int32_t> data(5 * 6 * 300);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<int32_t>(i % 7) - 3;
+  }
+  CheckReduceProd(dims, data);
+
+  // the products of 2 and -2 reach the bounds of int32 along the axis of 31 and 32
+  vector<int64_t> overflow_dims = {2, 32, 3};
+  vector<int32_t> overflow_data(2 * 32 * 3, 2);
+  for (size_t i = 0; i < overflow_data.size(); i += 2) {
+    overflow_data[i] = -2;
+  }
+  CheckReduceProd(overflow_dims, overflow_data);
+  vector<int32_t> bound_data(overflow_data.begin(), overflow_data.begin() + 2 * 31 * 3);
+  CheckReduceProd({2, 31, 3}, bound_data);
+
+  // large enough to be computed by multi threads
+  vector<int64_t> large_dims = {4, 64, 8192};
+  vector<int32_t> large_data(4 * 64 * 8192, 1);
+  for (size_t i = 0; i < large_data.size(); i += 5) {
+    large_data[i] = -1;
+  }
+  CheckReduceProd(large_dims, large_data);
+}
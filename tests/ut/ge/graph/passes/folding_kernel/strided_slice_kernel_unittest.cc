@@ -603,3 +603,53 @@ TEST_F(UtestGraphPassesFoldingKernelStridedSliceKernel, Test17) {
   shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(STRIDEDSLICE);
   ge::Status status = kernel->Compute(op_desc_ptr, input, outputs);
 }
+
+namespace {
+OpDescPtr CreateStridedSliceOp(DataType data_type) {
+  OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("StridedSlice", STRIDEDSLICE);
+  AttrUtils::SetInt(op_desc_ptr, STRIDE_SLICE_ATTR_BEGIN_MASK, 0);
+  AttrUtils::SetInt(op_desc_ptr, STRIDE_SLICE_ATTR_END_MASK, 0);
+  AttrUtils::SetInt(op_desc_ptr, STRIDE_SLICE_ATTR_ELLIPSIS_MASK, 0);
+  AttrUtils::SetInt(op_desc_ptr, STRIDE_SLICE_ATTR_NEW_AXIS_MASK, 0);
+  AttrUtils::SetInt(op_desc_ptr, STRIDE_SLICE_ATTR_SHRINK_AXIS_MASK, 0);
+  op_desc_ptr->AddInputDesc(0, GeTensorDesc(GeShape(), FORMAT_ND, data_type));
+  op_desc_ptr->AddOutputDesc(GeTensorDesc(GeShape(), FORMAT_ND, data_type));
+  return op_desc_ptr;
+}
+
+vector<ConstGeTensorPtr> CreateStridedSliceInputs(ConstGeTensorPtr x, vector<int32_t> &begin, vector<int32_t> &end,
+                                                  vector<int32_t> &stride) {
+  GeTensorDesc desc(GeShape({static_cast<int64_t>(begin.size())}), FORMAT_ND, DT_INT32);
+  return {x, std::make_shared<GeTensor>(desc, (uint8_t *)begin.data(), begin.size() * sizeof(int32_t)),
+          std::make_shared<GeTensor>(desc, (uint8_t *)end.data(), end.size() * sizeof(int32_t)),
+          std::make_shared<GeTensor>(desc, (uint8_t *)stride.data(), stride.size() * sizeof(int32_t))};
+}
+}  // namespace
+
+TEST_F(UtestGraphPassesFoldingKernelStridedSliceKernel, StridedSameAsReference) {
+  vector<int64_t> x_dims = {4, 6, 8};
+  vector<int64_t> x_data(4 * 6 * 8);
+  for (size_t i = 0; i < x_data.size(); i++) {
+    x_data[i] = static_cast<int64_t>(i);
+  }
+  GeTensorDesc x_desc(GeShape(x_dims), FORMAT_ND, DT_INT64);
+  ConstGeTensorPtr x = std::make_shared<GeTensor>(x_desc, (uint8_t *)x_data.data(), x_data.size() * sizeof(int64_t));
+  vector<int32_t> begin = {1, 1, 0};
+  vector<int32_t> end = {3, 5, 8};
+  vector<int32_t> stride = {1, 2, 1};
+  auto input = CreateStridedSliceInputs(x, begin, end, stride);
+
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(STRIDEDSLICE);
+  vector<GeTensorPtr> outputs;
+  ASSERT_EQ(kernel->Compute(CreateStridedSliceOp(DT_INT64), input, outputs), SUCCESS);
+  ASSERT_EQ(outputs[0]->GetTensorDesc().GetShape().GetDims(), vector<int64_t>({2, 2, 8}));
+  ASSERT_EQ(outputs[0]->GetData().size(), 2 * 2 * 8 * sizeof(int64_t));
+  const int64_t *y = reinterpret_cast<const int64_t *>(outputs[0]->GetData().data());
+  for (int64_t i = 0; i < 2; i++) {
+    for (int64_t j = 0; j < 2; j++) {
+      for (int64_t k = 0; k < 8; k++) {
+        EXPECT_EQ(y[(i * 2 + j) * 8 + k], x_data[((1 + i) * 6 + 1 + j * 2) * 8 + k]);
+      }
+    }
+  }
+}
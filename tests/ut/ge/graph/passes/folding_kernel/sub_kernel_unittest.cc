@@ -68,6 +68,9 @@ TEST_F(UtestFoldingKernelSubKernel, ComSuccessFloat) {
   test_op->AddOutputDesc(sub_desc);
   Status status = kernel->Compute(test_op, input, v_output);
   EXPECT_EQ(SUCCESS, status);
+  ASSERT_EQ(v_output.size(), 1);
+  ASSERT_EQ(v_output[0]->GetData().size(), sizeof(float));
+  EXPECT_FLOAT_EQ(*(const float *)v_output[0]->GetData().data(), 2.0f);
 }
 TEST_F(UtestFoldingKernelSubKernel, ComSuccessInt16) {
   OpDescPtr test_op = std::make_shared<OpDesc>("test", "Test");
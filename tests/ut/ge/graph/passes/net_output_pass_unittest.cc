@@ -17,6 +17,7 @@
 #include "graph/passes/net_output_pass.h"
 
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "common/ge_inner_error_codes.h"
 #include "common/types.h"
@@ -28,6 +29,7 @@
 #include "graph/operator_reg.h"
 #include "graph/utils/op_desc_utils.h"
 #include "inc/pass_manager.h"
+#include "omg/omg_inner_types.h"
 #include "init/gelib.h"
 #include "opskernel_manager/ops_kernel_manager.h"
 
@@ -864,3 +866,38 @@ TEST_F(UtestGraphPassesNetOutputPass, clear_weight) {
   Status ret = ge::OpDescUtils::ClearWeights(cast);
   EXPECT_EQ(ge::SUCCESS, ret);
 }
+
+namespace {
+void RunNetOutputPassWithOutputType(const std::string &output_type, std::vector<std::string> &user_def_dtypes) {
+  ge::OmgContext omg_context;
+  omg_context.output_type = output_type;
+  domi::OmgContextGuard omg_context_guard(&omg_context);
+
+  ge::ComputeGraphPtr compute_graph = build_graph();
+  ge::NodePtr mul1 = compute_graph->FindNode("Mul1");
+  ge::NodePtr mul2 = compute_graph->FindNode("Mul2");
+  std::vector<std::pair<ge::NodePtr, int32_t>> output_nodes = {{mul1, 0}, {mul2, 0}};
+  compute_graph->SetGraphOutNodesInfo(output_nodes);
+  NetOutputPass net_output_pass;
+  EXPECT_EQ(net_output_pass.Run(compute_graph), ge::SUCCESS);
+  NodePtr net_out_node = compute_graph->FindNode(NODE_NAME_NET_OUTPUT);
+  ASSERT_NE(net_out_node, nullptr);
+  (void)ge::AttrUtils::GetListStr(net_out_node->GetOpDesc(), ATTR_ATC_USER_DEFINE_DATATYPE, user_def_dtypes);
+}
+}  // namespace
+
+TEST_F(UtestGraphPassesNetOutputPass, concurrent_builds_with_different_output_type) {
+  const int kLoopNum = 20;
+  for (int i = 0; i < kLoopNum; ++i) {
+    std::vector<std::string> fp16_dtypes;
+    std::vector<std::string> int8_dtypes;
+    std::thread fp16_thread(RunNetOutputPassWithOutputType, "FP16", std::ref(fp16_dtypes));
+    std::thread int8_thread(RunNetOutputPassWithOutputType, "INT8", std::ref(int8_dtypes));
+    fp16_thread.join();
+    int8_thread.join();
+    EXPECT_EQ(fp16_dtypes, std::vector<std::string>({"0:DT_FLOAT16", "1:DT_FLOAT16"}));
+    EXPECT_EQ(int8_dtypes, std::vector<std::string>({"0:DT_INT8", "1:DT_INT8"}));
+  }
+  // the process wide context is untouched by the bound ones
+  EXPECT_TRUE(domi::GetContext().output_type.empty());
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hybrid/executor/hybrid_profiler.h"
+
+using namespace std;
+using namespace ge;
+using namespace ge::hybrid;
+
+namespace {
+const size_t kThreadNum = 4;
+
+size_t CountOf(const string &str, const string &pattern) {
+  size_t count = 0;
+  for (auto pos = str.find(pattern); pos != string::npos; pos = str.find(pattern, pos + pattern.size())) {
+    ++count;
+  }
+  return count;
+}
+}  // namespace
+
+class UtestHybridProfiler : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestHybridProfiler, chrome_trace_spans) {
+  HybridProfiler profiler;
+  vector<thread> threads;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&profiler, i]() {
+      string node_name = "node_" + to_string(i);
+      profiler.RecordEvent(HybridProfiler::SHAPE_INFERENCE, node_name.c_str(), "[InferShapeAndType] Start");
+      profiler.RecordEvent(HybridProfiler::EXECUTION, node_name.c_str(), "[AwaitNodeDone] [%s] Start", "pre_node");
+      profiler.RecordEvent(HybridProfiler::EXECUTION, node_name.c_str(), "[AwaitNodeDone] [%s] End", "pre_node");
+      profiler.RecordEvent(HybridProfiler::SHAPE_INFERENCE, node_name.c_str(), "[InferShapeAndType] End");
+      profiler.RecordEvent(HybridProfiler::COMPILE, node_name.c_str(), "Start");
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  profiler.RecordEvent(HybridProfiler::GENERAL, nullptr, "[Synchronize] End");
+
+  ostringstream oss;
+  profiler.DumpChromeTrace(oss);
+  auto trace = oss.str();
+  EXPECT_EQ(trace.find("{\"traceEvents\":["), 0);
+  EXPECT_EQ(CountOf(trace, "\"name\":\"InferShapeAndType\",\"cat\":\"ShapeInference\",\"ph\":\"X\""), kThreadNum);
+  EXPECT_EQ(CountOf(trace, "\"name\":\"AwaitNodeDone\",\"cat\":\"Execution\",\"ph\":\"X\""), kThreadNum);
+  EXPECT_EQ(CountOf(trace, "\"detail\":\"[AwaitNodeDone] [pre_node] Start\""), kThreadNum);
+  // unpaired events are instant events
+  EXPECT_EQ(CountOf(trace, "\"name\":\"Compilation\",\"cat\":\"Compilation\",\"ph\":\"i\""), kThreadNum);
+  EXPECT_EQ(CountOf(trace, "\"name\":\"Synchronize\",\"cat\":\"ModelExecutor\",\"ph\":\"i\""), 1);
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    EXPECT_EQ(CountOf(trace, "\"node\":\"node_" + to_string(i) + "\""), 3);
+  }
+
+  ostringstream text;
+  profiler.Dump(text);
+  EXPECT_EQ(CountOf(text.str(), "\n"), kThreadNum * 5 + 1);
+
+  profiler.Reset();
+  ostringstream empty;
+  profiler.DumpChromeTrace(empty);
+  EXPECT_EQ(CountOf(empty.str(), "\"name\""), 0);
+}
+
+TEST_F(UtestHybridProfiler, reused_name_address) {
+  HybridProfiler profiler;
+  char node_name[16] = "node_a";
+  profiler.RecordEvent(HybridProfiler::EXECUTION, node_name, "Start");
+  node_name[5] = 'b';
+  profiler.RecordEvent(HybridProfiler::EXECUTION, node_name, "End");
+
+  ostringstream oss;
+  profiler.DumpChromeTrace(oss);
+  EXPECT_EQ(CountOf(oss.str(), "\"node\":\"node_a\""), 1);
+  EXPECT_EQ(CountOf(oss.str(), "\"node\":\"node_b\""), 1);
+}
+
+TEST_F(UtestHybridProfiler, alternate_profilers) {
+  // more profilers than the cached buffers of a thread, the events still go to their own profilers
+  const size_t profiler_num = 6;
+  vector<unique_ptr<HybridProfiler>> profilers;
+  for (size_t i = 0; i < profiler_num; ++i) {
+    profilers.emplace_back(new HybridProfiler());
+  }
+  for (size_t round = 0; round < 3; ++round) {
+    for (size_t i = 0; i < profiler_num; ++i) {
+      string node_name = "node_" + to_string(i);
+      profilers[i]->RecordEvent(HybridProfiler::EXECUTION, node_name.c_str(), "[PrepareTask] Start");
+    }
+  }
+  for (size_t i = 0; i < profiler_num; ++i) {
+    ostringstream oss;
+    profilers[i]->DumpChromeTrace(oss);
+    EXPECT_EQ(CountOf(oss.str(), "\"node\":\"node_" + to_string(i) + "\""), 3);
+    EXPECT_EQ(CountOf(oss.str(), "\"node\":"), 3);
+  }
+}
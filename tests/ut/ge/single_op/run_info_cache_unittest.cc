@@ -0,0 +1,101 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/attr_utils.h"
+#include "single_op/run_info_cache.h"
+
+using namespace std;
+using namespace ge;
+
+namespace {
+string GetKey(const vector<int64_t> &input_dims, const vector<int64_t> &output_dims) {
+  vector<GeTensorDesc> input_desc = {GeTensorDesc(GeShape(input_dims))};
+  vector<GeTensorDesc> output_desc = {GeTensorDesc(GeShape(output_dims))};
+  string key;
+  RunInfoCache::GenerateKey(input_desc, output_desc, key);
+  return key;
+}
+
+RunInfoCacheEntry CreateEntry(uint32_t block_dim) {
+  RunInfoCacheEntry entry;
+  entry.tiling_data = "tiling_" + to_string(block_dim);
+  entry.block_dim = block_dim;
+  return entry;
+}
+}  // namespace
+
+class UtestRunInfoCache : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestRunInfoCache, generate_key) {
+  EXPECT_EQ(GetKey({1, 16}, {1, 16}), GetKey({1, 16}, {1, 16}));
+  EXPECT_NE(GetKey({1, 16}, {1, 16}), GetKey({16, 1}, {1, 16}));
+  EXPECT_NE(GetKey({1, 16}, {1, 16}), GetKey({1, 16}, {1, 16, 1}));
+  // same dims split differently between inputs and outputs
+  EXPECT_NE(GetKey({1}, {16, 1}), GetKey({1, 16}, {1}));
+
+  GeTensorDesc desc(GeShape({2, 32}));
+  desc.SetOriginShape(GeShape({2, 32}));
+  vector<GeTensorDesc> output_desc;
+  string key;
+  RunInfoCache::GenerateKey({desc}, output_desc, key);
+  (void)AttrUtils::SetInt(desc, ATTR_NAME_STORAGE_FORMAT, static_cast<int64_t>(FORMAT_FRACTAL_NZ));
+  (void)AttrUtils::SetListInt(desc, ATTR_NAME_STORAGE_SHAPE, vector<int64_t>({2, 1, 16, 16}));
+  string storage_key;
+  RunInfoCache::GenerateKey({desc}, output_desc, storage_key);
+  EXPECT_NE(key, storage_key);
+}
+
+TEST_F(UtestRunInfoCache, lru_eviction) {
+  RunInfoCache cache(2);
+  EXPECT_EQ(cache.Find("a"), nullptr);
+  cache.Insert("a", CreateEntry(1));
+  cache.Insert("b", CreateEntry(2));
+  auto entry = cache.Find("a");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->block_dim, 1);
+  EXPECT_EQ(entry->tiling_data, "tiling_1");
+
+  // b is the least recently used one
+  cache.Insert("c", CreateEntry(3));
+  EXPECT_EQ(cache.Find("b"), nullptr);
+  EXPECT_NE(cache.Find("a"), nullptr);
+  EXPECT_NE(cache.Find("c"), nullptr);
+
+  DynamicSingleOpCacheStats stats;
+  cache.GetStats(stats);
+  EXPECT_EQ(stats.hit_count, 3);
+  EXPECT_EQ(stats.miss_count, 2);
+  EXPECT_EQ(stats.evict_count, 1);
+  EXPECT_EQ(stats.entry_num, 2);
+  EXPECT_EQ(stats.capacity, 2);
+
+  cache.SetCapacity(0);
+  EXPECT_FALSE(cache.IsEnabled());
+  cache.Insert("d", CreateEntry(4));
+  cache.GetStats(stats);
+  EXPECT_EQ(stats.entry_num, 0);
+  EXPECT_EQ(stats.evict_count, 3);
+}
@@ -15,6 +15,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "cce/taskdown_common.hpp"
@@ -30,6 +34,14 @@ using namespace std;
 using namespace testing;
 using namespace ge;
 
+namespace {
+const size_t kThreadNum = 8;
+const size_t kOpNum = 16;
+const size_t kStepNum = 1000;
+const uintptr_t kStreamBase = 0x10000;
+const uintptr_t kStreamStride = 0x100;
+}  // namespace
+
 class UtestSingleOpManager : public testing::Test {
  protected:
   void SetUp() {}
@@ -41,7 +53,7 @@ TEST_F(UtestSingleOpManager, test_get_resource) {
   uintptr_t resource_id = 0x1;
   auto &instance = SingleOpManager::GetInstance();
   ASSERT_EQ(instance.TryGetResource(resource_id), nullptr);
-  ASSERT_NE(instance.GetResource(resource_id), nullptr);
+  ASSERT_NE(instance.GetResource(resource_id, nullptr), nullptr);
 }
 
 TEST_F(UtestSingleOpManager, test_get_op_from_model) {
@@ -56,7 +68,7 @@ TEST_F(UtestSingleOpManager, test_get_op_from_model) {
   model_data.model_len = model_str.size();
 
   ASSERT_EQ(instance.GetOpFromModel("model", model_data, stream, &single_op), FAILED);
-  ASSERT_EQ(instance.GetResource(resource_id)->GetOperator(model_data.model_data), nullptr);
+  ASSERT_EQ(instance.GetResource(resource_id, stream)->GetOperator(model_data.model_data), nullptr);
 }
 
 TEST_F(UtestSingleOpManager, test_relesase_resource) {
@@ -64,7 +76,7 @@ TEST_F(UtestSingleOpManager, test_relesase_resource) {
   auto &instance = SingleOpManager::GetInstance();
 
   ASSERT_EQ(instance.ReleaseResource(stream), SUCCESS);
-  instance.GetResource(0x99);
+  instance.GetResource(0x99, stream);
   ASSERT_EQ(instance.ReleaseResource(stream), SUCCESS);
 }
 
@@ -92,4 +104,76 @@ TEST_F(UtestSingleOpManager, get_resource_failed) {
   auto &instance = SingleOpManager::GetInstance();
 
   ASSERT_EQ(instance.GetOpFromModel("model", model_data, stream, &single_op), FAILED);
-}
\ No newline at end of file
+}
+TEST_F(UtestSingleOpManager, multi_thread_get_op_and_release) {
+  auto &instance = SingleOpManager::GetInstance();
+  vector<char> model_buffer(kOpNum);
+  vector<rtStream_t> streams;
+  vector<vector<ModelData>> models(kThreadNum);
+  vector<vector<SingleOp *>> ops(kThreadNum);
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    auto stream = (rtStream_t)(kStreamBase + i * kStreamStride);
+    streams.emplace_back(stream);
+    auto res = instance.GetResource(reinterpret_cast<uintptr_t>(stream), stream);
+    ASSERT_NE(res, nullptr);
+    for (size_t j = 0; j < kOpNum; ++j) {
+      ModelData model_data;
+      model_data.model_data = &model_buffer[j];
+      model_data.model_len = 1;
+      models[i].emplace_back(model_data);
+      ops[i].emplace_back(new SingleOp());
+      res->CacheOperator(model_data.model_data, unique_ptr<SingleOp>(ops[i].back()));
+    }
+  }
+
+  vector<size_t> mismatch_count(kThreadNum, 0);
+  vector<thread> threads;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&, i]() {
+      for (size_t step = 0; step < kStepNum; ++step) {
+        size_t index = step % kOpNum;
+        SingleOp *single_op = nullptr;
+        if ((instance.GetOpFromModel("model", models[i][index], streams[i], &single_op) != SUCCESS) ||
+            (single_op != ops[i][index])) {
+          ++mismatch_count[i];
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    EXPECT_EQ(mismatch_count[i], 0);
+  }
+
+  // ops cached by thread are dropped with the resource, the fake model is parsed then
+  SingleOp *single_op = nullptr;
+  ASSERT_EQ(instance.GetOpFromModel("model", models[0][0], streams[0], &single_op), SUCCESS);
+  for (auto stream : streams) {
+    ASSERT_EQ(instance.ReleaseResource(stream), SUCCESS);
+    ASSERT_EQ(instance.TryGetResource(reinterpret_cast<uintptr_t>(stream)), nullptr);
+  }
+  ASSERT_EQ(instance.GetOpFromModel("model", models[0][0], streams[0], &single_op), FAILED);
+  ASSERT_EQ(instance.ReleaseResource(streams[0]), SUCCESS);
+}
+
+TEST_F(UtestSingleOpManager, release_resource_waits_for_building_op) {
+  auto stream = (rtStream_t)0x77;
+  auto &instance = SingleOpManager::GetInstance();
+  std::unique_lock<std::mutex> resource_lock;
+  ASSERT_NE(instance.GetLockedResource(reinterpret_cast<uintptr_t>(stream), stream, resource_lock), nullptr);
+  ASSERT_TRUE(resource_lock.owns_lock());
+
+  std::atomic<bool> released(false);
+  std::thread release_thread([&]() {
+    EXPECT_EQ(instance.ReleaseResource(stream), SUCCESS);
+    released = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(released);
+  resource_lock.unlock();
+  release_thread.join();
+  EXPECT_TRUE(released);
+  EXPECT_EQ(instance.TryGetResource(reinterpret_cast<uintptr_t>(stream)), nullptr);
+}
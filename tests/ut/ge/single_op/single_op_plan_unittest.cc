@@ -0,0 +1,114 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "runtime/rt.h"
+
+#define protected public
+#define private public
+#include "single_op/single_op.h"
+#include "single_op/single_op_plan.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace ge;
+
+namespace {
+const size_t kBufferSize = 128;
+const size_t kBufferNum = 6;
+
+// single op with one tbe task, whose kernel args are the addresses of one input and one output
+unique_ptr<SingleOp> CreateSingleOp() {
+  unique_ptr<SingleOp> op(new SingleOp());
+  op->input_sizes_ = {kBufferSize};
+  op->output_sizes_ = {kBufferSize};
+  op->args_.resize(2);
+  op->arg_table_.resize(2);
+
+  auto task = new TbeOpTask();
+  unique_ptr<uint8_t[]> args(new uint8_t[2 * sizeof(uintptr_t)]());
+  task->SetKernelArgs(std::move(args), 2 * sizeof(uintptr_t), 1);
+  auto task_args = reinterpret_cast<uintptr_t *>(const_cast<void *>(task->GetArgs()));
+  op->arg_table_[0].emplace_back(&task_args[0]);
+  op->arg_table_[1].emplace_back(&task_args[1]);
+  op->tasks_.emplace_back(task);
+  return op;
+}
+
+const uintptr_t *GetKernelArgs(const SingleOp &op) {
+  auto task = dynamic_cast<TbeOpTask *>(op.tasks_[0]);
+  return reinterpret_cast<const uintptr_t *>(task->GetArgs());
+}
+
+vector<DataBuffer> CreateBuffers(vector<uint8_t> &memory, size_t index) {
+  DataBuffer buffer;
+  buffer.data = memory.data() + index * kBufferSize;
+  buffer.length = kBufferSize;
+  return {buffer};
+}
+}  // namespace
+
+class UtestSingleOpPlan : public testing::Test {
+ protected:
+  void SetUp() { memory_.resize(kBufferNum * kBufferSize); }
+
+  void TearDown() {}
+
+  vector<uint8_t> memory_;
+};
+
+TEST_F(UtestSingleOpPlan, capture_and_replay) {
+  auto op = CreateSingleOp();
+  SingleOpPlan plan;
+  ASSERT_EQ(plan.Capture(op.get(), CreateBuffers(memory_, 0), CreateBuffers(memory_, 1)), SUCCESS);
+  ASSERT_EQ(plan.Capture(op.get(), CreateBuffers(memory_, 1), CreateBuffers(memory_, 2)), SUCCESS);
+  EXPECT_EQ(plan.GetOpNum(), 2);
+
+  ASSERT_EQ(plan.Replay(), SUCCESS);
+  // the op is left with the bindings of its last launch
+  EXPECT_EQ(GetKernelArgs(*op)[0], reinterpret_cast<uintptr_t>(memory_.data() + kBufferSize));
+  EXPECT_EQ(GetKernelArgs(*op)[1], reinterpret_cast<uintptr_t>(memory_.data() + 2 * kBufferSize));
+
+  ASSERT_EQ(plan.Rebind(1, CreateBuffers(memory_, 3), CreateBuffers(memory_, 2)), SUCCESS);
+  ASSERT_EQ(plan.Replay(), SUCCESS);
+  EXPECT_EQ(GetKernelArgs(*op)[0], reinterpret_cast<uintptr_t>(memory_.data() + 3 * kBufferSize));
+  EXPECT_EQ(GetKernelArgs(*op)[1], reinterpret_cast<uintptr_t>(memory_.data() + 2 * kBufferSize));
+
+  // args written by ExecuteAsync are seen by replay
+  ASSERT_EQ(op->ExecuteAsync(CreateBuffers(memory_, 4), CreateBuffers(memory_, 5)), SUCCESS);
+  ASSERT_EQ(plan.Replay(), SUCCESS);
+  EXPECT_EQ(GetKernelArgs(*op)[0], reinterpret_cast<uintptr_t>(memory_.data() + 3 * kBufferSize));
+}
+
+TEST_F(UtestSingleOpPlan, invalid_bindings) {
+  auto op = CreateSingleOp();
+  SingleOpPlan plan;
+  EXPECT_NE(plan.Capture(nullptr, CreateBuffers(memory_, 0), CreateBuffers(memory_, 1)), SUCCESS);
+  EXPECT_EQ(plan.Capture(op.get(), {}, CreateBuffers(memory_, 1)), PARAM_INVALID);
+
+  vector<DataBuffer> small_outputs = CreateBuffers(memory_, 1);
+  small_outputs[0].length = 1;
+  EXPECT_EQ(plan.Capture(op.get(), CreateBuffers(memory_, 0), small_outputs), PARAM_INVALID);
+  EXPECT_EQ(plan.GetOpNum(), 0);
+
+  ASSERT_EQ(plan.Capture(op.get(), CreateBuffers(memory_, 0), CreateBuffers(memory_, 1)), SUCCESS);
+  EXPECT_EQ(plan.Rebind(1, CreateBuffers(memory_, 0), CreateBuffers(memory_, 1)), PARAM_INVALID);
+  EXPECT_EQ(plan.Rebind(0, CreateBuffers(memory_, 0), small_outputs), PARAM_INVALID);
+}